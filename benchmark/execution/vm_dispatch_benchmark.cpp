@@ -0,0 +1,96 @@
+#include <functional>
+#include <memory>
+
+#include "benchmark/benchmark.h"
+#include "execution/util/cpu_info.h"
+#include "execution/vm/module.h"
+#include "execution/vm/module_compiler.h"
+
+namespace terrier {
+
+/**
+ * Measures the dispatch cost of the bytecode interpreter on loops shaped like the filters of tuple-at-a-time
+ * pipelines: fetch a SQL value, compare it with a constant and branch on the result.
+ */
+class VMDispatchBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(const benchmark::State &state) final {
+    execution::CpuInfo::Instance();
+
+    // SQL filter: the comparison is on SQL values, so the branch tests a SQL boolean against a SQL constant
+    sql_filter_module_ = compiler_.CompileToModule(R"(
+      fun filter(n: int32) -> int32 {
+        var count: int32 = 0
+        for (var i: int32 = 0; i < n; i = i + 1) {
+          var v = @intToSql(i % 1000)
+          if (v < 500) {
+            count = count + 1
+          }
+        }
+        return count
+      })");
+    TERRIER_ASSERT(sql_filter_module_ != nullptr, "Failed to compile the SQL filter");
+    sql_filter_module_->GetFunction("filter", execution::vm::ExecutionMode::Interpret, &sql_filter_);
+
+    // Primitive filter: the same loop on primitive values, as a baseline
+    primitive_filter_module_ = compiler_.CompileToModule(R"(
+      fun filter(n: int32) -> int32 {
+        var count: int32 = 0
+        for (var i: int32 = 0; i < n; i = i + 1) {
+          if (i % 1000 < 500) {
+            count = count + 1
+          }
+        }
+        return count
+      })");
+    TERRIER_ASSERT(primitive_filter_module_ != nullptr, "Failed to compile the primitive filter");
+    primitive_filter_module_->GetFunction("filter", execution::vm::ExecutionMode::Interpret, &primitive_filter_);
+  }
+
+  void TearDown(const benchmark::State &state) final {
+    sql_filter_module_.reset();
+    primitive_filter_module_.reset();
+  }
+
+  static constexpr int32_t NUM_TUPLES = 1000000;
+
+  execution::vm::test::ModuleCompiler compiler_;
+  std::unique_ptr<execution::vm::Module> sql_filter_module_;
+  std::unique_ptr<execution::vm::Module> primitive_filter_module_;
+  std::function<int32_t(int32_t)> sql_filter_;
+  std::function<int32_t(int32_t)> primitive_filter_;
+};
+
+/**
+ * Interpret the SQL filter loop
+ */
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(VMDispatchBenchmark, SqlFilter)(benchmark::State &state) {
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sql_filter_(NUM_TUPLES));
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_TUPLES);
+}
+
+/**
+ * Interpret the primitive filter loop
+ */
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(VMDispatchBenchmark, PrimitiveFilter)(benchmark::State &state) {
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(primitive_filter_(NUM_TUPLES));
+  }
+  state.SetItemsProcessed(state.iterations() * NUM_TUPLES);
+}
+
+// ----------------------------------------------------------------------------
+// BENCHMARK REGISTRATION
+// ----------------------------------------------------------------------------
+// clang-format off
+BENCHMARK_REGISTER_F(VMDispatchBenchmark, SqlFilter)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(VMDispatchBenchmark, PrimitiveFilter)->Unit(benchmark::kMillisecond);
+// clang-format on
+
+}  // namespace terrier
@@ -0,0 +1,81 @@
+#include <memory>
+
+#include "benchmark/benchmark.h"
+#include "main/db_main.h"
+#include "network/postgres/postgres_packet_writer.h"
+#include "network/terrier_server.h"
+#include "test_util/manual_packet_util.h"
+
+namespace terrier {
+
+/**
+ * Compares the round-trip latency of a client on the same host connected through TCP loopback and through the Unix
+ * domain socket. Each round trip is a Sync message answered with ReadyForQuery, so the server does no query work.
+ */
+class NetworkLatencyBenchmark : public benchmark::Fixture {
+ public:
+  void SetUp(const benchmark::State &state) final {
+    db_main_ = DBMain::Builder()
+                   .SetUseGC(true)
+                   .SetUseGCThread(true)
+                   .SetUseCatalog(true)
+                   .SetUseStatsStorage(true)
+                   .SetUseExecution(true)
+                   .SetUseTrafficCop(true)
+                   .SetUseNetwork(true)
+                   .Build();
+    server_ = db_main_->GetNetworkLayer()->GetServer();
+    server_->RunServer();
+  }
+
+  void TearDown(const benchmark::State &state) final { db_main_.reset(); }
+
+  /**
+   * Runs Sync round trips on the given connection for as long as the benchmark asks for
+   */
+  static void RoundTrips(benchmark::State *state, std::unique_ptr<network::NetworkIoWrapper> io_socket_unique_ptr) {
+    TERRIER_ASSERT(io_socket_unique_ptr != nullptr, "Failed to connect");
+    auto io_socket = common::ManagedPointer(io_socket_unique_ptr);
+    network::PostgresPacketWriter writer(io_socket->GetWriteQueue());
+    // NOLINTNEXTLINE
+    for (auto _ : *state) {
+      io_socket->GetWriteQueue()->Reset();
+      writer.WriteSyncCommand();
+      io_socket->FlushAllWrites();
+      network::ManualPacketUtil::ReadUntilReadyOrClose(io_socket);
+    }
+    state->SetItemsProcessed(state->iterations());
+    network::ManualPacketUtil::TerminateConnection(io_socket->GetSocketFd());
+    io_socket->Close();
+  }
+
+  const uint16_t port_ = 15721;
+  std::unique_ptr<DBMain> db_main_;
+  common::ManagedPointer<network::TerrierServer> server_;
+};
+
+/**
+ * Round trips over TCP loopback
+ */
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(NetworkLatencyBenchmark, TcpRoundTrip)(benchmark::State &state) {
+  RoundTrips(&state, network::ManualPacketUtil::StartConnection(port_));
+}
+
+/**
+ * Round trips over the Unix domain socket
+ */
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(NetworkLatencyBenchmark, UnixSocketRoundTrip)(benchmark::State &state) {
+  RoundTrips(&state, network::ManualPacketUtil::StartUnixConnection(server_->UnixSocketPath()));
+}
+
+// ----------------------------------------------------------------------------
+// BENCHMARK REGISTRATION
+// ----------------------------------------------------------------------------
+// clang-format off
+BENCHMARK_REGISTER_F(NetworkLatencyBenchmark, TcpRoundTrip)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(NetworkLatencyBenchmark, UnixSocketRoundTrip)->Unit(benchmark::kMicrosecond);
+// clang-format on
+
+}  // namespace terrier
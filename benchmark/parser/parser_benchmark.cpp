@@ -1,3 +1,7 @@
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -18,8 +22,22 @@ namespace terrier {
     TERRIER_ASSERT(result->GetStatement(0).CastManagedPointerTo<TYPE>() != nullptr, "Failed to get ##TYPE object"); \
   }
 
+/**
+ * @return the resident set size of the process in bytes, 0 if it cannot be read
+ */
+static size_t ResidentBytes() {
+  std::ifstream statm("/proc/self/statm");
+  size_t size = 0;
+  size_t resident = 0;
+  statm >> size >> resident;
+  return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
 class ParserBenchmark : public benchmark::Fixture {
  public:
+  /** Number of rows in the VALUES list of the bulk INSERT */
+  static constexpr int BULK_INSERT_ROWS = 50000;
+
   void SetUp(const benchmark::State &state) final {
     // We only need to bring up the parser for these benchmarks
 
@@ -94,6 +112,15 @@ class ParserBenchmark : public benchmark::Fixture {
       inserts_complex_ = {"INSERT INTO xxx (" + os1.str() + ") VALUES (" + os2.str() + ");"};
     }
 
+    // BULK
+    {
+      std::ostringstream os;
+      for (int i = 0; i < BULK_INSERT_ROWS; i++) {
+        os << (i != 0 ? ", " : "") << "(" << i << ", " << i * 2 << ", 'row" << i << "', NULL)";
+      }
+      inserts_bulk_ = {"INSERT INTO xxx VALUES " + os.str() + ";"};
+    }
+
     // -------------------------------
     // DELETE
     // -------------------------------
@@ -126,6 +153,7 @@ class ParserBenchmark : public benchmark::Fixture {
   std::vector<std::string> updates_complex_;
   std::vector<std::string> inserts_simple_;
   std::vector<std::string> inserts_complex_;
+  std::vector<std::string> inserts_bulk_;
   std::vector<std::string> deletes_simple_;
   std::vector<std::string> deletes_complex_;
 };
@@ -184,6 +212,25 @@ BENCHMARK_DEFINE_F(ParserBenchmark, InsertsComplex)(benchmark::State &state) {
   state.SetItemsProcessed(state.iterations() * inserts_complex_.size());
 }
 
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(ParserBenchmark, InsertsBulk)(benchmark::State &state) {
+  // The memory the parse tree holds on to is measured once outside of the timed loop, as the growth of the resident set
+  // while it is alive. A tree of this size dwarfs what the allocator keeps around, but the numbers are approximate.
+  {
+    const auto resident_before = ResidentBytes();
+    std::vector<std::unique_ptr<parser::ParseResult>> results;
+    for (const auto &sql : inserts_bulk_) results.emplace_back(parser::PostgresParser::BuildParseTree(sql));
+    const auto parse_tree_bytes = static_cast<double>(std::max(ResidentBytes(), resident_before) - resident_before);
+    state.counters["ParseTreeBytes"] = parse_tree_bytes;
+    state.counters["BytesPerRow"] = parse_tree_bytes / (BULK_INSERT_ROWS * inserts_bulk_.size());
+  }
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    PARSER_BENCHMARK_EXECUTE(inserts_bulk_, parser::InsertStatement);
+  }
+  state.SetItemsProcessed(state.iterations() * inserts_bulk_.size());
+}
+
 // NOLINTNEXTLINE
 BENCHMARK_DEFINE_F(ParserBenchmark, DeletesSimple)(benchmark::State &state) {
   // NOLINTNEXTLINE
@@ -222,6 +269,7 @@ BENCHMARK_REGISTER_F(ParserBenchmark, UpdatesSimple)->Unit(benchmark::kNanosecon
 BENCHMARK_REGISTER_F(ParserBenchmark, UpdatesComplex)->Unit(benchmark::kNanosecond);
 BENCHMARK_REGISTER_F(ParserBenchmark, InsertsSimple)->Unit(benchmark::kNanosecond);
 BENCHMARK_REGISTER_F(ParserBenchmark, InsertsComplex)->Unit(benchmark::kNanosecond);
+BENCHMARK_REGISTER_F(ParserBenchmark, InsertsBulk)->Unit(benchmark::kNanosecond);
 BENCHMARK_REGISTER_F(ParserBenchmark, DeletesSimple)->Unit(benchmark::kNanosecond);
 BENCHMARK_REGISTER_F(ParserBenchmark, DeletesComplex)->Unit(benchmark::kNanosecond);
 BENCHMARK_REGISTER_F(ParserBenchmark, NOOPs)->Unit(benchmark::kNanosecond);
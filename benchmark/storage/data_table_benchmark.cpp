@@ -5,10 +5,13 @@
 #include "benchmark_util/benchmark_config.h"
 #include "common/scoped_timer.h"
 #include "storage/data_table.h"
+#include "storage/garbage_collector.h"
 #include "storage/storage_util.h"
 #include "test_util/multithread_test_util.h"
 #include "test_util/storage_test_util.h"
+#include "transaction/deferred_action_manager.h"
 #include "transaction/transaction_context.h"
+#include "transaction/transaction_manager.h"
 
 namespace terrier {
 
@@ -253,6 +256,75 @@ BENCHMARK_DEFINE_F(DataTableBenchmark, Scan)(benchmark::State &state) {
   state.SetItemsProcessed(state.iterations() * num_reads_ * BenchmarkConfig::num_threads);
 }
 
+// Scan the num_reads_ of tuples from a DataTable concurrently, after the GC truncated their version chains. Every block
+// has a version synopsis of zero, so the scans copy whole runs of tuples instead of reading them one at a time, and
+// only load the shared num_versions_ counter of each block twice.
+// NOLINTNEXTLINE
+BENCHMARK_DEFINE_F(DataTableBenchmark, ScanVersionFree)(benchmark::State &state) {
+  storage::DataTable read_table(common::ManagedPointer<storage::BlockStore>(&block_store_), layout_,
+                                storage::layout_version_t(0));
+  transaction::TimestampManager timestamp_manager;
+  transaction::DeferredActionManager deferred_action_manager{common::ManagedPointer(&timestamp_manager)};
+  transaction::TransactionManager txn_manager{common::ManagedPointer(&timestamp_manager),
+                                             common::ManagedPointer(&deferred_action_manager),
+                                             common::ManagedPointer(&buffer_pool_), true, DISABLED};
+  storage::GarbageCollector gc{common::ManagedPointer(&timestamp_manager),
+                               common::ManagedPointer(&deferred_action_manager), common::ManagedPointer(&txn_manager),
+                               DISABLED};
+
+  // populate read_table_ by inserting tuples, then unlink and deallocate the inserts
+  auto *insert_txn = txn_manager.BeginTransaction();
+  for (uint32_t i = 0; i < num_reads_; ++i) {
+    read_table.Insert(common::ManagedPointer(insert_txn), *redo_);
+  }
+  txn_manager.Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  gc.PerformGarbageCollection();
+  gc.PerformGarbageCollection();
+
+  std::vector<storage::col_id_t> all_cols = StorageTestUtil::ProjectionListAllColumns(layout_);
+  storage::ProjectedColumnsInitializer initializer(layout_, all_cols, common::Constants::K_DEFAULT_VECTOR_SIZE);
+
+  std::vector<storage::ProjectedColumns *> all_columns;
+  std::vector<byte *> buf;
+  for (uint32_t j = 0; j < BenchmarkConfig::num_threads; j++) {
+    auto *buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedColumnsSize());
+    storage::ProjectedColumns *columns = initializer.Initialize(buffer);
+    all_columns.push_back(columns);
+    buf.push_back(buffer);
+  }
+
+  auto *txn = txn_manager.BeginTransaction();
+  // NOLINTNEXTLINE
+  for (auto _ : state) {
+    auto workload = [&](uint32_t id) {
+      auto it = read_table.begin();
+      while (it != read_table.end()) {
+        read_table.Scan(common::ManagedPointer(txn), &it, all_columns[id]);
+      }
+    };
+    common::WorkerPool thread_pool(BenchmarkConfig::num_threads, {});
+    thread_pool.Startup();
+    uint64_t elapsed_ms;
+    {
+      common::ScopedTimer<std::chrono::milliseconds> timer(&elapsed_ms);
+      for (uint32_t j = 0; j < BenchmarkConfig::num_threads; j++) {
+        thread_pool.SubmitTask([j, &workload] { workload(j); });
+      }
+      thread_pool.WaitUntilAllFinished();
+    }
+    state.SetIterationTime(static_cast<double>(elapsed_ms) / 1000.0);
+  }
+  txn_manager.Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  gc.PerformGarbageCollection();
+  gc.PerformGarbageCollection();
+  for (auto p : buf) {
+    delete[] p;
+  }
+  state.SetItemsProcessed(state.iterations() * num_reads_ * BenchmarkConfig::num_threads);
+  state.SetBytesProcessed(state.iterations() * num_reads_ * BenchmarkConfig::num_threads * all_cols.size() *
+                          column_size_);
+}
+
 // ----------------------------------------------------------------------------
 // Benchmark Registration
 // ----------------------------------------------------------------------------
@@ -273,6 +345,10 @@ BENCHMARK_REGISTER_F(DataTableBenchmark, Scan)
     ->Unit(benchmark::kMillisecond)
     ->UseRealTime()
     ->UseManualTime();
+BENCHMARK_REGISTER_F(DataTableBenchmark, ScanVersionFree)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->UseManualTime();
 // clang-format on
 
 }  // namespace terrier
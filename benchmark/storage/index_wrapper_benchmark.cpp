@@ -66,7 +66,8 @@ class IndexBenchmark : public benchmark::Fixture {
     // Setup table with schema based on column structures
     table_schema_ = catalog::Schema({col});
     sql_table_ = new storage::SqlTable(common::ManagedPointer(&block_store_), table_schema_);
-    tuple_initializer_ = sql_table_->InitializerForProjectedRow({catalog::col_oid_t(1)});
+    tuple_initializer_ =
+        sql_table_->InitializerForProjectedRow({catalog::col_oid_t(1)}, storage::INITIAL_LAYOUT_VERSION);
 
     // Create time, action, and transaction managers
     timestamp_manager_ = new transaction::TimestampManager;
@@ -128,7 +129,8 @@ class IndexBenchmark : public benchmark::Fixture {
           insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
       auto *const insert_tuple = insert_redo->Delta();
       *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
-      const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+      const auto tuple_slot =
+          sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
       *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
 
       // Ensure that insert action appropriately listed
@@ -185,7 +185,7 @@ BENCHMARK_DEFINE_F(RecoveryBenchmark, IndexRecovery)(benchmark::State &state) {
     }
     txn_manager->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
 
-    auto initializer = table->InitializerForProjectedRow({schema.GetColumn(0).Oid()});
+    auto initializer = table->InitializerForProjectedRow({schema.GetColumn(0).Oid()}, storage::INITIAL_LAYOUT_VERSION);
 
     // Create and execute insert workload. We actually don't need to insert into indexes here, since we only care about
     // recovery doing it
@@ -196,7 +196,7 @@ BENCHMARK_DEFINE_F(RecoveryBenchmark, IndexRecovery)(benchmark::State &state) {
         auto *txn = txn_manager->BeginTransaction();
         auto redo_record = txn->StageWrite(db_oid, table_oid, initializer);
         *reinterpret_cast<int32_t *>(redo_record->Delta()->AccessForceNotNull(0)) = key;
-        table->Insert(common::ManagedPointer(txn), redo_record);
+        table->Insert(common::ManagedPointer(txn), redo_record, storage::INITIAL_LAYOUT_VERSION);
         txn_manager->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
       }
     };
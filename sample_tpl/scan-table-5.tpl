@@ -0,0 +1,32 @@
+// Perform:
+// select colA from test_1 WHERE colA < 500;
+//
+// Should output 510 (number of output rows, plus 10 for the row where colA = 7)
+// This tests the PCI compare and add-assign superinstructions: the column is compared without reading it into a
+// variable first, and the count is updated through a pointer.
+
+fun count(pci: *ProjectedColumnsIterator, matches: *int64) -> nil {
+  for (; @pciHasNext(pci); @pciAdvance(pci)) {
+    if (@pciGetInt(pci, 0) < 500) {
+      *matches = *matches + 1
+    }
+    if (@pciGetInt(pci, 0) == 7) {
+      *matches = *matches + 10
+    }
+  }
+}
+
+fun main(execCtx: *ExecutionContext) -> int64 {
+  var ret = 0
+  var tvi: TableVectorIterator
+  var oids: [1]uint32
+  oids[0] = 1 // colA
+  @tableIterInitBind(&tvi, execCtx, "test_1", oids)
+  for (@tableIterAdvance(&tvi)) {
+    var pci = @tableIterGetPCI(&tvi)
+    count(pci, &ret)
+    @pciReset(pci)
+  }
+  @tableIterClose(&tvi)
+  return ret
+}
@@ -17,9 +17,11 @@
 #include "parser/expression/aggregate_expression.h"
 #include "parser/expression/case_expression.h"
 #include "parser/expression/column_value_expression.h"
+#include "parser/expression/comparison_expression.h"
 #include "parser/expression/constant_value_expression.h"
 #include "parser/expression/function_expression.h"
 #include "parser/expression/operator_expression.h"
+#include "parser/expression/parameter_value_expression.h"
 #include "parser/expression/star_expression.h"
 #include "parser/expression/subquery_expression.h"
 #include "parser/expression/type_cast_expression.h"
@@ -143,6 +145,11 @@ void BindNodeVisitor::Visit(parser::UpdateStatement *node, parser::ParseResult *
   if (node->GetUpdateCondition() != nullptr) node->GetUpdateCondition()->Accept(this, parse_result);
   for (auto &update : node->GetUpdateClauses()) {
     update->GetUpdateValue()->Accept(this, parse_result);
+    if (update->GetUpdateValue()->GetExpressionType() == parser::ExpressionType::VALUE_PARAMETER) {
+      const auto table_oid = catalog_accessor_->GetTableOid(node->GetUpdateTable()->GetTableName());
+      SetParameterType(update->GetUpdateValue(),
+                       catalog_accessor_->GetSchema(table_oid).GetColumn(update->GetColumnName()).Type());
+    }
   }
 
   delete context_;
@@ -341,13 +348,13 @@ void BindNodeVisitor::Visit(parser::InsertStatement *node, parser::ParseResult *
     auto num_schema_columns = table_schema.GetColumns().size();
     auto num_insert_columns = insert_columns->size();  // potentially 0 if unspecified by query
     auto insert_values = node->GetValues();
+    const bool is_insert_cols_specified = num_insert_columns != 0;
     // Validate input values.
     {
       for (auto &values : *insert_values) {
         size_t num_values = values.size();
         // Test that they have the same number of columns.
         {
-          bool is_insert_cols_specified = num_insert_columns != 0;
           bool insert_cols_ok = is_insert_cols_specified && num_values == num_insert_columns;
           bool insert_schema_ok = !is_insert_cols_specified && num_values == num_schema_columns;
           if (!(insert_cols_ok || insert_schema_ok)) {
@@ -356,6 +363,12 @@ void BindNodeVisitor::Visit(parser::InsertStatement *node, parser::ParseResult *
         }
         // Test that the column values are of the right type.
         for (size_t i = 0; i < num_values; ++i) {
+          // A parameter has no value yet, it simply takes the type of its column
+          if (values[i]->GetExpressionType() == parser::ExpressionType::VALUE_PARAMETER) {
+            SetParameterType(values[i], is_insert_cols_specified ? table_schema.GetColumn((*insert_columns)[i]).Type()
+                                                                 : table_schema.GetColumn(i).Type());
+            continue;
+          }
           // TODO(WAN): handle additional cases, possibly think about calling DeriveReturnValueType
           //  so that we handle (1+2) type of expressions
           //  ADDENDUM. So I thought DeriveReturnValueType would actually derive the return value type.
@@ -378,6 +391,30 @@ void BindNodeVisitor::Visit(parser::InsertStatement *node, parser::ParseResult *
         }
       }
     }
+    // Validate the constant batch, if the values are in one.
+    auto constant_batch = node->GetConstantBatch();
+    if (constant_batch != nullptr) {
+      // All of the rows have the same number of columns.
+      const size_t num_values = constant_batch->NumColumns();
+      bool insert_cols_ok = is_insert_cols_specified && num_values == num_insert_columns;
+      bool insert_schema_ok = !is_insert_cols_specified && num_values == num_schema_columns;
+      if (!(insert_cols_ok || insert_schema_ok)) {
+        throw BINDER_EXCEPTION("Mismatch in number of insert columns and number of insert values.");
+      }
+      // Convert the values of each column to the column's type. NULLs just take on the type of the column.
+      for (uint32_t col = 0; col < num_values; col++) {
+        const auto expected_ret_type = is_insert_cols_specified
+                                           ? table_schema.GetColumn((*insert_columns)[col]).Type()
+                                           : table_schema.GetColumn(col).Type();
+        for (uint32_t row = 0; row < constant_batch->NumRows(); row++) {
+          const auto &value = constant_batch->GetValue(row, col);
+          if (value.Type() == expected_ret_type) continue;
+          constant_batch->SetValue(row, col,
+                                   value.Null() ? type::TransientValueFactory::GetNull(expected_ret_type)
+                                                : BinderUtil::ConvertValue(value, expected_ret_type));
+        }
+      }
+    }
   }
 
   delete context_;
@@ -530,4 +567,36 @@ void BindNodeVisitor::Visit(parser::AggregateExpression *expr, parser::ParseResu
   SqlNodeVisitor::Visit(expr, parse_result);
   expr->DeriveReturnValueType();
 }
+
+void BindNodeVisitor::Visit(parser::ComparisonExpression *expr, parser::ParseResult *parse_result) {
+  BINDER_LOG_TRACE("Visiting ComparisonExpression ...");
+  SqlNodeVisitor::Visit(expr, parse_result);
+  // In "col = $1" the parameter stands for a value of the column's type
+  if (expr->GetChildrenSize() != 2) return;
+  const auto left = expr->GetChild(0);
+  const auto right = expr->GetChild(1);
+  const auto parameter = parser::ExpressionType::VALUE_PARAMETER;
+  if (left->GetExpressionType() == parameter && right->GetExpressionType() != parameter) {
+    SetParameterType(left, right->GetReturnValueType());
+  } else if (right->GetExpressionType() == parameter && left->GetExpressionType() != parameter) {
+    SetParameterType(right, left->GetReturnValueType());
+  }
+}
+
+void BindNodeVisitor::Visit(parser::ParameterValueExpression *expr,
+                            UNUSED_ATTRIBUTE parser::ParseResult *parse_result) {
+  BINDER_LOG_TRACE("Visiting ParameterValueExpression ...");
+  // Keeps the type from the parser unless the parameter's context already decided it
+  const auto idx = expr->GetValueIdx();
+  if (idx >= parameter_types_.size()) parameter_types_.resize(idx + 1, type::TypeId::INVALID);
+  if (parameter_types_[idx] == type::TypeId::INVALID) parameter_types_[idx] = expr->GetReturnValueType();
+}
+
+void BindNodeVisitor::SetParameterType(const common::ManagedPointer<parser::AbstractExpression> expr,
+                                       const type::TypeId type) {
+  const auto idx = expr.CastManagedPointerTo<parser::ParameterValueExpression>()->GetValueIdx();
+  if (idx >= parameter_types_.size()) parameter_types_.resize(idx + 1, type::TypeId::INVALID);
+  parameter_types_[idx] = type;
+  expr->SetReturnValueType(type);
+}
 }  // namespace terrier::binder
@@ -29,17 +29,22 @@ Catalog::Catalog(const common::ManagedPointer<transaction::TransactionManager> t
                                                              postgres::DATABASE_OID_INDEX_OID);
   databases_name_index_ = postgres::Builder::BuildUniqueIndex(postgres::Builder::GetDatabaseNameIndexSchema(),
                                                               postgres::DATABASE_NAME_INDEX_OID);
-  get_database_oid_pri_ = databases_->InitializerForProjectedRow({postgres::DATOID_COL_OID});
-  get_database_catalog_pri_ = databases_->InitializerForProjectedRow({postgres::DAT_CATALOG_COL_OID});
+  get_database_oid_pri_ =
+      databases_->InitializerForProjectedRow({postgres::DATOID_COL_OID}, storage::INITIAL_LAYOUT_VERSION);
+  get_database_catalog_pri_ =
+      databases_->InitializerForProjectedRow({postgres::DAT_CATALOG_COL_OID}, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> pg_database_all_oids{postgres::PG_DATABASE_ALL_COL_OIDS.cbegin(),
                                                     postgres::PG_DATABASE_ALL_COL_OIDS.cend()};
-  pg_database_all_cols_pri_ = databases_->InitializerForProjectedRow(pg_database_all_oids);
-  pg_database_all_cols_prm_ = databases_->ProjectionMapForOids(pg_database_all_oids);
+  pg_database_all_cols_pri_ =
+      databases_->InitializerForProjectedRow(pg_database_all_oids, storage::INITIAL_LAYOUT_VERSION);
+  pg_database_all_cols_prm_ = databases_->ProjectionMapForOids(pg_database_all_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> delete_database_entry_oids{postgres::DATNAME_COL_OID, postgres::DAT_CATALOG_COL_OID};
-  delete_database_entry_pri_ = databases_->InitializerForProjectedRow(delete_database_entry_oids);
-  delete_database_entry_prm_ = databases_->ProjectionMapForOids(delete_database_entry_oids);
+  delete_database_entry_pri_ =
+      databases_->InitializerForProjectedRow(delete_database_entry_oids, storage::INITIAL_LAYOUT_VERSION);
+  delete_database_entry_prm_ =
+      databases_->ProjectionMapForOids(delete_database_entry_oids, storage::INITIAL_LAYOUT_VERSION);
 }
 
 void Catalog::TearDown() {
@@ -48,7 +53,7 @@ void Catalog::TearDown() {
   const std::vector<col_oid_t> cols{postgres::DAT_CATALOG_COL_OID};
 
   // Only one column, so we only need the initializer and not the ProjectionMap
-  const auto pci = databases_->InitializerForProjectedColumns(cols, 100);
+  const auto pci = databases_->InitializerForProjectedColumns(cols, 100, storage::INITIAL_LAYOUT_VERSION);
 
   // This could potentially be optimized by calculating this size and hard-coding a byte array on the stack
   byte *buffer = common::AllocationUtil::AllocateAligned(pci.ProjectedColumnsSize());
@@ -64,7 +69,7 @@ void Catalog::TearDown() {
   std::vector<DatabaseCatalog *> db_cats;
   auto table_iter = databases_->begin();
   while (table_iter != databases_->end()) {
-    databases_->Scan(common::ManagedPointer(txn), &table_iter, pc);
+    databases_->Scan(common::ManagedPointer(txn), &table_iter, pc, storage::INITIAL_LAYOUT_VERSION);
 
     for (uint i = 0; i < pc->NumTuples(); i++) db_cats.emplace_back(db_ptrs[i]);
   }
@@ -166,7 +171,8 @@ db_oid_t Catalog::GetDatabaseOid(const common::ManagedPointer<transaction::Trans
   TERRIER_ASSERT(index_results.size() == 1, "Database name not unique in index");
 
   pr = get_database_oid_pri_.InitializeRow(buffer);
-  const auto result UNUSED_ATTRIBUTE = databases_->Select(common::ManagedPointer(txn), index_results[0], pr);
+  const auto result UNUSED_ATTRIBUTE =
+      databases_->Select(common::ManagedPointer(txn), index_results[0], pr, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(result, "Index already verified visibility. This shouldn't fail.");
   const auto db_oid = *(reinterpret_cast<const db_oid_t *const>(pr->AccessForceNotNull(0)));
   delete[] buffer;
@@ -192,7 +198,8 @@ common::ManagedPointer<DatabaseCatalog> Catalog::GetDatabaseCatalog(
   TERRIER_ASSERT(index_results.size() == 1, "Database name not unique in index");
 
   pr = get_database_catalog_pri_.InitializeRow(buffer);
-  const auto UNUSED_ATTRIBUTE result = databases_->Select(common::ManagedPointer(txn), index_results[0], pr);
+  const auto UNUSED_ATTRIBUTE result =
+      databases_->Select(common::ManagedPointer(txn), index_results[0], pr, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(result, "Index scan did a visibility check, so Select shouldn't fail at this point.");
 
   const auto dbc = *(reinterpret_cast<DatabaseCatalog **>(pr->AccessForceNotNull(0)));
@@ -224,7 +231,7 @@ bool Catalog::CreateDatabaseEntry(const common::ManagedPointer<transaction::Tran
       redo->Delta()->AccessForceNotNull(pg_database_all_cols_prm_[postgres::DAT_CATALOG_COL_OID]))) = dbc;
 
   // Insert into the table to get the tuple slot
-  const auto tupleslot = databases_->Insert(common::ManagedPointer(txn), redo);
+  const auto tupleslot = databases_->Insert(common::ManagedPointer(txn), redo, storage::INITIAL_LAYOUT_VERSION);
 
   const auto name_pri = databases_name_index_->GetProjectedRowInitializer();
   const auto oid_pri = databases_oid_index_->GetProjectedRowInitializer();
@@ -279,7 +286,8 @@ DatabaseCatalog *Catalog::DeleteDatabaseEntry(const common::ManagedPointer<trans
       "pushing logic here.");
 
   pr = delete_database_entry_pri_.InitializeRow(buffer);
-  const auto UNUSED_ATTRIBUTE result = databases_->Select(common::ManagedPointer(txn), index_results[0], pr);
+  const auto UNUSED_ATTRIBUTE result =
+      databases_->Select(common::ManagedPointer(txn), index_results[0], pr, storage::INITIAL_LAYOUT_VERSION);
 
   TERRIER_ASSERT(result, "Index scan did a visibility check, so Select shouldn't fail at this point.");
 
@@ -265,88 +265,99 @@ void DatabaseCatalog::BootstrapPRIs() {
   // pg_namespace
   const std::vector<col_oid_t> pg_namespace_all_oids{postgres::PG_NAMESPACE_ALL_COL_OIDS.cbegin(),
                                                      postgres::PG_NAMESPACE_ALL_COL_OIDS.cend()};
-  pg_namespace_all_cols_pri_ = namespaces_->InitializerForProjectedRow(pg_namespace_all_oids);
-  pg_namespace_all_cols_prm_ = namespaces_->ProjectionMapForOids(pg_namespace_all_oids);
+  pg_namespace_all_cols_pri_ =
+      namespaces_->InitializerForProjectedRow(pg_namespace_all_oids, storage::INITIAL_LAYOUT_VERSION);
+  pg_namespace_all_cols_prm_ =
+      namespaces_->ProjectionMapForOids(pg_namespace_all_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> delete_namespace_oids{postgres::NSPNAME_COL_OID};
-  delete_namespace_pri_ = namespaces_->InitializerForProjectedRow(delete_namespace_oids);
+  delete_namespace_pri_ =
+      namespaces_->InitializerForProjectedRow(delete_namespace_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> get_namespace_oids{postgres::NSPOID_COL_OID};
-  get_namespace_pri_ = namespaces_->InitializerForProjectedRow(get_namespace_oids);
+  get_namespace_pri_ = namespaces_->InitializerForProjectedRow(get_namespace_oids, storage::INITIAL_LAYOUT_VERSION);
 
   // pg_attribute
   const std::vector<col_oid_t> pg_attribute_all_oids{postgres::PG_ATTRIBUTE_ALL_COL_OIDS.cbegin(),
                                                      postgres::PG_ATTRIBUTE_ALL_COL_OIDS.end()};
-  pg_attribute_all_cols_pri_ = columns_->InitializerForProjectedRow(pg_attribute_all_oids);
-  pg_attribute_all_cols_prm_ = columns_->ProjectionMapForOids(pg_attribute_all_oids);
+  pg_attribute_all_cols_pri_ =
+      columns_->InitializerForProjectedRow(pg_attribute_all_oids, storage::INITIAL_LAYOUT_VERSION);
+  pg_attribute_all_cols_prm_ = columns_->ProjectionMapForOids(pg_attribute_all_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> get_columns_oids{postgres::ATTNUM_COL_OID,     postgres::ATTNAME_COL_OID,
                                                 postgres::ATTTYPID_COL_OID,   postgres::ATTLEN_COL_OID,
                                                 postgres::ATTNOTNULL_COL_OID, postgres::ADSRC_COL_OID};
-  get_columns_pri_ = columns_->InitializerForProjectedRow(get_columns_oids);
-  get_columns_prm_ = columns_->ProjectionMapForOids(get_columns_oids);
+  get_columns_pri_ = columns_->InitializerForProjectedRow(get_columns_oids, storage::INITIAL_LAYOUT_VERSION);
+  get_columns_prm_ = columns_->ProjectionMapForOids(get_columns_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> delete_columns_oids{postgres::ATTNUM_COL_OID, postgres::ATTNAME_COL_OID};
-  delete_columns_pri_ = columns_->InitializerForProjectedRow(delete_columns_oids);
-  delete_columns_prm_ = columns_->ProjectionMapForOids(delete_columns_oids);
+  delete_columns_pri_ = columns_->InitializerForProjectedRow(delete_columns_oids, storage::INITIAL_LAYOUT_VERSION);
+  delete_columns_prm_ = columns_->ProjectionMapForOids(delete_columns_oids, storage::INITIAL_LAYOUT_VERSION);
 
   // pg_class
   const std::vector<col_oid_t> pg_class_all_oids{postgres::PG_CLASS_ALL_COL_OIDS.cbegin(),
                                                  postgres::PG_CLASS_ALL_COL_OIDS.cend()};
-  pg_class_all_cols_pri_ = classes_->InitializerForProjectedRow(pg_class_all_oids);
-  pg_class_all_cols_prm_ = classes_->ProjectionMapForOids(pg_class_all_oids);
+  pg_class_all_cols_pri_ = classes_->InitializerForProjectedRow(pg_class_all_oids, storage::INITIAL_LAYOUT_VERSION);
+  pg_class_all_cols_prm_ = classes_->ProjectionMapForOids(pg_class_all_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> get_class_oid_kind_oids{postgres::RELOID_COL_OID, postgres::RELKIND_COL_OID};
-  get_class_oid_kind_pri_ = classes_->InitializerForProjectedRow(get_class_oid_kind_oids);
+  get_class_oid_kind_pri_ =
+      classes_->InitializerForProjectedRow(get_class_oid_kind_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> set_class_pointer_oids{postgres::REL_PTR_COL_OID};
-  set_class_pointer_pri_ = classes_->InitializerForProjectedRow(set_class_pointer_oids);
+  set_class_pointer_pri_ =
+      classes_->InitializerForProjectedRow(set_class_pointer_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> set_class_schema_oids{postgres::REL_SCHEMA_COL_OID};
-  set_class_schema_pri_ = classes_->InitializerForProjectedRow(set_class_schema_oids);
+  set_class_schema_pri_ = classes_->InitializerForProjectedRow(set_class_schema_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> get_class_pointer_kind_oids{postgres::REL_PTR_COL_OID, postgres::RELKIND_COL_OID};
-  get_class_pointer_kind_pri_ = classes_->InitializerForProjectedRow(get_class_pointer_kind_oids);
+  get_class_pointer_kind_pri_ =
+      classes_->InitializerForProjectedRow(get_class_pointer_kind_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> get_class_schema_pointer_kind_oids{postgres::REL_SCHEMA_COL_OID,
                                                                   postgres::RELKIND_COL_OID};
-  get_class_schema_pointer_kind_pri_ = classes_->InitializerForProjectedRow(get_class_schema_pointer_kind_oids);
+  get_class_schema_pointer_kind_pri_ =
+      classes_->InitializerForProjectedRow(get_class_schema_pointer_kind_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> get_class_object_and_schema_oids{postgres::REL_PTR_COL_OID,
                                                                 postgres::REL_SCHEMA_COL_OID};
-  get_class_object_and_schema_pri_ = classes_->InitializerForProjectedRow(get_class_object_and_schema_oids);
-  get_class_object_and_schema_prm_ = classes_->ProjectionMapForOids(get_class_object_and_schema_oids);
+  get_class_object_and_schema_pri_ =
+      classes_->InitializerForProjectedRow(get_class_object_and_schema_oids, storage::INITIAL_LAYOUT_VERSION);
+  get_class_object_and_schema_prm_ =
+      classes_->ProjectionMapForOids(get_class_object_and_schema_oids, storage::INITIAL_LAYOUT_VERSION);
 
   // pg_index
   const std::vector<col_oid_t> pg_index_all_oids{postgres::PG_INDEX_ALL_COL_OIDS.cbegin(),
                                                  postgres::PG_INDEX_ALL_COL_OIDS.cend()};
-  pg_index_all_cols_pri_ = indexes_->InitializerForProjectedRow(pg_index_all_oids);
-  pg_index_all_cols_prm_ = indexes_->ProjectionMapForOids(pg_index_all_oids);
+  pg_index_all_cols_pri_ = indexes_->InitializerForProjectedRow(pg_index_all_oids, storage::INITIAL_LAYOUT_VERSION);
+  pg_index_all_cols_prm_ = indexes_->ProjectionMapForOids(pg_index_all_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> get_indexes_oids{postgres::INDOID_COL_OID};
-  get_indexes_pri_ = indexes_->InitializerForProjectedRow(get_class_oid_kind_oids);
+  get_indexes_pri_ = indexes_->InitializerForProjectedRow(get_class_oid_kind_oids, storage::INITIAL_LAYOUT_VERSION);
 
   const std::vector<col_oid_t> delete_index_oids{postgres::INDOID_COL_OID, postgres::INDRELID_COL_OID};
-  delete_index_pri_ = indexes_->InitializerForProjectedRow(delete_index_oids);
-  delete_index_prm_ = indexes_->ProjectionMapForOids(delete_index_oids);
+  delete_index_pri_ = indexes_->InitializerForProjectedRow(delete_index_oids, storage::INITIAL_LAYOUT_VERSION);
+  delete_index_prm_ = indexes_->ProjectionMapForOids(delete_index_oids, storage::INITIAL_LAYOUT_VERSION);
 
   // pg_type
   const std::vector<col_oid_t> pg_type_all_oids{postgres::PG_TYPE_ALL_COL_OIDS.cbegin(),
                                                 postgres::PG_TYPE_ALL_COL_OIDS.cend()};
-  pg_type_all_cols_pri_ = types_->InitializerForProjectedRow(pg_type_all_oids);
-  pg_type_all_cols_prm_ = types_->ProjectionMapForOids(pg_type_all_oids);
+  pg_type_all_cols_pri_ = types_->InitializerForProjectedRow(pg_type_all_oids, storage::INITIAL_LAYOUT_VERSION);
+  pg_type_all_cols_prm_ = types_->ProjectionMapForOids(pg_type_all_oids, storage::INITIAL_LAYOUT_VERSION);
 
   // pg_language
   const std::vector<col_oid_t> pg_language_all_oids{postgres::PG_LANGUAGE_ALL_COL_OIDS.cbegin(),
                                                     postgres::PG_LANGUAGE_ALL_COL_OIDS.cend()};
-  pg_language_all_cols_pri_ = languages_->InitializerForProjectedRow(pg_language_all_oids);
-  pg_language_all_cols_prm_ = languages_->ProjectionMapForOids(pg_language_all_oids);
+  pg_language_all_cols_pri_ =
+      languages_->InitializerForProjectedRow(pg_language_all_oids, storage::INITIAL_LAYOUT_VERSION);
+  pg_language_all_cols_prm_ = languages_->ProjectionMapForOids(pg_language_all_oids, storage::INITIAL_LAYOUT_VERSION);
 
   // pg_proc
   const std::vector<col_oid_t> pg_proc_all_oids{postgres::PG_PRO_ALL_COL_OIDS.cbegin(),
                                                 postgres::PG_PRO_ALL_COL_OIDS.cend()};
-  pg_proc_all_cols_pri_ = procs_->InitializerForProjectedRow(pg_proc_all_oids);
-  pg_proc_all_cols_prm_ = procs_->ProjectionMapForOids(pg_proc_all_oids);
+  pg_proc_all_cols_pri_ = procs_->InitializerForProjectedRow(pg_proc_all_oids, storage::INITIAL_LAYOUT_VERSION);
+  pg_proc_all_cols_prm_ = procs_->ProjectionMapForOids(pg_proc_all_oids, storage::INITIAL_LAYOUT_VERSION);
 }
 
 namespace_oid_t DatabaseCatalog::CreateNamespace(const common::ManagedPointer<transaction::TransactionContext> txn,
@@ -371,7 +382,7 @@ bool DatabaseCatalog::CreateNamespace(const common::ManagedPointer<transaction::
   *(reinterpret_cast<storage::VarlenEntry *>(
       redo->Delta()->AccessForceNotNull(pg_namespace_all_cols_prm_[postgres::NSPNAME_COL_OID]))) = name_varlen;
   // Finally, insert into the table to get the tuple slot
-  const auto tuple_slot = namespaces_->Insert(txn, redo);
+  const auto tuple_slot = namespaces_->Insert(txn, redo, storage::INITIAL_LAYOUT_VERSION);
 
   // Step 2: Insert into name index
   auto name_pri = namespaces_name_index_->GetProjectedRowInitializer();
@@ -422,7 +433,7 @@ bool DatabaseCatalog::DeleteNamespace(const common::ManagedPointer<transaction::
 
   // Step 2: Select from the table to get the name
   pr = delete_namespace_pri_.InitializeRow(buffer);
-  auto UNUSED_ATTRIBUTE result = namespaces_->Select(txn, tuple_slot, pr);
+  auto UNUSED_ATTRIBUTE result = namespaces_->Select(txn, tuple_slot, pr, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(result, "Index scan did a visibility check, so Select shouldn't fail at this point.");
   const auto name_varlen = *reinterpret_cast<storage::VarlenEntry *>(pr->AccessForceNotNull(0));
 
@@ -516,7 +527,7 @@ namespace_oid_t DatabaseCatalog::GetNamespaceOid(const common::ManagedPointer<tr
   // Step 2: Scan the table to get the oid
   pr = get_namespace_pri_.InitializeRow(buffer);
 
-  const auto UNUSED_ATTRIBUTE result = namespaces_->Select(txn, tuple_slot, pr);
+  const auto UNUSED_ATTRIBUTE result = namespaces_->Select(txn, tuple_slot, pr, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(result, "Index scan did a visibility check, so Select shouldn't fail at this point.");
   const auto ns_oid = *reinterpret_cast<namespace_oid_t *>(pr->AccessForceNotNull(0));
 
@@ -558,7 +569,7 @@ bool DatabaseCatalog::CreateColumn(const common::ManagedPointer<transaction::Tra
   storage::VarlenEntry dsrc_varlen = storage::StorageUtil::CreateVarlen(col.StoredExpression()->ToJson().dump());
   *dsrc_entry = dsrc_varlen;
   // Finally, insert into the table to get the tuple slot
-  const auto tupleslot = columns_->Insert(txn, redo);
+  const auto tupleslot = columns_->Insert(txn, redo, storage::INITIAL_LAYOUT_VERSION);
 
   // Step 2: Insert into name index
   const auto name_pri = columns_name_index_->GetProjectedRowInitializer();
@@ -635,7 +646,7 @@ std::vector<Column> DatabaseCatalog::GetColumns(const common::ManagedPointer<tra
   std::vector<Column> cols;
   pr = get_columns_pri_.InitializeRow(buffer);
   for (const auto &slot : index_results) {
-    const auto UNUSED_ATTRIBUTE result = columns_->Select(txn, slot, pr);
+    const auto UNUSED_ATTRIBUTE result = columns_->Select(txn, slot, pr, storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(result, "Index scan did a visibility check, so Select shouldn't fail at this point.");
     cols.emplace_back(MakeColumn<Column, ColOid>(pr, get_columns_prm_));
   }
@@ -689,7 +700,7 @@ bool DatabaseCatalog::DeleteColumns(const common::ManagedPointer<transaction::Tr
   pr = delete_columns_pri_.InitializeRow(buffer);
   for (const auto &slot : index_results) {
     // 1. Extract attributes from the tuple for the index deletions
-    auto UNUSED_ATTRIBUTE result = columns_->Select(txn, slot, pr);
+    auto UNUSED_ATTRIBUTE result = columns_->Select(txn, slot, pr, storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(result, "Index scan did a visibility check, so Select shouldn't fail at this point.");
     const auto *const col_name = reinterpret_cast<const storage::VarlenEntry *const>(
         pr->AccessWithNullCheck(delete_columns_prm_[postgres::ATTNAME_COL_OID]));
@@ -779,7 +790,7 @@ bool DatabaseCatalog::DeleteTable(const common::ManagedPointer<transaction::Tran
 
   // Select the tuple out of the table before deletion. We need the attributes to do index deletions later
   auto *const table_pr = pg_class_all_cols_pri_.InitializeRow(buffer);
-  result = classes_->Select(txn, index_results[0], table_pr);
+  result = classes_->Select(txn, index_results[0], table_pr, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(result, "Select must succeed if the index scan gave a visible result.");
 
   // Delete from pg_classes table
@@ -878,7 +889,7 @@ std::pair<uint32_t, postgres::ClassKind> DatabaseCatalog::GetClassOidKind(
   TERRIER_ASSERT(get_class_oid_kind_pri_.ProjectedRowSize() <= name_pri.ProjectedRowSize(),
                  "I want to reuse this buffer because I'm lazy and malloc is slow but it needs to be big enough.");
   pr = get_class_oid_kind_pri_.InitializeRow(buffer);
-  const auto result UNUSED_ATTRIBUTE = classes_->Select(txn, index_results[0], pr);
+  const auto result UNUSED_ATTRIBUTE = classes_->Select(txn, index_results[0], pr, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(result, "Index already verified visibility. This shouldn't fail.");
 
   // Write the attributes in the ProjectedRow. We know the offsets without the map because of the ordering of attribute
@@ -939,10 +950,86 @@ bool DatabaseCatalog::RenameTable(const common::ManagedPointer<transaction::Tran
 
 bool DatabaseCatalog::UpdateSchema(const common::ManagedPointer<transaction::TransactionContext> txn,
                                    const table_oid_t table, Schema *const new_schema) {
-  if (!TryLock(txn)) return false;
-  // TODO(John): Implement
-  TERRIER_ASSERT(false, "Not implemented");
-  return false;
+  if (!TryLock(txn)) {
+    delete new_schema;
+    return false;
+  }
+  const auto oid_pri = classes_oid_index_->GetProjectedRowInitializer();
+
+  TERRIER_ASSERT(pg_class_all_cols_pri_.ProjectedRowSize() >= oid_pri.ProjectedRowSize(),
+                 "Buffer must be allocated for largest ProjectedRow size");
+  auto *const buffer = common::AllocationUtil::AllocateAligned(pg_class_all_cols_pri_.ProjectedRowSize());
+  auto *const key_pr = oid_pri.InitializeRow(buffer);
+
+  // Find the entry using the index
+  *(reinterpret_cast<table_oid_t *>(key_pr->AccessForceNotNull(0))) = table;
+  std::vector<storage::TupleSlot> index_results;
+  classes_oid_index_->ScanKey(*txn, *key_pr, &index_results);
+  TERRIER_ASSERT(
+      index_results.size() == 1,
+      "Incorrect number of results from index scan. Expect 1 because it's a unique index. 0 implies that function was "
+      "called with an oid that doesn't exist in the Catalog, but binding somehow succeeded. That doesn't make sense.");
+
+  auto *const table_pr = pg_class_all_cols_pri_.InitializeRow(buffer);
+  auto result = classes_->Select(txn, index_results[0], table_pr, storage::INITIAL_LAYOUT_VERSION);
+  TERRIER_ASSERT(result, "Select must succeed if the index scan gave a visible result.");
+  const auto *const old_schema = *(reinterpret_cast<const Schema *const *const>(
+      table_pr->AccessForceNotNull(pg_class_all_cols_prm_[postgres::REL_SCHEMA_COL_OID])));
+  auto *const table_ptr = *(reinterpret_cast<storage::SqlTable *const *const>(
+      table_pr->AccessForceNotNull(pg_class_all_cols_prm_[postgres::REL_PTR_COL_OID])));
+  const auto first_new_col_oid = *(reinterpret_cast<const col_oid_t *const>(
+      table_pr->AccessForceNotNull(pg_class_all_cols_prm_[postgres::REL_NEXTCOLOID_COL_OID])));
+  delete[] buffer;
+
+  // Rewrite the table's entries in pg_attribute. Columns that are kept carry their oid over, while added columns get
+  // fresh oids that were never used by this table, so a col_oid names the same column in every layout version.
+  result = DeleteColumns<Schema::Column, table_oid_t>(txn, table);
+  auto next_col_oid = first_new_col_oid;
+  for (const auto &col : new_schema->GetColumns()) {
+    if (!result) break;
+    TERRIER_ASSERT(col.Oid() == INVALID_COLUMN_OID || old_schema->col_oid_to_offset_.count(col.Oid()) > 0,
+                   "Columns of the new schema must either be new or come from the current schema of the table.");
+    const auto col_oid = col.Oid() == INVALID_COLUMN_OID ? next_col_oid++ : col.Oid();
+    result = CreateColumn(txn, table, col_oid, col);
+  }
+  delete new_schema;
+  if (!result) return false;
+
+  if (next_col_oid != first_new_col_oid) {
+    // Do not need to store the projection map because it is only a single column
+    const auto next_col_oid_pri =
+        classes_->InitializerForProjectedRow({postgres::REL_NEXTCOLOID_COL_OID}, storage::INITIAL_LAYOUT_VERSION);
+    auto *const next_col_oid_redo = txn->StageWrite(db_oid_, postgres::CLASS_TABLE_OID, next_col_oid_pri);
+    next_col_oid_redo->SetTupleSlot(index_results[0]);
+    *(reinterpret_cast<col_oid_t *>(next_col_oid_redo->Delta()->AccessForceNotNull(0))) = next_col_oid;
+    if (!classes_->Update(txn, next_col_oid_redo, storage::INITIAL_LAYOUT_VERSION)) return false;
+  }
+
+  // The authoritative schema is rebuilt from pg_attribute, like CreateTableEntry does
+  std::vector<Schema::Column> cols = GetColumns<Schema::Column, table_oid_t, col_oid_t>(txn, table);
+  auto *const updated_schema = new Schema(cols);
+  // The layout version is installed in the SqlTable right away, so that this txn can already use it. Other txns keep
+  // using the version of the schema they see in the catalog, and the SqlTable translates between the two.
+  updated_schema->version_ = table_ptr->UpdateSchema(*updated_schema);
+  txn->RegisterAbortAction([=]() {
+    // Tuples inserted under the old schema in the meantime were stored under the new layout version, which may lack
+    // dropped columns. Make a layout of the old schema the latest again so that later inserts keep all of them.
+    table_ptr->UpdateSchema(*old_schema);
+    delete updated_schema;
+  });
+
+  auto *const update_redo = txn->StageWrite(db_oid_, postgres::CLASS_TABLE_OID, set_class_schema_pri_);
+  update_redo->SetTupleSlot(index_results[0]);
+  *reinterpret_cast<Schema **>(update_redo->Delta()->AccessForceNotNull(0)) = updated_schema;
+  if (!classes_->Update(txn, update_redo, storage::INITIAL_LAYOUT_VERSION)) return false;
+
+  // Queries that still use the old schema may be running, so delete it like DeleteTable does
+  txn->RegisterCommitAction([=](transaction::DeferredActionManager *deferred_action_manager) {
+    deferred_action_manager->RegisterDeferredAction([=]() {
+      deferred_action_manager->RegisterDeferredAction([=]() { delete old_schema; });
+    });
+  });
+  return true;
 }
 
 const Schema &DatabaseCatalog::GetSchema(const common::ManagedPointer<transaction::TransactionContext> txn,
@@ -986,7 +1073,7 @@ std::vector<index_oid_t> DatabaseCatalog::GetIndexOids(
   index_oids.reserve(index_scan_results.size());
   auto *select_pr = get_indexes_pri_.InitializeRow(buffer);
   for (auto &slot : index_scan_results) {
-    const auto result UNUSED_ATTRIBUTE = indexes_->Select(txn, slot, select_pr);
+    const auto result UNUSED_ATTRIBUTE = indexes_->Select(txn, slot, select_pr, storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(result, "Index already verified visibility. This shouldn't fail.");
     index_oids.emplace_back(*(reinterpret_cast<index_oid_t *>(select_pr->AccessForceNotNull(0))));
   }
@@ -1032,7 +1119,7 @@ bool DatabaseCatalog::DeleteIndex(const common::ManagedPointer<transaction::Tran
 
   // Select the tuple out of the table before deletion. We need the attributes to do index deletions later
   auto *table_pr = pg_class_all_cols_pri_.InitializeRow(buffer);
-  result = classes_->Select(txn, index_results[0], table_pr);
+  result = classes_->Select(txn, index_results[0], table_pr, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(result, "Select must succeed if the index scan gave a visible result.");
 
   // Delete from pg_classes table
@@ -1099,7 +1186,7 @@ bool DatabaseCatalog::DeleteIndex(const common::ManagedPointer<transaction::Tran
 
   // Select the tuple out of pg_index before deletion. We need the attributes to do index deletions later
   table_pr = delete_index_pri_.InitializeRow(buffer);
-  result = indexes_->Select(txn, index_results[0], table_pr);
+  result = indexes_->Select(txn, index_results[0], table_pr, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(result, "Select must succeed if the index scan gave a visible result.");
 
   TERRIER_ASSERT(index == *(reinterpret_cast<const index_oid_t *const>(
@@ -1169,7 +1256,7 @@ bool DatabaseCatalog::SetClassPointer(const common::ManagedPointer<transaction::
   const auto oid_pri = classes_oid_index_->GetProjectedRowInitializer();
 
   // Do not need to store the projection map because it is only a single column
-  auto pr_init = classes_->InitializerForProjectedRow({class_col});
+  auto pr_init = classes_->InitializerForProjectedRow({class_col}, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(pr_init.ProjectedRowSize() >= oid_pri.ProjectedRowSize(), "Buffer must allocated to fit largest PR");
   auto *const buffer = common::AllocationUtil::AllocateAligned(pr_init.ProjectedRowSize());
   auto *const key_pr = oid_pri.InitializeRow(buffer);
@@ -1194,7 +1281,7 @@ bool DatabaseCatalog::SetClassPointer(const common::ManagedPointer<transaction::
 
   // Finish
   delete[] buffer;
-  return classes_->Update(txn, update_redo);
+  return classes_->Update(txn, update_redo, storage::INITIAL_LAYOUT_VERSION);
 }
 
 bool DatabaseCatalog::SetIndexPointer(const common::ManagedPointer<transaction::TransactionContext> txn,
@@ -1275,7 +1362,7 @@ std::vector<std::pair<common::ManagedPointer<storage::index::Index>, const Index
   index_oids.reserve(index_scan_results.size());
   auto *index_select_pr = get_indexes_pri_.InitializeRow(buffer);
   for (auto &slot : index_scan_results) {
-    const auto result UNUSED_ATTRIBUTE = indexes_->Select(txn, slot, index_select_pr);
+    const auto result UNUSED_ATTRIBUTE = indexes_->Select(txn, slot, index_select_pr, storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(result, "Index already verified visibility. This shouldn't fail.");
     index_oids.emplace_back(*(reinterpret_cast<index_oid_t *>(index_select_pr->AccessForceNotNull(0))));
   }
@@ -1305,7 +1392,7 @@ std::vector<std::pair<common::ManagedPointer<storage::index::Index>, const Index
   index_objects.reserve(class_tuple_slots.size());
   auto *class_select_pr = get_class_object_and_schema_pri_.InitializeRow(buffer);
   for (const auto &slot : class_tuple_slots) {
-    bool result UNUSED_ATTRIBUTE = classes_->Select(txn, slot, class_select_pr);
+    bool result UNUSED_ATTRIBUTE = classes_->Select(txn, slot, class_select_pr, storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(result, "Index already verified visibility. This shouldn't fail.");
 
     auto *index = *(reinterpret_cast<storage::index::Index *const *const>(
@@ -1335,8 +1422,8 @@ void DatabaseCatalog::TearDown(const common::ManagedPointer<transaction::Transac
   const std::vector<col_oid_t> pg_class_oids{postgres::RELKIND_COL_OID, postgres::REL_SCHEMA_COL_OID,
                                              postgres::REL_PTR_COL_OID};
 
-  auto pci = classes_->InitializerForProjectedColumns(pg_class_oids, 100);
-  auto pm = classes_->ProjectionMapForOids(pg_class_oids);
+  auto pci = classes_->InitializerForProjectedColumns(pg_class_oids, 100, storage::INITIAL_LAYOUT_VERSION);
+  auto pm = classes_->ProjectionMapForOids(pg_class_oids, storage::INITIAL_LAYOUT_VERSION);
 
   byte *buffer = common::AllocationUtil::AllocateAligned(pci.ProjectedColumnsSize());
   auto pc = pci.Initialize(buffer);
@@ -1349,7 +1436,7 @@ void DatabaseCatalog::TearDown(const common::ManagedPointer<transaction::Transac
   // Scan the table
   auto table_iter = classes_->begin();
   while (table_iter != classes_->end()) {
-    classes_->Scan(txn, &table_iter, pc);
+    classes_->Scan(txn, &table_iter, pc, storage::INITIAL_LAYOUT_VERSION);
     for (uint i = 0; i < pc->NumTuples(); i++) {
       TERRIER_ASSERT(objects[i] != nullptr, "Pointer to objects in pg_class should not be nullptr");
       TERRIER_ASSERT(schemas[i] != nullptr, "Pointer to schemas in pg_class should not be nullptr");
@@ -1370,14 +1457,14 @@ void DatabaseCatalog::TearDown(const common::ManagedPointer<transaction::Transac
 
   // pg_constraint (expressions)
   const std::vector<col_oid_t> pg_constraint_oids{postgres::CONBIN_COL_OID};
-  pci = constraints_->InitializerForProjectedColumns(pg_constraint_oids, 100);
+  pci = constraints_->InitializerForProjectedColumns(pg_constraint_oids, 100, storage::INITIAL_LAYOUT_VERSION);
   pc = pci.Initialize(buffer);
 
   auto exprs = reinterpret_cast<parser::AbstractExpression **>(pc->ColumnStart(0));
 
   table_iter = constraints_->begin();
   while (table_iter != constraints_->end()) {
-    constraints_->Scan(txn, &table_iter, pc);
+    constraints_->Scan(txn, &table_iter, pc, storage::INITIAL_LAYOUT_VERSION);
 
     for (uint i = 0; i < pc->NumTuples(); i++) {
       expressions.emplace_back(exprs[i]);
@@ -1456,7 +1543,7 @@ bool DatabaseCatalog::CreateIndexEntry(const common::ManagedPointer<transaction:
   class_insert_pr->SetNull(index_ptr_offset);
 
   // Insert into pg_class table
-  const auto class_tuple_slot = classes_->Insert(txn, class_insert_redo);
+  const auto class_tuple_slot = classes_->Insert(txn, class_insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // Now we insert into indexes on pg_class
   // Get PR initializers allocate a buffer from the largest one
@@ -1530,7 +1617,7 @@ bool DatabaseCatalog::CreateIndexEntry(const common::ManagedPointer<transaction:
       indexes_insert_pr->AccessForceNotNull(pg_index_all_cols_prm_[postgres::IND_TYPE_COL_OID]))) = schema.type_;
 
   // Insert into pg_index table
-  const auto indexes_tuple_slot = indexes_->Insert(txn, indexes_insert_redo);
+  const auto indexes_tuple_slot = indexes_->Insert(txn, indexes_insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // Now insert into the indexes on pg_index
   // Get PR initializers and allocate a buffer from the largest one
@@ -1581,7 +1668,7 @@ bool DatabaseCatalog::CreateIndexEntry(const common::ManagedPointer<transaction:
 
   update_redo->SetTupleSlot(class_tuple_slot);
   *reinterpret_cast<IndexSchema **>(update_pr->AccessForceNotNull(0)) = new_schema;
-  auto UNUSED_ATTRIBUTE res = classes_->Update(txn, update_redo);
+  auto UNUSED_ATTRIBUTE res = classes_->Update(txn, update_redo, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(res, "Updating an uncommitted insert should not fail");
 
   return true;
@@ -1624,7 +1711,7 @@ void DatabaseCatalog::InsertType(const common::ManagedPointer<transaction::Trans
   *(reinterpret_cast<uint8_t *>(delta->AccessForceNotNull(offset))) = type;
 
   // Insert into table
-  auto tuple_slot = types_->Insert(txn, redo_record);
+  auto tuple_slot = types_->Insert(txn, redo_record, storage::INITIAL_LAYOUT_VERSION);
 
   // Allocate buffer of largest size needed
   TERRIER_ASSERT((types_name_index_->GetProjectedRowInitializer().ProjectedRowSize() >=
@@ -1807,7 +1894,7 @@ bool DatabaseCatalog::CreateTableEntry(const common::ManagedPointer<transaction:
   *(reinterpret_cast<storage::VarlenEntry *>(name_ptr)) = name_varlen;
 
   // Insert into pg_class table
-  const auto tuple_slot = classes_->Insert(txn, insert_redo);
+  const auto tuple_slot = classes_->Insert(txn, insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // Get PR initializers and allocate a buffer from the largest one
   const auto oid_index_init = classes_oid_index_->GetProjectedRowInitializer();
@@ -1860,7 +1947,7 @@ bool DatabaseCatalog::CreateTableEntry(const common::ManagedPointer<transaction:
 
   update_redo->SetTupleSlot(tuple_slot);
   *reinterpret_cast<Schema **>(update_pr->AccessForceNotNull(0)) = new_schema;
-  auto UNUSED_ATTRIBUTE res = classes_->Update(txn, update_redo);
+  auto UNUSED_ATTRIBUTE res = classes_->Update(txn, update_redo, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(res, "Updating an uncommitted insert should not fail");
 
   return true;
@@ -1889,7 +1976,7 @@ std::vector<std::pair<uint32_t, postgres::ClassKind>> DatabaseCatalog::GetNamesp
   std::vector<std::pair<uint32_t, postgres::ClassKind>> ns_objects;
   ns_objects.reserve(index_scan_results.size());
   for (const auto scan_result : index_scan_results) {
-    const auto result UNUSED_ATTRIBUTE = classes_->Select(txn, scan_result, select_pr);
+    const auto result UNUSED_ATTRIBUTE = classes_->Select(txn, scan_result, select_pr, storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(result, "Index already verified visibility. This shouldn't fail.");
     // oid_t is guaranteed to be larger in size than ClassKind, so we know the column offsets without the PR map
     ns_objects.emplace_back(*(reinterpret_cast<const uint32_t *const>(select_pr->AccessWithNullCheck(0))),
@@ -1923,7 +2010,8 @@ std::pair<void *, postgres::ClassKind> DatabaseCatalog::GetClassPtrKind(
       "called with an oid that doesn't exist in the Catalog, but binding somehow succeeded. That doesn't make sense.");
 
   auto *select_pr = get_class_pointer_kind_pri_.InitializeRow(buffer);
-  const auto result UNUSED_ATTRIBUTE = classes_->Select(txn, index_results[0], select_pr);
+  const auto result UNUSED_ATTRIBUTE =
+      classes_->Select(txn, index_results[0], select_pr, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(result, "Index already verified visibility. This shouldn't fail.");
 
   auto *const ptr_ptr = (reinterpret_cast<void *const *const>(select_pr->AccessWithNullCheck(0)));
@@ -1962,7 +2050,8 @@ std::pair<void *, postgres::ClassKind> DatabaseCatalog::GetClassSchemaPtrKind(
       "called with an oid that doesn't exist in the Catalog, but binding somehow succeeded. That doesn't make sense.");
 
   auto *select_pr = get_class_schema_pointer_kind_pri_.InitializeRow(buffer);
-  const auto result UNUSED_ATTRIBUTE = classes_->Select(txn, index_results[0], select_pr);
+  const auto result UNUSED_ATTRIBUTE =
+      classes_->Select(txn, index_results[0], select_pr, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(result, "Index already verified visibility. This shouldn't fail.");
 
   auto *const ptr = *(reinterpret_cast<void *const *const>(select_pr->AccessForceNotNull(0)));
@@ -2053,7 +2142,7 @@ bool DatabaseCatalog::CreateLanguage(const common::ManagedPointer<transaction::T
   redo->Delta()->SetNull(pg_language_all_cols_prm_[postgres::LANVALIDATOR_COL_OID]);
   redo->Delta()->SetNull(pg_language_all_cols_prm_[postgres::LANPLCALLFOID_COL_OID]);
 
-  const auto tuple_slot = languages_->Insert(txn, redo);
+  const auto tuple_slot = languages_->Insert(txn, redo, storage::INITIAL_LAYOUT_VERSION);
 
   // Insert into name index
   auto name_pri = languages_name_index_->GetProjectedRowInitializer();
@@ -2115,7 +2204,7 @@ language_oid_t DatabaseCatalog::GetLanguageOid(const common::ManagedPointer<tran
     // TODO(tanujnay112): Can optimize to not extract all columns.
     // We may need all columns in the future though so doing this for now
     auto all_cols_pr = pg_language_all_cols_pri_.InitializeRow(buffer);
-    languages_->Select(txn, found_tuple, all_cols_pr);
+    languages_->Select(txn, found_tuple, all_cols_pr, storage::INITIAL_LAYOUT_VERSION);
 
     oid = *reinterpret_cast<language_oid_t *>(
         all_cols_pr->AccessForceNotNull(pg_language_all_cols_prm_[postgres::LANOID_COL_OID]));
@@ -2163,7 +2252,7 @@ bool DatabaseCatalog::DropLanguage(const common::ManagedPointer<transaction::Tra
   languages_oid_index_->Delete(txn, *index_pr, to_delete_slot);
 
   auto table_pr = pg_language_all_cols_pri_.InitializeRow(buffer);
-  bool UNUSED_ATTRIBUTE visible = languages_->Select(txn, to_delete_slot, table_pr);
+  bool UNUSED_ATTRIBUTE visible = languages_->Select(txn, to_delete_slot, table_pr, storage::INITIAL_LAYOUT_VERSION);
 
   auto name_varlen = *reinterpret_cast<storage::VarlenEntry *>(
       table_pr->AccessForceNotNull(pg_language_all_cols_prm_[postgres::LANNAME_COL_OID]));
@@ -2276,7 +2365,7 @@ bool DatabaseCatalog::CreateProcedure(const common::ManagedPointer<transaction::
 
   redo->Delta()->SetNull(pg_proc_all_cols_prm_[postgres::PROCONFIG_COL_OID]);
 
-  const auto tuple_slot = procs_->Insert(txn, redo);
+  const auto tuple_slot = procs_->Insert(txn, redo, storage::INITIAL_LAYOUT_VERSION);
 
   auto oid_pri = procs_oid_index_->GetProjectedRowInitializer();
   auto name_pri = procs_name_index_->GetProjectedRowInitializer();
@@ -2339,7 +2428,7 @@ bool DatabaseCatalog::DropProcedure(const common::ManagedPointer<transaction::Tr
   procs_oid_index_->Delete(txn, *oid_pr, to_delete_slot);
 
   auto table_pr = pg_proc_all_cols_pri_.InitializeRow(buffer);
-  bool UNUSED_ATTRIBUTE visible = procs_->Select(txn, to_delete_slot, table_pr);
+  bool UNUSED_ATTRIBUTE visible = procs_->Select(txn, to_delete_slot, table_pr, storage::INITIAL_LAYOUT_VERSION);
 
   auto name_varlen = *reinterpret_cast<storage::VarlenEntry *>(
       table_pr->AccessForceNotNull(pg_proc_all_cols_prm_[postgres::PRONAME_COL_OID]));
@@ -2390,7 +2479,7 @@ proc_oid_t DatabaseCatalog::GetProcOid(common::ManagedPointer<transaction::Trans
     auto found_slot = results[0];
 
     auto table_pr = pg_proc_all_cols_pri_.InitializeRow(buffer);
-    bool UNUSED_ATTRIBUTE visible = procs_->Select(txn, found_slot, table_pr);
+    bool UNUSED_ATTRIBUTE visible = procs_->Select(txn, found_slot, table_pr, storage::INITIAL_LAYOUT_VERSION);
     ret =
         *reinterpret_cast<proc_oid_t *>(table_pr->AccessForceNotNull(pg_proc_all_cols_prm_[postgres::PROOID_COL_OID]));
   }
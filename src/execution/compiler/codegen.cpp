@@ -79,6 +79,14 @@ ast::Expr *CodeGen::OneArgCall(ast::Builtin builtin, ast::Expr *arg) {
   return Factory()->NewBuiltinCallExpr(fun, std::move(args));
 }
 
+ast::Expr *CodeGen::Call(ast::Identifier fn_name, std::vector<ast::Expr *> &&params) {
+  util::RegionVector<ast::Expr *> args{{}, Region()};
+  for (auto &expr : params) {
+    args.emplace_back(expr);
+  }
+  return Factory()->NewCallExpr(MakeExpr(fn_name), std::move(args));
+}
+
 ast::Expr *CodeGen::OneArgCall(ast::Builtin builtin, ast::Identifier ident, bool take_ptr) {
   ast::Expr *arg;
   if (take_ptr) {
@@ -188,6 +196,41 @@ ast::Expr *CodeGen::PCIFilter(ast::Identifier pci, parser::ExpressionType comp_t
   return Factory()->NewBuiltinCallExpr(fun, std::move(args));
 }
 
+ast::Expr *CodeGen::PCIColumnFilter(ast::Identifier pci, parser::ExpressionType comp_type, uint32_t col_idx,
+                                    type::TypeId col_type, uint32_t col_idx_2) {
+  // Call @FilterColComp(pci, col_idx, col_type, col_idx_2)
+  ast::Builtin builtin;
+  switch (comp_type) {
+    case parser::ExpressionType::COMPARE_EQUAL:
+      builtin = ast::Builtin::FilterColEq;
+      break;
+    case parser::ExpressionType::COMPARE_NOT_EQUAL:
+      builtin = ast::Builtin::FilterColNe;
+      break;
+    case parser::ExpressionType::COMPARE_LESS_THAN:
+      builtin = ast::Builtin::FilterColLt;
+      break;
+    case parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO:
+      builtin = ast::Builtin::FilterColLe;
+      break;
+    case parser::ExpressionType::COMPARE_GREATER_THAN:
+      builtin = ast::Builtin::FilterColGt;
+      break;
+    case parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO:
+      builtin = ast::Builtin::FilterColGe;
+      break;
+    default:
+      UNREACHABLE("Impossible filter comparison!");
+  }
+  ast::Expr *fun = BuiltinFunction(builtin);
+  ast::Expr *pci_expr = MakeExpr(pci);
+  ast::Expr *idx_expr = IntLiteral(col_idx);
+  ast::Expr *type_expr = IntLiteral(static_cast<int8_t>(col_type));
+  ast::Expr *idx_2_expr = IntLiteral(col_idx_2);
+  util::RegionVector<ast::Expr *> args{{pci_expr, idx_expr, type_expr, idx_2_expr}, Region()};
+  return Factory()->NewBuiltinCallExpr(fun, std::move(args));
+}
+
 ast::Expr *CodeGen::ExecCtxGetMem() {
   return OneArgCall(ast::Builtin::ExecutionContextGetMemoryPool, exec_ctx_var_, false);
 }
@@ -450,6 +493,11 @@ ast::Expr *CodeGen::ArrayType(uint64_t num_elems, ast::BuiltinType::Kind kind) {
   return Factory()->NewArrayType(DUMMY_POS, IntLiteral(num_elems), BuiltinType(kind));
 }
 
+ast::Expr *CodeGen::ArrayType(uint64_t num_elems, ast::Expr *elem_type) {
+  ast::Expr *len = num_elems == 0 ? nullptr : IntLiteral(num_elems);
+  return Factory()->NewArrayType(DUMMY_POS, len, elem_type);
+}
+
 ast::Expr *CodeGen::ArrayAccess(ast::Identifier arr, uint64_t idx) {
   return Factory()->NewIndexExpr(DUMMY_POS, MakeExpr(arr), IntLiteral(idx));
 }
@@ -7,6 +7,7 @@
 #include "execution/compiler/translator_factory.h"
 #include "execution/sema/sema.h"
 #include "loggers/execution_logger.h"
+#include "planner/plannodes/aggregate_plan_node.h"
 
 namespace terrier::execution::compiler {
 
@@ -76,6 +77,15 @@ void Compiler::MakePipelines(const terrier::planner::AbstractPlanNode &op, Pipel
       // These nodes split in two parts: A "build" side (called bottom) and an "iterate" side (called top).
       auto bottom_translator = TranslatorFactory::CreateBottomTranslator(&op, codegen_);
       auto top_translator = TranslatorFactory::CreateTopTranslator(&op, bottom_translator.get(), codegen_);
+      if (op.GetPlanNodeType() == terrier::planner::PlanNodeType::AGGREGATE &&
+          static_cast<const planner::AggregatePlanNode &>(op).GetAggregateStrategyType() ==
+              planner::AggregateStrategyType::SORTED) {
+        // A sorted aggregation streams over its input instead. Both sides belong to the current pipeline.
+        MakePipelines(*op.GetChild(0), curr_pipeline);
+        curr_pipeline->Add(std::move(bottom_translator));
+        curr_pipeline->Add(std::move(top_translator));
+        return;
+      }
       // The "build" side is a pipeline breaker. It belongs to a new pipeline.
       auto next_pipeline = std::make_unique<Pipeline>(codegen_);
       MakePipelines(*op.GetChild(0), next_pipeline.get());
@@ -1,4 +1,5 @@
 #include "execution/compiler/expression/arithmetic_translator.h"
+#include "execution/compiler/expression/constant_folder.h"
 #include "execution/compiler/translator_factory.h"
 
 namespace terrier::execution::compiler {
@@ -9,6 +10,9 @@ ArithmeticTranslator::ArithmeticTranslator(const terrier::parser::AbstractExpres
       right_(TranslatorFactory::CreateExpressionTranslator(expression_->GetChild(1).Get(), codegen_)) {}
 
 ast::Expr *ArithmeticTranslator::DeriveExpr(ExpressionEvaluator *evaluator) {
+  type::TransientValue folded;
+  if (ConstantFolder::Fold(expression_, &folded)) return codegen_->PeekValue(folded);
+  if (auto *common = evaluator->GetCommonSubexpression(expression_); common != nullptr) return common;
   auto *left_expr = left_->DeriveExpr(evaluator);
   auto *right_expr = right_->DeriveExpr(evaluator);
   parsing::Token::Type op_token;
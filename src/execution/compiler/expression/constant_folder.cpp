@@ -0,0 +1,127 @@
+#include "execution/compiler/expression/constant_folder.h"
+
+#include "parser/expression/constant_value_expression.h"
+#include "type/transient_value_factory.h"
+#include "type/transient_value_peeker.h"
+
+namespace terrier::execution::compiler {
+
+namespace {
+
+bool IsIntegral(const type::TypeId type) {
+  return type == type::TypeId::TINYINT || type == type::TypeId::SMALLINT || type == type::TypeId::INTEGER ||
+         type == type::TypeId::BIGINT;
+}
+
+int64_t PeekIntegral(const type::TransientValue &value) {
+  switch (value.Type()) {
+    case type::TypeId::TINYINT:
+      return type::TransientValuePeeker::PeekTinyInt(value);
+    case type::TypeId::SMALLINT:
+      return type::TransientValuePeeker::PeekSmallInt(value);
+    case type::TypeId::INTEGER:
+      return type::TransientValuePeeker::PeekInteger(value);
+    default:
+      return type::TransientValuePeeker::PeekBigInt(value);
+  }
+}
+
+double PeekReal(const type::TransientValue &value) {
+  if (value.Type() == type::TypeId::DECIMAL) return type::TransientValuePeeker::PeekDecimal(value);
+  return static_cast<double>(PeekIntegral(value));
+}
+
+bool FoldIntegral(const parser::ExpressionType op, const int64_t left, const int64_t right, int64_t *result) {
+  switch (op) {
+    case parser::ExpressionType::OPERATOR_PLUS:
+      return !__builtin_add_overflow(left, right, result);
+    case parser::ExpressionType::OPERATOR_MINUS:
+      return !__builtin_sub_overflow(left, right, result);
+    case parser::ExpressionType::OPERATOR_MULTIPLY:
+      return !__builtin_mul_overflow(left, right, result);
+    case parser::ExpressionType::OPERATOR_DIVIDE:
+      if (right == 0 || (left == INT64_MIN && right == -1)) return false;
+      *result = left / right;
+      return true;
+    case parser::ExpressionType::OPERATOR_MOD:
+      if (right == 0 || (left == INT64_MIN && right == -1)) return false;
+      *result = left % right;
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool FoldReal(const parser::ExpressionType op, const double left, const double right, double *result) {
+  switch (op) {
+    case parser::ExpressionType::OPERATOR_PLUS:
+      *result = left + right;
+      return true;
+    case parser::ExpressionType::OPERATOR_MINUS:
+      *result = left - right;
+      return true;
+    case parser::ExpressionType::OPERATOR_MULTIPLY:
+      *result = left * right;
+      return true;
+    case parser::ExpressionType::OPERATOR_DIVIDE:
+      if (right == 0) return false;
+      *result = left / right;
+      return true;
+    default:
+      // Modulo of reals is left to the runtime
+      return false;
+  }
+}
+
+}  // namespace
+
+bool ConstantFolder::Fold(const parser::AbstractExpression *expression, type::TransientValue *result) {
+  const auto op = expression->GetExpressionType();
+  switch (op) {
+    case parser::ExpressionType::VALUE_CONSTANT: {
+      const auto &value = static_cast<const parser::ConstantValueExpression *>(expression)->GetValue();
+      if (value.Null()) return false;
+      if (value.Type() == type::TypeId::DECIMAL) {
+        *result = type::TransientValueFactory::GetDecimal(type::TransientValuePeeker::PeekDecimal(value));
+        return true;
+      }
+      if (!IsIntegral(value.Type())) return false;
+      *result = type::TransientValueFactory::GetBigInt(PeekIntegral(value));
+      return true;
+    }
+    case parser::ExpressionType::OPERATOR_UNARY_MINUS: {
+      type::TransientValue child;
+      if (!Fold(expression->GetChild(0).Get(), &child)) return false;
+      if (child.Type() == type::TypeId::DECIMAL) {
+        *result = type::TransientValueFactory::GetDecimal(-type::TransientValuePeeker::PeekDecimal(child));
+        return true;
+      }
+      const int64_t val = PeekIntegral(child);
+      if (val == INT64_MIN) return false;
+      *result = type::TransientValueFactory::GetBigInt(-val);
+      return true;
+    }
+    case parser::ExpressionType::OPERATOR_PLUS:
+    case parser::ExpressionType::OPERATOR_MINUS:
+    case parser::ExpressionType::OPERATOR_MULTIPLY:
+    case parser::ExpressionType::OPERATOR_DIVIDE:
+    case parser::ExpressionType::OPERATOR_MOD: {
+      type::TransientValue left, right;
+      if (!Fold(expression->GetChild(0).Get(), &left) || !Fold(expression->GetChild(1).Get(), &right)) return false;
+      if (IsIntegral(left.Type()) && IsIntegral(right.Type())) {
+        int64_t folded;
+        if (!FoldIntegral(op, PeekIntegral(left), PeekIntegral(right), &folded)) return false;
+        *result = type::TransientValueFactory::GetBigInt(folded);
+        return true;
+      }
+      double folded;
+      if (!FoldReal(op, PeekReal(left), PeekReal(right), &folded)) return false;
+      *result = type::TransientValueFactory::GetDecimal(folded);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+}  // namespace terrier::execution::compiler
@@ -0,0 +1,70 @@
+#include "execution/compiler/expression/in_list_translator.h"
+
+#include <algorithm>
+
+#include "execution/compiler/expression/constant_folder.h"
+#include "execution/compiler/translator_factory.h"
+#include "type/transient_value_peeker.h"
+
+namespace terrier::execution::compiler {
+
+InListTranslator::InListTranslator(const terrier::parser::AbstractExpression *expression, CodeGen *codegen)
+    : ExpressionTranslator(expression, codegen),
+      value_(TranslatorFactory::CreateExpressionTranslator(expression_->GetChild(0).Get(), codegen_)) {
+  const auto value_type = expression_->GetChild(0)->GetReturnValueType();
+  bool integral = value_type == type::TypeId::TINYINT || value_type == type::TypeId::SMALLINT ||
+                  value_type == type::TypeId::INTEGER || value_type == type::TypeId::BIGINT;
+  for (size_t i = 1; i < expression_->GetChildrenSize(); i++) {
+    const auto *element = expression_->GetChild(i).Get();
+    elements_.emplace_back(TranslatorFactory::CreateExpressionTranslator(element, codegen_));
+    type::TransientValue folded;
+    if (integral && ConstantFolder::Fold(element, &folded) && folded.Type() == type::TypeId::BIGINT) {
+      constants_.emplace_back(type::TransientValuePeeker::PeekBigInt(folded));
+    } else {
+      integral = false;
+    }
+  }
+
+  if (integral) {
+    std::sort(constants_.begin(), constants_.end());
+    constants_.erase(std::unique(constants_.begin(), constants_.end()), constants_.end());
+  } else {
+    constants_.clear();
+  }
+}
+
+ast::Expr *InListTranslator::DeriveExpr(ExpressionEvaluator *evaluator) {
+  if (!constants_.empty()) return GenSearch(evaluator, 0, constants_.size());
+
+  // (a = b) or (a = c) or ...
+  ast::Expr *result = nullptr;
+  for (auto &element : elements_) {
+    auto *match = codegen_->Compare(parsing::Token::Type::EQUAL_EQUAL, value_->DeriveExpr(evaluator),
+                                    element->DeriveExpr(evaluator));
+    result = result == nullptr ? match : codegen_->BinaryOp(parsing::Token::Type::OR, result, match);
+  }
+  return result;
+}
+
+ast::Expr *InListTranslator::GenSearch(ExpressionEvaluator *evaluator, size_t lo, size_t hi) {
+  if (hi - lo <= LINEAR_SEARCH_MAX) {
+    ast::Expr *result = nullptr;
+    for (size_t i = lo; i < hi; i++) {
+      auto *match = codegen_->Compare(parsing::Token::Type::EQUAL_EQUAL, value_->DeriveExpr(evaluator),
+                                      codegen_->IntToSql(constants_[i]));
+      result = result == nullptr ? match : codegen_->BinaryOp(parsing::Token::Type::OR, result, match);
+    }
+    return result;
+  }
+
+  // (a < mid and <search of the lower half>) or (a >= mid and <search of the upper half>)
+  const size_t mid = lo + (hi - lo) / 2;
+  auto *lower = codegen_->Compare(parsing::Token::Type::LESS, value_->DeriveExpr(evaluator),
+                                  codegen_->IntToSql(constants_[mid]));
+  auto *upper = codegen_->Compare(parsing::Token::Type::GREATER_EQUAL, value_->DeriveExpr(evaluator),
+                                  codegen_->IntToSql(constants_[mid]));
+  return codegen_->BinaryOp(parsing::Token::Type::OR,
+                            codegen_->BinaryOp(parsing::Token::Type::AND, lower, GenSearch(evaluator, lo, mid)),
+                            codegen_->BinaryOp(parsing::Token::Type::AND, upper, GenSearch(evaluator, mid, hi)));
+}
+}  // namespace terrier::execution::compiler
@@ -9,42 +9,37 @@ ParamValueTranslator::ParamValueTranslator(const terrier::parser::AbstractExpres
     : ExpressionTranslator(expression, codegen) {}
 
 ast::Expr *ParamValueTranslator::DeriveExpr(ExpressionEvaluator *evaluator) {
+  // The parameter may have been read once for the whole pipeline
+  if (auto *common = evaluator->GetCommonSubexpression(expression_); common != nullptr) return common;
   auto param_val = GetExpressionAs<terrier::parser::ParameterValueExpression>();
   auto param_idx = param_val->GetValueIdx();
-  ast::Builtin builtin;
-  switch (param_val->GetReturnValueType()) {
+  ast::Builtin builtin = GetParamBuiltin(param_val->GetReturnValueType());
+  return codegen_->BuiltinCall(builtin,
+                               {codegen_->MakeExpr(codegen_->GetExecCtxVar()), codegen_->IntLiteral(param_idx)});
+}
+
+ast::Builtin ParamValueTranslator::GetParamBuiltin(type::TypeId type) {
+  switch (type) {
     case type::TypeId::BOOLEAN:
-      builtin = ast::Builtin::GetParamBool;
-      break;
+      return ast::Builtin::GetParamBool;
     case type::TypeId::TINYINT:
-      builtin = ast::Builtin::GetParamTinyInt;
-      break;
+      return ast::Builtin::GetParamTinyInt;
     case type::TypeId::SMALLINT:
-      builtin = ast::Builtin::GetParamSmallInt;
-      break;
+      return ast::Builtin::GetParamSmallInt;
     case type::TypeId::INTEGER:
-      builtin = ast::Builtin::GetParamInt;
-      break;
+      return ast::Builtin::GetParamInt;
     case type::TypeId::BIGINT:
-      builtin = ast::Builtin::GetParamBigInt;
-      break;
+      return ast::Builtin::GetParamBigInt;
     case type::TypeId::DECIMAL:
-      builtin = ast::Builtin::GetParamDouble;
-      break;
+      return ast::Builtin::GetParamDouble;
     case type::TypeId::DATE:
-      builtin = ast::Builtin::GetParamDate;
-      break;
+      return ast::Builtin::GetParamDate;
     case type::TypeId::TIMESTAMP:
-      builtin = ast::Builtin::GetParamTimestamp;
-      break;
+      return ast::Builtin::GetParamTimestamp;
     case type::TypeId::VARCHAR:
-      builtin = ast::Builtin::GetParamString;
-      break;
+      return ast::Builtin::GetParamString;
     default:
       UNREACHABLE("Unsupported parameter type");
   }
-
-  return codegen_->BuiltinCall(builtin,
-                               {codegen_->MakeExpr(codegen_->GetExecCtxVar()), codegen_->IntLiteral(param_idx)});
 }
 };  // namespace terrier::execution::compiler
@@ -1,4 +1,5 @@
 #include "execution/compiler/expression/unary_translator.h"
+#include "execution/compiler/expression/constant_folder.h"
 #include "execution/compiler/translator_factory.h"
 
 namespace terrier::execution::compiler {
@@ -8,6 +9,9 @@ UnaryTranslator::UnaryTranslator(const terrier::parser::AbstractExpression *expr
       child_(TranslatorFactory::CreateExpressionTranslator(expression->GetChild(0).Get(), codegen)) {}
 
 ast::Expr *UnaryTranslator::DeriveExpr(ExpressionEvaluator *evaluator) {
+  type::TransientValue folded;
+  if (ConstantFolder::Fold(expression_, &folded)) return codegen_->PeekValue(folded);
+  if (auto *common = evaluator->GetCommonSubexpression(expression_); common != nullptr) return common;
   auto *child_expr = child_->DeriveExpr(evaluator);
   parsing::Token::Type op_token;
   switch (expression_->GetExpressionType()) {
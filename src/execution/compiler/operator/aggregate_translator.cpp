@@ -16,7 +16,12 @@ AggregateBottomTranslator::AggregateBottomTranslator(const terrier::planner::Agg
       payload_struct_(codegen->NewIdentifier("AggPayload")),
       agg_payload_(codegen->NewIdentifier("agg_payload")),
       key_check_(codegen->NewIdentifier("aggKeyCheckFn")),
-      agg_ht_(codegen->NewIdentifier("agg_ht")) {}
+      agg_ht_(codegen->NewIdentifier("agg_ht")),
+      iters_(codegen->NewIdentifier("iters")),
+      hash_fn_(codegen->NewIdentifier("aggHashFn")),
+      batch_key_check_(codegen->NewIdentifier("aggBatchKeyCheckFn")),
+      construct_fn_(codegen->NewIdentifier("aggConstructFn")),
+      advance_fn_(codegen->NewIdentifier("aggAdvanceFn")) {}
 
 // Declare the hash table
 void AggregateBottomTranslator::InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) {
@@ -31,9 +36,13 @@ void AggregateBottomTranslator::InitializeStructs(util::RegionVector<ast::Decl *
   GenValuesStruct(decls);
 }
 
-// Create the key check function.
+// Create the key check function, or the batch functions in vectorized pipelines.
 void AggregateBottomTranslator::InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) {
-  GenSingleKeyCheckFn(decls);
+  if (vectorized_pipeline_) {
+    GenBatchFunctions(decls);
+  } else {
+    GenSingleKeyCheckFn(decls);
+  }
 }
 
 // Call @aggHTInit on the hash table
@@ -55,8 +64,13 @@ void AggregateBottomTranslator::Produce(FunctionBuilder *builder) { child_transl
 void AggregateBottomTranslator::Abort(FunctionBuilder *builder) { child_translator_->Abort(builder); }
 
 void AggregateBottomTranslator::Consume(FunctionBuilder *builder) {
+  // In vectorized pipelines, the hash table processes the whole input vector at once.
+  if (vectorized_pipeline_) {
+    GenProcessBatchCall(builder);
+    return;
+  }
   // Generate values to aggregate
-  FillValues(builder);
+  FillValues(builder, true);
   // Hash Call
   GenHashCall(builder);
   // Make Lookup call
@@ -83,6 +97,21 @@ ast::Expr *AggregateBottomTranslator::GetChildOutput(uint32_t child_idx, uint32_
   return child_translator_->GetOutput(attr_idx);
 }
 
+bool AggregateBottomTranslator::IsVectorizable() {
+  for (const auto &term : op_->GetGroupByTerms()) {
+    if (TranslatorFactory::HasParamVal(term.Get())) return false;
+  }
+  for (const auto &term : op_->GetAggregateTerms()) {
+    if (TranslatorFactory::HasParamVal(term.Get())) return false;
+  }
+  return true;
+}
+
+ast::Expr *AggregateBottomTranslator::DeriveGroupByTerm(uint32_t idx) {
+  auto term_translator = TranslatorFactory::CreateExpressionTranslator(op_->GetGroupByTerms()[idx].Get(), codegen_);
+  return term_translator->DeriveExpr(this);
+}
+
 ast::Expr *AggregateBottomTranslator::GetGroupByTerm(ast::Identifier object, uint32_t idx) {
   ast::Identifier member = codegen_->Context()->GetIdentifier(GROUP_BY_TERM_NAMES + std::to_string(idx));
   return codegen_->MemberExpr(object, member);
@@ -157,12 +186,12 @@ void AggregateBottomTranslator::GenValuesStruct(util::RegionVector<ast::Decl *>
 /*
  * Generate the key check logic
  */
-void AggregateBottomTranslator::GenKeyCheck(FunctionBuilder *builder) {
+void AggregateBottomTranslator::GenKeyCheck(FunctionBuilder *builder, bool from_input) {
   // Compare group by terms one by one
   // Generate if (payload.term_i )
   for (uint32_t term_idx = 0; term_idx < op_->GetGroupByTerms().size(); term_idx++) {
     ast::Expr *lhs = GetGroupByTerm(agg_payload_, term_idx);
-    ast::Expr *rhs = GetGroupByTerm(agg_values_, term_idx);
+    ast::Expr *rhs = from_input ? DeriveGroupByTerm(term_idx) : GetGroupByTerm(agg_values_, term_idx);
     ast::Expr *cond = codegen_->Compare(parsing::Token::Type::BANG_EQUAL, lhs, rhs);
     builder->StartIfStmt(cond);
     builder->Append(codegen_->ReturnStmt(codegen_->BoolLiteral(false)));
@@ -173,25 +202,21 @@ void AggregateBottomTranslator::GenKeyCheck(FunctionBuilder *builder) {
 
 /*
  * First declare var agg_values : AggValues
- * For each group by term, generate agg_values.term_i = group_by_term_i
+ * For each group by term, generate agg_values.term_i = group_by_term_i (unless group_by_terms is false)
  * For each aggregation expression, agg_values.expr_i = agg_expr_i
  */
-void AggregateBottomTranslator::FillValues(FunctionBuilder *builder) {
+void AggregateBottomTranslator::FillValues(FunctionBuilder *builder, bool group_by_terms) {
   // First declare var agg_values: AggValues
   builder->Append(codegen_->DeclareVariable(agg_values_, codegen_->MakeExpr(values_struct_), nullptr));
 
   // Add group by terms
-  uint32_t term_idx = 0;
-  for (const auto &term : op_->GetGroupByTerms()) {
+  for (uint32_t term_idx = 0; group_by_terms && term_idx < op_->GetGroupByTerms().size(); term_idx++) {
     // Set agg_values.term_i = group_term_i
     ast::Expr *lhs = GetGroupByTerm(agg_values_, term_idx);
-    auto term_translator = TranslatorFactory::CreateExpressionTranslator(term.Get(), codegen_);
-    ast::Expr *rhs = term_translator->DeriveExpr(this);
-    builder->Append(codegen_->Assign(lhs, rhs));
-    term_idx++;
+    builder->Append(codegen_->Assign(lhs, DeriveGroupByTerm(term_idx)));
   }
   // Add aggregates
-  term_idx = 0;
+  uint32_t term_idx = 0;
   for (const auto &term : op_->GetAggregateTerms()) {
     // Set agg_values.expr_i = agg_expr_i
     ast::Expr *lhs = GetAggTerm(agg_values_, term_idx, false);
@@ -264,20 +289,23 @@ void AggregateBottomTranslator::GenAdvance(FunctionBuilder *builder) {
 
 // Generate var agg_hash_val = @hash(groub_by_term1, group_by_term2, ...)
 void AggregateBottomTranslator::GenHashCall(FunctionBuilder *builder) {
+  // Create the variable declaration
+  builder->Append(codegen_->DeclareVariable(hash_val_, nullptr, MakeHashCall(false)));
+}
+
+// Generate @hash(groub_by_term1, group_by_term2, ...)
+ast::Expr *AggregateBottomTranslator::MakeHashCall(bool from_input) {
   // Create the @hash(group_by_term1, group_by_term2, ...) call
   std::vector<ast::Expr *> hash_args{};
   for (uint32_t term_idx = 0; term_idx < op_->GetGroupByTerms().size(); term_idx++) {
-    hash_args.emplace_back(GetGroupByTerm(agg_values_, term_idx));
+    hash_args.emplace_back(from_input ? DeriveGroupByTerm(term_idx) : GetGroupByTerm(agg_values_, term_idx));
   }
   // TODO(Amadou): In case there is no group by term, we can actually bypass the hash table.
   // For now, I am passing in a constant hash value.
   if (hash_args.empty()) {
     hash_args.emplace_back(codegen_->IntToSql(0));
   }
-  ast::Expr *hash_call = codegen_->BuiltinCall(ast::Builtin::Hash, std::move(hash_args));
-
-  // Create the variable declaration
-  builder->Append(codegen_->DeclareVariable(hash_val_, nullptr, hash_call));
+  return codegen_->BuiltinCall(ast::Builtin::Hash, std::move(hash_args));
 }
 
 void AggregateBottomTranslator::GenSingleKeyCheckFn(util::RegionVector<terrier::execution::ast::Decl *> *decls) {
@@ -295,11 +323,96 @@ void AggregateBottomTranslator::GenSingleKeyCheckFn(util::RegionVector<terrier::
   ast::Expr *ret_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Bool);
   FunctionBuilder builder(codegen_, key_check_, std::move(params), ret_type);
   // Fill up the function
-  GenKeyCheck(&builder);
+  GenKeyCheck(&builder, false);
   // Add it to top level declarations
   decls->emplace_back(builder.Finish());
 }
 
+util::RegionVector<ast::FieldDecl *> AggregateBottomTranslator::BatchParams(bool with_payload) {
+  util::RegionVector<ast::FieldDecl *> params{codegen_->Region()};
+  // agg_payload: *AggPayload
+  if (with_payload) params.emplace_back(codegen_->MakeField(agg_payload_, codegen_->PointerType(payload_struct_)));
+  // iters: [*]*ProjectedColumnsIterator
+  ast::Expr *vec_type = codegen_->BuiltinType(ast::BuiltinType::Kind::ProjectedColumnsIterator);
+  ast::Expr *iters_type = codegen_->ArrayType(0, codegen_->PointerType(vec_type));
+  params.emplace_back(codegen_->MakeField(iters_, iters_type));
+  return params;
+}
+
+void AggregateBottomTranslator::DeclareInputVector(FunctionBuilder *builder) {
+  // The column accesses of the child refer to its vector, so declare it under the same name.
+  ast::Identifier vec = child_translator_->GetVectorIterator();
+  builder->Append(codegen_->DeclareVariable(vec, nullptr, codegen_->ArrayAccess(iters_, 0)));
+}
+
+void AggregateBottomTranslator::GenBatchFunctions(util::RegionVector<ast::Decl *> *decls) {
+  // fun aggHashFn(iters: [*]*ProjectedColumnsIterator) -> uint64 { return @hash(group_by_term1, ...) }
+  {
+    ast::Expr *ret_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Uint64);
+    FunctionBuilder builder(codegen_, hash_fn_, BatchParams(false), ret_type);
+    DeclareInputVector(&builder);
+    builder.Append(codegen_->ReturnStmt(MakeHashCall(true)));
+    decls->emplace_back(builder.Finish());
+  }
+
+  // fun aggBatchKeyCheckFn(agg_payload: *AggPayload, iters: [*]*ProjectedColumnsIterator) -> bool
+  {
+    ast::Expr *ret_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Bool);
+    FunctionBuilder builder(codegen_, batch_key_check_, BatchParams(true), ret_type);
+    DeclareInputVector(&builder);
+    GenKeyCheck(&builder, true);
+    decls->emplace_back(builder.Finish());
+  }
+
+  // fun aggConstructFn(agg_payload: *AggPayload, iters: [*]*ProjectedColumnsIterator) -> nil
+  // The hash table does not advance the groups it creates, so the input tuple is aggregated here as well.
+  {
+    ast::Expr *ret_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Nil);
+    FunctionBuilder builder(codegen_, construct_fn_, BatchParams(true), ret_type);
+    DeclareInputVector(&builder);
+    FillValues(&builder, false);
+    // Set the Aggregate Keys (agg_payload.term_i = group_by_term_i)
+    for (uint32_t term_idx = 0; term_idx < op_->GetGroupByTerms().size(); term_idx++) {
+      builder.Append(codegen_->Assign(GetGroupByTerm(agg_payload_, term_idx), DeriveGroupByTerm(term_idx)));
+    }
+    // Call @aggInit(&agg_payload.expr_i) for each expression
+    for (uint32_t term_idx = 0; term_idx < op_->GetAggregateTerms().size(); term_idx++) {
+      ast::Expr *init_call = codegen_->BuiltinCall(ast::Builtin::AggInit, {GetAggTerm(agg_payload_, term_idx, true)});
+      builder.Append(codegen_->MakeStmt(init_call));
+    }
+    GenAdvance(&builder);
+    decls->emplace_back(builder.Finish());
+  }
+
+  // fun aggAdvanceFn(agg_payload: *AggPayload, iters: [*]*ProjectedColumnsIterator) -> nil
+  {
+    ast::Expr *ret_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Nil);
+    FunctionBuilder builder(codegen_, advance_fn_, BatchParams(true), ret_type);
+    DeclareInputVector(&builder);
+    FillValues(&builder, false);
+    GenAdvance(&builder);
+    decls->emplace_back(builder.Finish());
+  }
+}
+
+void AggregateBottomTranslator::GenProcessBatchCall(FunctionBuilder *builder) {
+  // var iters: [1]*ProjectedColumnsIterator
+  ast::Identifier vec = child_translator_->GetVectorIterator();
+  ast::Expr *vec_type = codegen_->BuiltinType(ast::BuiltinType::Kind::ProjectedColumnsIterator);
+  ast::Expr *iters_type = codegen_->ArrayType(1, codegen_->PointerType(vec_type));
+  builder->Append(codegen_->DeclareVariable(iters_, iters_type, nullptr));
+  // iters[0] = vec
+  builder->Append(codegen_->Assign(codegen_->ArrayAccess(iters_, 0), codegen_->MakeExpr(vec)));
+
+  // @aggHTProcessBatch(&state.agg_ht, &iters, aggHashFn, aggBatchKeyCheckFn, aggConstructFn, aggAdvanceFn, false)
+  std::vector<ast::Expr *> batch_args{codegen_->GetStateMemberPtr(agg_ht_),  codegen_->PointerTo(iters_),
+                                      codegen_->MakeExpr(hash_fn_),          codegen_->MakeExpr(batch_key_check_),
+                                      codegen_->MakeExpr(construct_fn_),     codegen_->MakeExpr(advance_fn_),
+                                      codegen_->BoolLiteral(false)};
+  ast::Expr *batch_call = codegen_->BuiltinCall(ast::Builtin::AggHashTableProcessBatch, std::move(batch_args));
+  builder->Append(codegen_->MakeStmt(batch_call));
+}
+
 ///////////////////////////////////////////////
 ///// Top Translator
 ///////////////////////////////////////////////
@@ -398,4 +511,81 @@ bool AggregateTopTranslator::GenHaving(execution::compiler::FunctionBuilder *bui
   return false;
 }
 
+////////////////////////////////////////
+//// Sorted aggregation
+////////////////////////////////////////
+
+void SortedAggregateBottomTranslator::InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) {
+  GenSingleKeyCheckFn(decls);
+}
+
+void SortedAggregateBottomTranslator::Produce(FunctionBuilder *builder) {
+  DeclareGroup(builder);
+  child_translator_->Produce(builder);
+  // Output the last group
+  builder->StartIfStmt(codegen_->MakeExpr(has_group_));
+  parent_translator_->Consume(builder);
+  builder->FinishBlockStmt();
+}
+
+void SortedAggregateBottomTranslator::Abort(FunctionBuilder *builder) { child_translator_->Abort(builder); }
+
+void SortedAggregateBottomTranslator::Consume(FunctionBuilder *builder) {
+  // Generate values to aggregate
+  FillValues(builder, true);
+  // Output the current group if this tuple starts a new one
+  GenGroupEnd(builder);
+  // Start a new group if needed
+  GenGroupStart(builder);
+  // Advance aggregates
+  GenAdvance(builder);
+}
+
+void SortedAggregateBottomTranslator::DeclareGroup(FunctionBuilder *builder) {
+  builder->Append(codegen_->DeclareVariable(agg_payload_, codegen_->MakeExpr(payload_struct_), nullptr));
+  builder->Append(codegen_->DeclareVariable(has_group_, nullptr, codegen_->BoolLiteral(false)));
+}
+
+void SortedAggregateBottomTranslator::GenGroupEnd(FunctionBuilder *builder) {
+  builder->StartIfStmt(codegen_->MakeExpr(has_group_));
+  // !aggKeyCheckFn(&agg_payload, &agg_values)
+  std::vector<ast::Expr *> key_check_args{codegen_->PointerTo(agg_payload_), codegen_->PointerTo(agg_values_)};
+  ast::Expr *same_group = codegen_->Call(key_check_, std::move(key_check_args));
+  builder->StartIfStmt(codegen_->UnaryOp(parsing::Token::Type::BANG, same_group));
+  parent_translator_->Consume(builder);
+  builder->Append(codegen_->Assign(codegen_->MakeExpr(has_group_), codegen_->BoolLiteral(false)));
+  builder->FinishBlockStmt();
+  builder->FinishBlockStmt();
+}
+
+void SortedAggregateBottomTranslator::GenGroupStart(FunctionBuilder *builder) {
+  builder->StartIfStmt(codegen_->UnaryOp(parsing::Token::Type::BANG, codegen_->MakeExpr(has_group_)));
+  // Set the Aggregate Keys (agg_payload.term_i = agg_value.term_i)
+  for (uint32_t term_idx = 0; term_idx < op_->GetGroupByTerms().size(); term_idx++) {
+    ast::Expr *lhs = GetGroupByTerm(agg_payload_, term_idx);
+    ast::Expr *rhs = GetGroupByTerm(agg_values_, term_idx);
+    builder->Append(codegen_->Assign(lhs, rhs));
+  }
+  // Call @aggInit(&agg_payload.expr_i) for each expression
+  for (uint32_t term_idx = 0; term_idx < op_->GetAggregateTerms().size(); term_idx++) {
+    ast::Expr *init_call = codegen_->BuiltinCall(ast::Builtin::AggInit, {GetAggTerm(agg_payload_, term_idx, true)});
+    builder->Append(codegen_->MakeStmt(init_call));
+  }
+  builder->Append(codegen_->Assign(codegen_->MakeExpr(has_group_), codegen_->BoolLiteral(true)));
+  builder->FinishBlockStmt();
+}
+
+void SortedAggregateTopTranslator::Produce(FunctionBuilder *builder) { child_translator_->Produce(builder); }
+
+void SortedAggregateTopTranslator::Abort(FunctionBuilder *builder) { child_translator_->Abort(builder); }
+
+void SortedAggregateTopTranslator::Consume(FunctionBuilder *builder) {
+  bool has_having = GenHaving(builder);
+  parent_translator_->Consume(builder);
+  // Close having statement
+  if (has_having) {
+    builder->FinishBlockStmt();
+  }
+}
+
 }  // namespace terrier::execution::compiler
@@ -57,8 +57,16 @@ void HashJoinLeftTranslator::InitializeStructs(util::RegionVector<ast::Decl *> *
 
 // Call @joinHTInit on the hash table
 void HashJoinLeftTranslator::InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) {
-  // @joinHTInit(&state.join_table, @execCtxGetMem(execCtx), @sizeOf(BuildRow))
-  ast::Expr *init_call = codegen_->HTInitCall(ast::Builtin::JoinHashTableInit, join_ht_, build_struct_);
+  ast::Expr *init_call;
+  if (op_->UseConciseHashTable()) {
+    // @joinHTInit(&state.join_table, @execCtxGetMem(execCtx), @sizeOf(BuildRow), true)
+    std::vector<ast::Expr *> init_args{codegen_->GetStateMemberPtr(join_ht_), codegen_->ExecCtxGetMem(),
+                                       codegen_->SizeOf(build_struct_), codegen_->BoolLiteral(true)};
+    init_call = codegen_->BuiltinCall(ast::Builtin::JoinHashTableInit, std::move(init_args));
+  } else {
+    // @joinHTInit(&state.join_table, @execCtxGetMem(execCtx), @sizeOf(BuildRow))
+    init_call = codegen_->HTInitCall(ast::Builtin::JoinHashTableInit, join_ht_, build_struct_);
+  }
   // Add it the setup statements
   setup_stmts->emplace_back(codegen_->MakeStmt(init_call));
 }
@@ -146,9 +154,17 @@ HashJoinRightTranslator::HashJoinRightTranslator(const terrier::planner::HashJoi
       probe_struct_{codegen->NewIdentifier("ProbeRow")},
       probe_row_{codegen->NewIdentifier("probe_row")},
       key_check_{codegen->NewIdentifier("joinKeyCheckFn")},
-      join_iter_{codegen->NewIdentifier("join_iter")} {}
+      join_iter_{codegen->NewIdentifier("join_iter")},
+      join_probe_{codegen->NewIdentifier("join_probe")},
+      probe_hash_fn_{codegen->NewIdentifier("joinProbeHashFn")},
+      vec_key_check_{codegen->NewIdentifier("joinVecKeyCheckFn")} {}
 
 void HashJoinRightTranslator::Produce(FunctionBuilder *builder) {
+  // The vector probe lives in the state
+  if (vectorized_pipeline_) {
+    child_translator_->Produce(builder);
+    return;
+  }
   // Declare the iterator
   DeclareIterator(builder);
   // Let right child produce its code
@@ -160,20 +176,37 @@ void HashJoinRightTranslator::Produce(FunctionBuilder *builder) {
 void HashJoinRightTranslator::Abort(FunctionBuilder *builder) {
   child_translator_->Abort(builder);
   // Close iterator
-  GenIteratorClose(builder);
+  if (!vectorized_pipeline_) {
+    GenIteratorClose(builder);
+  }
 }
 
 void HashJoinRightTranslator::Consume(FunctionBuilder *builder) {
-  // Materialize the probe tuple if necessary.
-  if (!is_child_materializer_) {
-    FillProbeRow(builder);
+  if (vectorized_pipeline_) {
+    if (IsFilteringJoin()) {
+      // Filter the whole vector, and loop over the remaining tuples.
+      GenVectorProbeFilter(builder);
+    } else {
+      // Probe the whole vector, and loop over the matches.
+      GenVectorProbeLoop(builder);
+    }
+  } else {
+    // Materialize the probe tuple if necessary.
+    if (!is_child_materializer_) {
+      FillProbeRow(builder);
+    }
+    // Create the right hash_value
+    GenHashValue(builder);
+    if (IsFilteringJoin()) {
+      // Only check whether there is a match.
+      GenProbeCheck(builder);
+    } else {
+      // Generate the probe loop
+      GenProbeLoop(builder);
+      // Get the matching tuple
+      DeclareMatch(builder);
+    }
   }
-  // Create the right hash_value
-  GenHashValue(builder);
-  // Generate the probe loop
-  GenProbeLoop(builder);
-  // Get the matching tuple
-  DeclareMatch(builder);
   // Check left semi join flag.
   if (op_->GetLogicalJoinType() == planner::LogicalJoinType::LEFT_SEMI) {
     GenLeftSemiJoinCondition(builder);
@@ -195,6 +228,11 @@ ast::Expr *HashJoinRightTranslator::GetOutput(uint32_t attr_idx) {
   return translator->DeriveExpr(this);
 }
 
+bool HashJoinRightTranslator::IsFilteringJoin() const {
+  return op_->GetLogicalJoinType() == planner::LogicalJoinType::SEMI ||
+         op_->GetLogicalJoinType() == planner::LogicalJoinType::ANTI;
+}
+
 ast::Expr *HashJoinRightTranslator::GetChildOutput(uint32_t child_idx, uint32_t attr_idx, terrier::type::TypeId type) {
   TERRIER_ASSERT(child_idx <= 1, "A hash join can only have two children.");
   // For the left child, just get the output at the given index
@@ -206,8 +244,8 @@ ast::Expr *HashJoinRightTranslator::GetChildOutput(uint32_t child_idx, uint32_t
 }
 
 ast::Expr *HashJoinRightTranslator::GetProbeValue(uint32_t idx) {
-  // If the right child is a materializer, get its output.
-  if (is_child_materializer_) {
+  // If the right child is a materializer, or the probe is vectorized, get its output.
+  if (is_child_materializer_ || vectorized_pipeline_) {
     return child_translator_->GetOutput(idx);
   }
   // Otherwise get the attribute from the probe row.
@@ -215,10 +253,41 @@ ast::Expr *HashJoinRightTranslator::GetProbeValue(uint32_t idx) {
   return codegen_->MemberExpr(probe_row_, member);
 }
 
+void HashJoinRightTranslator::InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) {
+  if (!vectorized_pipeline_) return;
+  // join_probe : JoinHashTableVectorProbe
+  ast::Expr *probe_type = codegen_->BuiltinType(ast::BuiltinType::Kind::JoinHashTableVectorProbe);
+  state_fields->emplace_back(codegen_->MakeField(join_probe_, probe_type));
+}
+
+// Call @joinHTVecProbeInit on the vector probe
+void HashJoinRightTranslator::InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) {
+  if (!vectorized_pipeline_) return;
+  std::vector<ast::Expr *> init_args{codegen_->GetStateMemberPtr(join_probe_),
+                                     codegen_->GetStateMemberPtr(left_->join_ht_)};
+  ast::Expr *init_call = codegen_->BuiltinCall(ast::Builtin::JoinHashTableVectorProbeInit, std::move(init_args));
+  setup_stmts->emplace_back(codegen_->MakeStmt(init_call));
+}
+
+// Call @joinHTVecProbeFree on the vector probe
+void HashJoinRightTranslator::InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) {
+  if (!vectorized_pipeline_) return;
+  ast::Expr *free_call = codegen_->OneArgStateCall(ast::Builtin::JoinHashTableVectorProbeFree, join_probe_);
+  teardown_stmts->emplace_back(codegen_->MakeStmt(free_call));
+}
+
+bool HashJoinRightTranslator::IsVectorizable() {
+  // Query parameters are read through the execution context, which the vector probe functions don't have.
+  for (const auto &key : op_->GetRightHashKeys()) {
+    if (TranslatorFactory::HasParamVal(key.Get())) return false;
+  }
+  return op_->GetJoinPredicate() == nullptr || !TranslatorFactory::HasParamVal(op_->GetJoinPredicate().Get());
+}
+
 // Make the probe struct if necessary.
 void HashJoinRightTranslator::InitializeStructs(util::RegionVector<ast::Decl *> *decls) {
-  // If the child already materialized it's tuple, do nothing
-  if (is_child_materializer_) return;
+  // If the child already materialized it's tuple, or the probe reads the vector directly, do nothing
+  if (is_child_materializer_ || vectorized_pipeline_) return;
 
   // Otherwise let the struct have a field for each right child attribute.
   util::RegionVector<ast::FieldDecl *> fields{codegen_->Region()};
@@ -228,6 +297,11 @@ void HashJoinRightTranslator::InitializeStructs(util::RegionVector<ast::Decl *>
 
 // Declare a function that checks if the join predicate is true
 void HashJoinRightTranslator::InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) {
+  if (vectorized_pipeline_) {
+    GenVectorProbeFunctions(decls);
+    return;
+  }
+
   // Generate the function type (*State, *ProbeRow, *BuildRow) -> bool
   // State paramater
   ast::Identifier state_variable = codegen_->GetStateVar();
@@ -280,6 +354,87 @@ void HashJoinRightTranslator::GenKeyCheck(FunctionBuilder *builder) {
   }
 }
 
+void HashJoinRightTranslator::GenVectorProbeFunctions(util::RegionVector<ast::Decl *> *decls) {
+  // The probe values are read from the vector, so both functions name their vector parameter like the child's.
+  ast::Expr *pci_type = codegen_->PointerType(codegen_->BuiltinType(ast::BuiltinType::Kind::ProjectedColumnsIterator));
+  ast::Identifier vec = child_translator_->GetVectorIterator();
+
+  // fn joinProbeHashFn(pci: *ProjectedColumnsIterator) -> uint64 { return @hash(right_join_keys) }
+  {
+    util::RegionVector<ast::FieldDecl *> params({codegen_->MakeField(vec, pci_type)}, codegen_->Region());
+    ast::Expr *ret_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Uint64);
+    FunctionBuilder builder(codegen_, probe_hash_fn_, std::move(params), ret_type);
+    std::vector<ast::Expr *> hash_args{};
+    for (const auto &key : op_->GetRightHashKeys()) {
+      std::unique_ptr<ExpressionTranslator> key_translator =
+          TranslatorFactory::CreateExpressionTranslator(key.Get(), codegen_);
+      hash_args.emplace_back(key_translator->DeriveExpr(this));
+    }
+    builder.Append(codegen_->ReturnStmt(codegen_->BuiltinCall(ast::Builtin::Hash, std::move(hash_args))));
+    decls->emplace_back(builder.Finish());
+  }
+
+  // fn joinVecKeyCheckFn(build_row: *BuildRow, pci: *ProjectedColumnsIterator) -> bool
+  {
+    ast::Expr *build_struct_ptr = codegen_->PointerType(left_->build_struct_);
+    util::RegionVector<ast::FieldDecl *> params(
+        {codegen_->MakeField(left_->build_row_, build_struct_ptr), codegen_->MakeField(vec, pci_type)},
+        codegen_->Region());
+    ast::Expr *ret_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Bool);
+    FunctionBuilder builder(codegen_, vec_key_check_, std::move(params), ret_type);
+    GenKeyCheck(&builder);
+    decls->emplace_back(builder.Finish());
+  }
+}
+
+void HashJoinRightTranslator::GenVectorProbeLoop(FunctionBuilder *builder) {
+  // @joinHTVecProbePrepare(&state.join_probe, pci, joinProbeHashFn)
+  std::vector<ast::Expr *> prepare_args{codegen_->GetStateMemberPtr(join_probe_),
+                                        codegen_->MakeExpr(child_translator_->GetVectorIterator()),
+                                        codegen_->MakeExpr(probe_hash_fn_)};
+  ast::Expr *prepare_call =
+      codegen_->BuiltinCall(ast::Builtin::JoinHashTableVectorProbePrepare, std::move(prepare_args));
+  builder->Append(codegen_->MakeStmt(prepare_call));
+
+  // for (var build_row = next_match; build_row != nil; build_row = next_match) {...}
+  ast::Stmt *loop_init = codegen_->DeclareVariable(left_->build_row_, nullptr, GetNextVectorMatch());
+  ast::Expr *loop_cond = codegen_->Compare(parsing::Token::Type::BANG_EQUAL, codegen_->MakeExpr(left_->build_row_),
+                                           codegen_->NilLiteral());
+  ast::Stmt *loop_next = codegen_->Assign(codegen_->MakeExpr(left_->build_row_), GetNextVectorMatch());
+  builder->StartForStmt(loop_init, loop_cond, loop_next);
+}
+
+void HashJoinRightTranslator::GenVectorProbeFilter(FunctionBuilder *builder) {
+  ast::Identifier vec = child_translator_->GetVectorIterator();
+  // @joinHTVecProbePrepare(&state.join_probe, pci, joinProbeHashFn)
+  std::vector<ast::Expr *> prepare_args{codegen_->GetStateMemberPtr(join_probe_), codegen_->MakeExpr(vec),
+                                        codegen_->MakeExpr(probe_hash_fn_)};
+  ast::Expr *prepare_call =
+      codegen_->BuiltinCall(ast::Builtin::JoinHashTableVectorProbePrepare, std::move(prepare_args));
+  builder->Append(codegen_->MakeStmt(prepare_call));
+
+  // @joinHTVecProbeFilter(&state.join_probe, pci, joinVecKeyCheckFn, anti)
+  bool anti = op_->GetLogicalJoinType() == planner::LogicalJoinType::ANTI;
+  std::vector<ast::Expr *> filter_args{codegen_->GetStateMemberPtr(join_probe_), codegen_->MakeExpr(vec),
+                                       codegen_->MakeExpr(vec_key_check_), codegen_->BoolLiteral(anti)};
+  ast::Expr *filter_call = codegen_->BuiltinCall(ast::Builtin::JoinHashTableVectorProbeFilter, std::move(filter_args));
+  builder->Append(codegen_->MakeStmt(filter_call));
+
+  // for (; @pciHasNextFiltered(pci); @pciAdvanceFiltered(pci)) {...}
+  ast::Expr *has_next_call = codegen_->OneArgCall(ast::Builtin::PCIHasNextFiltered, vec, false);
+  ast::Stmt *loop_advance = codegen_->MakeStmt(codegen_->OneArgCall(ast::Builtin::PCIAdvanceFiltered, vec, false));
+  builder->StartForStmt(nullptr, has_next_call, loop_advance);
+}
+
+ast::Expr *HashJoinRightTranslator::GetNextVectorMatch() {
+  std::vector<ast::Expr *> get_next_args{codegen_->GetStateMemberPtr(join_probe_),
+                                         codegen_->MakeExpr(child_translator_->GetVectorIterator()),
+                                         codegen_->MakeExpr(vec_key_check_)};
+  ast::Expr *get_next_call =
+      codegen_->BuiltinCall(ast::Builtin::JoinHashTableVectorProbeGetNext, std::move(get_next_args));
+  return codegen_->PtrCast(left_->build_struct_, get_next_call);
+}
+
 // Set var hash_val = @hash(right_join_keys)
 void HashJoinRightTranslator::GenHashValue(FunctionBuilder *builder) {
   // First create @hash(join_key1, join_key2, ...)
@@ -314,11 +469,31 @@ void HashJoinRightTranslator::DeclareIterator(FunctionBuilder *builder) {
 void HashJoinRightTranslator::GenProbeLoop(FunctionBuilder *builder) {
   // for (@joinHTIterInit(&hti, &state.join_table, hash_val);
   //      @joinHTIterHasNext(&hti, checkJoinKey, execCtx, &lineitem_row);) {...}
+  builder->StartForStmt(GenIteratorInit(), GenIteratorHasNext(), nullptr);
+}
+
+// Check for a match in the hash table
+void HashJoinRightTranslator::GenProbeCheck(FunctionBuilder *builder) {
+  // @joinHTIterInit(&hti, &state.join_table, hash_val)
+  builder->Append(GenIteratorInit());
+  // if (@joinHTIterHasNext(...)) {...} for semi joins, if (!@joinHTIterHasNext(...)) {...} for anti joins
+  ast::Expr *has_next_call = GenIteratorHasNext();
+  if (op_->GetLogicalJoinType() == planner::LogicalJoinType::ANTI) {
+    has_next_call = codegen_->UnaryOp(parsing::Token::Type::BANG, has_next_call);
+  }
+  builder->StartIfStmt(has_next_call);
+}
+
+// @joinHTIterInit(&hti, &state.join_table, hash_val)
+ast::Stmt *HashJoinRightTranslator::GenIteratorInit() {
   std::vector<ast::Expr *> init_args{codegen_->PointerTo(join_iter_), codegen_->GetStateMemberPtr(left_->join_ht_),
                                      codegen_->MakeExpr(hash_val_)};
   ast::Expr *init_call = codegen_->BuiltinCall(ast::Builtin::JoinHashTableIterInit, std::move(init_args));
-  ast::Stmt *loop_init = codegen_->MakeStmt(init_call);
-  // Loop condition
+  return codegen_->MakeStmt(init_call);
+}
+
+// @joinHTIterHasNext(&hti, checkJoinKey, execCtx, &lineitem_row)
+ast::Expr *HashJoinRightTranslator::GenIteratorHasNext() {
   std::vector<ast::Expr *> has_next_args{codegen_->PointerTo(join_iter_), codegen_->MakeExpr(key_check_),
                                          codegen_->MakeExpr(codegen_->GetExecCtxVar())};
   if (is_child_materializer_) {
@@ -331,9 +506,7 @@ void HashJoinRightTranslator::GenProbeLoop(FunctionBuilder *builder) {
     // Otherwise use the constructed probe row.
     has_next_args.emplace_back(codegen_->PointerTo(probe_row_));
   }
-  ast::Expr *has_next_call = codegen_->BuiltinCall(ast::Builtin::JoinHashTableIterHasNext, std::move(has_next_args));
-  // Make the loop
-  builder->StartForStmt(loop_init, has_next_call, nullptr);
+  return codegen_->BuiltinCall(ast::Builtin::JoinHashTableIterHasNext, std::move(has_next_args));
 }
 
 // Call @joinHTIterCLose(&join_iter)
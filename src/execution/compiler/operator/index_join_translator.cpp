@@ -12,7 +12,8 @@ IndexJoinTranslator::IndexJoinTranslator(const planner::IndexJoinPlanNode *op, C
       op_(op),
       input_oids_(op_->CollectInputOids()),
       table_schema_(codegen_->Accessor()->GetSchema(op_->GetTableOid())),
-      table_pm_(codegen_->Accessor()->GetTable(op_->GetTableOid())->ProjectionMapForOids(input_oids_)),
+      table_pm_(codegen_->Accessor()->GetTable(op_->GetTableOid())->ProjectionMapForOids(input_oids_,
+                                                                                         table_schema_.GetVersion())),
       index_schema_(codegen_->Accessor()->GetIndexSchema(op_->GetIndexOid())),
       index_pm_(codegen_->Accessor()->GetIndex(op_->GetIndexOid())->GetKeyOidToOffsetMap()),
       index_iter_(codegen_->NewIdentifier("index_iter")),
@@ -3,6 +3,7 @@
 #include <utility>
 #include <vector>
 
+#include "execution/compiler/expression/param_value_translator.h"
 #include "execution/compiler/function_builder.h"
 #include "execution/compiler/translator_factory.h"
 
@@ -15,7 +16,8 @@ InsertTranslator::InsertTranslator(const terrier::planner::InsertPlanNode *op, C
       col_oids_(codegen->NewIdentifier("col_oids")),
       table_schema_(codegen->Accessor()->GetSchema(op_->GetTableOid())),
       all_oids_(AllColOids(table_schema_)),
-      table_pm_(codegen->Accessor()->GetTable(op_->GetTableOid())->ProjectionMapForOids(all_oids_)),
+      table_pm_(codegen->Accessor()->GetTable(op_->GetTableOid())->ProjectionMapForOids(all_oids_,
+                                                                                        table_schema_.GetVersion())),
       pr_filler_(codegen_, table_schema_, table_pm_, insert_pr_) {}
 
 void InsertTranslator::Produce(FunctionBuilder *builder) {
@@ -30,6 +32,11 @@ void InsertTranslator::Produce(FunctionBuilder *builder) {
 
   // Otherwise, this is a raw insert.
   DeclareInsertPR(builder);
+  if (op_->GetConstantBatch() != nullptr) {
+    GenConstantBatchInsert(builder);
+    GenInserterFree(builder);
+    return;
+  }
   // For each set of values, insert into table and indexes
   for (uint32_t idx = 0; idx < op_->GetBulkInsertCount(); idx++) {
     // Get the table PR
@@ -133,6 +140,39 @@ void InsertTranslator::GenSetTablePR(FunctionBuilder *builder, uint32_t idx) {
   }
 }
 
+void InsertTranslator::GenConstantBatchInsert(FunctionBuilder *builder) {
+  // The batch is stored column by column, and passed to the query as its parameters. So the value of column i in
+  // row r is the parameter i * num_rows + r.
+  // for (var row = 0; row < num_rows; row = row + 1)
+  const auto batch = op_->GetConstantBatch();
+  auto row = codegen_->NewIdentifier("row");
+  ast::Stmt *loop_init = codegen_->DeclareVariable(row, nullptr, codegen_->IntLiteral(0));
+  ast::Expr *loop_cond =
+      codegen_->Compare(parsing::Token::Type::LESS, codegen_->MakeExpr(row), codegen_->IntLiteral(batch->NumRows()));
+  ast::Expr *next_row =
+      codegen_->BinaryOp(parsing::Token::Type::PLUS, codegen_->MakeExpr(row), codegen_->IntLiteral(1));
+  ast::Stmt *loop_update = codegen_->Assign(codegen_->MakeExpr(row), next_row);
+  builder->StartForStmt(loop_init, loop_cond, loop_update);
+  GetInsertPR(builder);
+  for (uint32_t i = 0; i < batch->NumColumns(); i++) {
+    auto table_col_oid = op_->GetColumnOidForValue(i);
+    const auto &table_col = table_schema_.GetColumn(table_col_oid);
+    ast::Expr *param_idx = codegen_->BinaryOp(parsing::Token::Type::PLUS,
+                                              codegen_->IntLiteral(batch->ValueIndex(0, i)), codegen_->MakeExpr(row));
+    ast::Expr *src = codegen_->BuiltinCall(ParamValueTranslator::GetParamBuiltin(table_col.Type()),
+                                           {codegen_->MakeExpr(codegen_->GetExecCtxVar()), param_idx});
+    auto pr_set_call = codegen_->PRSet(codegen_->MakeExpr(insert_pr_), table_col.Type(), table_col.Nullable(),
+                                       table_pm_[table_col_oid], src, true);
+    builder->Append(codegen_->MakeStmt(pr_set_call));
+  }
+  GenTableInsert(builder);
+  const auto &indexes = codegen_->Accessor()->GetIndexOids(op_->GetTableOid());
+  for (auto &index_oid : indexes) {
+    GenIndexInsert(builder, index_oid);
+  }
+  builder->FinishBlockStmt();
+}
+
 void InsertTranslator::GenTableInsert(FunctionBuilder *builder) {
   // var insert_slot = @tableInsert(&inserter_)
   auto insert_slot = codegen_->NewIdentifier("insert_slot");
@@ -0,0 +1,131 @@
+#include "execution/compiler/operator/operator_translator.h"
+
+#include <vector>
+
+#include "execution/compiler/expression/constant_folder.h"
+#include "execution/compiler/function_builder.h"
+#include "execution/compiler/translator_factory.h"
+#include "parser/expression/column_value_expression.h"
+#include "parser/expression/constant_value_expression.h"
+#include "parser/expression/derived_value_expression.h"
+#include "parser/expression/parameter_value_expression.h"
+
+namespace terrier::execution::compiler {
+
+namespace {
+// Whether the expression is made only of constants, query parameters and arithmetic. has_param is set if it has a
+// parameter, otherwise it is a constant expression.
+bool IsParameterOnly(const parser::AbstractExpression *expression, bool *has_param) {
+  const auto type = expression->GetExpressionType();
+  if (type == parser::ExpressionType::VALUE_PARAMETER) {
+    *has_param = true;
+    return true;
+  }
+  if (type == parser::ExpressionType::VALUE_CONSTANT) return true;
+  if (!TranslatorFactory::IsArithmeticOp(type) && !TranslatorFactory::IsUnaryOp(type)) return false;
+  for (const auto &child : expression->GetChildren()) {
+    if (!IsParameterOnly(child.Get(), has_param)) return false;
+  }
+  return true;
+}
+}  // namespace
+
+ast::Expr *OperatorTranslator::GetCommonSubexpression(const terrier::parser::AbstractExpression *expression) {
+  for (const auto &[common, var] : common_subexpressions_) {
+    if (SameValue(expression, common, nullptr)) return codegen_->MakeExpr(var);
+  }
+  for (const auto &[invariant, var] : loop_invariants_) {
+    if (SameValue(expression, invariant, nullptr)) return codegen_->MakeExpr(var);
+  }
+  return nullptr;
+}
+
+ast::Expr *OperatorTranslator::GetCommonOutputSubexpression(const terrier::parser::AbstractExpression *expression) {
+  const auto *outputs = Op()->GetOutputSchema().Get();
+  for (const auto &[common, var] : common_subexpressions_) {
+    if (SameValue(expression, common, outputs)) return codegen_->MakeExpr(var);
+  }
+  return nullptr;
+}
+
+void OperatorTranslator::CollectArithmetic(const terrier::parser::AbstractExpression *expression, bool unconditional,
+                                           std::vector<const terrier::parser::AbstractExpression *> *nodes) {
+  const auto type = expression->GetExpressionType();
+  const bool arithmetic = TranslatorFactory::IsArithmeticOp(type) || TranslatorFactory::IsUnaryOp(type);
+  if (unconditional && TranslatorFactory::IsConjunctionOp(type)) {
+    CollectArithmetic(expression->GetChild(0).Get(), unconditional, nodes);
+    return;
+  }
+  if (unconditional && !arithmetic && !TranslatorFactory::IsComparisonOp(type)) return;
+
+  for (const auto &child : expression->GetChildren()) CollectArithmetic(child.Get(), unconditional, nodes);
+  if (arithmetic) nodes->emplace_back(expression);
+}
+
+bool OperatorTranslator::SameValue(const terrier::parser::AbstractExpression *expression,
+                                   const terrier::parser::AbstractExpression *other,
+                                   const planner::OutputSchema *outputs) {
+  const auto type = expression->GetExpressionType();
+  if (type == parser::ExpressionType::VALUE_TUPLE && outputs != nullptr) {
+    // Compare the output column instead
+    const auto *derived = static_cast<const parser::DerivedValueExpression *>(expression);
+    if (derived->GetTupleIdx() != 0) return false;
+    return SameValue(outputs->GetColumn(derived->GetValueIdx()).GetExpr().Get(), other, nullptr);
+  }
+  if (type != other->GetExpressionType() || expression->GetReturnValueType() != other->GetReturnValueType() ||
+      expression->GetChildrenSize() != other->GetChildrenSize()) {
+    return false;
+  }
+
+  switch (type) {
+    case parser::ExpressionType::VALUE_TUPLE: {
+      const auto *derived = static_cast<const parser::DerivedValueExpression *>(expression);
+      const auto *other_derived = static_cast<const parser::DerivedValueExpression *>(other);
+      return derived->GetTupleIdx() == other_derived->GetTupleIdx() &&
+             derived->GetValueIdx() == other_derived->GetValueIdx();
+    }
+    case parser::ExpressionType::COLUMN_VALUE:
+      return static_cast<const parser::ColumnValueExpression *>(expression)->GetColumnOid() ==
+             static_cast<const parser::ColumnValueExpression *>(other)->GetColumnOid();
+    case parser::ExpressionType::VALUE_PARAMETER:
+      return static_cast<const parser::ParameterValueExpression *>(expression)->GetValueIdx() ==
+             static_cast<const parser::ParameterValueExpression *>(other)->GetValueIdx();
+    case parser::ExpressionType::VALUE_CONSTANT:
+      return static_cast<const parser::ConstantValueExpression *>(expression)->GetValue() ==
+             static_cast<const parser::ConstantValueExpression *>(other)->GetValue();
+    default:
+      break;
+  }
+
+  if (!TranslatorFactory::IsArithmeticOp(type) && !TranslatorFactory::IsUnaryOp(type)) return false;
+  for (uint32_t i = 0; i < expression->GetChildrenSize(); i++) {
+    if (!SameValue(expression->GetChild(i).Get(), other->GetChild(i).Get(), outputs)) return false;
+  }
+  return true;
+}
+
+void OperatorTranslator::DeclareCommonSubexpression(FunctionBuilder *builder,
+                                                    const terrier::parser::AbstractExpression *expression) {
+  auto translator = TranslatorFactory::CreateExpressionTranslator(expression, codegen_);
+  ast::Identifier var = codegen_->NewIdentifier("common");
+  builder->Append(codegen_->DeclareVariable(var, nullptr, translator->DeriveExpr(this)));
+  common_subexpressions_.emplace_back(expression, var);
+}
+
+void OperatorTranslator::HoistLoopInvariants(FunctionBuilder *builder,
+                                             const terrier::parser::AbstractExpression *expression) {
+  bool has_param = false;
+  if (!IsParameterOnly(expression, &has_param)) {
+    for (const auto &child : expression->GetChildren()) HoistLoopInvariants(builder, child.Get());
+    return;
+  }
+
+  // Constant expressions are folded instead
+  if (!has_param || GetCommonSubexpression(expression) != nullptr) return;
+  auto translator = TranslatorFactory::CreateExpressionTranslator(expression, codegen_);
+  ast::Identifier var = codegen_->NewIdentifier("invariant");
+  builder->Append(codegen_->DeclareVariable(var, nullptr, translator->DeriveExpr(this)));
+  loop_invariants_.emplace_back(expression, var);
+}
+
+}  // namespace terrier::execution::compiler
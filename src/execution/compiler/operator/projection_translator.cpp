@@ -0,0 +1,51 @@
+#include "execution/compiler/operator/projection_translator.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "execution/compiler/expression/constant_folder.h"
+#include "execution/compiler/function_builder.h"
+
+namespace terrier::execution::compiler {
+
+void ProjectionTranslator::Consume(FunctionBuilder *builder) {
+  if (!vectorized_pipeline_) DeclareCommonSubexpressions(builder);
+  parent_translator_->Consume(builder);
+  // The variables are only in scope for this tuple
+  common_subexpressions_.clear();
+}
+
+void ProjectionTranslator::DeclareLoopInvariants(FunctionBuilder *builder) {
+  for (const auto &col : op_->GetOutputSchema()->GetColumns()) HoistLoopInvariants(builder, col.GetExpr().Get());
+}
+
+bool ProjectionTranslator::ReusesChildSubexpression(const terrier::parser::AbstractExpression *expression) {
+  if (vectorized_pipeline_) return false;
+  std::vector<const parser::AbstractExpression *> nodes;
+  for (const auto &col : op_->GetOutputSchema()->GetColumns()) CollectArithmetic(col.GetExpr().Get(), false, &nodes);
+  const auto *child_outputs = child_translator_->Op()->GetOutputSchema().Get();
+  return std::any_of(nodes.begin(), nodes.end(),
+                     [&](const auto *node) { return SameValue(node, expression, child_outputs); });
+}
+
+ast::Expr *ProjectionTranslator::GetCommonSubexpression(const terrier::parser::AbstractExpression *expression) {
+  if (auto *common = OperatorTranslator::GetCommonSubexpression(expression); common != nullptr) return common;
+  // The child may have computed it for the current tuple, e.g. in its predicate
+  return child_translator_->GetCommonOutputSubexpression(expression);
+}
+
+void ProjectionTranslator::DeclareCommonSubexpressions(FunctionBuilder *builder) {
+  std::vector<const parser::AbstractExpression *> nodes;
+  for (const auto &col : op_->GetOutputSchema()->GetColumns()) CollectArithmetic(col.GetExpr().Get(), false, &nodes);
+
+  // Inner sub-expressions come first, so an outer one reuses the variables of those it contains
+  type::TransientValue folded;
+  for (uint32_t i = 0; i < nodes.size(); i++) {
+    if (GetCommonSubexpression(nodes[i]) != nullptr || ConstantFolder::Fold(nodes[i], &folded)) continue;
+    bool repeated = false;
+    for (uint32_t j = i + 1; j < nodes.size() && !repeated; j++) repeated = SameValue(nodes[i], nodes[j], nullptr);
+    if (repeated) DeclareCommonSubexpression(builder, nodes[i]);
+  }
+}
+
+}  // namespace terrier::execution::compiler
@@ -1,29 +1,181 @@
 #include "execution/compiler/operator/seq_scan_translator.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <utility>
+#include <vector>
 #include "execution/ast/type.h"
 #include "execution/compiler/codegen.h"
+#include "execution/compiler/expression/constant_folder.h"
 #include "execution/compiler/function_builder.h"
 #include "execution/compiler/pipeline.h"
 #include "execution/compiler/translator_factory.h"
+#include "execution/sql/runtime_types.h"
+#include "parser/expression/column_value_expression.h"
 #include "parser/expression/constant_value_expression.h"
 #include "planner/plannodes/seq_scan_plan_node.h"
+#include "type/transient_value_peeker.h"
+#include "util/time_util.h"
 
 namespace terrier::execution::compiler {
 
+namespace {
+
+// The oid of the column a column value expression refers to
+catalog::col_oid_t ColumnOid(const terrier::parser::AbstractExpression *expr) {
+  return static_cast<const terrier::parser::ColumnValueExpression *>(expr)->GetColumnOid();
+}
+
+// Integers up to this magnitude convert to a double exactly
+constexpr int64_t MAX_EXACT_DOUBLE_INTEGER = int64_t{1} << 53;
+
+// The fixed-width types the vectorized filters support
+bool IsFilterType(terrier::type::TypeId type) {
+  switch (type) {
+    case terrier::type::TypeId::BOOLEAN:
+    case terrier::type::TypeId::TINYINT:
+    case terrier::type::TypeId::SMALLINT:
+    case terrier::type::TypeId::INTEGER:
+    case terrier::type::TypeId::BIGINT:
+    case terrier::type::TypeId::DATE:
+    case terrier::type::TypeId::TIMESTAMP:
+    case terrier::type::TypeId::DECIMAL:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// The value of an integer constant
+bool PeekIntegerValue(const terrier::type::TransientValue &trans_val, int64_t *val) {
+  switch (trans_val.Type()) {
+    case terrier::type::TypeId::TINYINT:
+      *val = terrier::type::TransientValuePeeker::PeekTinyInt(trans_val);
+      return true;
+    case terrier::type::TypeId::SMALLINT:
+      *val = terrier::type::TransientValuePeeker::PeekSmallInt(trans_val);
+      return true;
+    case terrier::type::TypeId::INTEGER:
+      *val = terrier::type::TransientValuePeeker::PeekInteger(trans_val);
+      return true;
+    case terrier::type::TypeId::BIGINT:
+      *val = terrier::type::TransientValuePeeker::PeekBigInt(trans_val);
+      return true;
+    default:
+      return false;
+  }
+}
+
+// The comparison that gives the same result when the operands are swapped
+terrier::parser::ExpressionType FlipComparison(terrier::parser::ExpressionType comp_type) {
+  switch (comp_type) {
+    case terrier::parser::ExpressionType::COMPARE_LESS_THAN:
+      return terrier::parser::ExpressionType::COMPARE_GREATER_THAN;
+    case terrier::parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO:
+      return terrier::parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO;
+    case terrier::parser::ExpressionType::COMPARE_GREATER_THAN:
+      return terrier::parser::ExpressionType::COMPARE_LESS_THAN;
+    case terrier::parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO:
+      return terrier::parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO;
+    default:
+      return comp_type;
+  }
+}
+
+// The comparisons the vectorized filters support
+bool IsFilterComparison(terrier::parser::ExpressionType comp_type) {
+  switch (comp_type) {
+    case terrier::parser::ExpressionType::COMPARE_EQUAL:
+    case terrier::parser::ExpressionType::COMPARE_NOT_EQUAL:
+    case terrier::parser::ExpressionType::COMPARE_LESS_THAN:
+    case terrier::parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO:
+    case terrier::parser::ExpressionType::COMPARE_GREATER_THAN:
+    case terrier::parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
 SeqScanTranslator::SeqScanTranslator(const terrier::planner::SeqScanPlanNode *op, CodeGen *codegen)
     : OperatorTranslator(codegen),
       op_(op),
       schema_(codegen->Accessor()->GetSchema(op_->GetTableOid())),
       input_oids_(MakeInputOids(schema_, op_)),
-      pm_(codegen->Accessor()->GetTable(op_->GetTableOid())->ProjectionMapForOids(input_oids_)),
+      pm_(codegen->Accessor()->GetTable(op_->GetTableOid())->ProjectionMapForOids(input_oids_, schema_.GetVersion())),
       has_predicate_(op_->GetScanPredicate() != nullptr),
-      is_vectorizable_{IsVectorizable(op_->GetScanPredicate().Get())},
+      is_vectorizable_(true),
+      uses_filter_manager_(false),
       tvi_(codegen->NewIdentifier("tvi")),
       col_oids_(codegen->NewIdentifier("col_oids")),
       pci_(codegen->NewIdentifier("pci")),
       slot_(codegen->NewIdentifier("slot")),
-      pci_type_{codegen->Context()->GetIdentifier("ProjectedColumnsIterator")} {}
+      pci_type_{codegen->Context()->GetIdentifier("ProjectedColumnsIterator")},
+      filter_(codegen->NewIdentifier("filter")) {
+  if (has_predicate_) {
+    std::vector<const terrier::parser::AbstractExpression *> conjuncts;
+    CollectConjuncts(op_->GetScanPredicate().Get(), &conjuncts);
+    PlanConjuncts(conjuncts);
+  }
+}
+
+void SeqScanTranslator::DeclareLoopInvariants(FunctionBuilder *builder) {
+  // The filter manager runs its clauses in helper functions, which have no parameters to hoist
+  if (vectorized_pipeline_) return;
+  if (uses_filter_manager_) {
+    for (const auto *conjunct : residual_conjuncts_) HoistLoopInvariants(builder, conjunct);
+  } else if (has_predicate_) {
+    HoistLoopInvariants(builder, op_->GetScanPredicate().Get());
+  }
+  for (const auto &col : op_->GetOutputSchema()->GetColumns()) HoistLoopInvariants(builder, col.GetExpr().Get());
+}
+
+void SeqScanTranslator::InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) {
+  if (!uses_filter_manager_) return;
+  // filter: FilterManager
+  ast::Expr *filter_type = codegen_->BuiltinType(ast::BuiltinType::Kind::FilterManager);
+  state_fields->emplace_back(codegen_->MakeField(filter_, filter_type));
+}
+
+void SeqScanTranslator::InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) {
+  if (!uses_filter_manager_) return;
+  for (const auto &clause : filter_clauses_) {
+    decls->push_back(GenConjunctFunction(clause.tuple_fn_, clause.conjunct_));
+    if (clause.vectorized_) {
+      decls->push_back(GenVectorizedConjunctFunction(clause.vectorized_fn_, clause.conjunct_));
+    }
+  }
+}
+
+void SeqScanTranslator::InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) {
+  if (!uses_filter_manager_) return;
+  // @filterManagerInit(&state.filter)
+  ast::Expr *init_call = codegen_->OneArgStateCall(ast::Builtin::FilterManagerInit, filter_);
+  setup_stmts->emplace_back(codegen_->MakeStmt(init_call));
+
+  // One clause per conjunct, with its flavors: @filterManagerInsertFilter(&state.filter, conjunctVec, conjunct)
+  for (const auto &clause : filter_clauses_) {
+    std::vector<ast::Expr *> insert_args{codegen_->GetStateMemberPtr(filter_)};
+    if (clause.vectorized_) insert_args.emplace_back(codegen_->MakeExpr(clause.vectorized_fn_));
+    insert_args.emplace_back(codegen_->MakeExpr(clause.tuple_fn_));
+    ast::Expr *insert_call = codegen_->BuiltinCall(ast::Builtin::FilterManagerInsertFilter, std::move(insert_args));
+    setup_stmts->emplace_back(codegen_->MakeStmt(insert_call));
+  }
+
+  // @filterManagerFinalize(&state.filter)
+  ast::Expr *finalize_call = codegen_->OneArgStateCall(ast::Builtin::FilterManagerFinalize, filter_);
+  setup_stmts->emplace_back(codegen_->MakeStmt(finalize_call));
+}
+
+void SeqScanTranslator::InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) {
+  if (!uses_filter_manager_) return;
+  // @filterManagerFree(&state.filter)
+  ast::Expr *free_call = codegen_->OneArgStateCall(ast::Builtin::FilterManagerFree, filter_);
+  teardown_stmts->emplace_back(codegen_->MakeStmt(free_call));
+}
 
 void SeqScanTranslator::Produce(FunctionBuilder *builder) {
   SetOids(builder);
@@ -52,14 +204,28 @@ void SeqScanTranslator::DoTableScan(FunctionBuilder *builder) {
   // Start looping over the table
   GenTVILoop(builder);
   DeclarePCI(builder);
+  if (vectorized_pipeline_) {
+    // Let the parent consume the whole (filtered) vector.
+    if (uses_filter_manager_) GenFilterManagerRun(builder);
+    parent_translator_->Consume(builder);
+    // Close TVI loop
+    builder->FinishBlockStmt();
+    return;
+  }
   // The PCI loop depends on whether we vectorize or not.
   bool has_if_stmt = false;
-  if (is_vectorizable_) {
-    if (has_predicate_) GenVectorizedPredicate(builder, op_->GetScanPredicate().Get());
+  if (uses_filter_manager_) {
+    GenFilterManagerRun(builder);
     GenPCILoop(builder);
+    if (!residual_conjuncts_.empty()) {
+      DeclareFilterSubexpressions(builder, residual_conjuncts_.front(), op_->GetScanPredicate().Get());
+      GenResidualCondition(builder);
+      has_if_stmt = true;
+    }
   } else {
     GenPCILoop(builder);
     if (has_predicate_) {
+      DeclareFilterSubexpressions(builder, op_->GetScanPredicate().Get(), op_->GetScanPredicate().Get());
       GenScanCondition(builder);
       has_if_stmt = true;
     }
@@ -68,6 +234,8 @@ void SeqScanTranslator::DoTableScan(FunctionBuilder *builder) {
   DeclareSlot(builder);
   // Let parent consume.
   parent_translator_->Consume(builder);
+  // The variables are only in scope for this tuple
+  common_subexpressions_.clear();
   // Close predicate if statement
   if (has_if_stmt) {
     builder->FinishBlockStmt();
@@ -144,12 +312,10 @@ void SeqScanTranslator::DeclareSlot(FunctionBuilder *builder) {
 void SeqScanTranslator::GenPCILoop(FunctionBuilder *builder) {
   // Generate for(; @pciHasNext(pci); @pciAdvance(pci)) {...} or the Filtered version
   // The HasNext call
-  ast::Builtin has_next_fn =
-      (is_vectorizable_ && has_predicate_) ? ast::Builtin::PCIHasNextFiltered : ast::Builtin::PCIHasNext;
+  ast::Builtin has_next_fn = uses_filter_manager_ ? ast::Builtin::PCIHasNextFiltered : ast::Builtin::PCIHasNext;
   ast::Expr *has_next_call = codegen_->OneArgCall(has_next_fn, pci_, false);
   // The Advance call
-  ast::Builtin advance_fn =
-      (is_vectorizable_ && has_predicate_) ? ast::Builtin::PCIAdvanceFiltered : ast::Builtin::PCIAdvance;
+  ast::Builtin advance_fn = uses_filter_manager_ ? ast::Builtin::PCIAdvanceFiltered : ast::Builtin::PCIAdvance;
   ast::Expr *advance_call = codegen_->OneArgCall(advance_fn, pci_, false);
   ast::Stmt *loop_advance = codegen_->MakeStmt(advance_call);
   // Make the for loop.
@@ -164,6 +330,88 @@ void SeqScanTranslator::GenScanCondition(FunctionBuilder *builder) {
   builder->StartIfStmt(cond);
 }
 
+void SeqScanTranslator::GenResidualCondition(FunctionBuilder *builder) {
+  // Generate tuple at a time condition for the conjuncts the filter manager does not run
+  ast::Expr *cond = nullptr;
+  for (const auto *conjunct : residual_conjuncts_) {
+    auto cond_translator = TranslatorFactory::CreateExpressionTranslator(conjunct, codegen_);
+    ast::Expr *conjunct_cond = cond_translator->DeriveExpr(this);
+    cond = cond == nullptr ? conjunct_cond : codegen_->BinaryOp(parsing::Token::Type::AND, cond, conjunct_cond);
+  }
+  builder->StartIfStmt(cond);
+}
+
+void SeqScanTranslator::DeclareFilterSubexpressions(FunctionBuilder *builder,
+                                                    const terrier::parser::AbstractExpression *condition,
+                                                    const terrier::parser::AbstractExpression *predicate) {
+  // Only the first operand of AND and OR is always evaluated, the rest may be short-circuited
+  std::vector<const terrier::parser::AbstractExpression *> nodes;
+  CollectArithmetic(condition, true, &nodes);
+  std::vector<const terrier::parser::AbstractExpression *> predicate_nodes;
+  CollectArithmetic(predicate, false, &predicate_nodes);
+  std::vector<const terrier::parser::AbstractExpression *> output_nodes;
+  for (const auto &col : op_->GetOutputSchema()->GetColumns()) {
+    CollectArithmetic(col.GetExpr().Get(), false, &output_nodes);
+  }
+
+  // Inner sub-expressions come first, so an outer one reuses the variables of those it contains
+  type::TransientValue folded;
+  for (const auto *node : nodes) {
+    if (GetCommonSubexpression(node) != nullptr || ConstantFolder::Fold(node, &folded)) continue;
+    auto same = [node](const auto *other) { return other != node && SameValue(node, other, nullptr); };
+    bool reused = std::any_of(predicate_nodes.begin(), predicate_nodes.end(), same) ||
+                  std::any_of(output_nodes.begin(), output_nodes.end(), same) ||
+                  parent_translator_->ReusesChildSubexpression(node);
+    if (reused) DeclareCommonSubexpression(builder, node);
+  }
+}
+
+void SeqScanTranslator::GenFilterManagerRun(FunctionBuilder *builder) {
+  // @filtersRun(&state.filter, pci)
+  std::vector<ast::Expr *> run_args{codegen_->GetStateMemberPtr(filter_), codegen_->MakeExpr(pci_)};
+  ast::Expr *run_call = codegen_->BuiltinCall(ast::Builtin::FilterManagerRunFilters, std::move(run_args));
+  builder->Append(codegen_->MakeStmt(run_call));
+}
+
+ast::Decl *SeqScanTranslator::GenConjunctFunction(ast::Identifier fn_name,
+                                                  const terrier::parser::AbstractExpression *conjunct) {
+  // The parameter is named like the scan's pci, so that column accesses resolve to it.
+  ast::FieldDecl *pci_param = codegen_->MakeField(pci_, codegen_->PointerType(pci_type_));
+  ast::Expr *ret_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Int32);
+  util::RegionVector<ast::FieldDecl *> params{{pci_param}, codegen_->Region()};
+  FunctionBuilder builder{codegen_, fn_name, std::move(params), ret_type};
+
+  // var filtered = @pciIsFiltered(pci)
+  ast::Identifier filtered = codegen_->NewIdentifier("filtered");
+  ast::Expr *is_filtered_call = codegen_->OneArgCall(ast::Builtin::PCIIsFiltered, pci_, false);
+  builder.Append(codegen_->DeclareVariable(filtered, nullptr, is_filtered_call));
+
+  // if (filtered) { for (; @pciHasNextFiltered(pci); @pciAdvanceFiltered(pci)) { @pciMatch(pci, cond) } }
+  // if (!filtered) { for (; @pciHasNext(pci); @pciAdvance(pci)) { @pciMatch(pci, cond) } }
+  for (bool is_filtered : {true, false}) {
+    ast::Expr *if_cond = codegen_->MakeExpr(filtered);
+    if (!is_filtered) if_cond = codegen_->UnaryOp(parsing::Token::Type::BANG, if_cond);
+    builder.StartIfStmt(if_cond);
+    ast::Builtin has_next_fn = is_filtered ? ast::Builtin::PCIHasNextFiltered : ast::Builtin::PCIHasNext;
+    ast::Builtin advance_fn = is_filtered ? ast::Builtin::PCIAdvanceFiltered : ast::Builtin::PCIAdvance;
+    ast::Expr *has_next_call = codegen_->OneArgCall(has_next_fn, pci_, false);
+    ast::Stmt *loop_advance = codegen_->MakeStmt(codegen_->OneArgCall(advance_fn, pci_, false));
+    builder.StartForStmt(nullptr, has_next_call, loop_advance);
+    auto cond_translator = TranslatorFactory::CreateExpressionTranslator(conjunct, codegen_);
+    std::vector<ast::Expr *> match_args{codegen_->MakeExpr(pci_), cond_translator->DeriveExpr(this)};
+    builder.Append(codegen_->MakeStmt(codegen_->BuiltinCall(ast::Builtin::PCIMatch, std::move(match_args))));
+    builder.FinishBlockStmt();
+    builder.FinishBlockStmt();
+  }
+
+  // @pciResetFiltered(pci)
+  ast::Expr *reset_call = codegen_->OneArgCall(ast::Builtin::PCIResetFiltered, pci_, false);
+  builder.Append(codegen_->MakeStmt(reset_call));
+  // return 0
+  builder.Append(codegen_->ReturnStmt(codegen_->IntLiteral(0)));
+  return builder.Finish();
+}
+
 void SeqScanTranslator::GenTVIClose(execution::compiler::FunctionBuilder *builder) {
   // Close iterator
   ast::Expr *close_call = codegen_->OneArgCall(ast::Builtin::TableIterClose, tvi_, true);
@@ -176,61 +424,187 @@ void SeqScanTranslator::GenTVIReset(execution::compiler::FunctionBuilder *builde
   builder->Append(codegen_->MakeStmt(reset_call));
 }
 
-bool SeqScanTranslator::IsVectorizable(const terrier::parser::AbstractExpression *predicate) {
-  // TODO(Amadou): Does not currently work with negative numbers so it's commented out.
-  // Once that bug is fixed, comment back in.
-  /*
-  // Recursively walks down the query plan to ensure that predicate has the form ((colX comp int) AND (colY comp int)
-  ...) if (predicate == nullptr) return true;
-
+void SeqScanTranslator::CollectConjuncts(const terrier::parser::AbstractExpression *predicate,
+                                         std::vector<const terrier::parser::AbstractExpression *> *conjuncts) {
   if (predicate->GetExpressionType() == terrier::parser::ExpressionType::CONJUNCTION_AND) {
-    return IsVectorizable(predicate->GetChild(0).Get()) && IsVectorizable(predicate->GetChild(1).Get());
-  }
-  if (TranslatorFactory::IsComparisonOp(predicate->GetExpressionType())) {
-    // left is TVE and right is constant integer.
-    // TODO(Amadou): Add support for floats here and in the SIMD code.
-    // TODO(Amadou): Support right TVE and left constant integers. Be sure to flip inequalities while codegening.
-    return predicate->GetChild(0)->GetExpressionType() == terrier::parser::ExpressionType::COLUMN_VALUE &&
-        predicate->GetChild(1)->GetExpressionType() == terrier::parser::ExpressionType::VALUE_CONSTANT &&
-        (predicate->GetChild(1)->GetReturnValueType() >= terrier::type::TypeId::TINYINT &&
-            predicate->GetChild(1)->GetReturnValueType() <= terrier::type::TypeId::BIGINT);
-  }*/
-  return false;
+    CollectConjuncts(predicate->GetChild(0).Get(), conjuncts);
+    CollectConjuncts(predicate->GetChild(1).Get(), conjuncts);
+  } else {
+    conjuncts->push_back(predicate);
+  }
 }
 
-void SeqScanTranslator::GenVectorizedPredicate(FunctionBuilder *builder,
-                                               const terrier::parser::AbstractExpression *predicate) {
-  if (predicate->GetExpressionType() == terrier::parser::ExpressionType::CONJUNCTION_AND) {
-    GenVectorizedPredicate(builder, predicate->GetChild(0).Get());
-    GenVectorizedPredicate(builder, predicate->GetChild(1).Get());
-  } else if (TranslatorFactory::IsComparisonOp(predicate->GetExpressionType())) {
-    auto left_cve = dynamic_cast<const terrier::parser::ColumnValueExpression *>(predicate->GetChild(0).Get());
-    auto col_idx = pm_[left_cve->GetColumnOid()];
-    auto col_type = schema_.GetColumn(left_cve->GetColumnOid()).Type();
-    auto const_val = dynamic_cast<const terrier::parser::ConstantValueExpression *>(predicate->GetChild(1).Get());
-    auto trans_val = const_val->GetValue();
-    auto type = trans_val.Type();
-    ast::Expr *filter_val;
-    switch (type) {
-      case terrier::type::TypeId::TINYINT:
-        filter_val = codegen_->IntLiteral(terrier::type::TransientValuePeeker::PeekTinyInt(trans_val));
-        break;
-      case terrier::type::TypeId::SMALLINT:
-        filter_val = codegen_->IntLiteral(terrier::type::TransientValuePeeker::PeekSmallInt(trans_val));
-        break;
-      case terrier::type::TypeId::INTEGER:
-        filter_val = codegen_->IntLiteral(terrier::type::TransientValuePeeker::PeekInteger(trans_val));
-        break;
-      case terrier::type::TypeId::BIGINT:
-        filter_val =
-            codegen_->IntLiteral(static_cast<int32_t>(terrier::type::TransientValuePeeker::PeekBigInt(trans_val)));
-        break;
-      default:
-        UNREACHABLE("Impossible vectorized predicate!");
+void SeqScanTranslator::PlanConjuncts(const std::vector<const terrier::parser::AbstractExpression *> &conjuncts) {
+  bool any_vectorized = false;
+  for (const auto *conjunct : conjuncts) {
+    if (TranslatorFactory::HasParamVal(conjunct)) {
+      residual_conjuncts_.push_back(conjunct);
+      continue;
     }
-    ast::Expr *filter_call = codegen_->PCIFilter(pci_, predicate->GetExpressionType(), col_idx, col_type, filter_val);
-    builder->Append(codegen_->MakeStmt(filter_call));
+    bool vectorized = IsVectorizable(conjunct);
+    any_vectorized = any_vectorized || vectorized;
+    filter_clauses_.push_back({conjunct, vectorized, codegen_->NewIdentifier("conjunct"),
+                               vectorized ? codegen_->NewIdentifier("conjunctVec") : ast::Identifier(nullptr)});
   }
-  UNREACHABLE("This function should not be called on non vectorized predicates!");
+
+  // A single tuple at a time clause has nothing to reorder or vectorize, so it is evaluated in the scan loop
+  uses_filter_manager_ = filter_clauses_.size() >= 2 || any_vectorized;
+  if (!uses_filter_manager_) {
+    for (const auto &clause : filter_clauses_) residual_conjuncts_.push_back(clause.conjunct_);
+    filter_clauses_.clear();
+  }
+
+  is_vectorizable_ = residual_conjuncts_.empty();
+}
+
+bool SeqScanTranslator::GetFilterValue(const terrier::parser::AbstractExpression *expr, terrier::type::TypeId col_type,
+                                       int64_t *val) {
+  bool negate = false;
+  if (expr->GetExpressionType() == terrier::parser::ExpressionType::OPERATOR_UNARY_MINUS) {
+    negate = true;
+    expr = expr->GetChild(0).Get();
+  }
+  if (expr->GetExpressionType() != terrier::parser::ExpressionType::VALUE_CONSTANT) return false;
+  const auto &trans_val = static_cast<const terrier::parser::ConstantValueExpression *>(expr)->GetValue();
+  if (trans_val.Null()) return false;
+
+  // Dates and timestamps are compared in the native representation the table stores them in
+  switch (col_type) {
+    case terrier::type::TypeId::BOOLEAN: {
+      if (negate || trans_val.Type() != terrier::type::TypeId::BOOLEAN) return false;
+      *val = terrier::type::TransientValuePeeker::PeekBoolean(trans_val) ? 1 : 0;
+      return true;
+    }
+    case terrier::type::TypeId::DATE: {
+      if (negate || trans_val.Type() != terrier::type::TypeId::DATE) return false;
+      auto ymd = terrier::util::TimeConvertor::YMDFromDate(terrier::type::TransientValuePeeker::PeekDate(trans_val));
+      *val = sql::Date::FromYMD(static_cast<int32_t>(ymd.year()), static_cast<uint32_t>(ymd.month()),
+                                static_cast<uint32_t>(ymd.day()))
+                 .ToNative();
+      return true;
+    }
+    case terrier::type::TypeId::TIMESTAMP: {
+      if (negate || trans_val.Type() != terrier::type::TypeId::TIMESTAMP) return false;
+      auto julian_usec = terrier::util::TimeConvertor::ExtractJulianMicroseconds(
+          terrier::type::TransientValuePeeker::PeekTimestamp(trans_val));
+      *val = static_cast<int64_t>(sql::Timestamp::FromMicroseconds(julian_usec).ToNative());
+      return true;
+    }
+    case terrier::type::TypeId::DECIMAL: {
+      // The filter takes the double's bit pattern
+      double decimal;
+      int64_t integer;
+      if (trans_val.Type() == terrier::type::TypeId::DECIMAL) {
+        decimal = terrier::type::TransientValuePeeker::PeekDecimal(trans_val);
+      } else if (PeekIntegerValue(trans_val, &integer) && integer >= -MAX_EXACT_DOUBLE_INTEGER &&
+                 integer <= MAX_EXACT_DOUBLE_INTEGER) {
+        decimal = static_cast<double>(integer);
+      } else {
+        return false;
+      }
+      if (negate) decimal = -decimal;
+      std::memcpy(val, &decimal, sizeof(double));
+      return true;
+    }
+    default:
+      break;
+  }
+
+  int64_t raw;
+  if (!PeekIntegerValue(trans_val, &raw)) return false;
+  if (negate) {
+    if (raw == std::numeric_limits<int64_t>::min()) return false;
+    raw = -raw;
+  }
+
+  // The filter compares in the column's type, so the value must be representable in it
+  int64_t min, max;
+  switch (col_type) {
+    case terrier::type::TypeId::TINYINT:
+      min = std::numeric_limits<int8_t>::min();
+      max = std::numeric_limits<int8_t>::max();
+      break;
+    case terrier::type::TypeId::SMALLINT:
+      min = std::numeric_limits<int16_t>::min();
+      max = std::numeric_limits<int16_t>::max();
+      break;
+    case terrier::type::TypeId::INTEGER:
+      min = std::numeric_limits<int32_t>::min();
+      max = std::numeric_limits<int32_t>::max();
+      break;
+    case terrier::type::TypeId::BIGINT:
+      min = std::numeric_limits<int64_t>::min();
+      max = std::numeric_limits<int64_t>::max();
+      break;
+    default:
+      return false;
+  }
+  if (raw < min || raw > max) return false;
+  *val = raw;
+  return true;
+}
+
+bool SeqScanTranslator::IsVectorizable(const terrier::parser::AbstractExpression *conjunct) const {
+  if (!IsFilterComparison(conjunct->GetExpressionType())) return false;
+  // The vectorized filters drop NULL values themselves, so nullable columns are fine
+  auto filter_column = [this](const terrier::parser::AbstractExpression *expr) {
+    if (expr->GetExpressionType() != terrier::parser::ExpressionType::COLUMN_VALUE) return false;
+    return IsFilterType(schema_.GetColumn(ColumnOid(expr)).Type());
+  };
+  const auto *left = conjunct->GetChild(0).Get();
+  const auto *right = conjunct->GetChild(1).Get();
+  int64_t val;
+  if (filter_column(left) && filter_column(right)) {
+    // Both columns must have the same type
+    auto left_oid = ColumnOid(left);
+    auto right_oid = ColumnOid(right);
+    return schema_.GetColumn(left_oid).Type() == schema_.GetColumn(right_oid).Type();
+  }
+  if (filter_column(left)) {
+    auto col_oid = ColumnOid(left);
+    return GetFilterValue(right, schema_.GetColumn(col_oid).Type(), &val);
+  }
+  if (filter_column(right)) {
+    auto col_oid = ColumnOid(right);
+    return GetFilterValue(left, schema_.GetColumn(col_oid).Type(), &val);
+  }
+  return false;
+}
+
+ast::Decl *SeqScanTranslator::GenVectorizedConjunctFunction(ast::Identifier fn_name,
+                                                            const terrier::parser::AbstractExpression *conjunct) {
+  ast::FieldDecl *pci_param = codegen_->MakeField(pci_, codegen_->PointerType(pci_type_));
+  ast::Expr *ret_type = codegen_->BuiltinType(ast::BuiltinType::Kind::Int32);
+  util::RegionVector<ast::FieldDecl *> params{{pci_param}, codegen_->Region()};
+  FunctionBuilder builder{codegen_, fn_name, std::move(params), ret_type};
+
+  // Put the column on the left
+  auto comp_type = conjunct->GetExpressionType();
+  const auto *left = conjunct->GetChild(0).Get();
+  const auto *right = conjunct->GetChild(1).Get();
+  if (left->GetExpressionType() != terrier::parser::ExpressionType::COLUMN_VALUE) {
+    std::swap(left, right);
+    comp_type = FlipComparison(comp_type);
+  }
+  auto col_oid = ColumnOid(left);
+  auto col_type = schema_.GetColumn(col_oid).Type();
+
+  ast::Expr *filter_call;
+  if (right->GetExpressionType() == terrier::parser::ExpressionType::COLUMN_VALUE) {
+    // @filterColComp(pci, col_idx, col_type, col_idx_2)
+    auto col_oid_2 = ColumnOid(right);
+    filter_call = codegen_->PCIColumnFilter(pci_, comp_type, pm_[col_oid], col_type, pm_[col_oid_2]);
+  } else {
+    // @filterComp(pci, col_idx, col_type, val)
+    int64_t val = 0;
+    UNUSED_ATTRIBUTE bool valid = GetFilterValue(right, col_type, &val);
+    TERRIER_ASSERT(valid, "Conjunct should be vectorizable");
+    filter_call = codegen_->PCIFilter(pci_, comp_type, pm_[col_oid], col_type, codegen_->IntLiteral(val));
+  }
+  builder.Append(codegen_->MakeStmt(filter_call));
+
+  // return 0
+  builder.Append(codegen_->ReturnStmt(codegen_->IntLiteral(0)));
+  return builder.Finish();
 }
 }  // namespace terrier::execution::compiler
@@ -15,7 +15,8 @@ UpdateTranslator::UpdateTranslator(const terrier::planner::UpdatePlanNode *op, C
       col_oids_(codegen->NewIdentifier("col_oids")),
       table_schema_(codegen->Accessor()->GetSchema(op_->GetTableOid())),
       all_oids_(CollectOids(op)),
-      table_pm_(codegen->Accessor()->GetTable(op_->GetTableOid())->ProjectionMapForOids(all_oids_)),
+      table_pm_(codegen->Accessor()->GetTable(op_->GetTableOid())->ProjectionMapForOids(all_oids_,
+                                                                                        table_schema_.GetVersion())),
       pr_filler_(codegen_, table_schema_, table_pm_, update_pr_) {}
 
 void UpdateTranslator::Produce(FunctionBuilder *builder) {
@@ -17,7 +17,8 @@ void Pipeline::Initialize(util::RegionVector<ast::Decl *> *decls, util::RegionVe
     if (i < pipeline_.size() - 1) parent_translator = pipeline_[i + 1].get();
 
     // Initialize
-    curr_translator->Prepare(child_translator, parent_translator, is_vectorizable_, is_parallelizable_);
+    bool vectorize = is_vectorizable_ && i < num_vectorizable_;
+    curr_translator->Prepare(child_translator, parent_translator, vectorize, is_parallelizable_);
     curr_translator->InitializeStateFields(state_fields);
     curr_translator->InitializeStructs(decls);
     curr_translator->InitializeHelperFunctions(decls);
@@ -39,6 +40,11 @@ ast::Decl *Pipeline::Produce(uint32_t pipeline_idx) {
 
   FunctionBuilder builder{codegen_, fn_name, std::move(params), ret_type};
 
+  // Values that are the same for every tuple are computed before any loop
+  for (const auto &translator : pipeline_) {
+    translator->DeclareLoopInvariants(&builder);
+  }
+
   // for (const auto & translator: pipeline_) {
   pipeline_[pipeline_.size() - 1]->Produce(&builder);
   //}
@@ -9,6 +9,7 @@
 #include "execution/compiler/expression/conjunction_translator.h"
 #include "execution/compiler/expression/constant_translator.h"
 #include "execution/compiler/expression/derived_value_translator.h"
+#include "execution/compiler/expression/in_list_translator.h"
 #include "execution/compiler/expression/null_check_translator.h"
 #include "execution/compiler/expression/param_value_translator.h"
 #include "execution/compiler/expression/star_translator.h"
@@ -63,8 +64,13 @@ std::unique_ptr<OperatorTranslator> TranslatorFactory::CreateRegularTranslator(
 std::unique_ptr<OperatorTranslator> TranslatorFactory::CreateBottomTranslator(
     const terrier::planner::AbstractPlanNode *op, CodeGen *codegen) {
   switch (op->GetPlanNodeType()) {
-    case terrier::planner::PlanNodeType::AGGREGATE:
-      return std::make_unique<AggregateBottomTranslator>(static_cast<const planner::AggregatePlanNode *>(op), codegen);
+    case terrier::planner::PlanNodeType::AGGREGATE: {
+      auto agg_op = static_cast<const planner::AggregatePlanNode *>(op);
+      if (agg_op->GetAggregateStrategyType() == planner::AggregateStrategyType::SORTED) {
+        return std::make_unique<SortedAggregateBottomTranslator>(agg_op, codegen);
+      }
+      return std::make_unique<AggregateBottomTranslator>(agg_op, codegen);
+    }
     case terrier::planner::PlanNodeType::ORDERBY:
       return std::make_unique<SortBottomTranslator>(static_cast<const planner::OrderByPlanNode *>(op), codegen);
     default:
@@ -76,9 +82,13 @@ std::unique_ptr<OperatorTranslator> TranslatorFactory::CreateTopTranslator(const
                                                                            OperatorTranslator *bottom,
                                                                            CodeGen *codegen) {
   switch (op->GetPlanNodeType()) {
-    case terrier::planner::PlanNodeType::AGGREGATE:
-      return std::make_unique<AggregateTopTranslator>(static_cast<const planner::AggregatePlanNode *>(op), codegen,
-                                                      bottom);
+    case terrier::planner::PlanNodeType::AGGREGATE: {
+      auto agg_op = static_cast<const planner::AggregatePlanNode *>(op);
+      if (agg_op->GetAggregateStrategyType() == planner::AggregateStrategyType::SORTED) {
+        return std::make_unique<SortedAggregateTopTranslator>(agg_op, codegen, bottom);
+      }
+      return std::make_unique<AggregateTopTranslator>(agg_op, codegen, bottom);
+    }
     case terrier::planner::PlanNodeType::ORDERBY:
       return std::make_unique<SortTopTranslator>(static_cast<const planner::OrderByPlanNode *>(op), codegen, bottom);
     default:
@@ -119,6 +129,9 @@ std::unique_ptr<ExpressionTranslator> TranslatorFactory::CreateExpressionTransla
   if (IsComparisonOp(type)) {
     return std::make_unique<ComparisonTranslator>(expression, codegen);
   }
+  if (IsInList(type)) {
+    return std::make_unique<InListTranslator>(expression, codegen);
+  }
   if (IsArithmeticOp(type)) {
     return std::make_unique<ArithmeticTranslator>(expression, codegen);
   }
@@ -213,6 +213,12 @@ void Sema::CheckBuiltinFilterCall(ast::CallExpr *call) {
     return;
   }
 
+  // The fourth call argument must be the filter value, or the index of the column to compare with
+  if (!args[3]->IsIntegerLiteral()) {
+    ReportIncorrectCallArg(call, 3, GetBuiltinType(ast::BuiltinType::Int64));
+    return;
+  }
+
   // Set return type
   call->SetType(GetBuiltinType(ast::BuiltinType::Int64));
 }
@@ -569,11 +575,14 @@ void Sema::CheckBuiltinAggregatorCall(ast::CallExpr *call, ast::Builtin builtin)
 }
 
 void Sema::CheckBuiltinJoinHashTableInit(ast::CallExpr *call) {
-  if (!CheckArgCount(call, 3)) {
+  if (!CheckArgCountAtLeast(call, 3)) {
     return;
   }
 
   const auto &args = call->Arguments();
+  if (args.size() > 4 && !CheckArgCount(call, 4)) {
+    return;
+  }
 
   // First argument must be a pointer to a JoinHashTable
   const auto jht_kind = ast::BuiltinType::JoinHashTable;
@@ -595,6 +604,12 @@ void Sema::CheckBuiltinJoinHashTableInit(ast::CallExpr *call) {
     return;
   }
 
+  // Optional fourth argument is a boolean indicating whether to build a concise hash table
+  if (args.size() == 4 && !args[3]->GetType()->IsBoolType()) {
+    ReportIncorrectCallArg(call, 3, GetBuiltinType(ast::BuiltinType::Bool));
+    return;
+  }
+
   // This call returns nothing
   call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
 }
@@ -796,6 +811,94 @@ void Sema::CheckBuiltinJoinHashTableIterClose(execution::ast::CallExpr *call) {
   call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
 }
 
+void Sema::CheckBuiltinJoinHashTableVectorProbeCall(ast::CallExpr *call, ast::Builtin builtin) {
+  if (!CheckArgCountAtLeast(call, 1)) {
+    return;
+  }
+
+  const auto &args = call->Arguments();
+
+  // The first argument is always a pointer to a JoinHashTableVectorProbe
+  const auto probe_kind = ast::BuiltinType::JoinHashTableVectorProbe;
+  if (!IsPointerToSpecificBuiltin(args[0]->GetType(), probe_kind)) {
+    ReportIncorrectCallArg(call, 0, GetBuiltinType(probe_kind)->PointerTo());
+    return;
+  }
+
+  switch (builtin) {
+    case ast::Builtin::JoinHashTableVectorProbeInit: {
+      if (!CheckArgCount(call, 2)) {
+        return;
+      }
+      // The second argument is the JoinHashTable to probe
+      const auto jht_kind = ast::BuiltinType::JoinHashTable;
+      if (!IsPointerToSpecificBuiltin(args[1]->GetType(), jht_kind)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(jht_kind)->PointerTo());
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbePrepare:
+    case ast::Builtin::JoinHashTableVectorProbeGetNext: {
+      if (!CheckArgCount(call, 3)) {
+        return;
+      }
+      // The second argument is the probe vector
+      const auto pci_kind = ast::BuiltinType::ProjectedColumnsIterator;
+      if (!IsPointerToSpecificBuiltin(args[1]->GetType(), pci_kind)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(pci_kind)->PointerTo());
+        return;
+      }
+      // The third argument is the hash function (Prepare) or the key equality function (GetNext)
+      if (!args[2]->GetType()->IsFunctionType()) {
+        ReportIncorrectCallArg(call, 2, "function");
+        return;
+      }
+      // GetNext returns a pointer to the payload of the next match, or nil
+      if (builtin == ast::Builtin::JoinHashTableVectorProbeGetNext) {
+        call->SetType(GetBuiltinType(ast::BuiltinType::Uint8)->PointerTo());
+      } else {
+        call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      }
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbeFilter: {
+      if (!CheckArgCount(call, 4)) {
+        return;
+      }
+      // The second argument is the probe vector
+      const auto pci_kind = ast::BuiltinType::ProjectedColumnsIterator;
+      if (!IsPointerToSpecificBuiltin(args[1]->GetType(), pci_kind)) {
+        ReportIncorrectCallArg(call, 1, GetBuiltinType(pci_kind)->PointerTo());
+        return;
+      }
+      // The third argument is the key equality function
+      if (!args[2]->GetType()->IsFunctionType()) {
+        ReportIncorrectCallArg(call, 2, "function");
+        return;
+      }
+      // The fourth argument tells whether to keep the tuples without a match (anti join)
+      if (!args[3]->GetType()->IsBoolType()) {
+        ReportIncorrectCallArg(call, 3, GetBuiltinType(ast::BuiltinType::Bool));
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbeFree: {
+      if (!CheckArgCount(call, 1)) {
+        return;
+      }
+      call->SetType(GetBuiltinType(ast::BuiltinType::Nil));
+      break;
+    }
+    default: {
+      UNREACHABLE("Impossible join hash table vector probe call");
+    }
+  }
+}
+
 void Sema::CheckBuiltinExecutionContextCall(ast::CallExpr *call, UNUSED_ATTRIBUTE ast::Builtin builtin) {
   if (!CheckArgCount(call, 1)) {
     return;
@@ -2117,7 +2220,13 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
     case ast::Builtin::FilterGt:
     case ast::Builtin::FilterLt:
     case ast::Builtin::FilterNe:
-    case ast::Builtin::FilterLe: {
+    case ast::Builtin::FilterLe:
+    case ast::Builtin::FilterColEq:
+    case ast::Builtin::FilterColGe:
+    case ast::Builtin::FilterColGt:
+    case ast::Builtin::FilterColLt:
+    case ast::Builtin::FilterColNe:
+    case ast::Builtin::FilterColLe: {
       CheckBuiltinFilterCall(call);
       break;
     }
@@ -2255,6 +2364,14 @@ void Sema::CheckBuiltinCall(ast::CallExpr *call) {
       CheckBuiltinJoinHashTableFree(call);
       break;
     }
+    case ast::Builtin::JoinHashTableVectorProbeInit:
+    case ast::Builtin::JoinHashTableVectorProbePrepare:
+    case ast::Builtin::JoinHashTableVectorProbeGetNext:
+    case ast::Builtin::JoinHashTableVectorProbeFilter:
+    case ast::Builtin::JoinHashTableVectorProbeFree: {
+      CheckBuiltinJoinHashTableVectorProbeCall(call, builtin);
+      break;
+    }
     case ast::Builtin::SorterInit: {
       CheckBuiltinSorterInit(call);
       break;
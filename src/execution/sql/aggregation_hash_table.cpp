@@ -264,9 +264,14 @@ void AggregationHashTable::FollowNextLoop(ProjectedColumnsIterator *iters[], uin
     for (uint32_t idx = 0; idx < num_elems; idx++) {
       iters[0]->SetPosition<PCIIsFiltered>(group_sel[idx]);
 
-      const bool keys_match = entries[group_sel[idx]]->hash_ == hashes[group_sel[idx]] &&
-                              key_eq_fn(entries[group_sel[idx]]->payload_, iters);
-      const bool has_next = entries[group_sel[idx]]->next_ != nullptr;
+      HashTableEntry *&entry = entries[group_sel[idx]];
+      const bool keys_match = entry->hash_ == hashes[group_sel[idx]] && key_eq_fn(entry->payload_, iters);
+      const bool has_next = entry->next_ != nullptr;
+
+      // The end of the chain was reached without finding the group: it is created by CreateMissingGroups()
+      if (!keys_match && !has_next) {
+        entry = nullptr;
+      }
 
       group_sel[write_idx] = group_sel[idx];
       write_idx += static_cast<uint32_t>(!keys_match && has_next);
@@ -1,5 +1,7 @@
 #include "execution/sql/filter_manager.h"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <utility>
@@ -71,6 +73,10 @@ void FilterManager::Finalize() {
   for (uint32_t idx = 0; idx < clauses_.size(); idx++) {
     agents_.emplace_back(policy_.get(), ClauseAt(idx)->NumFlavors());
   }
+  stats_.resize(clauses_.size());
+  if (clauses_.size() > 1) {
+    sample_input_ = std::make_unique<ProjectedColumnsIterator::Selection>();
+  }
 
   finalized_ = true;
 }
@@ -78,13 +84,48 @@ void FilterManager::Finalize() {
 void FilterManager::RunFilters(ProjectedColumnsIterator *const pci) {
   TERRIER_ASSERT(finalized_, "Must finalize the filter before it can be used");
 
-  // Execute the clauses in what we currently believe to be the optimal order
+  // Re-sample the clause order if it is time to
+  if (optimal_clause_order_.size() > 1 && pci->NumSelected() > 0) {
+    if (vectors_until_sample_ == 0) {
+      SampleClauses(pci);
+    } else {
+      vectors_until_sample_--;
+    }
+  }
+
+  // Execute the clauses in what we currently believe to be the optimal order.
+  // Once a clause has discarded every tuple, the remaining ones needn't run.
   for (const uint32_t opt_clause_idx : optimal_clause_order_) {
+    if (pci->NumSelected() == 0) {
+      break;
+    }
     RunFilterClause(pci, opt_clause_idx);
   }
 }
 
-void FilterManager::RunFilterClause(ProjectedColumnsIterator *const pci, const uint32_t clause_index) {
+void FilterManager::SampleClauses(ProjectedColumnsIterator *const pci) {
+  // Every clause runs over the same input, so that its selectivity is not
+  // skewed by the clauses that would run before it
+  const uint32_t num_input = pci->NumSelected();
+  pci->SaveSelection(sample_input_.get());
+  for (uint32_t clause_idx = 0; clause_idx < clauses_.size(); clause_idx++) {
+    const double exec_ms = RunFilterClause(pci, clause_idx);
+    stats_[clause_idx].cost_per_tuple_ = exec_ms / num_input;
+    stats_[clause_idx].selectivity_ = static_cast<double>(pci->NumSelected()) / num_input;
+    pci->RestoreSelection(*sample_input_);
+  }
+
+  // Sample less often while the order holds, and right away again once it
+  // changed since the data has shifted
+  if (ReorderClauses()) {
+    sample_interval_ = MIN_SAMPLE_INTERVAL;
+  } else {
+    sample_interval_ = std::min(sample_interval_ * 2, MAX_SAMPLE_INTERVAL);
+  }
+  vectors_until_sample_ = sample_interval_ - 1;
+}
+
+double FilterManager::RunFilterClause(ProjectedColumnsIterator *const pci, const uint32_t clause_index) {
   //
   // This function will execute the clause at the given clause index. But, we'll
   // be smart about it. We'll use our multi-armed bandit agent to predict the
@@ -110,6 +151,27 @@ void FilterManager::RunFilterClause(ProjectedColumnsIterator *const pci, const u
   double reward = bandit::MultiArmedBandit::ExecutionTimeToReward(exec_ms);
   agent->Observe(reward);
   EXECUTION_LOG_DEBUG("Clause {} observed reward {}", clause_index, reward);
+  return exec_ms;
+}
+
+bool FilterManager::ReorderClauses() {
+  //
+  // The expected cost of a clause order is minimized by running the clauses in
+  // ascending order of cost / (1 - selectivity).
+  //
+  const auto rank = [this](const uint32_t clause_index) {
+    const ClauseStats &stats = stats_[clause_index];
+    const double discarded = 1.0 - stats.selectivity_;
+    if (discarded <= 0.0) {
+      return std::numeric_limits<double>::max();
+    }
+    return stats.cost_per_tuple_ / discarded;
+  };
+
+  const std::vector<uint32_t> previous_order = optimal_clause_order_;
+  std::stable_sort(optimal_clause_order_.begin(), optimal_clause_order_.end(),
+                   [&rank](const uint32_t a, const uint32_t b) { return rank(a) < rank(b); });
+  return optimal_clause_order_ != previous_order;
 }
 
 std::pair<uint32_t, double> FilterManager::RunFilterClauseImpl(ProjectedColumnsIterator *const pci,
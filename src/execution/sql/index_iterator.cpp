@@ -9,13 +9,14 @@ IndexIterator::IndexIterator(exec::ExecutionContext *exec_ctx, uint32_t num_attr
       num_attrs_(num_attrs),
       col_oids_(col_oids, col_oids + num_oids),
       index_(exec_ctx_->GetAccessor()->GetIndex(catalog::index_oid_t(index_oid))),
-      table_(exec_ctx_->GetAccessor()->GetTable(catalog::table_oid_t(table_oid))) {}
+      table_(exec_ctx_->GetAccessor()->GetTable(catalog::table_oid_t(table_oid))),
+      layout_version_(exec_ctx_->GetAccessor()->GetSchema(catalog::table_oid_t(table_oid)).GetVersion()) {}
 
 void IndexIterator::Init() {
   // Initialize projected rows for the index and the table
   TERRIER_ASSERT(!col_oids_.empty(), "There must be at least one col oid!");
   // Table's PR
-  auto table_pri = table_->InitializerForProjectedRow(col_oids_);
+  auto table_pri = table_->InitializerForProjectedRow(col_oids_, layout_version_);
   table_buffer_ = exec_ctx_->GetMemoryPool()->AllocateAligned(table_pri.ProjectedRowSize(), alignof(uint64_t), false);
   table_pr_ = table_pri.InitializeRow(table_buffer_);
 
@@ -65,7 +66,7 @@ bool IndexIterator::Advance() {
 }
 
 storage::ProjectedRow *IndexIterator::TablePR() {
-  table_->Select(exec_ctx_->GetTxn(), tuples_[curr_index_ - 1], table_pr_);
+  table_->Select(exec_ctx_->GetTxn(), tuples_[curr_index_ - 1], table_pr_, layout_version_);
   return table_pr_;
 }
 
@@ -33,4 +33,20 @@ void JoinHashTableVectorProbe::Prepare(ProjectedColumnsIterator *pci, const Hash
   table_.LookupBatch(pci->NumSelected(), hashes_, entries_);
 }
 
+void JoinHashTableVectorProbe::FilterMatches(ProjectedColumnsIterator *pci, const KeyEqFn key_eq_fn, const bool anti) {
+  // The filter visits the selected tuples in the order Prepare() hashed them
+  uint32_t idx = 0;
+  pci->RunFilter([&]() {
+    bool matched = false;
+    for (const auto *entry = entries_[idx]; entry != nullptr; entry = entry->next_) {
+      if (entry->hash_ == hashes_[idx] && key_eq_fn(entry->payload_, pci)) {
+        matched = true;
+        break;
+      }
+    }
+    idx++;
+    return matched != anti;
+  });
+}
+
 }  // namespace terrier::execution::sql
@@ -42,6 +42,10 @@ uint32_t ProjectedColumnsIterator::FilterColByColImpl(const uint32_t col_idx_1,
   // filtered out in this filter.
   ResetFiltered();
 
+  // The filter compared whatever bytes sit in the slots of NULL values
+  RemoveNulls(col_idx_1);
+  RemoveNulls(col_idx_2);
+
   // After the call to ResetFiltered(), num_selected_ should indicate the number
   // of valid tuples in the filter.
   return NumSelected();
@@ -66,15 +70,36 @@ uint32_t ProjectedColumnsIterator::FilterColByValImpl(uint32_t col_idx, T val) {
   // filtered out in this filter.
   ResetFiltered();
 
+  // The filter compared whatever bytes sit in the slots of NULL values
+  RemoveNulls(col_idx);
+
   // After the call to ResetFiltered(), num_selected_ should indicate the number
   // of valid tuples in the filter.
   return NumSelected();
 }
 
+void ProjectedColumnsIterator::RemoveNulls(const uint32_t col_idx) {
+  TERRIER_ASSERT(IsFiltered() || num_selected_ == 0, "Nulls are removed from a filtered PCI");
+  const common::RawBitmap *null_bitmap = projected_column_->ColumnNullBitmap(static_cast<uint16_t>(col_idx));
+
+  // Compact the selection vector in place, a set bit means the value is not NULL
+  uint32_t num_not_null = 0;
+  for (uint32_t i = 0; i < num_selected_; i++) {
+    const uint32_t idx = selection_vector_[i];
+    selection_vector_[num_not_null] = idx;
+    num_not_null += null_bitmap->Test(idx) ? 1 : 0;
+  }
+  num_selected_ = num_not_null;
+  curr_idx_ = selection_vector_[0];
+}
+
 // Filter an entire column's data by the provided constant value
 template <template <typename> typename Op>
 uint32_t ProjectedColumnsIterator::FilterColByVal(uint32_t col_idx, type::TypeId type, FilterVal val) {
   switch (type) {
+    case type::TypeId::TINYINT: {
+      return FilterColByValImpl<int8_t, Op>(col_idx, val.ti_);
+    }
     case type::TypeId::SMALLINT: {
       return FilterColByValImpl<int16_t, Op>(col_idx, val.si_);
     }
@@ -84,6 +109,18 @@ uint32_t ProjectedColumnsIterator::FilterColByVal(uint32_t col_idx, type::TypeId
     case type::TypeId::BIGINT: {
       return FilterColByValImpl<int64_t, Op>(col_idx, val.bi_);
     }
+    case type::TypeId::BOOLEAN: {
+      return FilterColByValImpl<bool, Op>(col_idx, val.b_);
+    }
+    case type::TypeId::DATE: {
+      return FilterColByValImpl<uint32_t, Op>(col_idx, val.date_);
+    }
+    case type::TypeId::TIMESTAMP: {
+      return FilterColByValImpl<uint64_t, Op>(col_idx, val.ts_);
+    }
+    case type::TypeId::DECIMAL: {
+      return FilterColByValImpl<double, Op>(col_idx, val.d_);
+    }
     default: {
       throw std::runtime_error("Filter not supported on type");
     }
@@ -96,6 +133,9 @@ uint32_t ProjectedColumnsIterator::FilterColByCol(const uint32_t col_idx_1, type
   TERRIER_ASSERT(type_1 == type_2, "Incompatible column types for filter");
 
   switch (type_1) {
+    case type::TypeId::TINYINT: {
+      return FilterColByColImpl<int8_t, Op>(col_idx_1, col_idx_2);
+    }
     case type::TypeId::SMALLINT: {
       return FilterColByColImpl<int16_t, Op>(col_idx_1, col_idx_2);
     }
@@ -105,6 +145,18 @@ uint32_t ProjectedColumnsIterator::FilterColByCol(const uint32_t col_idx_1, type
     case type::TypeId::BIGINT: {
       return FilterColByColImpl<int64_t, Op>(col_idx_1, col_idx_2);
     }
+    case type::TypeId::BOOLEAN: {
+      return FilterColByColImpl<bool, Op>(col_idx_1, col_idx_2);
+    }
+    case type::TypeId::DATE: {
+      return FilterColByColImpl<uint32_t, Op>(col_idx_1, col_idx_2);
+    }
+    case type::TypeId::TIMESTAMP: {
+      return FilterColByColImpl<uint64_t, Op>(col_idx_1, col_idx_2);
+    }
+    case type::TypeId::DECIMAL: {
+      return FilterColByColImpl<double, Op>(col_idx_1, col_idx_2);
+    }
     default: {
       throw std::runtime_error("Filter not supported on type");
     }
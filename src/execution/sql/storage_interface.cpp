@@ -1,6 +1,7 @@
 #include "execution/sql/storage_interface.h"
 
 #include <algorithm>
+#include <cstring>
 #include <vector>
 
 #include "execution/exec/execution_context.h"
@@ -12,6 +13,7 @@ StorageInterface::StorageInterface(exec::ExecutionContext *exec_ctx, catalog::ta
                                    uint32_t num_oids, bool need_indexes)
     : table_oid_{table_oid},
       table_(exec_ctx->GetAccessor()->GetTable(table_oid)),
+      layout_version_(exec_ctx->GetAccessor()->GetSchema(table_oid).GetVersion()),
       exec_ctx_(exec_ctx),
       col_oids_(col_oids, col_oids + num_oids),
       need_indexes_(need_indexes) {
@@ -35,7 +37,7 @@ StorageInterface::~StorageInterface() {
 
 storage::ProjectedRow *StorageInterface::GetTablePR() {
   // We need all the columns
-  storage::ProjectedRowInitializer pri = table_->InitializerForProjectedRow(col_oids_);
+  storage::ProjectedRowInitializer pri = table_->InitializerForProjectedRow(col_oids_, layout_version_);
   auto txn = exec_ctx_->GetTxn();
   table_redo_ = txn->StageWrite(exec_ctx_->DBOid(), table_oid_, pri);
   return table_redo_->Delta();
@@ -49,7 +51,7 @@ storage::ProjectedRow *StorageInterface::GetIndexPR(catalog::index_oid_t index_o
 
 storage::TupleSlot StorageInterface::TableInsert() {
   exec_ctx_->RowsAffected()++;  // believe this should only happen in root plan nodes, so should reflect count of query
-  return table_->Insert(exec_ctx_->GetTxn(), table_redo_);
+  return table_->Insert(exec_ctx_->GetTxn(), table_redo_, layout_version_);
 }
 
 bool StorageInterface::TableDelete(storage::TupleSlot table_tuple_slot) {
@@ -62,7 +64,51 @@ bool StorageInterface::TableDelete(storage::TupleSlot table_tuple_slot) {
 bool StorageInterface::TableUpdate(storage::TupleSlot table_tuple_slot) {
   exec_ctx_->RowsAffected()++;  // believe this should only happen in root plan nodes, so should reflect count of query
   table_redo_->SetTupleSlot(table_tuple_slot);
-  return table_->Update(exec_ctx_->GetTxn(), table_redo_);
+  storage::TupleSlot new_slot;
+  if (!table_->Update(exec_ctx_->GetTxn(), table_redo_, layout_version_, &new_slot)) return false;
+  if (new_slot != table_tuple_slot) MoveIndexEntries(table_tuple_slot, new_slot);
+  return true;
+}
+
+void StorageInterface::MoveIndexEntries(const storage::TupleSlot old_slot, const storage::TupleSlot new_slot) {
+  auto *const accessor = exec_ctx_->GetAccessor();
+  for (const auto index_oid : accessor->GetIndexOids(table_oid_)) {
+    const auto index = accessor->GetIndex(index_oid);
+    const auto &index_schema = accessor->GetIndexSchema(index_oid);
+    const auto &indexed_oids = index_schema.GetIndexedColOids();
+
+    // The keys did not change, so read them back from the moved tuple
+    const auto table_pri = table_->InitializerForProjectedRow(indexed_oids, layout_version_);
+    const auto table_pm = table_->ProjectionMapForOids(indexed_oids, layout_version_);
+    const auto &index_pri = index->GetProjectedRowInitializer();
+    auto *const table_buffer = common::AllocationUtil::AllocateAligned(table_pri.ProjectedRowSize());
+    auto *const index_buffer = common::AllocationUtil::AllocateAligned(index_pri.ProjectedRowSize());
+    auto *const table_pr = table_pri.InitializeRow(table_buffer);
+    auto *const index_pr = index_pri.InitializeRow(index_buffer);
+    const bool UNUSED_ATTRIBUTE selected = table_->Select(exec_ctx_->GetTxn(), new_slot, table_pr, layout_version_);
+    TERRIER_ASSERT(selected, "The txn that moved the tuple must see it.");
+
+    // Like recovery, assume every index key is a plain column of the table
+    for (uint32_t col_idx = 0; col_idx < index_schema.GetColumns().size(); col_idx++) {
+      const auto &col = index_schema.GetColumn(col_idx);
+      const auto key_offset = index->GetKeyOidToOffsetMap().at(col.Oid());
+      const auto table_offset = table_pm.at(indexed_oids[col_idx]);
+      if (table_pr->IsNull(table_offset)) {
+        index_pr->SetNull(key_offset);
+      } else {
+        std::memcpy(index_pr->AccessForceNotNull(key_offset), table_pr->AccessWithNullCheck(table_offset),
+                    storage::AttrSizeBytes(col.AttrSize()));
+      }
+    }
+
+    index->Delete(exec_ctx_->GetTxn(), *index_pr, old_slot);
+    const bool UNUSED_ATTRIBUTE inserted = index_schema.Unique()
+                                               ? index->InsertUnique(exec_ctx_->GetTxn(), *index_pr, new_slot)
+                                               : index->Insert(exec_ctx_->GetTxn(), *index_pr, new_slot);
+    TERRIER_ASSERT(inserted, "The old entry of the same key was just deleted.");
+    delete[] table_buffer;
+    delete[] index_buffer;
+  }
 }
 
 bool StorageInterface::IndexInsert() {
@@ -23,10 +23,12 @@ bool TableVectorIterator::Init() {
   // Find the table
   table_ = exec_ctx_->GetAccessor()->GetTable(table_oid_);
   TERRIER_ASSERT(table_ != nullptr, "Table must exist!!");
+  layout_version_ = exec_ctx_->GetAccessor()->GetSchema(table_oid_).GetVersion();
 
   // Initialize the projected column
   TERRIER_ASSERT(!col_oids_.empty(), "There must be at least one col oid!");
-  auto pc_init = table_->InitializerForProjectedColumns(col_oids_, common::Constants::K_DEFAULT_VECTOR_SIZE);
+  auto pc_init = table_->InitializerForProjectedColumns(col_oids_, common::Constants::K_DEFAULT_VECTOR_SIZE,
+                                                      layout_version_);
   buffer_ = exec_ctx_->GetMemoryPool()->AllocateAligned(pc_init.ProjectedColumnsSize(), alignof(uint64_t), false);
   projected_columns_ = pc_init.Initialize(buffer_);
   initialized_ = true;
@@ -43,7 +45,7 @@ bool TableVectorIterator::Advance() {
     return false;
   }
   // Scan the table to set the projected column.
-  table_->Scan(exec_ctx_->GetTxn(), iter_.get(), projected_columns_);
+  table_->Scan(exec_ctx_->GetTxn(), iter_.get(), projected_columns_, layout_version_);
   pci_.SetProjectedColumn(projected_columns_);
   return true;
 }
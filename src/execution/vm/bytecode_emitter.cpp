@@ -37,6 +37,8 @@ void BytecodeEmitter::EmitAssignImm8F(LocalVar dest, double val) { EmitAll(Bytec
 
 void BytecodeEmitter::EmitAssignImm8(LocalVar dest, int64_t val) { EmitAll(Bytecode::AssignImm8, dest, val); }
 
+void BytecodeEmitter::EmitInitIntegerImm(LocalVar dest, int32_t val) { EmitAll(Bytecode::InitIntegerImm, dest, val); }
+
 void BytecodeEmitter::EmitUnaryOp(Bytecode bytecode, LocalVar dest, LocalVar input) { EmitAll(bytecode, dest, input); }
 
 void BytecodeEmitter::EmitBinaryOp(Bytecode bytecode, LocalVar dest, LocalVar lhs, LocalVar rhs) {
@@ -273,11 +275,21 @@ void BytecodeEmitter::EmitPCIGet(Bytecode bytecode, LocalVar out, LocalVar pci,
   EmitAll(bytecode, out, pci, col_idx);
 }
 
+void BytecodeEmitter::EmitPCICompare(Bytecode bytecode, LocalVar dest, LocalVar pci, uint16_t col_idx,
+                                     LocalVar right) {
+  EmitAll(bytecode, dest, pci, col_idx, right);
+}
+
 void BytecodeEmitter::EmitPCIVectorFilter(Bytecode bytecode, LocalVar selected, LocalVar pci, uint32_t col_idx,
                                           int8_t type, int64_t val) {
   EmitAll(bytecode, selected, pci, col_idx, type, val);
 }
 
+void BytecodeEmitter::EmitPCIVectorColumnFilter(Bytecode bytecode, LocalVar selected, LocalVar pci, uint32_t col_idx,
+                                                int8_t type, uint32_t col_idx_2) {
+  EmitAll(bytecode, selected, pci, col_idx, type, col_idx_2);
+}
+
 void BytecodeEmitter::EmitFilterManagerInsertFlavor(LocalVar fmb, FunctionId func) {
   EmitAll(Bytecode::FilterManagerInsertFlavor, fmb, func);
 }
@@ -308,6 +320,20 @@ void BytecodeEmitter::EmitJoinHashTableIterHasNext(LocalVar has_more, LocalVar i
   EmitAll(Bytecode::JoinHashTableIterHasNext, has_more, iterator, key_eq, opaque_ctx, probe_tuple);
 }
 
+void BytecodeEmitter::EmitJoinHashTableVectorProbePrepare(LocalVar probe, LocalVar pci, FunctionId hash_fn) {
+  EmitAll(Bytecode::JoinHashTableVectorProbePrepare, probe, pci, hash_fn);
+}
+
+void BytecodeEmitter::EmitJoinHashTableVectorProbeGetNext(LocalVar result, LocalVar probe, LocalVar pci,
+                                                          FunctionId key_eq_fn) {
+  EmitAll(Bytecode::JoinHashTableVectorProbeGetNext, result, probe, pci, key_eq_fn);
+}
+
+void BytecodeEmitter::EmitJoinHashTableVectorProbeFilter(LocalVar probe, LocalVar pci, FunctionId key_eq_fn,
+                                                         LocalVar anti) {
+  EmitAll(Bytecode::JoinHashTableVectorProbeFilter, probe, pci, key_eq_fn, anti);
+}
+
 void BytecodeEmitter::EmitSorterInit(Bytecode bytecode, LocalVar sorter, LocalVar region, FunctionId cmp_fn,
                                      LocalVar tuple_size) {
   EmitAll(bytecode, sorter, region, cmp_fn, tuple_size);
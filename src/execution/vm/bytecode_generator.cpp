@@ -1,3 +1,4 @@
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -218,6 +219,10 @@ void BytecodeGenerator::VisitIdentifierExpr(ast::IdentifierExpr *node) {
 
 void BytecodeGenerator::VisitImplicitCastExpr(ast::ImplicitCastExpr *node) {
   LocalVar dest = ExecutionResult()->GetOrCreateDestination(node->GetType());
+  if (node->GetCastKind() == ast::CastKind::IntToSqlInt && BuildInitIntegerImm(dest, node->Input())) {
+    ExecutionResult()->SetDestination(dest);
+    return;
+  }
   LocalVar input = VisitExpressionForRValue(node->Input());
 
   switch (node->GetCastKind()) {
@@ -450,6 +455,7 @@ void BytecodeGenerator::VisitSqlConversionCall(ast::CallExpr *call, ast::Builtin
     }
     case ast::Builtin::IntToSql: {
       auto dest = ExecutionResult()->GetOrCreateDestination(ast::BuiltinType::Get(ctx, ast::BuiltinType::Integer));
+      if (BuildInitIntegerImm(dest, call->Arguments()[0])) break;
       auto input = VisitExpressionForRValue(call->Arguments()[0]);
       Emitter()->Emit(Bytecode::InitInteger, dest, input);
       break;
@@ -847,10 +853,11 @@ void BytecodeGenerator::VisitBuiltinFilterCall(ast::CallExpr *call, ast::Builtin
   // Column index
   auto col_idx = static_cast<uint16_t>(call->Arguments()[1]->As<ast::LitExpr>()->Int64Val());
   auto col_type = static_cast<int8_t>(call->Arguments()[2]->As<ast::LitExpr>()->Int64Val());
-  // Filter value
+  // Filter value, or index of the second column
   int64_t val = call->Arguments()[3]->As<ast::LitExpr>()->Int64Val();
 
   Bytecode bytecode;
+  bool by_column = false;
   switch (builtin) {
     case ast::Builtin::FilterEq: {
       bytecode = Bytecode::PCIFilterEqual;
@@ -876,11 +883,45 @@ void BytecodeGenerator::VisitBuiltinFilterCall(ast::CallExpr *call, ast::Builtin
       bytecode = Bytecode::PCIFilterNotEqual;
       break;
     }
+    case ast::Builtin::FilterColEq: {
+      bytecode = Bytecode::PCIFilterColEqual;
+      by_column = true;
+      break;
+    }
+    case ast::Builtin::FilterColGt: {
+      bytecode = Bytecode::PCIFilterColGreaterThan;
+      by_column = true;
+      break;
+    }
+    case ast::Builtin::FilterColGe: {
+      bytecode = Bytecode::PCIFilterColGreaterThanEqual;
+      by_column = true;
+      break;
+    }
+    case ast::Builtin::FilterColLt: {
+      bytecode = Bytecode::PCIFilterColLessThan;
+      by_column = true;
+      break;
+    }
+    case ast::Builtin::FilterColLe: {
+      bytecode = Bytecode::PCIFilterColLessThanEqual;
+      by_column = true;
+      break;
+    }
+    case ast::Builtin::FilterColNe: {
+      bytecode = Bytecode::PCIFilterColNotEqual;
+      by_column = true;
+      break;
+    }
     default: {
       UNREACHABLE("Impossible bytecode");
     }
   }
-  Emitter()->EmitPCIVectorFilter(bytecode, ret_val, pci, col_idx, col_type, val);
+  if (by_column) {
+    Emitter()->EmitPCIVectorColumnFilter(bytecode, ret_val, pci, col_idx, col_type, static_cast<uint16_t>(val));
+  } else {
+    Emitter()->EmitPCIVectorFilter(bytecode, ret_val, pci, col_idx, col_type, val);
+  }
 }
 
 void BytecodeGenerator::VisitBuiltinAggHashTableCall(ast::CallExpr *call, ast::Builtin builtin) {
@@ -1178,7 +1219,16 @@ void BytecodeGenerator::VisitBuiltinJoinHashTableCall(ast::CallExpr *call, ast::
       LocalVar join_hash_table = VisitExpressionForRValue(call->Arguments()[0]);
       LocalVar memory = VisitExpressionForRValue(call->Arguments()[1]);
       LocalVar entry_size = VisitExpressionForRValue(call->Arguments()[2]);
-      Emitter()->Emit(Bytecode::JoinHashTableInit, join_hash_table, memory, entry_size);
+      // The concise hash table flag is optional and defaults to false
+      LocalVar use_concise_ht;
+      if (call->Arguments().size() > 3) {
+        use_concise_ht = VisitExpressionForRValue(call->Arguments()[3]);
+      } else {
+        use_concise_ht = CurrentFunction()->NewLocal(ast::BuiltinType::Get(call->GetType()->GetContext(),
+                                                                           ast::BuiltinType::Bool));
+        Emitter()->EmitAssignImm1(use_concise_ht, 0);
+      }
+      Emitter()->Emit(Bytecode::JoinHashTableInit, join_hash_table, memory, entry_size, use_concise_ht);
       break;
     }
     case ast::Builtin::JoinHashTableInsert: {
@@ -1234,6 +1284,41 @@ void BytecodeGenerator::VisitBuiltinJoinHashTableCall(ast::CallExpr *call, ast::
       Emitter()->Emit(Bytecode::JoinHashTableFree, join_hash_table);
       break;
     }
+    case ast::Builtin::JoinHashTableVectorProbeInit: {
+      LocalVar probe = VisitExpressionForRValue(call->Arguments()[0]);
+      LocalVar join_hash_table = VisitExpressionForRValue(call->Arguments()[1]);
+      Emitter()->Emit(Bytecode::JoinHashTableVectorProbeInit, probe, join_hash_table);
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbePrepare: {
+      LocalVar probe = VisitExpressionForRValue(call->Arguments()[0]);
+      LocalVar pci = VisitExpressionForRValue(call->Arguments()[1]);
+      auto hash_fn = LookupFuncIdByName(call->Arguments()[2]->As<ast::IdentifierExpr>()->Name().Data());
+      Emitter()->EmitJoinHashTableVectorProbePrepare(probe, pci, hash_fn);
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbeGetNext: {
+      LocalVar dest = ExecutionResult()->GetOrCreateDestination(call->GetType());
+      LocalVar probe = VisitExpressionForRValue(call->Arguments()[0]);
+      LocalVar pci = VisitExpressionForRValue(call->Arguments()[1]);
+      auto key_eq_fn = LookupFuncIdByName(call->Arguments()[2]->As<ast::IdentifierExpr>()->Name().Data());
+      Emitter()->EmitJoinHashTableVectorProbeGetNext(dest, probe, pci, key_eq_fn);
+      ExecutionResult()->SetDestination(dest.ValueOf());
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbeFilter: {
+      LocalVar probe = VisitExpressionForRValue(call->Arguments()[0]);
+      LocalVar pci = VisitExpressionForRValue(call->Arguments()[1]);
+      auto key_eq_fn = LookupFuncIdByName(call->Arguments()[2]->As<ast::IdentifierExpr>()->Name().Data());
+      LocalVar anti = VisitExpressionForRValue(call->Arguments()[3]);
+      Emitter()->EmitJoinHashTableVectorProbeFilter(probe, pci, key_eq_fn, anti);
+      break;
+    }
+    case ast::Builtin::JoinHashTableVectorProbeFree: {
+      LocalVar probe = VisitExpressionForRValue(call->Arguments()[0]);
+      Emitter()->Emit(Bytecode::JoinHashTableVectorProbeFree, probe);
+      break;
+    }
     default: {
       UNREACHABLE("Impossible bytecode");
     }
@@ -1967,7 +2052,13 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     case ast::Builtin::FilterGe:
     case ast::Builtin::FilterLt:
     case ast::Builtin::FilterLe:
-    case ast::Builtin::FilterNe: {
+    case ast::Builtin::FilterNe:
+    case ast::Builtin::FilterColEq:
+    case ast::Builtin::FilterColGt:
+    case ast::Builtin::FilterColGe:
+    case ast::Builtin::FilterColLt:
+    case ast::Builtin::FilterColLe:
+    case ast::Builtin::FilterColNe: {
       VisitBuiltinFilterCall(call, builtin);
       break;
     }
@@ -2080,7 +2171,12 @@ void BytecodeGenerator::VisitBuiltinCallExpr(ast::CallExpr *call) {
     case ast::Builtin::JoinHashTableIterClose:
     case ast::Builtin::JoinHashTableBuild:
     case ast::Builtin::JoinHashTableBuildParallel:
-    case ast::Builtin::JoinHashTableFree: {
+    case ast::Builtin::JoinHashTableFree:
+    case ast::Builtin::JoinHashTableVectorProbeInit:
+    case ast::Builtin::JoinHashTableVectorProbePrepare:
+    case ast::Builtin::JoinHashTableVectorProbeGetNext:
+    case ast::Builtin::JoinHashTableVectorProbeFilter:
+    case ast::Builtin::JoinHashTableVectorProbeFree: {
       VisitBuiltinJoinHashTableCall(call, builtin);
       break;
     }
@@ -2262,6 +2358,7 @@ void BytecodeGenerator::VisitCallExpr(ast::CallExpr *node) {
 }
 
 void BytecodeGenerator::VisitAssignmentStmt(ast::AssignmentStmt *node) {
+  if (BuildAddAssign(node)) return;
   LocalVar dest = VisitExpressionForLValue(node->Destination());
   VisitExpressionForRValue(node->Source(), dest);
 }
@@ -2495,6 +2592,11 @@ void BytecodeGenerator::VisitBinaryOpExpr(ast::BinaryOpExpr *node) {
 
 void BytecodeGenerator::VisitSqlCompareOpExpr(ast::ComparisonOpExpr *compare) {
   LocalVar dest = ExecutionResult()->GetOrCreateDestination(compare->GetType());
+  if (BuildPCICompare(dest, compare)) {
+    ExecutionResult()->SetDestination(dest);
+    return;
+  }
+
   LocalVar left = VisitExpressionForLValue(compare->Left());
   LocalVar right = VisitExpressionForLValue(compare->Right());
 
@@ -2803,6 +2905,8 @@ void BytecodeGenerator::VisitExpressionForRValue(ast::Expr *expr, LocalVar dest)
 
 void BytecodeGenerator::VisitExpressionForTest(ast::Expr *expr, BytecodeLabel *then_label, BytecodeLabel *else_label,
                                                TestFallthrough fallthrough) {
+  if (VisitSqlBoolForTest(expr, then_label, else_label, fallthrough)) return;
+
   // Evaluate the expression
   LocalVar cond = VisitExpressionForRValue(expr);
 
@@ -2823,6 +2927,150 @@ void BytecodeGenerator::VisitExpressionForTest(ast::Expr *expr, BytecodeLabel *t
   }
 }
 
+bool BytecodeGenerator::VisitSqlBoolForTest(ast::Expr *expr, BytecodeLabel *then_label, BytecodeLabel *else_label,
+                                            TestFallthrough fallthrough) {
+  // Find the SQL boolean whose truth value is tested, either through an implicit cast or through @sqlToBool()
+  ast::Expr *sql_bool = nullptr;
+  if (auto *cast = expr->SafeAs<ast::ImplicitCastExpr>(); cast != nullptr) {
+    if (cast->GetCastKind() == ast::CastKind::SqlBoolToBool) sql_bool = cast->Input();
+  } else if (auto *call = expr->SafeAs<ast::CallExpr>(); call != nullptr) {
+    ast::Builtin builtin;
+    if (call->GetCallKind() == ast::CallExpr::CallKind::Builtin &&
+        call->GetType()->GetContext()->IsBuiltinFunction(call->GetFuncName(), &builtin) &&
+        builtin == ast::Builtin::SqlToBool) {
+      sql_bool = call->Arguments()[0];
+    }
+  }
+  if (sql_bool == nullptr) return false;
+
+  // Test the SQL boolean and jump in one instruction, instead of a ForceBoolTruth followed by a jump on its result
+  LocalVar cond = VisitExpressionForRValue(sql_bool);
+  switch (fallthrough) {
+    case TestFallthrough::Then: {
+      Emitter()->EmitConditionalJump(Bytecode::JumpIfSqlFalse, cond, else_label);
+      break;
+    }
+    case TestFallthrough::Else: {
+      Emitter()->EmitConditionalJump(Bytecode::JumpIfSqlTrue, cond, then_label);
+      break;
+    }
+    case TestFallthrough::None: {
+      Emitter()->EmitConditionalJump(Bytecode::JumpIfSqlFalse, cond, else_label);
+      Emitter()->EmitJump(Bytecode::Jump, then_label);
+      break;
+    }
+  }
+  return true;
+}
+
+bool BytecodeGenerator::BuildInitIntegerImm(LocalVar dest, ast::Expr *input) {
+  if (!input->IsIntegerLiteral()) return false;
+  const int64_t val = input->As<ast::LitExpr>()->Int64Val();
+  if (val < std::numeric_limits<int32_t>::min() || val > std::numeric_limits<int32_t>::max()) return false;
+  // Initialize the SQL integer directly from the constant, instead of assigning the constant to a temporary first
+  Emitter()->EmitInitIntegerImm(dest, static_cast<int32_t>(val));
+  return true;
+}
+
+namespace {
+
+// Whether two expressions name the same memory location. Only side-effect free identifiers, dereferences and
+// member accesses are considered, so that evaluating one of them in place of both is safe.
+bool IsSameLocation(ast::Expr *a, ast::Expr *b) {
+  if (auto *ident_a = a->SafeAs<ast::IdentifierExpr>(), *ident_b = b->SafeAs<ast::IdentifierExpr>();
+      ident_a != nullptr && ident_b != nullptr) {
+    return ident_a->Name() == ident_b->Name();
+  }
+  if (auto *unary_a = a->SafeAs<ast::UnaryOpExpr>(), *unary_b = b->SafeAs<ast::UnaryOpExpr>();
+      unary_a != nullptr && unary_b != nullptr) {
+    return unary_a->Op() == parsing::Token::Type::STAR && unary_b->Op() == parsing::Token::Type::STAR &&
+           IsSameLocation(unary_a->Expression(), unary_b->Expression());
+  }
+  if (auto *member_a = a->SafeAs<ast::MemberExpr>(), *member_b = b->SafeAs<ast::MemberExpr>();
+      member_a != nullptr && member_b != nullptr) {
+    return IsSameLocation(member_a->Object(), member_b->Object()) &&
+           IsSameLocation(member_a->Member(), member_b->Member());
+  }
+  return false;
+}
+
+// Whether an expression is a literal or a local, possibly behind an implicit cast
+bool IsSimpleValue(ast::Expr *expr) {
+  if (auto *cast = expr->SafeAs<ast::ImplicitCastExpr>(); cast != nullptr) expr = cast->Input();
+  return expr->Is<ast::LitExpr>() || expr->Is<ast::IdentifierExpr>();
+}
+
+}  // namespace
+
+bool BytecodeGenerator::BuildAddAssign(ast::AssignmentStmt *assign) {
+  // Locals live in the frame and are already updated in place, so only stores through memory are worth fusing
+  ast::Expr *destination = assign->Destination();
+  if (destination->Is<ast::IdentifierExpr>()) return false;
+
+  auto *sum = assign->Source()->SafeAs<ast::BinaryOpExpr>();
+  if (sum == nullptr || sum->Op() != parsing::Token::Type::PLUS) return false;
+  ast::Type *type = sum->GetType();
+  if (!type->IsIntegerType() && !type->IsFloatType()) return false;
+  if (!IsSameLocation(destination, sum->Left()) || !IsSimpleValue(sum->Right())) return false;
+
+  // Add into the destination directly, instead of a load, an add and a store through the same pointer
+  Bytecode bytecode = type->IsIntegerType()
+                          ? GetIntTypedBytecode(GET_BASE_FOR_INT_TYPES(Bytecode::AddAssign), type)
+                          : GetFloatTypedBytecode(GET_BASE_FOR_FLOAT_TYPES(Bytecode::AddAssign), type);
+  LocalVar dest = VisitExpressionForLValue(destination);
+  LocalVar rhs = VisitExpressionForRValue(sum->Right());
+  Emitter()->Emit(bytecode, dest, rhs);
+  return true;
+}
+
+bool BytecodeGenerator::BuildPCICompare(LocalVar dest, ast::ComparisonOpExpr *compare) {
+  auto *call = compare->Left()->SafeAs<ast::CallExpr>();
+  ast::Builtin builtin;
+  if (call == nullptr || call->GetCallKind() != ast::CallExpr::CallKind::Builtin ||
+      !call->GetType()->GetContext()->IsBuiltinFunction(call->GetFuncName(), &builtin) ||
+      builtin != ast::Builtin::PCIGetInt) {
+    return false;
+  }
+
+  Bytecode bytecode;
+  switch (compare->Op()) {
+    case parsing::Token::Type::GREATER: {
+      bytecode = Bytecode::PCIGreaterThanInteger;
+      break;
+    }
+    case parsing::Token::Type::GREATER_EQUAL: {
+      bytecode = Bytecode::PCIGreaterThanEqualInteger;
+      break;
+    }
+    case parsing::Token::Type::EQUAL_EQUAL: {
+      bytecode = Bytecode::PCIEqualInteger;
+      break;
+    }
+    case parsing::Token::Type::LESS: {
+      bytecode = Bytecode::PCILessThanInteger;
+      break;
+    }
+    case parsing::Token::Type::LESS_EQUAL: {
+      bytecode = Bytecode::PCILessThanEqualInteger;
+      break;
+    }
+    case parsing::Token::Type::BANG_EQUAL: {
+      bytecode = Bytecode::PCINotEqualInteger;
+      break;
+    }
+    default: {
+      return false;
+    }
+  }
+
+  // Read the column and compare it in one instruction, instead of materializing the value in a temporary first
+  LocalVar pci = VisitExpressionForRValue(call->Arguments()[0]);
+  auto col_idx = static_cast<uint16_t>(call->Arguments()[1]->As<ast::LitExpr>()->Int64Val());
+  LocalVar right = VisitExpressionForLValue(compare->Right());
+  Emitter()->EmitPCICompare(bytecode, dest, pci, col_idx, right);
+  return true;
+}
+
 Bytecode BytecodeGenerator::GetIntTypedBytecode(Bytecode bytecode, ast::Type *type) {
   TERRIER_ASSERT(type->IsIntegerType(), "Type must be integer type");
   auto int_kind = type->SafeAs<ast::BuiltinType>()->GetKind();
@@ -84,6 +84,42 @@ void OpPCIFilterNotEqual(uint64_t *size, terrier::execution::sql::ProjectedColum
   *size = iter->FilterColByVal<std::not_equal_to>(col_idx, sql_type, v);
 }
 
+void OpPCIFilterColEqual(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                         uint32_t col_idx, int8_t type, uint32_t col_idx_2) {
+  auto sql_type = static_cast<terrier::type::TypeId>(type);
+  *size = iter->FilterColByCol<std::equal_to>(col_idx, sql_type, col_idx_2, sql_type);
+}
+
+void OpPCIFilterColGreaterThan(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                               uint32_t col_idx, int8_t type, uint32_t col_idx_2) {
+  auto sql_type = static_cast<terrier::type::TypeId>(type);
+  *size = iter->FilterColByCol<std::greater>(col_idx, sql_type, col_idx_2, sql_type);
+}
+
+void OpPCIFilterColGreaterThanEqual(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                                    uint32_t col_idx, int8_t type, uint32_t col_idx_2) {
+  auto sql_type = static_cast<terrier::type::TypeId>(type);
+  *size = iter->FilterColByCol<std::greater_equal>(col_idx, sql_type, col_idx_2, sql_type);
+}
+
+void OpPCIFilterColLessThan(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                            uint32_t col_idx, int8_t type, uint32_t col_idx_2) {
+  auto sql_type = static_cast<terrier::type::TypeId>(type);
+  *size = iter->FilterColByCol<std::less>(col_idx, sql_type, col_idx_2, sql_type);
+}
+
+void OpPCIFilterColLessThanEqual(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                                 uint32_t col_idx, int8_t type, uint32_t col_idx_2) {
+  auto sql_type = static_cast<terrier::type::TypeId>(type);
+  *size = iter->FilterColByCol<std::less_equal>(col_idx, sql_type, col_idx_2, sql_type);
+}
+
+void OpPCIFilterColNotEqual(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                            uint32_t col_idx, int8_t type, uint32_t col_idx_2) {
+  auto sql_type = static_cast<terrier::type::TypeId>(type);
+  *size = iter->FilterColByCol<std::not_equal_to>(col_idx, sql_type, col_idx_2, sql_type);
+}
+
 // ---------------------------------------------------------
 // Filter Manager
 // ---------------------------------------------------------
@@ -115,8 +151,8 @@ void OpFilterManagerFree(terrier::execution::sql::FilterManager *filter_manager)
 // ---------------------------------------------------------
 
 void OpJoinHashTableInit(terrier::execution::sql::JoinHashTable *join_hash_table,
-                         terrier::execution::sql::MemoryPool *memory, uint32_t tuple_size) {
-  new (join_hash_table) terrier::execution::sql::JoinHashTable(memory, tuple_size);
+                         terrier::execution::sql::MemoryPool *memory, uint32_t tuple_size, bool use_concise_ht) {
+  new (join_hash_table) terrier::execution::sql::JoinHashTable(memory, tuple_size, use_concise_ht);
 }
 
 void OpJoinHashTableBuild(terrier::execution::sql::JoinHashTable *join_hash_table) { join_hash_table->Build(); }
@@ -129,6 +165,15 @@ void OpJoinHashTableBuildParallel(terrier::execution::sql::JoinHashTable *join_h
 
 void OpJoinHashTableFree(terrier::execution::sql::JoinHashTable *join_hash_table) { join_hash_table->~JoinHashTable(); }
 
+void OpJoinHashTableVectorProbeInit(terrier::execution::sql::JoinHashTableVectorProbe *probe,
+                                    terrier::execution::sql::JoinHashTable *join_hash_table) {
+  new (probe) terrier::execution::sql::JoinHashTableVectorProbe(*join_hash_table);
+}
+
+void OpJoinHashTableVectorProbeFree(terrier::execution::sql::JoinHashTableVectorProbe *probe) {
+  probe->~JoinHashTableVectorProbe();
+}
+
 // ---------------------------------------------------------
 // Aggregation Hash Table
 // ---------------------------------------------------------
@@ -811,6 +811,25 @@ void LLVMEngine::CompiledModuleBuilder::DefineFunction(const FunctionInfo &func_
         break;
       }
 
+      case Bytecode::JumpIfSqlFalse:
+      case Bytecode::JumpIfSqlTrue: {
+        //
+        // The bytecode handler tests the SQL boolean and returns whether the
+        // jump is taken.
+        //
+
+        std::size_t fallthrough_bb_pos = iter.GetPosition() + iter.CurrentBytecodeSize();
+        std::size_t branch_target_bb_pos =
+            iter.GetPosition() + Bytecodes::GetNthOperandOffset(bytecode, 1) + iter.GetJumpOffsetOperand(1);
+        TERRIER_ASSERT(blocks[fallthrough_bb_pos] != nullptr, "Branch fallthrough does not point to valid basic block");
+        TERRIER_ASSERT(blocks[branch_target_bb_pos] != nullptr, "Branch target does not point to valid basic block");
+
+        llvm::Value *taken = issue_call(LookupBytecodeHandler(bytecode), args);
+        llvm::Value *cond = ir_builder->CreateICmpNE(taken, llvm::ConstantInt::get(taken->getType(), 0, false));
+        ir_builder->CreateCondBr(cond, blocks[branch_target_bb_pos], blocks[fallthrough_bb_pos]);
+        break;
+      }
+
       case Bytecode::Return: {
         if (FunctionHasDirectReturn(func_info.FuncType())) {
           llvm::Value *ret_val = locals_map.GetArgumentById(func_info.GetReturnValueLocal());
@@ -276,6 +276,17 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
 #undef GEN_ARITHMETIC_OP
 #undef DO_GEN_ARITHMETIC_OP
 
+#define GEN_ADD_ASSIGN_OP(type, ...)                      \
+  OP(AddAssign##_##type) : {                              \
+    auto *dest = frame->LocalAt<type *>(READ_LOCAL_ID()); \
+    auto rhs = frame->LocalAt<type>(READ_LOCAL_ID());     \
+    OpAddAssign##_##type(dest, rhs);                      \
+    DISPATCH_NEXT();                                      \
+  }
+
+  ALL_NUMERIC_TYPES(GEN_ADD_ASSIGN_OP)
+#undef GEN_ADD_ASSIGN_OP
+
   // -------------------------------------------------------
   // Arithmetic negation
   // -------------------------------------------------------
@@ -362,6 +373,28 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  OP(JumpIfSqlTrue) : {
+    auto *cond = frame->LocalAt<sql::BoolVal *>(READ_LOCAL_ID());
+    auto skip = PEEK_JMP_OFFSET();
+    if (OpJumpIfSqlTrue(cond)) {
+      ip += skip;
+    } else {
+      READ_JMP_OFFSET();
+    }
+    DISPATCH_NEXT();
+  }
+
+  OP(JumpIfSqlFalse) : {
+    auto *cond = frame->LocalAt<sql::BoolVal *>(READ_LOCAL_ID());
+    auto skip = PEEK_JMP_OFFSET();
+    if (OpJumpIfSqlFalse(cond)) {
+      ip += skip;
+    } else {
+      READ_JMP_OFFSET();
+    }
+    DISPATCH_NEXT();
+  }
+
   // -------------------------------------------------------
   // Low-level memory operations
   // -------------------------------------------------------
@@ -661,6 +694,23 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
   GEN_PCI_ACCESS(Varlen, sql::StringVal)
 #undef GEN_PCI_ACCESS
 
+#define GEN_PCI_COMPARE(Op)                                                       \
+  OP(PCI##Op##Integer) : {                                                        \
+    auto *result = frame->LocalAt<sql::BoolVal *>(READ_LOCAL_ID());               \
+    auto *pci = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID()); \
+    auto col_idx = READ_UIMM2();                                                  \
+    auto *right = frame->LocalAt<sql::Integer *>(READ_LOCAL_ID());                \
+    OpPCI##Op##Integer(result, pci, col_idx, right);                              \
+    DISPATCH_NEXT();                                                              \
+  }
+  GEN_PCI_COMPARE(GreaterThan)
+  GEN_PCI_COMPARE(GreaterThanEqual)
+  GEN_PCI_COMPARE(Equal)
+  GEN_PCI_COMPARE(LessThan)
+  GEN_PCI_COMPARE(LessThanEqual)
+  GEN_PCI_COMPARE(NotEqual)
+#undef GEN_PCI_COMPARE
+
 #define GEN_PCI_FILTER(Op)                                                         \
   OP(PCIFilter##Op) : {                                                            \
     auto *size = frame->LocalAt<uint64_t *>(READ_LOCAL_ID());                      \
@@ -679,6 +729,24 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
   GEN_PCI_FILTER(NotEqual)
 #undef GEN_PCI_FILTER
 
+#define GEN_PCI_COL_FILTER(Op)                                                     \
+  OP(PCIFilterCol##Op) : {                                                         \
+    auto *size = frame->LocalAt<uint64_t *>(READ_LOCAL_ID());                      \
+    auto *iter = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID()); \
+    auto col_idx = READ_UIMM4();                                                   \
+    auto type = READ_IMM1();                                                       \
+    auto col_idx_2 = READ_UIMM4();                                                 \
+    OpPCIFilterCol##Op(size, iter, col_idx, type, col_idx_2);                      \
+    DISPATCH_NEXT();                                                               \
+  }
+  GEN_PCI_COL_FILTER(Equal)
+  GEN_PCI_COL_FILTER(GreaterThan)
+  GEN_PCI_COL_FILTER(GreaterThanEqual)
+  GEN_PCI_COL_FILTER(LessThan)
+  GEN_PCI_COL_FILTER(LessThanEqual)
+  GEN_PCI_COL_FILTER(NotEqual)
+#undef GEN_PCI_COL_FILTER
+
   // ------------------------------------------------------
   // Hashing
   // ------------------------------------------------------
@@ -779,6 +847,12 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  OP(InitIntegerImm) : {
+    auto *sql_int = frame->LocalAt<sql::Integer *>(READ_LOCAL_ID());
+    OpInitIntegerImm(sql_int, READ_IMM4());
+    DISPATCH_NEXT();
+  }
+
   OP(InitReal) : {
     auto *sql_real = frame->LocalAt<sql::Real *>(READ_LOCAL_ID());
     auto val = frame->LocalAt<double>(READ_LOCAL_ID());
@@ -1254,7 +1328,8 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     auto *join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
     auto *memory = frame->LocalAt<sql::MemoryPool *>(READ_LOCAL_ID());
     auto tuple_size = frame->LocalAt<uint32_t>(READ_LOCAL_ID());
-    OpJoinHashTableInit(join_hash_table, memory, tuple_size);
+    auto use_concise_ht = frame->LocalAt<bool>(READ_LOCAL_ID());
+    OpJoinHashTableInit(join_hash_table, memory, tuple_size, use_concise_ht);
     DISPATCH_NEXT();
   }
 
@@ -1318,6 +1393,50 @@ void VM::Interpret(const uint8_t *ip, Frame *frame) {
     DISPATCH_NEXT();
   }
 
+  OP(JoinHashTableVectorProbeInit) : {
+    auto *probe = frame->LocalAt<sql::JoinHashTableVectorProbe *>(READ_LOCAL_ID());
+    auto *join_hash_table = frame->LocalAt<sql::JoinHashTable *>(READ_LOCAL_ID());
+    OpJoinHashTableVectorProbeInit(probe, join_hash_table);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableVectorProbePrepare) : {
+    auto *probe = frame->LocalAt<sql::JoinHashTableVectorProbe *>(READ_LOCAL_ID());
+    auto *pci = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());
+    auto hash_fn_id = READ_FUNC_ID();
+    auto hash_fn = reinterpret_cast<sql::JoinHashTableVectorProbe::HashFn>(module_->GetRawFunctionImpl(hash_fn_id));
+    OpJoinHashTableVectorProbePrepare(probe, pci, hash_fn);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableVectorProbeGetNext) : {
+    auto *result = frame->LocalAt<const byte **>(READ_LOCAL_ID());
+    auto *probe = frame->LocalAt<sql::JoinHashTableVectorProbe *>(READ_LOCAL_ID());
+    auto *pci = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());
+    auto key_eq_fn_id = READ_FUNC_ID();
+    auto key_eq_fn =
+        reinterpret_cast<sql::JoinHashTableVectorProbe::KeyEqFn>(module_->GetRawFunctionImpl(key_eq_fn_id));
+    OpJoinHashTableVectorProbeGetNext(result, probe, pci, key_eq_fn);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableVectorProbeFilter) : {
+    auto *probe = frame->LocalAt<sql::JoinHashTableVectorProbe *>(READ_LOCAL_ID());
+    auto *pci = frame->LocalAt<sql::ProjectedColumnsIterator *>(READ_LOCAL_ID());
+    auto key_eq_fn_id = READ_FUNC_ID();
+    auto anti = frame->LocalAt<bool>(READ_LOCAL_ID());
+    auto key_eq_fn =
+        reinterpret_cast<sql::JoinHashTableVectorProbe::KeyEqFn>(module_->GetRawFunctionImpl(key_eq_fn_id));
+    OpJoinHashTableVectorProbeFilter(probe, pci, key_eq_fn, anti);
+    DISPATCH_NEXT();
+  }
+
+  OP(JoinHashTableVectorProbeFree) : {
+    auto *probe = frame->LocalAt<sql::JoinHashTableVectorProbe *>(READ_LOCAL_ID());
+    OpJoinHashTableVectorProbeFree(probe);
+    DISPATCH_NEXT();
+  }
+
   // -------------------------------------------------------
   // Sorting
   // -------------------------------------------------------
@@ -3,12 +3,14 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "binder/binder_context.h"
 #include "catalog/catalog_defs.h"
 #include "common/sql_node_visitor.h"
 #include "parser/postgresparser.h"
 #include "parser/statements.h"
+#include "type/type_id.h"
 
 namespace terrier {
 
@@ -21,6 +23,8 @@ class SubqueryExpression;
 class StarExpression;
 class OperatorExpression;
 class AggregateExpression;
+class ComparisonExpression;
+class ParameterValueExpression;
 }  // namespace parser
 
 namespace catalog {
@@ -50,6 +54,12 @@ class BindNodeVisitor : public SqlNodeVisitor {
    */
   void BindNameToNode(common::ManagedPointer<parser::SQLStatement> tree, parser::ParseResult *parse_result);
 
+  /**
+   * A parameter ($n) takes the type of the column it is compared with or assigned to, or INTEGER if there is none
+   * @return the type of every parameter of the bound statement, by index. Indexes that never appear are INVALID.
+   */
+  const std::vector<type::TypeId> &GetParameterTypes() const { return parameter_types_; }
+
   void Visit(parser::SelectStatement *node, parser::ParseResult *parse_result) override;
   void Visit(parser::JoinDefinition *node, parser::ParseResult *parse_result) override;
   void Visit(parser::TableRef *node, parser::ParseResult *parse_result) override;
@@ -76,6 +86,8 @@ class BindNodeVisitor : public SqlNodeVisitor {
   void Visit(parser::FunctionExpression *expr, parser::ParseResult *parse_result) override;
   void Visit(parser::OperatorExpression *expr, parser::ParseResult *parse_result) override;
   void Visit(parser::AggregateExpression *expr, parser::ParseResult *parse_result) override;
+  void Visit(parser::ComparisonExpression *expr, parser::ParseResult *parse_result) override;
+  void Visit(parser::ParameterValueExpression *expr, parser::ParseResult *parse_result) override;
   void Visit(parser::TypeCastExpression *expr, parser::ParseResult *parse_result) override;
 
  private:
@@ -85,6 +97,11 @@ class BindNodeVisitor : public SqlNodeVisitor {
   common::ManagedPointer<catalog::CatalogAccessor> catalog_accessor_;
   /** Default database name of the query. Default to current database reside in */
   std::string default_database_name_;
+  /** Type of every parameter seen so far, by index */
+  std::vector<type::TypeId> parameter_types_;
+
+  /** Gives a parameter the type of the value it stands for */
+  void SetParameterType(common::ManagedPointer<parser::AbstractExpression> expr, type::TypeId type);
 };
 
 }  // namespace binder
@@ -40,71 +40,7 @@ class BinderUtil {
       // Looking at a ConstantValueExpression
       case parser::ExpressionType::VALUE_CONSTANT: {
         auto cexpr = expr.CastManagedPointerTo<parser::ConstantValueExpression>();
-
-        // TODO(WAN): There is code repetition here, but given that we intend to nuke the TransientValue
-        //  in favor of Prashanth's Value system, this is probably fine and is easier to read.
-        switch (expected_ret_type) {
-          // We expect to turn integers into TINYINT.
-          case type::TypeId::TINYINT: {
-            if (expr_ret_type != type::TypeId::INTEGER) {
-              throw BINDER_EXCEPTION("Can't convert to TINYINT.");
-            }
-            int32_t val{type::TransientValuePeeker::PeekInteger(cexpr->GetValue())};
-            return std::make_unique<parser::ConstantValueExpression>(type::TransientValueFactory::GetTinyInt(val));
-          }
-          // We expect to turn integers into SMALLINT.
-          case type::TypeId::SMALLINT: {
-            if (expr_ret_type != type::TypeId::INTEGER) {
-              throw BINDER_EXCEPTION("Can't convert to SMALLINT.");
-            }
-            int32_t val{type::TransientValuePeeker::PeekInteger(cexpr->GetValue())};
-            return std::make_unique<parser::ConstantValueExpression>(type::TransientValueFactory::GetSmallInt(val));
-          }
-          // We expect to turn integers into BIGINT.
-          case type::TypeId::BIGINT: {
-            if (expr_ret_type != type::TypeId::INTEGER) {
-              throw BINDER_EXCEPTION("Can't convert to BIGINT.");
-            }
-            int32_t val{type::TransientValuePeeker::PeekInteger(cexpr->GetValue())};
-            return std::make_unique<parser::ConstantValueExpression>(type::TransientValueFactory::GetBigInt(val));
-          }
-          // We expect to turn integers into DECIMAL.
-          case type::TypeId::DECIMAL: {
-            if (expr_ret_type != type::TypeId::INTEGER) {
-              throw BINDER_EXCEPTION("Can't convert to DECIMAL.");
-            }
-            int32_t val{type::TransientValuePeeker::PeekInteger(cexpr->GetValue())};
-            return std::make_unique<parser::ConstantValueExpression>(type::TransientValueFactory::GetDecimal(val));
-          }
-          // We expect to turn strings into DATE.
-          case type::TypeId::DATE: {
-            if (expr_ret_type != type::TypeId::VARCHAR) {
-              throw BINDER_EXCEPTION("Can't convert to DATE.");
-            }
-            std::string str{type::TransientValuePeeker::PeekVarChar(cexpr->GetValue())};
-            auto parsed = util::TimeConvertor::ParseDate(str);
-            if (!parsed.first) {
-              throw BINDER_EXCEPTION("Unable to parse the date.");
-            }
-            return std::make_unique<parser::ConstantValueExpression>(
-                type::TransientValueFactory::GetDate(parsed.second));
-          }
-          // We expect to turn strings into TIMESTAMP.
-          case type::TypeId::TIMESTAMP: {
-            if (expr_ret_type != type::TypeId::VARCHAR) {
-              throw BINDER_EXCEPTION("Can't convert to TIMESTAMP.");
-            }
-            std::string str{type::TransientValuePeeker::PeekVarChar(cexpr->GetValue())};
-            auto parsed = util::TimeConvertor::ParseTimestamp(str);
-            if (!parsed.first) {
-              throw BINDER_EXCEPTION("Unable to parse the timestamp.");
-            }
-            return std::make_unique<parser::ConstantValueExpression>(
-                type::TransientValueFactory::GetTimestamp(parsed.second));
-          }
-          default:
-            throw BINDER_EXCEPTION("Unimplemented binder conversion.");
-        }
+        return std::make_unique<parser::ConstantValueExpression>(ConvertValue(cexpr->GetValue(), expected_ret_type));
       }
       // Looking at a TypeCastExpression
       case parser::ExpressionType::OPERATOR_CAST: {
@@ -117,6 +53,79 @@ class BinderUtil {
         throw BINDER_EXCEPTION("Mismatch in expected return type and expression return type.");
     }
   }
+
+  /**
+   * Convert a constant to the given type, following the rules of Convert.
+   * @param value The constant to convert, this is not modified.
+   * @param expected_ret_type The type to convert to, must differ from the type of the constant.
+   * @return The converted constant.
+   */
+  static type::TransientValue ConvertValue(const type::TransientValue &value, type::TypeId expected_ret_type) {
+    const auto value_type = value.Type();
+
+    // TODO(WAN): There is code repetition here, but given that we intend to nuke the TransientValue
+    //  in favor of Prashanth's Value system, this is probably fine and is easier to read.
+    switch (expected_ret_type) {
+      // We expect to turn integers into TINYINT.
+      case type::TypeId::TINYINT: {
+        if (value_type != type::TypeId::INTEGER) {
+          throw BINDER_EXCEPTION("Can't convert to TINYINT.");
+        }
+        int32_t val{type::TransientValuePeeker::PeekInteger(value)};
+        return type::TransientValueFactory::GetTinyInt(val);
+      }
+      // We expect to turn integers into SMALLINT.
+      case type::TypeId::SMALLINT: {
+        if (value_type != type::TypeId::INTEGER) {
+          throw BINDER_EXCEPTION("Can't convert to SMALLINT.");
+        }
+        int32_t val{type::TransientValuePeeker::PeekInteger(value)};
+        return type::TransientValueFactory::GetSmallInt(val);
+      }
+      // We expect to turn integers into BIGINT.
+      case type::TypeId::BIGINT: {
+        if (value_type != type::TypeId::INTEGER) {
+          throw BINDER_EXCEPTION("Can't convert to BIGINT.");
+        }
+        int32_t val{type::TransientValuePeeker::PeekInteger(value)};
+        return type::TransientValueFactory::GetBigInt(val);
+      }
+      // We expect to turn integers into DECIMAL.
+      case type::TypeId::DECIMAL: {
+        if (value_type != type::TypeId::INTEGER) {
+          throw BINDER_EXCEPTION("Can't convert to DECIMAL.");
+        }
+        int32_t val{type::TransientValuePeeker::PeekInteger(value)};
+        return type::TransientValueFactory::GetDecimal(val);
+      }
+      // We expect to turn strings into DATE.
+      case type::TypeId::DATE: {
+        if (value_type != type::TypeId::VARCHAR) {
+          throw BINDER_EXCEPTION("Can't convert to DATE.");
+        }
+        std::string str{type::TransientValuePeeker::PeekVarChar(value)};
+        auto parsed = util::TimeConvertor::ParseDate(str);
+        if (!parsed.first) {
+          throw BINDER_EXCEPTION("Unable to parse the date.");
+        }
+        return type::TransientValueFactory::GetDate(parsed.second);
+      }
+      // We expect to turn strings into TIMESTAMP.
+      case type::TypeId::TIMESTAMP: {
+        if (value_type != type::TypeId::VARCHAR) {
+          throw BINDER_EXCEPTION("Can't convert to TIMESTAMP.");
+        }
+        std::string str{type::TransientValuePeeker::PeekVarChar(value)};
+        auto parsed = util::TimeConvertor::ParseTimestamp(str);
+        if (!parsed.first) {
+          throw BINDER_EXCEPTION("Unable to parse the timestamp.");
+        }
+        return type::TransientValueFactory::GetTimestamp(parsed.second);
+      }
+      default:
+        throw BINDER_EXCEPTION("Unimplemented binder conversion.");
+    }
+  }
 };
 
 }  // namespace terrier::binder
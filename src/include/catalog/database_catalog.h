@@ -136,8 +136,10 @@ class DatabaseCatalog {
 
   /**
    * Apply a new schema to the given table.  The changes should modify the latest
-   * schema as provided by the catalog.  There is no guarantee that the OIDs for
-   * modified columns will be stable across a schema change.
+   * schema as provided by the catalog.  Columns that keep their OID are kept,
+   * columns without an OID are added and columns of the latest schema that are
+   * missing are dropped.  The new schema describes a new layout version of the
+   * table, existing tuples are not rewritten.
    * @param txn for the operation
    * @param table OID of the modified table
    * @param new_schema object describing the table after modification
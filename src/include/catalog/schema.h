@@ -307,6 +307,12 @@ class Schema {
    */
   const std::vector<Column> &GetColumns() const { return columns_; }
 
+  /**
+   * @return the layout version of the SqlTable this schema describes. Projections built from this schema must be
+   * initialized against it.
+   */
+  storage::layout_version_t GetVersion() const { return version_; }
+
   /**
    * @return serialized schema
    */
@@ -361,6 +367,8 @@ class Schema {
   friend class DatabaseCatalog;
   std::vector<Column> columns_;
   std::unordered_map<col_oid_t, uint32_t> col_oid_to_offset_;
+  // Set by the catalog when the schema is installed on the table
+  storage::layout_version_t version_ = storage::INITIAL_LAYOUT_VERSION;
 };
 
 DEFINE_JSON_DECLARATIONS(Schema::Column);
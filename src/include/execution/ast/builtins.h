@@ -25,6 +25,12 @@ namespace terrier::execution::ast {
   F(FilterLe, filterLe)                                                 \
   F(FilterLt, filterLt)                                                 \
   F(FilterNe, filterNe)                                                 \
+  F(FilterColEq, filterColEq)                                           \
+  F(FilterColGe, filterColGe)                                           \
+  F(FilterColGt, filterColGt)                                           \
+  F(FilterColLe, filterColLe)                                           \
+  F(FilterColLt, filterColLt)                                           \
+  F(FilterColNe, filterColNe)                                           \
                                                                         \
   /* Thread State Container */                                          \
   F(ExecutionContextGetMemoryPool, execCtxGetMem)                       \
@@ -116,6 +122,11 @@ namespace terrier::execution::ast {
   F(JoinHashTableBuild, joinHTBuild)                                    \
   F(JoinHashTableBuildParallel, joinHTBuildParallel)                    \
   F(JoinHashTableFree, joinHTFree)                                      \
+  F(JoinHashTableVectorProbeInit, joinHTVecProbeInit)                   \
+  F(JoinHashTableVectorProbePrepare, joinHTVecProbePrepare)             \
+  F(JoinHashTableVectorProbeGetNext, joinHTVecProbeGetNext)             \
+  F(JoinHashTableVectorProbeFilter, joinHTVecProbeFilter)               \
+  F(JoinHashTableVectorProbeFree, joinHTVecProbeFree)                   \
                                                                         \
   /* Sorting */                                                         \
   F(SorterInit, sorterInit)                                             \
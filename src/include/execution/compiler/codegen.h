@@ -211,6 +211,11 @@ class CodeGen {
    */
   ast::Expr *ArrayType(uint64_t num_elems, ast::BuiltinType::Kind kind);
 
+  /**
+   * @return the type represented by [num_elems]elem_type, or [*]elem_type when num_elems is 0
+   */
+  ast::Expr *ArrayType(uint64_t num_elems, ast::Expr *elem_type);
+
   /**
    *
    * @return the expression arr[idx]
@@ -429,6 +434,18 @@ class CodeGen {
   ast::Expr *PCIFilter(ast::Identifier pci, terrier::parser::ExpressionType comp_type, uint32_t col_idx,
                        terrier::type::TypeId col_type, ast::Expr *filter_val);
 
+  /**
+   * Call filterColCompType(pci, col_idx, col_type, col_idx_2)
+   * @param pci The identifier of the projected columns iterator
+   * @param comp_type The type of comparison being performed.
+   * @param col_idx Index of the column being filtered.
+   * @param col_type The type of both columns.
+   * @param col_idx_2 Index of the column to compare with.
+   * @return The expression corresponding to the builtin call.
+   */
+  ast::Expr *PCIColumnFilter(ast::Identifier pci, terrier::parser::ExpressionType comp_type, uint32_t col_idx,
+                             terrier::type::TypeId col_type, uint32_t col_idx_2);
+
   /**
    * Call execCtxGetMem(execCtx)
    * @return The expression corresponding to the builtin call.
@@ -504,6 +521,14 @@ class CodeGen {
    */
   ast::Expr *BuiltinCall(ast::Builtin builtin, std::vector<ast::Expr *> &&params);
 
+  /**
+   * Call a generated helper function with the given arguments.
+   * @param fn_name name of the function to call
+   * @param params parameters of the function
+   * @return The expression corresponding to the function call.
+   */
+  ast::Expr *Call(ast::Identifier fn_name, std::vector<ast::Expr *> &&params);
+
   /**
    * This is for functions that take one identifier or a pointer to an identifier as their argument.
    * @param builtin builtin function to call
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "parser/expression/abstract_expression.h"
+#include "type/transient_value.h"
+
+namespace terrier::execution::compiler {
+
+/**
+ * Evaluates constant arithmetic at code generation time, so that e.g. "a + 2 * 3" is generated as "a + 6" instead of
+ * multiplying the two constants for every tuple.
+ */
+class ConstantFolder {
+ public:
+  /**
+   * Evaluates an expression made only of numeric constants and arithmetic operators.
+   * Expressions whose evaluation would fail at runtime (division by zero, overflow) or that involve NULLs are left
+   * alone, so that they behave exactly as they would without folding.
+   * @param expression expression to evaluate
+   * @param result where to write the value of the expression
+   * @return whether the expression could be evaluated
+   */
+  static bool Fold(const parser::AbstractExpression *expression, type::TransientValue *result);
+};
+
+}  // namespace terrier::execution::compiler
@@ -30,6 +30,13 @@ class ExpressionEvaluator {
   virtual ast::Expr *GetTableColumn(const catalog::col_oid_t &col_oid) {
     UNREACHABLE("This operator does not interact with tables");
   }
+
+  /**
+   * Lets an evaluator reuse the value of a sub-expression it already computed for the current tuple.
+   * @param expression expression about to be generated
+   * @return an expression holding the value of an equal expression, or nullptr if it has to be computed
+   */
+  virtual ast::Expr *GetCommonSubexpression(const terrier::parser::AbstractExpression *expression) { return nullptr; }
 };
 
 /**
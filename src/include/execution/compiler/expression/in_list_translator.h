@@ -0,0 +1,35 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "execution/compiler/expression/expression_translator.h"
+
+namespace terrier::execution::compiler {
+
+/**
+ * In List Translator, for "a IN (b, c, ...)". A list of integer constants is sorted, so that it is probed with a
+ * binary search instead of comparing the value with every element.
+ */
+class InListTranslator : public ExpressionTranslator {
+ public:
+  /**
+   * Constructor
+   * @param expression expression to translate
+   * @param codegen code generator to use
+   */
+  InListTranslator(const terrier::parser::AbstractExpression *expression, CodeGen *codegen);
+
+  ast::Expr *DeriveExpr(ExpressionEvaluator *evaluator) override;
+
+ private:
+  // Generates the search of constants_[lo, hi)
+  ast::Expr *GenSearch(ExpressionEvaluator *evaluator, size_t lo, size_t hi);
+
+  // Ranges of at most this many constants are compared one after the other
+  static constexpr size_t LINEAR_SEARCH_MAX = 4;
+
+  std::unique_ptr<ExpressionTranslator> value_;
+  std::vector<std::unique_ptr<ExpressionTranslator>> elements_;
+  // The distinct elements in ascending order, if they are all integer constants and the value is an integer
+  std::vector<int64_t> constants_;
+};
+}  // namespace terrier::execution::compiler
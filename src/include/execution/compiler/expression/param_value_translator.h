@@ -17,5 +17,11 @@ class ParamValueTranslator : public ExpressionTranslator {
   ParamValueTranslator(const terrier::parser::AbstractExpression *expression, CodeGen *codegen);
 
   ast::Expr *DeriveExpr(ExpressionEvaluator *evaluator) override;
+
+  /**
+   * @param type type of the parameter
+   * @return the builtin that reads a parameter of the given type from the execution context
+   */
+  static ast::Builtin GetParamBuiltin(type::TypeId type);
 };
 }  // namespace terrier::execution::compiler
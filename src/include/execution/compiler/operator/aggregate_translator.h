@@ -8,6 +8,8 @@ namespace terrier::execution::compiler {
 
 // Forward declare
 class AggregateTopTranslator;
+class SortedAggregateBottomTranslator;
+class SortedAggregateTopTranslator;
 
 /**
  * Aggregate Bottom Translator
@@ -28,7 +30,7 @@ class AggregateBottomTranslator : public OperatorTranslator {
   // Declare payload and probe structs
   void InitializeStructs(util::RegionVector<ast::Decl *> *decls) override;
 
-  // Create the key check function.
+  // Create the key check function, or the batch functions in vectorized pipelines.
   void InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) override;
 
   // Call @aggHTInit on the hash table
@@ -58,9 +60,19 @@ class AggregateBottomTranslator : public OperatorTranslator {
     return {&agg_payload_, &payload_struct_};
   }
 
+  // Vectorizable if the terms can be computed in the batch functions, which have no access to the parameters
+  bool IsVectorizable() override;
+
   const planner::AbstractPlanNode *Op() override { return op_; }
 
  private:
+  /**
+   * Return the value of the group by term at the given index for the current input tuple
+   * @param idx index of the term
+   * @return the value of the term
+   */
+  ast::Expr *DeriveGroupByTerm(uint32_t idx);
+
   /**
    * Return the group by term at the given index
    * @param object either agg_payload_ or agg_values_
@@ -90,15 +102,16 @@ class AggregateBottomTranslator : public OperatorTranslator {
 
   /*
    * Generate the key check logic
+   * When from_input is set, the payload is compared with the current input tuple instead of agg_values
    */
-  void GenKeyCheck(FunctionBuilder *builder);
+  void GenKeyCheck(FunctionBuilder *builder, bool from_input);
 
   /*
    * First declare var agg_values : AggValues
-   * For each group by term, generate agg_values.term_i = group_by_term_i
+   * For each group by term, generate agg_values.term_i = group_by_term_i (unless group_by_terms is false)
    * For each aggregation expression, agg_values.expr_i = agg_expr_i
    */
-  void FillValues(FunctionBuilder *builder);
+  void FillValues(FunctionBuilder *builder, bool group_by_terms);
 
   // Generate var agg_payload = @ptrCast(*AggPayload, @aggHTLookup(&state.agg_ht, agg_hash_val, keyCheck, &agg_values))
   void GenLookupCall(FunctionBuilder *builder);
@@ -118,11 +131,35 @@ class AggregateBottomTranslator : public OperatorTranslator {
   // Generate var agg_hash_val = @hash(groub_by_term1, group_by_term2, ...)
   void GenHashCall(FunctionBuilder *builder);
 
+  // Generate @hash(groub_by_term1, group_by_term2, ...), using either agg_values or the current input tuple
+  ast::Expr *MakeHashCall(bool from_input);
+
   // Tuple at a time key check
   void GenSingleKeyCheckFn(util::RegionVector<ast::Decl *> *decls);
 
-  // Make the top translator a friend class.
+  /*
+   * Generate the functions passed to @aggHTProcessBatch. They all take the input vectors as their last parameter:
+   * fun aggHashFn(iters: [*]*ProjectedColumnsIterator) -> uint64
+   * fun aggBatchKeyCheckFn(agg_payload: *AggPayload, iters: [*]*ProjectedColumnsIterator) -> bool
+   * fun aggConstructFn(agg_payload: *AggPayload, iters: [*]*ProjectedColumnsIterator) -> nil
+   * fun aggAdvanceFn(agg_payload: *AggPayload, iters: [*]*ProjectedColumnsIterator) -> nil
+   */
+  void GenBatchFunctions(util::RegionVector<ast::Decl *> *decls);
+
+  // Parameters of a batch function: (agg_payload: *AggPayload if with_payload, iters: [*]*ProjectedColumnsIterator)
+  util::RegionVector<ast::FieldDecl *> BatchParams(bool with_payload);
+
+  // Generate var vec = iters[0], so that the input columns can be read from the vector
+  void DeclareInputVector(FunctionBuilder *builder);
+
+  // Generate var iters: [1]*ProjectedColumnsIterator, iters[0] = vec and
+  // @aggHTProcessBatch(&state.agg_ht, &iters, aggHashFn, aggBatchKeyCheckFn, aggConstructFn, aggAdvanceFn, false)
+  void GenProcessBatchCall(FunctionBuilder *builder);
+
+  // Make the top translator and the sorted aggregation translators friend classes.
   friend class AggregateTopTranslator;
+  friend class SortedAggregateBottomTranslator;
+  friend class SortedAggregateTopTranslator;
 
  private:
   // The number of group by terms.
@@ -140,6 +177,11 @@ class AggregateBottomTranslator : public OperatorTranslator {
   ast::Identifier agg_payload_;
   ast::Identifier key_check_;
   ast::Identifier agg_ht_;
+  ast::Identifier iters_;
+  ast::Identifier hash_fn_;
+  ast::Identifier batch_key_check_;
+  ast::Identifier construct_fn_;
+  ast::Identifier advance_fn_;
 };
 
 /**
@@ -213,6 +255,9 @@ class AggregateTopTranslator : public OperatorTranslator {
   // Return true iff there is a having clause
   bool GenHaving(FunctionBuilder *builder);
 
+  // The sorted aggregation reuses the having clause.
+  friend class SortedAggregateTopTranslator;
+
   const planner::AggregatePlanNode *op_;
   // Used to access member of the resulting aggregate
   AggregateBottomTranslator *bottom_;
@@ -220,4 +265,80 @@ class AggregateTopTranslator : public OperatorTranslator {
   // Structs, Functions, and local variables needed.
   ast::Identifier agg_iterator_;
 };
+
+/**
+ * Sorted Aggregate Bottom Translator
+ * When the input is sorted on the group by terms (AggregateStrategyType::SORTED), each group is a run of consecutive
+ * tuples. The aggregation then streams: it keeps only the current group, and hands it to the top translator as soon as
+ * the next group starts. There is no hash table, and both halves stay in the pipeline of the child.
+ */
+class SortedAggregateBottomTranslator : public AggregateBottomTranslator {
+ public:
+  /**
+   * Constructor
+   * @param op plan node to translate
+   * @param codegen code generator
+   */
+  SortedAggregateBottomTranslator(const terrier::planner::AggregatePlanNode *op, CodeGen *codegen)
+      : AggregateBottomTranslator(op, codegen), has_group_(codegen->NewIdentifier("agg_has_group")) {}
+
+  // Does nothing: the current group is a local of the pipeline
+  void InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) override {}
+
+  // Create the key check function
+  void InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) override;
+
+  // Does nothing
+  void InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) override {}
+
+  // Does nothing
+  void InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) override {}
+
+  void Produce(FunctionBuilder *builder) override;
+  void Abort(FunctionBuilder *builder) override;
+  void Consume(FunctionBuilder *builder) override;
+
+  // The groups are detected one tuple at a time
+  bool IsVectorizable() override { return false; }
+
+  // The current group is a struct, not a pointer
+  bool IsMaterializer(bool *is_ptr) override {
+    *is_ptr = false;
+    return true;
+  }
+
+ private:
+  // Declare var agg_payload: AggPayload and var agg_has_group = false
+  void DeclareGroup(FunctionBuilder *builder);
+
+  // if (agg_has_group) { if (!aggKeyCheckFn(&agg_payload, &agg_values)) { output the group; agg_has_group = false } }
+  void GenGroupEnd(FunctionBuilder *builder);
+
+  // if (!agg_has_group) { agg_payload.term_i = agg_values.term_i; @aggInit(&agg_payload.expr_i); ... }
+  void GenGroupStart(FunctionBuilder *builder);
+
+  // Whether agg_payload holds a group
+  ast::Identifier has_group_;
+};
+
+/**
+ * Sorted Aggregate Top Translator
+ * This translator outputs the groups handed over by the sorted aggregate bottom translator.
+ */
+class SortedAggregateTopTranslator : public AggregateTopTranslator {
+ public:
+  /**
+   * Constructor
+   * @param op plan node
+   * @param codegen The code generator
+   * @param bottom The corresponding bottom translator
+   */
+  SortedAggregateTopTranslator(const terrier::planner::AggregatePlanNode *op, CodeGen *codegen,
+                               OperatorTranslator *bottom)
+      : AggregateTopTranslator(op, codegen, bottom) {}
+
+  void Produce(FunctionBuilder *builder) override;
+  void Abort(FunctionBuilder *builder) override;
+  void Consume(FunctionBuilder *builder) override;
+};
 }  // namespace terrier::execution::compiler
@@ -99,20 +99,26 @@ class HashJoinRightTranslator : public OperatorTranslator {
   void Abort(FunctionBuilder *builder) override;
   void Consume(FunctionBuilder *builder) override;
 
-  // Does nothing
-  void InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) override {}
+  // Add the vector probe in vectorized pipelines
+  void InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) override;
 
   // Declare JoinProbe struct if the previous operator is not a materializer
   void InitializeStructs(util::RegionVector<ast::Decl *> *decls) override;
 
-  // Declare the keyCheck function
+  // Declare the keyCheck function, or the hash and key check functions of the vector probe
   void InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) override;
 
-  // Does nothing (left operator already initialized the hash table)
-  void InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) override {}
+  // Initialize the vector probe in vectorized pipelines (left operator already initialized the hash table)
+  void InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) override;
 
-  // Does nothing (left operator already freed the hash table)
-  void InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) override {}
+  // Free the vector probe in vectorized pipelines (left operator already freed the hash table)
+  void InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) override;
+
+  // The probe can be done a vector at a time, unless the hash keys or the join predicate need query parameters
+  bool IsVectorizable() override;
+
+  // The matches (or the remaining probe tuples of semi and anti joins) are handed to the parent one at a time
+  bool EndsVectorization() override { return true; }
 
   // Get the output at idx
   ast::Expr *GetOutput(uint32_t attr_idx) override;
@@ -123,6 +129,10 @@ class HashJoinRightTranslator : public OperatorTranslator {
   const planner::AbstractPlanNode *Op() override { return op_; }
 
  private:
+  // Whether this is a semi or anti join. These only check whether a probe tuple has a match, so the output can only
+  // reference the probe side.
+  bool IsFilteringJoin() const;
+
   // Returns a probe value
   ast::Expr *GetProbeValue(uint32_t idx);
 
@@ -138,6 +148,15 @@ class HashJoinRightTranslator : public OperatorTranslator {
   // Loop to probe the hash table
   void GenProbeLoop(FunctionBuilder *builder);
 
+  // If statement checking whether the probe tuple has a match (semi join) or none (anti join)
+  void GenProbeCheck(FunctionBuilder *builder);
+
+  // @joinHTIterInit(&join_iter, &state.join_ht, hash_val)
+  ast::Stmt *GenIteratorInit();
+
+  // @joinHTIterHasNext(&join_iter, joinKeyCheckFn, execCtx, probe_row)
+  ast::Expr *GenIteratorHasNext();
+
   // Close the iterator after the loop
   void GenIteratorClose(FunctionBuilder *builder);
 
@@ -150,6 +169,23 @@ class HashJoinRightTranslator : public OperatorTranslator {
   // Complete the join key check function
   void GenKeyCheck(FunctionBuilder *builder);
 
+  // fn joinProbeHashFn(pci: *ProjectedColumnsIterator) -> uint64
+  // fn joinVecKeyCheckFn(build_row: *BuildRow, pci: *ProjectedColumnsIterator) -> bool
+  void GenVectorProbeFunctions(util::RegionVector<ast::Decl *> *decls);
+
+  // @joinHTVecProbePrepare(&state.join_probe, pci, joinProbeHashFn)
+  // for (var build_row = @ptrCast(*BuildRow, @joinHTVecProbeGetNext(&state.join_probe, pci, joinVecKeyCheckFn));
+  //      build_row != nil; build_row = ...) {...}
+  void GenVectorProbeLoop(FunctionBuilder *builder);
+
+  // @joinHTVecProbePrepare(&state.join_probe, pci, joinProbeHashFn)
+  // @joinHTVecProbeFilter(&state.join_probe, pci, joinVecKeyCheckFn, anti)
+  // for (; @pciHasNextFiltered(pci); @pciAdvanceFiltered(pci)) {...}
+  void GenVectorProbeFilter(FunctionBuilder *builder);
+
+  // @joinHTVecProbeGetNext(&state.join_probe, pci, joinVecKeyCheckFn) cast to *BuildRow
+  ast::Expr *GetNextVectorMatch();
+
   // The hash join plan node
   const planner::HashJoinPlanNode *op_;
   // The left translator
@@ -168,5 +204,9 @@ class HashJoinRightTranslator : public OperatorTranslator {
   ast::Identifier probe_row_;
   ast::Identifier key_check_;
   ast::Identifier join_iter_;
+  // Only used in vectorized pipelines
+  ast::Identifier join_probe_;
+  ast::Identifier probe_hash_fn_;
+  ast::Identifier vec_key_check_;
 };
 }  // namespace terrier::execution::compiler
@@ -56,6 +56,8 @@ class InsertTranslator : public OperatorTranslator {
   void FillPRFromChild(FunctionBuilder *builder);
   // Set the table PR from raw values
   void GenSetTablePR(FunctionBuilder *builder, uint32_t idx);
+  // Insert every row of the constant batch in a loop
+  void GenConstantBatchInsert(FunctionBuilder *builder);
   // Insert into table.
   void GenTableInsert(FunctionBuilder *builder);
   // Insert into index.
@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <utility>
+#include <vector>
 #include "execution/compiler/codegen.h"
 #include "execution/compiler/expression/expression_translator.h"
 #include "planner/plannodes/abstract_plan_node.h"
@@ -74,6 +75,36 @@ class OperatorTranslator : public ExpressionEvaluator {
    */
   virtual void Consume(FunctionBuilder *builder) = 0;
 
+  /**
+   * Declares a variable for every expression this operator evaluates in the pipeline function that only depends on
+   * query parameters (e.g. "$1 + 1"). It is called before anything is produced, so the value is computed once instead
+   * of once per tuple.
+   * @param builder builder of the pipeline function
+   */
+  virtual void DeclareLoopInvariants(FunctionBuilder *builder) {}
+
+  /**
+   * Reuses a sub-expression this operator holds in a variable, either for the current tuple or for the whole pipeline.
+   * @param expression expression about to be generated
+   * @return an expression holding the value of an equal expression, or nullptr if it has to be computed
+   */
+  ast::Expr *GetCommonSubexpression(const terrier::parser::AbstractExpression *expression) override;
+
+  /**
+   * Like GetCommonSubexpression, but for an expression over the outputs of this operator (e.g. of its parent). A
+   * projection of "a * b" over a scan with the predicate "a * b > 10" thereby computes "a * b" once per tuple.
+   * @param expression expression over the outputs of this operator
+   * @return an expression holding the value of an equal expression, or nullptr if it has to be computed
+   */
+  ast::Expr *GetCommonOutputSubexpression(const terrier::parser::AbstractExpression *expression);
+
+  /**
+   * Tells the child whether declaring a variable for one of its sub-expressions pays off.
+   * @param expression sub-expression of the child, over the child's input
+   * @return whether this operator evaluates an expression over the child's outputs with the same value
+   */
+  virtual bool ReusesChildSubexpression(const terrier::parser::AbstractExpression *expression) { return false; }
+
   /**
    * Setup state needed before generating code
    * @param child_translator the child translator
@@ -94,6 +125,13 @@ class OperatorTranslator : public ExpressionEvaluator {
    */
   virtual bool IsVectorizable() { return false; }
 
+  /**
+   * Whether this operator consumes whole vectors, but hands its parent one tuple at a time (e.g. the probe side of a
+   * hash join). The operators above it are produced tuple-at-a-time, so they don't prevent vectorizing the pipeline.
+   * @return Whether the vectorized part of the pipeline ends with this operator
+   */
+  virtual bool EndsVectorization() { return false; }
+
   /**
    * @return Whether this operator is parallelizable
    */
@@ -140,6 +178,16 @@ class OperatorTranslator : public ExpressionEvaluator {
    */
   virtual std::pair<ast::Identifier *, ast::Identifier *> GetMaterializedTuple() { return {nullptr, nullptr}; }
 
+  /**
+   * In a vectorized pipeline, the source operator calls Consume once per vector of tuples instead of once per tuple.
+   * Operators that don't produce vectors pass the call through to their child.
+   * @return the identifier of the ProjectedColumnsIterator over the current vector.
+   */
+  virtual ast::Identifier GetVectorIterator() {
+    TERRIER_ASSERT(child_translator_ != nullptr, "Vectorized pipelines must start with a vector producer");
+    return child_translator_->GetVectorIterator();
+  }
+
   /**
    * Used by operators when they need to generate a struct containing a child's output.
    * Also used by the output layer to materialize the output
@@ -162,6 +210,53 @@ class OperatorTranslator : public ExpressionEvaluator {
   virtual const planner::AbstractPlanNode *Op() = 0;
 
  protected:
+  /**
+   * Appends the arithmetic nodes of an expression, children before parents.
+   * @param expression expression to search
+   * @param unconditional whether to only append the nodes that are evaluated for every tuple, i.e. not in the second
+   * operand of an AND or OR, which is short-circuited
+   * @param nodes where to append the nodes
+   */
+  static void CollectArithmetic(const terrier::parser::AbstractExpression *expression, bool unconditional,
+                                std::vector<const terrier::parser::AbstractExpression *> *nodes);
+
+  /**
+   * Whether two expressions compute the same value. Unlike operator==, names and aliases don't matter.
+   * @param expression expression to compare
+   * @param other expression to compare with
+   * @param outputs if given, the derived values of expression refer to these columns, i.e. the outputs of the
+   * operator that evaluates other
+   * @return whether both compute the same value
+   */
+  static bool SameValue(const terrier::parser::AbstractExpression *expression,
+                        const terrier::parser::AbstractExpression *other, const planner::OutputSchema *outputs);
+
+  /**
+   * Declares a variable holding the value of an expression for the current tuple, @see GetCommonSubexpression
+   * @param builder builder of the pipeline function
+   * @param expression expression to compute
+   */
+  void DeclareCommonSubexpression(FunctionBuilder *builder, const terrier::parser::AbstractExpression *expression);
+
+  /**
+   * Declares a variable for every largest sub-expression that only depends on query parameters, @see
+   * DeclareLoopInvariants
+   * @param builder builder of the pipeline function
+   * @param expression expression to search
+   */
+  void HoistLoopInvariants(FunctionBuilder *builder, const terrier::parser::AbstractExpression *expression);
+
+  /**
+   * Sub-expressions of the current tuple, and the variables holding their values. They are only in scope for the
+   * current tuple, so the operator clears them once its parent consumed it.
+   */
+  std::vector<std::pair<const terrier::parser::AbstractExpression *, ast::Identifier>> common_subexpressions_;
+
+  /**
+   * Sub-expressions that only depend on query parameters, and the variables holding their values
+   */
+  std::vector<std::pair<const terrier::parser::AbstractExpression *, ast::Identifier>> loop_invariants_;
+
   /**
    * The code generator to use
    */
@@ -28,8 +28,18 @@ class ProjectionTranslator : public OperatorTranslator {
   // Pass through
   void Abort(FunctionBuilder *builder) override { child_translator_->Abort(builder); }
 
-  // Pass through
-  void Consume(FunctionBuilder *builder) override { parent_translator_->Consume(builder); }
+  /**
+   * Computes the arithmetic sub-expressions that several output columns share, then passes through. In a vectorized
+   * pipeline this is called once per vector, so the sub-expressions are left inline.
+   * @param builder builder of the pipeline function
+   */
+  void Consume(FunctionBuilder *builder) override;
+
+  // Hoists the parts of the outputs that only depend on the query parameters
+  void DeclareLoopInvariants(FunctionBuilder *builder) override;
+
+  // Whether an output column contains the child's sub-expression
+  bool ReusesChildSubexpression(const terrier::parser::AbstractExpression *expression) override;
 
   // Does nothing
   void InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) override {}
@@ -59,6 +69,8 @@ class ProjectionTranslator : public OperatorTranslator {
   // Is always vectorizable.
   bool IsVectorizable() override { return true; }
 
+  ast::Expr *GetCommonSubexpression(const terrier::parser::AbstractExpression *expression) override;
+
   // Should not be called here
   ast::Expr *GetTableColumn(const catalog::col_oid_t &col_oid) override {
     UNREACHABLE("Projection nodes should not use column value expressions");
@@ -67,6 +79,9 @@ class ProjectionTranslator : public OperatorTranslator {
   const planner::AbstractPlanNode *Op() override { return op_; }
 
  private:
+  // Declares a variable for every arithmetic sub-expression that occurs more than once in the output columns
+  void DeclareCommonSubexpressions(FunctionBuilder *builder);
+
   const planner::ProjectionPlanNode *op_;
 };
 
@@ -23,20 +23,23 @@ class SeqScanTranslator : public OperatorTranslator {
   void Abort(FunctionBuilder *builder) override;
   void Consume(FunctionBuilder *builder) override;
 
-  // Does nothing
-  void InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) override {}
+  // Hoists the parts of the residual predicate and of the outputs that only depend on the query parameters
+  void DeclareLoopInvariants(FunctionBuilder *builder) override;
+
+  // Declares the filter manager, if any
+  void InitializeStateFields(util::RegionVector<ast::FieldDecl *> *state_fields) override;
 
   // Does nothing
   void InitializeStructs(util::RegionVector<ast::Decl *> *decls) override {}
 
-  // Does nothing
-  void InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) override {}
+  // Generates the filter functions of the conjuncts run by the filter manager, if any
+  void InitializeHelperFunctions(util::RegionVector<ast::Decl *> *decls) override;
 
-  // Does nothing
-  void InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) override {}
+  // Initializes the filter manager, if any
+  void InitializeSetup(util::RegionVector<ast::Stmt *> *setup_stmts) override;
 
-  // Does nothing
-  void InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) override {}
+  // Frees the filter manager, if any
+  void InitializeTeardown(util::RegionVector<ast::Stmt *> *teardown_stmts) override;
 
   ast::Expr *GetOutput(uint32_t attr_idx) override;
 
@@ -51,18 +54,32 @@ class SeqScanTranslator : public OperatorTranslator {
     return true;
   }
 
-  // This is vectorizable only if the predicate is vectorizable
+  // The scan can hand whole vectors to its parent, unless a conjunct has to be checked in the tuple at a time loop
   bool IsVectorizable() override { return is_vectorizable_; }
+
+  /**
+   * Checks whether a conjunct of the predicate can be evaluated with a vectorized filter, i.e. whether it has the form
+   * (col comp const), (const comp col) or (col comp col) over fixed-width columns (integers, booleans, dates,
+   * timestamps and decimals), and the constant fits the column. NULL values never pass the vectorized filters.
+   * @param conjunct The conjunct to check
+   * @return Whether the conjunct is vectorizable or not.
+   */
+  bool IsVectorizable(const terrier::parser::AbstractExpression *conjunct) const;
+
   /**
-   * Recursively walk down the predicate tree to check if it is vectorizable.
-   * @param predicate The predicate to check
-   * @return Whether the predicate is vectorizable or not.
+   * Splits a predicate into its conjuncts.
+   * @param predicate The predicate to split
+   * @param conjuncts The list to append the conjuncts to
    */
-  static bool IsVectorizable(const terrier::parser::AbstractExpression *predicate);
+  static void CollectConjuncts(const terrier::parser::AbstractExpression *predicate,
+                               std::vector<const terrier::parser::AbstractExpression *> *conjuncts);
 
   // Return the pci and its type
   std::pair<ast::Identifier *, ast::Identifier *> GetMaterializedTuple() override { return {&pci_, &pci_type_}; }
 
+  // The pci is the vector consumed by the parent in vectorized pipelines
+  ast::Identifier GetVectorIterator() override { return pci_; }
+
   // Used by column value expression to get a column.
   ast::Expr *GetTableColumn(const catalog::col_oid_t &col_oid) override;
 
@@ -98,8 +115,27 @@ class SeqScanTranslator : public OperatorTranslator {
   // @tableIterReset(&tvi)
   void GenTVIReset(FunctionBuilder *builder);
 
-  // Generated vectorized filters
-  void GenVectorizedPredicate(FunctionBuilder *builder, const terrier::parser::AbstractExpression *predicate);
+  // @filtersRun(&state.filter, pci)
+  void GenFilterManagerRun(FunctionBuilder *builder);
+
+  // if (residual_conjuncts) {...}
+  void GenResidualCondition(FunctionBuilder *builder);
+
+  // var common = ... for the sub-expressions the condition always evaluates and that are evaluated again, either later
+  // in the predicate or by the parent for the tuples that pass
+  void DeclareFilterSubexpressions(FunctionBuilder *builder, const terrier::parser::AbstractExpression *condition,
+                                   const terrier::parser::AbstractExpression *predicate);
+
+  // fun conjunct(pci: *ProjectedColumnsIterator) -> int32 {...}
+  ast::Decl *GenConjunctFunction(ast::Identifier fn_name, const terrier::parser::AbstractExpression *conjunct);
+
+  // fun conjunctVec(pci: *ProjectedColumnsIterator) -> int32 { @filterComp(pci, ...) }
+  ast::Decl *GenVectorizedConjunctFunction(ast::Identifier fn_name,
+                                           const terrier::parser::AbstractExpression *conjunct);
+
+  // The value of a constant, possibly negated, that fits in a column of the given type, encoded as the filter takes it
+  static bool GetFilterValue(const terrier::parser::AbstractExpression *expr, terrier::type::TypeId col_type,
+                             int64_t *val);
 
   // Create the input oids used for the scans.
   // When the plan's oid list is empty (like in "SELECT COUNT(*)"), then we just read the first column of the table.
@@ -115,6 +151,19 @@ class SeqScanTranslator : public OperatorTranslator {
     return op_->GetColumnOids();
   }
 
+  // Splits the conjuncts of the predicate into the clauses run by the FilterManager, which reorders them at runtime,
+  // and the residual conjuncts evaluated tuple at a time in the scan loop. The clauses are compiled into standalone
+  // functions, so the conjuncts that refer to the query parameters are always residual.
+  void PlanConjuncts(const std::vector<const terrier::parser::AbstractExpression *> &conjuncts);
+
+  // A conjunct run by the FilterManager, with its tuple at a time and (optionally) its vectorized flavor
+  struct FilterClause {
+    const terrier::parser::AbstractExpression *conjunct_;
+    bool vectorized_;
+    ast::Identifier tuple_fn_;
+    ast::Identifier vectorized_fn_;
+  };
+
  private:
   const planner::SeqScanPlanNode *op_;
   const catalog::Schema &schema_;
@@ -122,6 +171,9 @@ class SeqScanTranslator : public OperatorTranslator {
   storage::ProjectionMap pm_;
   bool has_predicate_;
   bool is_vectorizable_;
+  std::vector<FilterClause> filter_clauses_;
+  std::vector<const terrier::parser::AbstractExpression *> residual_conjuncts_;
+  bool uses_filter_manager_;
 
   // Structs, functions and locals
   ast::Identifier tvi_;
@@ -129,6 +181,7 @@ class SeqScanTranslator : public OperatorTranslator {
   ast::Identifier pci_;
   ast::Identifier slot_;
   ast::Identifier pci_type_;
+  ast::Identifier filter_;
 };
 
 }  // namespace terrier::execution::compiler
@@ -26,7 +26,12 @@ class Pipeline {
    * @param translator translator to add
    */
   void Add(std::unique_ptr<OperatorTranslator> &&translator) {
-    is_vectorizable_ = is_vectorizable_ && translator->IsVectorizable();
+    // Operators above the end of the vectorized part are tuple-at-a-time anyway
+    if (!ends_vectorization_) {
+      is_vectorizable_ = is_vectorizable_ && translator->IsVectorizable();
+      ends_vectorization_ = translator->EndsVectorization();
+      num_vectorizable_++;
+    }
     is_parallelizable_ = is_parallelizable_ && translator->IsParallelizable();
     pipeline_.emplace_back(std::move(translator));
   }
@@ -60,6 +65,9 @@ class Pipeline {
   std::vector<std::unique_ptr<OperatorTranslator>> pipeline_{};
   uint32_t pipeline_idx_{0};
   bool is_vectorizable_{true};
+  // Number of operators, from the bottom of the pipeline, that are produced in vectorized mode if is_vectorizable_
+  uint32_t num_vectorizable_{0};
+  bool ends_vectorization_{false};
   bool is_parallelizable_{true};
 };
 
@@ -63,6 +63,11 @@ class TranslatorFactory {
            type == parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO;
   }
 
+  /**
+   * Whether this is an IN list
+   */
+  static bool IsInList(parser::ExpressionType type) { return type == parser::ExpressionType::COMPARE_IN; }
+
   /**
    * Whether this is an arithmetic operation
    */
@@ -107,6 +112,17 @@ class TranslatorFactory {
    */
   static bool IsParamVal(parser::ExpressionType type) { return ((type) == parser::ExpressionType::VALUE_PARAMETER); }
 
+  /**
+   * Whether the expression refers to a parameter value anywhere in its tree
+   */
+  static bool HasParamVal(const parser::AbstractExpression *expression) {
+    if (IsParamVal(expression->GetExpressionType())) return true;
+    for (size_t i = 0; i < expression->GetChildrenSize(); i++) {
+      if (HasParamVal(expression->GetChild(i).Get())) return true;
+    }
+    return false;
+  }
+
   /**
    * Whether this is a null operation
    */
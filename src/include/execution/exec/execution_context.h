@@ -125,13 +125,22 @@ class EXPORT ExecutionContext {
    * Set the execution parameters.
    * @param params The exection parameters.
    */
-  void SetParams(std::vector<type::TransientValue> &&params) { params_ = std::move(params); }
+  void SetParams(std::vector<type::TransientValue> &&params) {
+    owned_params_ = std::move(params);
+    params_ = common::ManagedPointer<const std::vector<type::TransientValue>>(&owned_params_);
+  }
+
+  /**
+   * Set the execution parameters without taking ownership of them, e.g. the values of a parser::ConstantBatch
+   * @param params The execution parameters. They must outlive the execution.
+   */
+  void SetParams(common::ManagedPointer<const std::vector<type::TransientValue>> params) { params_ = params; }
 
   /**
    * @param param_idx index of parameter to access
    * @return immutable parameter at provided index
    */
-  const type::TransientValue &GetParam(uint32_t param_idx) const { return params_[param_idx]; }
+  const type::TransientValue &GetParam(uint32_t param_idx) const { return (*params_)[param_idx]; }
 
   /**
    * INSERT, UPDATE, and DELETE queries return a number for the rows affected, so this should be incremented in the root
@@ -146,7 +155,8 @@ class EXPORT ExecutionContext {
   std::unique_ptr<OutputBuffer> buffer_;
   StringAllocator string_allocator_;
   common::ManagedPointer<catalog::CatalogAccessor> accessor_;
-  std::vector<type::TransientValue> params_;
+  std::vector<type::TransientValue> owned_params_;
+  common::ManagedPointer<const std::vector<type::TransientValue>> params_ = nullptr;
   uint64_t rows_affected_ = 0;
 };
 }  // namespace terrier::execution::exec
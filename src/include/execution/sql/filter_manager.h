@@ -6,15 +6,25 @@
 
 #include "common/macros.h"
 #include "execution/bandit/policy.h"
+#include "execution/sql/projected_columns_iterator.h"
 #include "execution/util/execution_common.h"
 
 namespace terrier::execution::sql {
 
-class ProjectedColumnsIterator;
-
 /**
  * An adaptive filter manager that tries to discover the optimal filter
- * configuration.
+ * configuration. Two things are adapted as vectors flow through the filter:
+ * the implementation flavor of each clause, picked by a multi-armed bandit,
+ * and the order the clauses run in.
+ *
+ * The order is explored by sampling: on a sample vector, every clause runs on
+ * its own over the same input, which measures its cost per tuple and its
+ * selectivity independently of the others. The clauses then run in ascending
+ * order of cost / (1 - selectivity), so that cheap clauses that discard many
+ * tuples go first, until the next sample. Samples are taken every vector at
+ * first. The interval doubles every time a sample confirms the order, and
+ * drops back to every vector when a sample changes it, so the order follows
+ * the data when its distribution shifts during the scan.
  */
 class EXPORT FilterManager {
  public:
@@ -87,9 +97,33 @@ class EXPORT FilterManager {
    */
   uint32_t GetOptimalFlavorForClause(uint32_t clause_index) const;
 
+  /**
+   * Return the order the clauses will run in on the next vector
+   * @return The indexes of the clauses, in execution order
+   */
+  const std::vector<uint32_t> &GetOptimalClauseOrder() const { return optimal_clause_order_; }
+
  private:
-  // Run a specific clause of the filter
-  void RunFilterClause(ProjectedColumnsIterator *pci, uint32_t clause_index);
+  // Statistics of a clause from the latest sample, used to order the clauses
+  struct ClauseStats {
+    // Execution time per input tuple, in milliseconds
+    double cost_per_tuple_{0.0};
+    // Fraction of the input tuples that pass the clause
+    double selectivity_{1.0};
+  };
+
+  // Bounds of the number of vectors between two samples
+  static constexpr uint32_t MIN_SAMPLE_INTERVAL = 1;
+  static constexpr uint32_t MAX_SAMPLE_INTERVAL = 64;
+
+  // Run every clause on its own over the input, and re-sort the clauses by the ranks measured
+  void SampleClauses(ProjectedColumnsIterator *pci);
+
+  // Re-sort the clauses by their rank in the latest sample, returns true if the order changed
+  bool ReorderClauses();
+
+  // Run a specific clause of the filter, returns its execution time in milliseconds
+  double RunFilterClause(ProjectedColumnsIterator *pci, uint32_t clause_index);
 
   // Run the given matching function
   std::pair<uint32_t, double> RunFilterClauseImpl(ProjectedColumnsIterator *pci, FilterManager::MatchFn func);
@@ -110,6 +144,13 @@ class EXPORT FilterManager {
   std::unique_ptr<bandit::Policy> policy_;
   // The agents, one per clause
   std::vector<bandit::Agent> agents_;
+  // The statistics of the latest sample, one per clause
+  std::vector<ClauseStats> stats_;
+  // The input of the vector being sampled
+  std::unique_ptr<ProjectedColumnsIterator::Selection> sample_input_;
+  // Number of vectors between two samples, and number left until the next one
+  uint32_t sample_interval_{MIN_SAMPLE_INTERVAL};
+  uint32_t vectors_until_sample_{0};
   // Has the manager's clauses been finalized?
   bool finalized_{false};
 };
@@ -95,6 +95,8 @@ class EXPORT IndexIterator {
   std::vector<catalog::col_oid_t> col_oids_;
   common::ManagedPointer<storage::index::Index> index_;
   common::ManagedPointer<storage::SqlTable> table_;
+  // Layout version of the table's schema as seen by this txn
+  storage::layout_version_t layout_version_;
 
   uint32_t curr_index_ = 0;
   void *index_buffer_;
@@ -37,13 +37,24 @@ class EXPORT JoinHashTableVectorProbe {
   void Prepare(ProjectedColumnsIterator *pci, HashFn hash_fn);
 
   /**
-   * Return the next match, moving the input iterator if need be
+   * Return the next match, moving the input iterator if need be. Once the vector is exhausted, this keeps returning
+   * null until the next call to Prepare().
    * @param pci The input vector projection
    * @param key_eq_fn The function to check key equality
    * @return The next matching entry
    */
   const HashTableEntry *GetNextOutput(ProjectedColumnsIterator *pci, KeyEqFn key_eq_fn);
 
+  /**
+   * Filter the input vector down to the tuples that have at least one match in the table, or to those that have none
+   * if @em anti is set. This is all a semi or anti join needs: the chain of each tuple is only walked up to its first
+   * match, and no matches are handed out. Must be called right after Prepare().
+   * @param pci The input vector projection
+   * @param key_eq_fn The function to check key equality
+   * @param anti Whether to keep the tuples without a match instead
+   */
+  void FilterMatches(ProjectedColumnsIterator *pci, KeyEqFn key_eq_fn, bool anti);
+
  private:
   // The table we're probing
   const JoinHashTable &table_;
@@ -64,7 +75,11 @@ class EXPORT JoinHashTableVectorProbe {
 inline const HashTableEntry *JoinHashTableVectorProbe::GetNextOutput(ProjectedColumnsIterator *const pci,
                                                                      const KeyEqFn key_eq_fn) {
   TERRIER_ASSERT(pci != nullptr, "No input PCI!");
-  TERRIER_ASSERT(match_idx_ < pci->NumSelected(), "Continuing past iteration!");
+
+  // The vector is exhausted (or was empty to begin with, in which case entries_ holds no results from Prepare())
+  if (match_idx_ >= pci->NumSelected()) {
+    return nullptr;
+  }
 
   while (true) {
     // Continue along current chain until we find a match
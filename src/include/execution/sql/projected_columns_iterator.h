@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
 #include <type_traits>
 #include "storage/projected_columns.h"
@@ -118,6 +120,28 @@ class EXPORT ProjectedColumnsIterator {
    */
   void ResetFiltered();
 
+  /**
+   * The tuples an iterator has selected, @see SaveSelection
+   */
+  struct Selection {
+    /** copy of the iterator's selection vector */
+    uint32_t selection_vector_[common::Constants::K_DEFAULT_VECTOR_SIZE];
+    /** number of selected tuples */
+    uint32_t num_selected_;
+  };
+
+  /**
+   * Copy the tuples currently selected, so that filters can be run over the same input again
+   * @param[out] selection where to copy the selection to
+   */
+  void SaveSelection(Selection *selection) const;
+
+  /**
+   * Select the tuples of a copy again, and reset iteration to the first of them
+   * @param selection the copy to restore
+   */
+  void RestoreSelection(const Selection &selection);
+
   /**
    * Run a function over each active tuple in the projection. This is a
    * read-only function (despite it being non-const), meaning the callback must
@@ -166,10 +190,27 @@ class EXPORT ProjectedColumnsIterator {
      * an int64_t filter value
      */
     int64_t bi_;
+    /**
+     * a bool filter value
+     */
+    bool b_;
+    /**
+     * a date filter value, in the native representation of sql::Date
+     */
+    uint32_t date_;
+    /**
+     * a timestamp filter value, in the native representation of sql::Timestamp
+     */
+    uint64_t ts_;
+    /**
+     * a double filter value
+     */
+    double d_;
   };
 
   /**
-   * Creates a filter value according to the given type.
+   * Creates a filter value according to the given type. Dates and timestamps are passed in their native
+   * representation, and doubles as their bit pattern.
    * @param val filter value
    * @param type type of the value
    * @return filter val of the given type
@@ -184,13 +225,25 @@ class EXPORT ProjectedColumnsIterator {
         return FilterVal{.i_ = static_cast<int32_t>(val)};
       case type::TypeId::BIGINT:
         return FilterVal{.bi_ = static_cast<int64_t>(val)};
+      case type::TypeId::BOOLEAN:
+        return FilterVal{.b_ = val != 0};
+      case type::TypeId::DATE:
+        return FilterVal{.date_ = static_cast<uint32_t>(val)};
+      case type::TypeId::TIMESTAMP:
+        return FilterVal{.ts_ = static_cast<uint64_t>(val)};
+      case type::TypeId::DECIMAL: {
+        FilterVal filter_val{.d_ = 0};
+        std::memcpy(&filter_val.d_, &val, sizeof(double));
+        return filter_val;
+      }
       default:
         throw std::runtime_error("Filter not supported on type");
     }
   }
 
   /**
-   * Filter the column at index @em col_idx by the given constant value @em val.
+   * Filter the column at index @em col_idx by the given constant value @em val. Like a SQL comparison, NULL values
+   * never pass the filter.
    * @tparam Op The filtering operator.
    * @param col_idx The index of the column in the projection to filter.
    * @param type The type of the column.
@@ -202,7 +255,7 @@ class EXPORT ProjectedColumnsIterator {
 
   /**
    * Filter the column at index @em col_idx_1 with the contents of the column
-   * at index @em col_idx_2.
+   * at index @em col_idx_2. Tuples where either column is NULL never pass the filter.
    * @tparam Op The filtering operator.
    * @param col_idx_1 The index of the first column to compare.
    * @param type_1 the Type of the first column.
@@ -227,6 +280,9 @@ class EXPORT ProjectedColumnsIterator {
   template <typename T, template <typename> typename Op>
   uint32_t FilterColByColImpl(uint32_t col_idx_1, uint32_t col_idx_2);
 
+  // Remove the selected tuples whose value in the given column is NULL. The PCI must be filtered.
+  void RemoveNulls(uint32_t col_idx);
+
  private:
   // The selection vector used to filter the ProjectedColumns
   alignas(common::Constants::CACHELINE_SIZE) uint32_t selection_vector_[common::Constants::K_DEFAULT_VECTOR_SIZE];
@@ -307,6 +363,21 @@ inline void ProjectedColumnsIterator::ResetFiltered() {
   selection_vector_write_idx_ = 0;
 }
 
+inline void ProjectedColumnsIterator::SaveSelection(Selection *const selection) const {
+  // An unfiltered iterator only needs the marker in the first slot
+  const uint32_t num_slots = IsFiltered() ? std::max(num_selected_, 1u) : 1;
+  std::copy(selection_vector_, selection_vector_ + num_slots, selection->selection_vector_);
+  selection->num_selected_ = num_selected_;
+}
+
+inline void ProjectedColumnsIterator::RestoreSelection(const Selection &selection) {
+  const bool filtered = selection.selection_vector_[0] != K_INVALID_POS;
+  const uint32_t num_slots = filtered ? std::max(selection.num_selected_, 1u) : 1;
+  std::copy(selection.selection_vector_, selection.selection_vector_ + num_slots, selection_vector_);
+  num_selected_ = selection.num_selected_;
+  Reset();
+}
+
 template <typename F>
 inline void ProjectedColumnsIterator::ForEach(const F &fn) {
   // Ensure function conforms to expected form
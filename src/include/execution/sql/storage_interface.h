@@ -41,7 +41,8 @@ class EXPORT StorageInterface {
   bool TableDelete(storage::TupleSlot tuple_slot);
 
   /**
-   * Update a tuple in the table.
+   * Update a tuple in the table. If the tuple has to move to another layout version of the table, the entries of every
+   * index on the table are moved along with it.
    * @param table_tuple_slot tuple slot of the tuple.
    * @return Whether update was successful.
    */
@@ -78,6 +79,13 @@ class EXPORT StorageInterface {
   bool IndexInsertUnique();
 
  protected:
+  /**
+   * Moves the index entries of a tuple that an update moved to another slot. The indexed columns were not updated.
+   * @param old_slot slot the tuple was in before the update
+   * @param new_slot slot the tuple is in after the update
+   */
+  void MoveIndexEntries(storage::TupleSlot old_slot, storage::TupleSlot new_slot);
+
   /**
    * Oid of the table being accessed.
    */
@@ -86,6 +94,10 @@ class EXPORT StorageInterface {
    * Table being accessed.
    */
   common::ManagedPointer<terrier::storage::SqlTable> table_;
+  /**
+   * Layout version of the table's schema as seen by this txn. PRs are initialized against it.
+   */
+  storage::layout_version_t layout_version_;
   /**
    * The current execution context.
    */
@@ -96,6 +96,8 @@ class EXPORT TableVectorIterator {
   ProjectedColumnsIterator pci_;
   // SqlTable to iterate over
   common::ManagedPointer<storage::SqlTable> table_{nullptr};
+  // Layout version of the table's schema as seen by this txn
+  storage::layout_version_t layout_version_;
   // A PC and its buffer.
   void *buffer_ = nullptr;
   storage::ProjectedColumns *projected_columns_ = nullptr;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <type_traits>
 
 #include "execution/util/execution_common.h"
 #include "execution/util/simd.h"
@@ -37,10 +38,12 @@ class VectorUtil {
     static_assert(std::is_same_v<bool, std::invoke_result_t<Op<T>, T, T>>);
 
     uint32_t in_pos = 0;
-#if defined(__AVX2__) || defined(__AVX512F__)
-    uint32_t out_pos = simd::FilterVectorByVal<T, Op>(in, in_count, val, out, sel, &in_pos);
-#else
     uint32_t out_pos = 0;
+#if defined(__AVX2__) || defined(__AVX512F__)
+    // The SIMD filters only handle integers, the loops below filter the rest
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+      out_pos = simd::FilterVectorByVal<T, Op>(in, in_count, val, out, sel, &in_pos);
+    }
 #endif
 
     if (sel == nullptr) {
@@ -81,10 +84,12 @@ class VectorUtil {
     static_assert(std::is_same_v<bool, std::invoke_result_t<Op<T>, T, T>>);
 
     uint32_t in_pos = 0;
-#if defined(__AVX2__) || defined(__AVX512F__)
-    uint32_t out_pos = simd::FilterVectorByVector<T, Op>(in_1, in_2, in_count, out, sel, &in_pos);
-#else
     uint32_t out_pos = 0;
+#if defined(__AVX2__) || defined(__AVX512F__)
+    // The SIMD filters only handle integers, the loops below filter the rest
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+      out_pos = simd::FilterVectorByVector<T, Op>(in_1, in_2, in_count, out, sel, &in_pos);
+    }
 #endif
 
     if (sel == nullptr) {
@@ -107,6 +107,13 @@ class BytecodeEmitter {
    */
   void EmitAssignImm8(LocalVar dest, int64_t val);
 
+  /**
+   * Emit initialization code for a SQL integer from a constant.
+   * @param dest destination SQL integer
+   * @param val value to initialize it with
+   */
+  void EmitInitIntegerImm(LocalVar dest, int32_t val);
+
   // -------------------------------------------------------
   // Jumps
   // -------------------------------------------------------
@@ -335,6 +342,16 @@ class BytecodeEmitter {
    */
   void EmitPCIGet(Bytecode bytecode, LocalVar out, LocalVar pci, uint16_t col_idx);
 
+  /**
+   * Emit bytecode to read an integer from a PCI and compare it with a value
+   * @param bytecode PCI comparison bytecode
+   * @param dest destination of the comparison result
+   * @param pci PCI to read
+   * @param col_idx index of the column to read
+   * @param right value to compare with
+   */
+  void EmitPCICompare(Bytecode bytecode, LocalVar dest, LocalVar pci, uint16_t col_idx, LocalVar right);
+
   /**
    * Filter a column in the iterator by a constant value
    * @param bytecode filter bytecode to emit
@@ -347,6 +364,18 @@ class BytecodeEmitter {
   void EmitPCIVectorFilter(Bytecode bytecode, LocalVar selected, LocalVar pci, uint32_t col_idx, int8_t type,
                            int64_t val);
 
+  /**
+   * Filter a column in the iterator by a second column of the same type
+   * @param bytecode filter bytecode to emit
+   * @param selected output variable for the number of selected values
+   * @param pci PCI to filter
+   * @param col_idx index of the first column in the iterator
+   * @param type type of both columns
+   * @param col_idx_2 index of the second column in the iterator
+   */
+  void EmitPCIVectorColumnFilter(Bytecode bytecode, LocalVar selected, LocalVar pci, uint32_t col_idx, int8_t type,
+                                 uint32_t col_idx_2);
+
   /**
    * Insert a filter flavor into the filter manager builder
    */
@@ -380,6 +409,21 @@ class BytecodeEmitter {
   void EmitJoinHashTableIterHasNext(LocalVar has_more, LocalVar iterator, FunctionId key_eq, LocalVar opaque_ctx,
                                     LocalVar probe_tuple);
 
+  /**
+   * Compute the hashes of a probe vector and look up their chain heads
+   */
+  void EmitJoinHashTableVectorProbePrepare(LocalVar probe, LocalVar pci, FunctionId hash_fn);
+
+  /**
+   * Find the next match of the probe vector
+   */
+  void EmitJoinHashTableVectorProbeGetNext(LocalVar result, LocalVar probe, LocalVar pci, FunctionId key_eq_fn);
+
+  /**
+   * Filter the probe vector down to the tuples with (or without) a match
+   */
+  void EmitJoinHashTableVectorProbeFilter(LocalVar probe, LocalVar pci, FunctionId key_eq_fn, LocalVar anti);
+
   /**
    * Initialize a sorter instance
    */
@@ -128,6 +128,17 @@ class BytecodeGenerator : public ast::AstVisitor<BytecodeGenerator> {
   void VisitExpressionForTest(ast::Expr *expr, BytecodeLabel *then_label, BytecodeLabel *else_label,
                               TestFallthrough fallthrough);
 
+  // Superinstruction selection. Each returns false, having emitted nothing, if the expression doesn't fit.
+  // Emits a JumpIfSql{True,False} if the condition is the truth value of a SQL boolean
+  bool VisitSqlBoolForTest(ast::Expr *expr, BytecodeLabel *then_label, BytecodeLabel *else_label,
+                           TestFallthrough fallthrough);
+  // Emits an InitIntegerImm if the input of an integer-to-SQL conversion is a 32-bit literal
+  bool BuildInitIntegerImm(LocalVar dest, ast::Expr *input);
+  // Emits an AddAssign if the assignment adds a simple value to the location it stores into
+  bool BuildAddAssign(ast::AssignmentStmt *assign);
+  // Emits a PCI<Op>Integer if the left input of a SQL comparison is a @pciGetInt()
+  bool BuildPCICompare(LocalVar dest, ast::ComparisonOpExpr *compare);
+
   // Visit the body of an iteration statement
   void VisitIterationStatement(ast::IterationStmt *iteration, LoopBuilder *loop_builder);
 
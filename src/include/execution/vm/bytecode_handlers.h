@@ -14,6 +14,7 @@
 #include "execution/sql/functions/string_functions.h"
 #include "execution/sql/index_iterator.h"
 #include "execution/sql/join_hash_table.h"
+#include "execution/sql/join_hash_table_vector_probe.h"
 #include "execution/sql/projected_columns_iterator.h"
 #include "execution/sql/runtime_types.h"
 #include "execution/sql/sorter.h"
@@ -71,6 +72,9 @@ VM_OP_HOT void OpNot(bool *const result, const bool input) { *result = !input; }
   /* Primitive addition */                                                                 \
   VM_OP_HOT void OpAdd##_##type(type *result, type lhs, type rhs) { *result = lhs + rhs; } \
                                                                                            \
+  /* Primitive addition into memory, i.e. a deref, add and assign */                       \
+  VM_OP_HOT void OpAddAssign##_##type(type *result, type rhs) { *result += rhs; }          \
+                                                                                           \
   /* Primitive subtraction */                                                              \
   VM_OP_HOT void OpSub##_##type(type *result, type lhs, type rhs) { *result = lhs - rhs; } \
                                                                                            \
@@ -183,6 +187,10 @@ VM_OP_HOT bool OpJumpIfTrue(bool cond) { return cond; }
 
 VM_OP_HOT bool OpJumpIfFalse(bool cond) { return !cond; }
 
+VM_OP_HOT bool OpJumpIfSqlTrue(terrier::execution::sql::BoolVal *cond) { return cond->ForceTruth(); }
+
+VM_OP_HOT bool OpJumpIfSqlFalse(terrier::execution::sql::BoolVal *cond) { return !cond->ForceTruth(); }
+
 VM_OP_HOT void OpCall(UNUSED_ATTRIBUTE uint16_t func_id, UNUSED_ATTRIBUTE uint16_t num_args) {}
 
 VM_OP_HOT void OpReturn() {}
@@ -539,6 +547,24 @@ VM_OP void OpPCIFilterLessThanEqual(uint64_t *size, terrier::execution::sql::Pro
 VM_OP void OpPCIFilterNotEqual(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
                                uint32_t col_idx, int8_t type, int64_t val);
 
+VM_OP void OpPCIFilterColEqual(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                               uint32_t col_idx, int8_t type, uint32_t col_idx_2);
+
+VM_OP void OpPCIFilterColGreaterThan(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                                     uint32_t col_idx, int8_t type, uint32_t col_idx_2);
+
+VM_OP void OpPCIFilterColGreaterThanEqual(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                                          uint32_t col_idx, int8_t type, uint32_t col_idx_2);
+
+VM_OP void OpPCIFilterColLessThan(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                                  uint32_t col_idx, int8_t type, uint32_t col_idx_2);
+
+VM_OP void OpPCIFilterColLessThanEqual(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                                       uint32_t col_idx, int8_t type, uint32_t col_idx_2);
+
+VM_OP void OpPCIFilterColNotEqual(uint64_t *size, terrier::execution::sql::ProjectedColumnsIterator *iter,
+                                  uint32_t col_idx, int8_t type, uint32_t col_idx_2);
+
 // ---------------------------------------------------------
 // Hashing
 // ---------------------------------------------------------
@@ -599,6 +625,11 @@ VM_OP_HOT void OpInitInteger(terrier::execution::sql::Integer *result, int32_t i
   result->val_ = input;
 }
 
+VM_OP_HOT void OpInitIntegerImm(terrier::execution::sql::Integer *result, int32_t input) {
+  result->is_null_ = false;
+  result->val_ = input;
+}
+
 VM_OP_HOT void OpInitReal(terrier::execution::sql::Real *result, double input) {
   result->is_null_ = false;
   result->val_ = input;
@@ -669,6 +700,24 @@ GEN_SQL_COMPARISONS(DateVal)
 GEN_SQL_COMPARISONS(TimestampVal)
 #undef GEN_SQL_COMPARISONS
 
+// Superinstructions: a PCIGetInteger followed by a comparison of the value read
+#define GEN_PCI_COMPARISON(OP)                                                                                      \
+  VM_OP_HOT void OpPCI##OP##Integer(terrier::execution::sql::BoolVal *const result,                                 \
+                                    terrier::execution::sql::ProjectedColumnsIterator *const iter,                  \
+                                    const uint16_t col_idx, const terrier::execution::sql::Integer *const right) { \
+    terrier::execution::sql::Integer left(0);                                                                       \
+    OpPCIGetInteger(&left, iter, col_idx);                                                                          \
+    Op##OP##Integer(result, &left, right);                                                                          \
+  }
+
+GEN_PCI_COMPARISON(GreaterThan)
+GEN_PCI_COMPARISON(GreaterThanEqual)
+GEN_PCI_COMPARISON(Equal)
+GEN_PCI_COMPARISON(LessThan)
+GEN_PCI_COMPARISON(LessThanEqual)
+GEN_PCI_COMPARISON(NotEqual)
+#undef GEN_PCI_COMPARISON
+
 // ----------------------------------
 // SQL arithmetic
 // ---------------------------------
@@ -1092,7 +1141,7 @@ VM_OP_HOT void OpAvgAggregateFree(terrier::execution::sql::AvgAggregate *agg) {
 // ---------------------------------------------------------
 
 VM_OP void OpJoinHashTableInit(terrier::execution::sql::JoinHashTable *join_hash_table,
-                               terrier::execution::sql::MemoryPool *memory, uint32_t tuple_size);
+                               terrier::execution::sql::MemoryPool *memory, uint32_t tuple_size, bool use_concise_ht);
 
 VM_OP_HOT void OpJoinHashTableAllocTuple(terrier::byte **result,
                                          terrier::execution::sql::JoinHashTable *join_hash_table,
@@ -1108,7 +1157,11 @@ VM_OP void OpJoinHashTableBuildParallel(terrier::execution::sql::JoinHashTable *
 
 VM_OP_HOT void OpJoinHashTableIterInit(terrier::execution::sql::JoinHashTableIterator *result,
                                        terrier::execution::sql::JoinHashTable *join_hash_table, terrier::hash_t hash) {
-  *result = join_hash_table->Lookup<false>(hash);
+  if (join_hash_table->UseConciseHashTable()) {
+    *result = join_hash_table->Lookup<true>(hash);
+  } else {
+    *result = join_hash_table->Lookup<false>(hash);
+  }
 }
 
 VM_OP_HOT void OpJoinHashTableIterHasNext(bool *has_more, terrier::execution::sql::JoinHashTableIterator *iterator,
@@ -1128,6 +1181,32 @@ VM_OP_HOT void OpJoinHashTableIterClose(terrier::execution::sql::JoinHashTableIt
 
 VM_OP void OpJoinHashTableFree(terrier::execution::sql::JoinHashTable *join_hash_table);
 
+VM_OP void OpJoinHashTableVectorProbeInit(terrier::execution::sql::JoinHashTableVectorProbe *probe,
+                                          terrier::execution::sql::JoinHashTable *join_hash_table);
+
+VM_OP_HOT void OpJoinHashTableVectorProbePrepare(terrier::execution::sql::JoinHashTableVectorProbe *probe,
+                                                 terrier::execution::sql::ProjectedColumnsIterator *pci,
+                                                 terrier::execution::sql::JoinHashTableVectorProbe::HashFn hash_fn) {
+  probe->Prepare(pci, hash_fn);
+}
+
+VM_OP_HOT void OpJoinHashTableVectorProbeGetNext(const terrier::byte **result,
+                                                 terrier::execution::sql::JoinHashTableVectorProbe *probe,
+                                                 terrier::execution::sql::ProjectedColumnsIterator *pci,
+                                                 terrier::execution::sql::JoinHashTableVectorProbe::KeyEqFn key_eq_fn) {
+  const auto *entry = probe->GetNextOutput(pci, key_eq_fn);
+  *result = (entry == nullptr ? nullptr : entry->payload_);
+}
+
+VM_OP_HOT void OpJoinHashTableVectorProbeFilter(terrier::execution::sql::JoinHashTableVectorProbe *probe,
+                                                terrier::execution::sql::ProjectedColumnsIterator *pci,
+                                                terrier::execution::sql::JoinHashTableVectorProbe::KeyEqFn key_eq_fn,
+                                                bool anti) {
+  probe->FilterMatches(pci, key_eq_fn, anti);
+}
+
+VM_OP void OpJoinHashTableVectorProbeFree(terrier::execution::sql::JoinHashTableVectorProbe *probe);
+
 // ---------------------------------------------------------
 // Sorting
 // ---------------------------------------------------------
@@ -54,6 +54,8 @@ namespace terrier::execution::vm {
   CREATE_FOR_NUMERIC_TYPES(F, Mul, OperandType::Local, OperandType::Local, OperandType::Local)                        \
   CREATE_FOR_NUMERIC_TYPES(F, Div, OperandType::Local, OperandType::Local, OperandType::Local)                        \
   CREATE_FOR_NUMERIC_TYPES(F, Rem, OperandType::Local, OperandType::Local, OperandType::Local)                        \
+  /* Superinstruction: add to a value in memory, without dereferencing it into a temporary first */                   \
+  CREATE_FOR_NUMERIC_TYPES(F, AddAssign, OperandType::Local, OperandType::Local)                                      \
   CREATE_FOR_INT_TYPES(F, BitAnd, OperandType::Local, OperandType::Local, OperandType::Local)                         \
   CREATE_FOR_INT_TYPES(F, BitOr, OperandType::Local, OperandType::Local, OperandType::Local)                          \
   CREATE_FOR_INT_TYPES(F, BitXor, OperandType::Local, OperandType::Local, OperandType::Local)                         \
@@ -71,6 +73,9 @@ namespace terrier::execution::vm {
   F(Jump, OperandType::JumpOffset)                                                                                    \
   F(JumpIfTrue, OperandType::Local, OperandType::JumpOffset)                                                          \
   F(JumpIfFalse, OperandType::Local, OperandType::JumpOffset)                                                         \
+  /* Superinstructions: test a SQL boolean and jump, without materializing its truth value */                        \
+  F(JumpIfSqlTrue, OperandType::Local, OperandType::JumpOffset)                                                       \
+  F(JumpIfSqlFalse, OperandType::Local, OperandType::JumpOffset)                                                      \
                                                                                                                       \
   /* Memory/pointer operations */                                                                                     \
   F(IsNullPtr, OperandType::Local, OperandType::Local)                                                                \
@@ -150,6 +155,13 @@ namespace terrier::execution::vm {
   F(PCIGetDateValNull, OperandType::Local, OperandType::Local, OperandType::UImm2)                                    \
   F(PCIGetTimestampValNull, OperandType::Local, OperandType::Local, OperandType::UImm2)                               \
   F(PCIGetVarlenNull, OperandType::Local, OperandType::Local, OperandType::UImm2)                                     \
+  /* Superinstructions: read an integer column and compare it, without materializing it first */                      \
+  F(PCIGreaterThanInteger, OperandType::Local, OperandType::Local, OperandType::UImm2, OperandType::Local)            \
+  F(PCIGreaterThanEqualInteger, OperandType::Local, OperandType::Local, OperandType::UImm2, OperandType::Local)       \
+  F(PCIEqualInteger, OperandType::Local, OperandType::Local, OperandType::UImm2, OperandType::Local)                  \
+  F(PCILessThanInteger, OperandType::Local, OperandType::Local, OperandType::UImm2, OperandType::Local)               \
+  F(PCILessThanEqualInteger, OperandType::Local, OperandType::Local, OperandType::UImm2, OperandType::Local)          \
+  F(PCINotEqualInteger, OperandType::Local, OperandType::Local, OperandType::UImm2, OperandType::Local)               \
   F(PCIFilterEqual, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1, OperandType::Imm8) \
   F(PCIFilterGreaterThan, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,              \
     OperandType::Imm8)                                                                                                \
@@ -161,6 +173,18 @@ namespace terrier::execution::vm {
     OperandType::Imm8)                                                                                                \
   F(PCIFilterNotEqual, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,                 \
     OperandType::Imm8)                                                                                                \
+  F(PCIFilterColEqual, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,                 \
+    OperandType::UImm4)                                                                                               \
+  F(PCIFilterColGreaterThan, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,           \
+    OperandType::UImm4)                                                                                               \
+  F(PCIFilterColGreaterThanEqual, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,      \
+    OperandType::UImm4)                                                                                               \
+  F(PCIFilterColLessThan, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,              \
+    OperandType::UImm4)                                                                                               \
+  F(PCIFilterColLessThanEqual, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,         \
+    OperandType::UImm4)                                                                                               \
+  F(PCIFilterColNotEqual, OperandType::Local, OperandType::Local, OperandType::UImm4, OperandType::Imm1,              \
+    OperandType::UImm4)                                                                                               \
                                                                                                                       \
   /* Filter Manager */                                                                                                \
   F(FilterManagerInit, OperandType::Local)                                                                            \
@@ -174,6 +198,7 @@ namespace terrier::execution::vm {
   F(ForceBoolTruth, OperandType::Local, OperandType::Local)                                                           \
   F(InitBoolVal, OperandType::Local, OperandType::Local)                                                              \
   F(InitInteger, OperandType::Local, OperandType::Local)                                                              \
+  F(InitIntegerImm, OperandType::Local, OperandType::Imm4)                                                            \
   F(InitReal, OperandType::Local, OperandType::Local)                                                                 \
   F(InitDate, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local)                         \
   F(InitTimestamp, OperandType::Local, OperandType::Local)                                                            \
@@ -320,7 +345,7 @@ namespace terrier::execution::vm {
   F(RealMinAggregateFree, OperandType::Local)                                                                         \
                                                                                                                       \
   /* Hash Joins */                                                                                                    \
-  F(JoinHashTableInit, OperandType::Local, OperandType::Local, OperandType::Local)                                    \
+  F(JoinHashTableInit, OperandType::Local, OperandType::Local, OperandType::Local, OperandType::Local)                \
   F(JoinHashTableAllocTuple, OperandType::Local, OperandType::Local, OperandType::Local)                              \
   F(JoinHashTableIterInit, OperandType::Local, OperandType::Local, OperandType::Local)                                \
   F(JoinHashTableIterHasNext, OperandType::Local, OperandType::Local, OperandType::FunctionId, OperandType::Local,    \
@@ -330,6 +355,13 @@ namespace terrier::execution::vm {
   F(JoinHashTableBuild, OperandType::Local)                                                                           \
   F(JoinHashTableBuildParallel, OperandType::Local, OperandType::Local, OperandType::Local)                           \
   F(JoinHashTableFree, OperandType::Local)                                                                            \
+  F(JoinHashTableVectorProbeInit, OperandType::Local, OperandType::Local)                                             \
+  F(JoinHashTableVectorProbePrepare, OperandType::Local, OperandType::Local, OperandType::FunctionId)                 \
+  F(JoinHashTableVectorProbeGetNext, OperandType::Local, OperandType::Local, OperandType::Local,                      \
+    OperandType::FunctionId)                                                                                          \
+  F(JoinHashTableVectorProbeFilter, OperandType::Local, OperandType::Local, OperandType::FunctionId,                  \
+    OperandType::Local)                                                                                               \
+  F(JoinHashTableVectorProbeFree, OperandType::Local)                                                                 \
                                                                                                                       \
   /* Sorting */                                                                                                       \
   F(SorterInit, OperandType::Local, OperandType::Local, OperandType::FunctionId, OperandType::Local)                  \
@@ -605,7 +637,8 @@ class Bytecodes {
    * @return whether the given bytecode is a jump bytecode.
    */
   static constexpr bool IsJump(Bytecode bytecode) {
-    return (bytecode == Bytecode::Jump || bytecode == Bytecode::JumpIfFalse || bytecode == Bytecode::JumpIfTrue);
+    return (bytecode == Bytecode::Jump || bytecode == Bytecode::JumpIfFalse || bytecode == Bytecode::JumpIfTrue ||
+            bytecode == Bytecode::JumpIfSqlFalse || bytecode == Bytecode::JumpIfSqlTrue);
   }
 
   /**
@@ -120,15 +120,16 @@ class DBMain {
      * @param block_store_reuse_limit argument to the BlockStore
      * @param use_gc enable GarbageCollector
      * @param log_manager needed for safe destruction of StorageLayer
+     * @param gc_num_threads argument to the GarbageCollector
      */
     StorageLayer(const common::ManagedPointer<TransactionLayer> txn_layer, const uint64_t block_store_size_limit,
                  const uint64_t block_store_reuse_limit, const bool use_gc,
-                 const common::ManagedPointer<storage::LogManager> log_manager)
+                 const common::ManagedPointer<storage::LogManager> log_manager, const uint32_t gc_num_threads = 1)
         : deferred_action_manager_(txn_layer->GetDeferredActionManager()), log_manager_(log_manager) {
       if (use_gc)
-        garbage_collector_ = std::make_unique<storage::GarbageCollector>(txn_layer->GetTimestampManager(),
-                                                                         txn_layer->GetDeferredActionManager(),
-                                                                         txn_layer->GetTransactionManager(), DISABLED);
+        garbage_collector_ = std::make_unique<storage::GarbageCollector>(
+            txn_layer->GetTimestampManager(), txn_layer->GetDeferredActionManager(),
+            txn_layer->GetTransactionManager(), DISABLED, gc_num_threads);
 
       block_store_ = std::make_unique<storage::BlockStore>(block_store_size_limit, block_store_reuse_limit);
     }
@@ -229,15 +230,20 @@ class DBMain {
      * @param thread_registry argument to the TerrierServer
      * @param traffic_cop argument to the ConnectionHandleFactor
      * @param port needed for safe destruction of CatalogLayer if logging is enabled
+     * @param num_acceptors argument to the TerrierServer
+     * @param num_handlers argument to the TerrierServer
+     * @param socket_directory argument to the TerrierServer
      */
     NetworkLayer(const common::ManagedPointer<common::DedicatedThreadRegistry> thread_registry,
-                 const common::ManagedPointer<trafficcop::TrafficCop> traffic_cop, const uint16_t port) {
+                 const common::ManagedPointer<trafficcop::TrafficCop> traffic_cop, const uint16_t port,
+                 const uint32_t num_acceptors, const uint32_t num_handlers, const std::string &socket_directory) {
       connection_handle_factory_ = std::make_unique<network::ConnectionHandleFactory>(traffic_cop);
       command_factory_ = std::make_unique<network::PostgresCommandFactory>();
       provider_ =
           std::make_unique<network::PostgresProtocolInterpreter::Provider>(common::ManagedPointer(command_factory_));
       server_ = std::make_unique<network::TerrierServer>(
-          common::ManagedPointer(provider_), common::ManagedPointer(connection_handle_factory_), thread_registry, port);
+          common::ManagedPointer(provider_), common::ManagedPointer(connection_handle_factory_), thread_registry, port,
+          num_acceptors, num_handlers, socket_directory);
     }
 
     /**
@@ -312,7 +318,7 @@ class DBMain {
 
       auto storage_layer =
           std::make_unique<StorageLayer>(common::ManagedPointer(txn_layer), block_store_size_, block_store_reuse_,
-                                         use_gc_, common::ManagedPointer(log_manager));
+                                         use_gc_, common::ManagedPointer(log_manager), gc_num_threads_);
 
       std::unique_ptr<CatalogLayer> catalog_layer = DISABLED;
       if (use_catalog_) {
@@ -327,7 +333,8 @@ class DBMain {
         TERRIER_ASSERT(use_gc_ && storage_layer->GetGarbageCollector() != DISABLED,
                        "GarbageCollectorThread needs GarbageCollector.");
         gc_thread = std::make_unique<storage::GarbageCollectorThread>(storage_layer->GetGarbageCollector(),
-                                                                      std::chrono::milliseconds{gc_interval_});
+                                                                      std::chrono::milliseconds{gc_interval_},
+                                                                      common::ManagedPointer(metrics_manager));
       }
 
       std::unique_ptr<optimizer::StatsStorage> stats_storage = DISABLED;
@@ -355,7 +362,9 @@ class DBMain {
       if (use_network_) {
         TERRIER_ASSERT(use_traffic_cop_ && traffic_cop != DISABLED, "NetworkLayer needs TrafficCopLayer.");
         network_layer = std::make_unique<NetworkLayer>(common::ManagedPointer(thread_registry),
-                                                       common::ManagedPointer(traffic_cop), network_port_);
+                                                       common::ManagedPointer(traffic_cop), network_port_,
+                                                       network_num_acceptors_, network_num_handlers_,
+                                                       uds_file_directory_);
       }
 
       db_main->settings_manager_ = std::move(settings_manager);
@@ -511,6 +520,15 @@ class DBMain {
       return *this;
     }
 
+    /**
+     * @param value GarbageCollector argument
+     * @return self reference for chaining
+     */
+    Builder &SetGCNumThreads(const uint32_t value) {
+      gc_num_threads_ = value;
+      return *this;
+    }
+
     /**
      * @param value use component
      * @return self reference for chaining
@@ -538,6 +556,33 @@ class DBMain {
       return *this;
     }
 
+    /**
+     * @param value TerrierServer argument
+     * @return self reference for chaining
+     */
+    Builder &SetNetworkNumAcceptors(const uint32_t value) {
+      network_num_acceptors_ = value;
+      return *this;
+    }
+
+    /**
+     * @param value TerrierServer argument
+     * @return self reference for chaining
+     */
+    Builder &SetNetworkNumHandlers(const uint32_t value) {
+      network_num_handlers_ = value;
+      return *this;
+    }
+
+    /**
+     * @param value TerrierServer argument
+     * @return self reference for chaining
+     */
+    Builder &SetUDSFileDirectory(const std::string &value) {
+      uds_file_directory_ = value;
+      return *this;
+    }
+
     /**
      * @param value RecordBufferSegmentPool argument
      * @return self reference for chaining
@@ -617,12 +662,16 @@ class DBMain {
     uint64_t block_store_size_ = 1e5;
     uint64_t block_store_reuse_ = 1e3;
     int32_t gc_interval_ = 10;
+    uint32_t gc_num_threads_ = 1;
     bool use_gc_thread_ = false;
     bool use_stats_storage_ = false;
     bool use_execution_ = false;
     bool use_traffic_cop_ = false;
     uint64_t optimizer_timeout_ = 5000;
     uint16_t network_port_ = 15721;
+    uint32_t network_num_acceptors_ = 1;
+    uint32_t network_num_handlers_ = 4;
+    std::string uds_file_directory_ = "/tmp";
     bool use_network_ = false;
 
     /**
@@ -650,8 +699,13 @@ class DBMain {
           static_cast<uint64_t>(settings_manager->GetInt64(settings::Param::log_persist_threshold));
 
       gc_interval_ = settings_manager->GetInt(settings::Param::gc_interval);
+      gc_num_threads_ = static_cast<uint32_t>(settings_manager->GetInt(settings::Param::gc_num_threads));
 
       network_port_ = static_cast<uint16_t>(settings_manager->GetInt(settings::Param::port));
+      network_num_acceptors_ =
+          static_cast<uint32_t>(settings_manager->GetInt(settings::Param::network_acceptor_threads));
+      network_num_handlers_ = static_cast<uint32_t>(settings_manager->GetInt(settings::Param::connection_thread_count));
+      uds_file_directory_ = settings_manager->GetString(settings::Param::uds_file_directory);
       optimizer_timeout_ = static_cast<uint64_t>(settings_manager->GetInt(settings::Param::task_execution_timeout));
 
       return settings_manager;
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>  //NOLINT
+#include <fstream>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include "metrics/abstract_metric.h"
+#include "metrics/metrics_util.h"
+
+namespace terrier::metrics {
+
+/**
+ * Raw data object for holding stats collected by the garbage collector
+ */
+class GarbageCollectionMetricRawData : public AbstractRawData {
+ public:
+  void Aggregate(AbstractRawData *const other) override {
+    auto other_db_metric = dynamic_cast<GarbageCollectionMetricRawData *>(other);
+    if (!other_db_metric->gc_data_.empty()) {
+      gc_data_.splice(gc_data_.cbegin(), other_db_metric->gc_data_);
+    }
+  }
+
+  /**
+   * @return the type of the metric this object is holding the data for
+   */
+  MetricsComponent GetMetricType() const override { return MetricsComponent::GARBAGECOLLECTION; }
+
+  /**
+   * Writes the data out to ofstreams
+   * @param outfiles vector of ofstreams to write to that have been opened by the MetricsManager
+   */
+  void ToCSV(std::vector<std::ofstream> *const outfiles) final {
+    TERRIER_ASSERT(outfiles->size() == FILES.size(), "Number of files passed to metric is wrong.");
+    TERRIER_ASSERT(std::count_if(outfiles->cbegin(), outfiles->cend(),
+                                 [](const std::ofstream &outfile) { return !outfile.is_open(); }) == 0,
+                   "Not all files are open.");
+
+    for (const auto &data : gc_data_) {
+      ((*outfiles)[0]) << data.now_ << "," << data.elapsed_us_ << "," << data.txns_deallocated_ << ","
+                       << data.txns_unlinked_ << "," << data.unlink_backlog_ << std::endl;
+    }
+    gc_data_.clear();
+  }
+
+  /**
+   * Files to use for writing to CSV.
+   */
+  static constexpr std::array<std::string_view, 1> FILES = {"./gc.csv"};
+
+  /**
+   * Columns to use for writing to CSV.
+   */
+  static constexpr std::array<std::string_view, 1> COLUMNS = {
+      "now,elapsed_us,txns_deallocated,txns_unlinked,unlink_backlog"};
+
+ private:
+  friend class GarbageCollectionMetric;
+  FRIEND_TEST(MetricsTests, GarbageCollectionCSVTest);
+
+  void RecordGCData(const uint64_t elapsed_us, const uint32_t txns_deallocated, const uint32_t txns_unlinked,
+                    const uint32_t unlink_backlog) {
+    gc_data_.emplace_back(elapsed_us, txns_deallocated, txns_unlinked, unlink_backlog);
+  }
+
+  struct Data {
+    Data(const uint64_t elapsed_us, const uint32_t txns_deallocated, const uint32_t txns_unlinked,
+         const uint32_t unlink_backlog)
+        : now_(MetricsUtil::Now()),
+          elapsed_us_(elapsed_us),
+          txns_deallocated_(txns_deallocated),
+          txns_unlinked_(txns_unlinked),
+          unlink_backlog_(unlink_backlog) {}
+    const uint64_t now_;
+    const uint64_t elapsed_us_;
+    const uint32_t txns_deallocated_;
+    const uint32_t txns_unlinked_;
+    const uint32_t unlink_backlog_;
+  };
+
+  std::list<Data> gc_data_;
+};
+
+/**
+ * Metrics for the garbage collector: time spent per invocation, and how far it lags behind committed transactions
+ */
+class GarbageCollectionMetric : public AbstractMetric<GarbageCollectionMetricRawData> {
+ private:
+  friend class MetricsStore;
+
+  void RecordGCData(const uint64_t elapsed_us, const uint32_t txns_deallocated, const uint32_t txns_unlinked,
+                    const uint32_t unlink_backlog) {
+    GetRawData()->RecordGCData(elapsed_us, txns_deallocated, txns_unlinked, unlink_backlog);
+  }
+};
+}  // namespace terrier::metrics
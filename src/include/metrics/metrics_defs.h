@@ -5,8 +5,8 @@ namespace terrier::metrics {
 /**
  * Metric types
  */
-enum class MetricsComponent : uint8_t { LOGGING, TRANSACTION };
+enum class MetricsComponent : uint8_t { LOGGING, TRANSACTION, GARBAGECOLLECTION };
 
-constexpr uint8_t NUM_COMPONENTS = 2;
+constexpr uint8_t NUM_COMPONENTS = 3;
 
 }  // namespace terrier::metrics
@@ -8,6 +8,7 @@
 #include "common/managed_pointer.h"
 #include "metrics/abstract_metric.h"
 #include "metrics/abstract_raw_data.h"
+#include "metrics/garbage_collection_metric.h"
 #include "metrics/logging_metric.h"
 #include "metrics/metrics_defs.h"
 #include "metrics/transaction_metric.h"
@@ -74,6 +75,20 @@ class MetricsStore {
     txn_metric_->RecordCommitData(elapsed_us, txn_start);
   }
 
+  /**
+   * Record metrics from a GarbageCollector invocation
+   * @param elapsed_us first entry of gc datapoint
+   * @param txns_deallocated second entry of gc datapoint
+   * @param txns_unlinked third entry of gc datapoint
+   * @param unlink_backlog fourth entry of gc datapoint
+   */
+  void RecordGCData(const uint64_t elapsed_us, const uint32_t txns_deallocated, const uint32_t txns_unlinked,
+                    const uint32_t unlink_backlog) {
+    TERRIER_ASSERT(ComponentEnabled(MetricsComponent::GARBAGECOLLECTION), "GarbageCollectionMetric not enabled.");
+    TERRIER_ASSERT(gc_metric_ != nullptr, "GarbageCollectionMetric not allocated. Check MetricsStore constructor.");
+    gc_metric_->RecordGCData(elapsed_us, txns_deallocated, txns_unlinked, unlink_backlog);
+  }
+
   /**
    * @param component metrics component to test
    * @return true if metrics enabled for this component, false otherwise
@@ -99,6 +114,7 @@ class MetricsStore {
 
   std::unique_ptr<LoggingMetric> logging_metric_;
   std::unique_ptr<TransactionMetric> txn_metric_;
+  std::unique_ptr<GarbageCollectionMetric> gc_metric_;
 
   const std::bitset<NUM_COMPONENTS> &enabled_metrics_;
 };
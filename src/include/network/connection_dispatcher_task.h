@@ -2,53 +2,40 @@
 
 #include <memory>
 #include <vector>
-#include "common/dedicated_thread_registry.h"
 #include "common/managed_pointer.h"
 #include "common/notifiable_task.h"
 #include "loggers/network_logger.h"
-#include "network/connection_handle_factory.h"
 #include "network/connection_handler_task.h"
 #include "network/network_types.h"
 
 namespace terrier::network {
 
 /**
- * @brief A ConnectionDispatcherTask on the main server thread and dispatches
- * incoming connections to handler threads.
- *
- * On RunTask(), the dispatcher registers a number of handlers with the dedicated thread registry. The registered
- * handlers will shut down during Terminate() of this task. ConnectionDispatcherTask is almost a pseudo-owner of the
- * ConnectionHandlerTask objects, but since we can't be both a DedicatedThreadTask/NotifiableTask and
- * DedicatedThreadOwner, we pass the original DedicatedThreadOwner (TerrierServer) value through to the
- * ConnectionHandlerTasks. TerrierServer ends up the DedicatedThreadOwner of both ConnectionDispatcherTask and
- * ConnectionHandlerTasks for its instance.
+ * @brief A ConnectionDispatcherTask accepts incoming connections on one listen socket and dispatches them to handler
+ * threads.
  *
+ * The TerrierServer may run several dispatchers, each accepting on its own SO_REUSEPORT socket bound to the same port,
+ * so that the kernel spreads incoming connections over them. All dispatchers of a server share the same set of
+ * ConnectionHandlerTasks, which the TerrierServer registers and stops itself.
  */
 class ConnectionDispatcherTask : public common::NotifiableTask {
  public:
   /**
    * Creates a new ConnectionDispatcherTask
    *
-   * @param num_handlers The number of handler tasks to spawn.
    * @param listen_fd The server socket fd to listen on.
-   * @param dedicated_thread_owner The DedicatedThreadOwner associated with this task
+   * @param handlers The handler tasks to dispatch connections to. Must stay valid for the lifetime of this task.
    * @param interpreter_provider provider that constructs protocol interpreters
-   * @param connection_handle_factory The connection handle factory pointer to pass down to the handlers
-   * @param thread_registry DedicatedThreadRegistry dependency needed because it eventually spawns more threads in
-   * RunTask
    */
-  ConnectionDispatcherTask(uint32_t num_handlers, int listen_fd, common::DedicatedThreadOwner *dedicated_thread_owner,
-                           common::ManagedPointer<ProtocolInterpreter::Provider> interpreter_provider,
-                           common::ManagedPointer<ConnectionHandleFactory> connection_handle_factory,
-                           common::ManagedPointer<common::DedicatedThreadRegistry> thread_registry);
+  ConnectionDispatcherTask(
+      int listen_fd, common::ManagedPointer<const std::vector<common::ManagedPointer<ConnectionHandlerTask>>> handlers,
+      common::ManagedPointer<ProtocolInterpreter::Provider> interpreter_provider);
 
   /**
    * @brief Dispatches the client connection at fd to a handler.
-   * Currently, the dispatch uses round-robin, and thread communication is
-   * achieved
-   * through channels. The dispatch writes a symbol to the fd that the handler
-   * is configured
-   * to receive updates on.
+   * The connection goes to the least loaded handler, @see ConnectionHandlerTask::Load
+   * Thread communication is achieved through channels. The dispatch writes a symbol to the fd that the handler is
+   * configured to receive updates on.
    *
    * @param fd the socket fd of the client connection being dispatched
    * @param flags Unused. This is here to conform to libevent callback function
@@ -57,24 +44,47 @@ class ConnectionDispatcherTask : public common::NotifiableTask {
   void DispatchConnection(int fd, int16_t flags);
 
   /**
-   * Creates all of the ConnectionHandlerTasks (num_handlers of them) and then sits in its event loop until stopped.
+   * Picks the handler with the lowest load. Ties go to the first such handler at or after start, so that successive
+   * calls with an advancing start spread connections round-robin over equally loaded handlers.
+   *
+   * @tparam LoadFn callable that returns the load of the handler with a given index, of a type that is ordered and
+   * whose value-initialized value is the lowest load, e.g. a count or a pair of counts
+   * @param num_handlers the number of handlers, must be positive
+   * @param start index of the handler to start the search at
+   * @param load returns the load of a handler
+   * @return the index of the handler to dispatch to
+   */
+  template <typename LoadFn>
+  static uint64_t LeastLoadedHandler(const uint64_t num_handlers, const uint64_t start, const LoadFn &load) {
+    using LoadType = decltype(load(start));
+    uint64_t handler_id = start;
+    LoadType min_load = load(start);
+    for (uint64_t i = 1; i < num_handlers && LoadType{} < min_load; i++) {
+      const uint64_t candidate = (start + i) % num_handlers;
+      const LoadType candidate_load = load(candidate);
+      if (candidate_load < min_load) {
+        handler_id = candidate;
+        min_load = candidate_load;
+      }
+    }
+    return handler_id;
+  }
+
+  /**
+   * Sits in its event loop until stopped.
    */
   void RunTask() override;
 
   /**
-   * Exits its event loop and then cleans up all of the ConnectionHandlerTasks before returning.
+   * Exits its event loop.
    */
   void Terminate() override;
 
  private:
-  const uint32_t num_handlers_;
-  common::DedicatedThreadOwner *const dedicated_thread_owner_;
-  const common::ManagedPointer<ConnectionHandleFactory> connection_handle_factory_;
-  const common::ManagedPointer<common::DedicatedThreadRegistry> thread_registry_;
+  const common::ManagedPointer<const std::vector<common::ManagedPointer<ConnectionHandlerTask>>> handlers_;
   const common::ManagedPointer<ProtocolInterpreter::Provider> interpreter_provider_;
-  std::vector<common::ManagedPointer<ConnectionHandlerTask>> handlers_;
-  // TODO(TianyuLi): have a smarter dispatch scheduler, we currently use round-robin
-  std::atomic<uint64_t> next_handler_;
+  // Where the search for the least loaded handler starts, so that ties are broken round-robin
+  uint64_t next_handler_;
 };
 
 }  // namespace terrier::network
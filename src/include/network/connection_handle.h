@@ -118,6 +118,7 @@ class ConnectionHandle {
    * @return The transition to trigger in the state machine after
    */
   Transition Process() {
+    SetBusy(true);
     auto transition = protocol_interpreter_->Process(io_wrapper_->GetReadBuffer(), io_wrapper_->GetWriteQueue(),
                                                      traffic_cop_, common::ManagedPointer(&context_));
     return transition;
@@ -143,6 +144,8 @@ class ConnectionHandle {
    * EV_TIMEOUT
    */
   void UpdateEventFlags(int16_t flags, int timeout_secs = 0) {
+    // Waiting for the client to send more means the request was answered
+    if ((flags & EV_WRITE) == 0) SetBusy(false);
     if ((flags & EV_TIMEOUT) != 0) {
       struct timeval timeout;
       struct timeval *timeout_str;
@@ -232,12 +235,24 @@ class ConnectionHandle {
   friend class StateMachine;
   friend class ConnectionHandleFactory;
 
+  // Counts the connection as busy on its handler while it processes a request, @see ConnectionHandlerTask::Load
+  void SetBusy(const bool busy) {
+    if (busy == busy_) return;
+    busy_ = busy;
+    if (busy) {
+      conn_handler_->RequestStarted();
+    } else {
+      conn_handler_->RequestFinished();
+    }
+  }
+
   std::unique_ptr<NetworkIoWrapper> io_wrapper_;
   common::ManagedPointer<ConnectionHandlerTask> conn_handler_;
   common::ManagedPointer<trafficcop::TrafficCop> traffic_cop_;
   std::unique_ptr<ProtocolInterpreter> protocol_interpreter_;
 
   StateMachine state_machine_{};
+  bool busy_ = false;
   struct event *network_event_ = nullptr, *workpool_event_ = nullptr;
 
   // TODO(Tianyu): Do we want to flatten this struct out into connection handle, or is this current separation
@@ -5,6 +5,7 @@
 #include <event2/event.h>
 #include <event2/listener.h>
 #include <unistd.h>
+#include <atomic>
 #include <deque>
 #include <memory>
 #include <utility>
@@ -59,6 +60,32 @@ class ConnectionHandlerTask : public common::NotifiableTask {
    */
   void HandleDispatch(int new_conn_recv_fd, int16_t flags);
 
+  /**
+   * Used by the dispatchers to balance connections across handlers. The handler thread serves its connections one
+   * event at a time, so what delays a new connection is the work in front of it: the connections the handler has not
+   * picked up yet, and those in the middle of a request. Idle sessions only break ties.
+   * @return the number of queued and busy connections of this handler, and the number of its connections that are not
+   * closed yet
+   */
+  std::pair<uint32_t, uint32_t> Load() const {
+    return {num_queued_.load() + num_busy_.load(), num_connections_.load()};
+  }
+
+  /**
+   * Called when a connection of this handler starts processing a request.
+   */
+  void RequestStarted() { num_busy_++; }
+
+  /**
+   * Called when a connection of this handler has answered its request and waits for the next one, or is closed.
+   */
+  void RequestFinished() { num_busy_--; }
+
+  /**
+   * Called when a connection of this handler is closed.
+   */
+  void ConnectionClosed() { num_connections_--; }
+
  private:
   /**
    * Using this latch+deque instead of the Common::ConcurrentQueue as the overhead is not worth
@@ -69,6 +96,12 @@ class ConnectionHandlerTask : public common::NotifiableTask {
    * each pair is represents <connection fd, ProtocolInterpreter>
    */
   std::deque<std::pair<int, std::unique_ptr<ProtocolInterpreter>>> jobs_;
+  // Connections handed to this handler that it has not picked up yet
+  std::atomic<uint32_t> num_queued_{0};
+  // Connections that are processing a request
+  std::atomic<uint32_t> num_busy_{0};
+  // Connections handed to this handler that are not closed yet
+  std::atomic<uint32_t> num_connections_{0};
   event *notify_event_;
   common::ManagedPointer<ConnectionHandleFactory> connection_handle_factory_;
 };
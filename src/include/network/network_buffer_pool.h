@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "common/macros.h"
+#include "common/spin_latch.h"
+#include "network/network_defs.h"
+
+namespace terrier::network {
+
+/**
+ * Recycles the storage of network buffers across all connections.
+ *
+ * Storage is handed out in size classes of doubling capacity, starting at SOCKET_BUFFER_CAPACITY and going up to the
+ * smallest class that holds a packet of PACKET_LEN_LIMIT bytes. Write queues that spill into more buffers for a large
+ * result and read buffers that grow for a large packet then take their memory from here instead of allocating and
+ * zeroing it every time, and give it back as soon as they are done with it.
+ */
+class NetworkBufferPool {
+ public:
+  DISALLOW_COPY_AND_MOVE(NetworkBufferPool)
+
+  /**
+   * @return the pool shared by all network buffers of this process
+   */
+  static NetworkBufferPool *Instance() {
+    static NetworkBufferPool instance;
+    return &instance;
+  }
+
+  /**
+   * @param capacity minimum number of bytes the storage must hold
+   * @return storage of the smallest size class that holds capacity many bytes
+   */
+  ByteBuf Get(size_t capacity);
+
+  /**
+   * Returns storage to the pool. It is freed instead if the pool already holds enough storage of its size class.
+   * @param buf storage obtained from Get
+   */
+  void Release(ByteBuf buf);
+
+ private:
+  NetworkBufferPool() = default;
+
+  // Number of size classes, enough for the largest packet a client may send
+  static constexpr uint32_t NUM_SIZE_CLASSES = 10;
+  static_assert((static_cast<size_t>(SOCKET_BUFFER_CAPACITY) << (NUM_SIZE_CLASSES - 1)) >= PACKET_LEN_LIMIT,
+                "The largest size class must hold the largest packet");
+  // Number of bytes kept for reuse in each size class, so that few large buffers are kept around
+  static constexpr size_t MAX_POOLED_BYTES_PER_CLASS = 4 * 1024 * 1024;
+
+  static size_t ClassCapacity(uint32_t size_class) {
+    return static_cast<size_t>(SOCKET_BUFFER_CAPACITY) << size_class;
+  }
+
+  common::SpinLatch latch_;
+  std::array<std::vector<ByteBuf>, NUM_SIZE_CLASSES> free_buffers_;
+};
+
+}  // namespace terrier::network
@@ -29,9 +29,6 @@ class ReadBuffer;
 // want anyone using it to directly access the socket downstream
 STRONG_TYPEDEF(connection_id_t, uint16_t);
 
-// For threads
-#define CONNECTION_THREAD_COUNT 4
-
 // Number of seconds to timeout on a client read
 #define READ_TIMEOUT (20 * 60)
 
@@ -94,6 +91,7 @@ enum class NetworkMessageType : unsigned char {
   // Commands
   PG_EXECUTE_COMMAND = 'E',
   PG_SYNC_COMMAND = 'S',
+  PG_FLUSH_COMMAND = 'H',
   PG_TERMINATE_COMMAND = 'X',
   PG_DESCRIBE_COMMAND = 'D',
   PG_BIND_COMMAND = 'B',
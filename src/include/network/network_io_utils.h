@@ -1,13 +1,17 @@
 #pragma once
 #include <arpa/inet.h>
+#include <sys/uio.h>
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common/exception.h"
 #include "common/managed_pointer.h"
+#include "network/network_buffer_pool.h"
 #include "network/network_defs.h"
 #include "util/portable_endian.h"
 
@@ -17,17 +21,25 @@ namespace terrier::network {
  * A plain old buffer with a movable cursor, the meaning of which is dependent
  * on the use case.
  *
- * The buffer has a fix capacity and one can write a variable amount of
- * meaningful bytes into it. We call this amount "size" of the buffer.
+ * The buffer has a capacity and one can write a variable amount of
+ * meaningful bytes into it. We call this amount "size" of the buffer. Its
+ * storage comes from the NetworkBufferPool and goes back to it on destruction.
  */
 class Buffer {
  public:
-  Buffer() { buf_.resize(capacity_); }
+  DISALLOW_COPY_AND_MOVE(Buffer)
+
+  Buffer() : Buffer(SOCKET_BUFFER_CAPACITY) {}
 
   /**
-   * Instantiates a new buffer and reserve capacity many bytes.
+   * Instantiates a new buffer and reserve at least capacity many bytes.
+   */
+  explicit Buffer(size_t capacity) : buf_(NetworkBufferPool::Instance()->Get(capacity)) {}
+
+  /**
+   * Returns the storage of the buffer to the pool
    */
-  explicit Buffer(size_t capacity) : capacity_(capacity) { buf_.resize(capacity_); }
+  ~Buffer() { NetworkBufferPool::Instance()->Release(std::move(buf_)); }
 
   /**
    * Reset the buffer pointer and clears content
@@ -64,7 +76,7 @@ class Buffer {
   /**
    * @return Capacity of the buffer (not actual size)
    */
-  size_t Capacity() const { return capacity_; }
+  size_t Capacity() const { return buf_.size(); }
 
   /**
    * Shift contents to align the current cursor with start of the buffer,
@@ -88,11 +100,6 @@ class Buffer {
    */
   size_t offset_ = 0;
 
-  /**
-   * Capacity of the buffer
-   */
-  const size_t capacity_ = SOCKET_BUFFER_CAPACITY;
-
   /**
    * Actual character buffer where bytes are held
    */
@@ -258,6 +265,36 @@ class ReadBuffer : public Buffer {
    */
   size_t BytesAvailable() { return size_ - offset_; }
 
+  /**
+   * Makes sure that a packet of the given size fits after the cursor, so that
+   * its bytes are read from the socket straight into this buffer instead of
+   * being copied into a separate one. The buffer moves to pooled storage of a
+   * larger size class if the packet is larger than its capacity.
+   * @param bytes size of the packet at the cursor
+   */
+  void EnsureCapacity(size_t bytes) {
+    if (bytes <= Capacity()) return;
+    ByteBuf larger = NetworkBufferPool::Instance()->Get(bytes);
+    std::copy(buf_.begin() + offset_, buf_.begin() + size_, larger.begin());
+    NetworkBufferPool::Instance()->Release(std::move(buf_));
+    buf_ = std::move(larger);
+    size_ -= offset_;
+    offset_ = 0;
+  }
+
+  /**
+   * Gives storage grown by EnsureCapacity back to the pool once all of its
+   * bytes have been consumed. Only the protocol interpreter may call this,
+   * after it has consumed a whole packet: while a packet header is pending,
+   * the rest of the packet has to be read into the grown storage.
+   */
+  void Shrink() {
+    if (HasMore() || Capacity() <= SOCKET_BUFFER_CAPACITY) return;
+    NetworkBufferPool::Instance()->Release(std::move(buf_));
+    buf_ = NetworkBufferPool::Instance()->Get(SOCKET_BUFFER_CAPACITY);
+    Reset();
+  }
+
   /**
    * Mark a chunk of bytes as read and return a view to the bytes read.
    *
@@ -303,17 +340,6 @@ class ReadBuffer : public Buffer {
  */
 class WriteBuffer : public Buffer {
  public:
-  /**
-   * Write as many bytes as possible using Posix write to fd
-   * @param fd File descriptor to write out to
-   * @return return value of Posix write
-   */
-  int WriteOutTo(int fd) {
-    ssize_t bytes_written = write(fd, &buf_[offset_], size_ - offset_);
-    if (bytes_written > 0) offset_ += bytes_written;
-    return static_cast<int>(bytes_written);
-  }
-
   /**
    * The remaining capacity of this buffer. This value is equal to the
    * maximum capacity minus the capacity already in use.
@@ -391,17 +417,43 @@ class WriteQueue {
   }
 
   /**
-   * @return The head of the WriteQueue
+   * @return Whether all buffers of the WriteQueue have been written out
    */
-  common::ManagedPointer<WriteBuffer> FlushHead() {
-    if (buffers_.size() > offset_) return common::ManagedPointer(buffers_[offset_]);
-    return nullptr;
-  }
+  bool Flushed() const { return offset_ == buffers_.size(); }
 
   /**
-   * Marks the head of the queue as flushed
+   * Write as many bytes as possible using a single Posix writev to fd,
+   * gathering all buffers that have not been written out yet. Buffers that
+   * were written out completely are marked flushed.
+   * @param fd File descriptor to write out to
+   * @return return value of Posix writev, or 0 if there was nothing to write
    */
-  void MarkHeadFlushed() { offset_++; }
+  int WriteOutTo(int fd) {
+    std::array<struct iovec, MAX_IOVECS> iovecs;
+    int num_iovecs = 0;
+    for (size_t i = offset_; i < buffers_.size() && num_iovecs < MAX_IOVECS; i++) {
+      WriteBuffer &buffer = *buffers_[i];
+      if (!buffer.HasMore()) continue;
+      iovecs[num_iovecs].iov_base = &buffer.buf_[buffer.offset_];
+      iovecs[num_iovecs].iov_len = buffer.size_ - buffer.offset_;
+      num_iovecs++;
+    }
+    ssize_t bytes_written = num_iovecs == 0 ? 0 : writev(fd, iovecs.data(), num_iovecs);
+
+    // Move the cursors past the bytes written, which may end in the middle of a buffer
+    size_t remaining = bytes_written > 0 ? static_cast<size_t>(bytes_written) : 0;
+    for (; offset_ < buffers_.size(); offset_++) {
+      WriteBuffer &buffer = *buffers_[offset_];
+      const size_t unwritten = buffer.size_ - buffer.offset_;
+      if (remaining < unwritten) {
+        buffer.Skip(remaining);
+        break;
+      }
+      buffer.Skip(unwritten);
+      remaining -= unwritten;
+    }
+    return static_cast<int>(bytes_written);
+  }
 
   /**
    * Force this WriteQueue to be flushed next time the network layer
@@ -455,6 +507,8 @@ class WriteQueue {
 
  private:
   friend class PacketWriter;
+  // Maximum number of buffers gathered by a single writev, well under IOV_MAX
+  static constexpr int MAX_IOVECS = 64;
   std::vector<std::unique_ptr<WriteBuffer>> buffers_;
   size_t offset_ = 0;
   bool flush_ = false;
@@ -464,10 +518,6 @@ class WriteQueue {
  * Encapsulates an input packet
  */
 struct InputPacket {
-  ~InputPacket() {
-    if (extended_) delete buf_;
-  }
-
   /**
    * Type of message this packet encodes
    */
@@ -479,7 +529,8 @@ struct InputPacket {
   size_t len_ = 0;
 
   /**
-   * ReadBuffer containing this packet's contents
+   * ReadBuffer containing this packet's contents. This is always the read
+   * buffer of the connection, grown if needed to hold the whole packet.
    */
   ReadBuffer *buf_;
 
@@ -488,22 +539,14 @@ struct InputPacket {
    */
   bool header_parsed_ = false;
 
-  /**
-   * Whether or not this packet's buffer was extended
-   */
-  bool extended_ = false;
-
   /**
    * Clears the packet's contents
    */
   virtual void Clear() {
     msg_type_ = NetworkMessageType::NULL_COMMAND;
     len_ = 0;
-
-    if (extended_) delete buf_;
     buf_ = nullptr;
     header_parsed_ = false;
-    extended_ = false;
   }
 };
 
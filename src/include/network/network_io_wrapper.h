@@ -49,13 +49,7 @@ class NetworkIoWrapper {
   bool ShouldFlush() { return out_->ShouldFlush(); }
 
   /**
-   * @brief Flushes the write buffer of this IOWrapper to the assigned fd
-   * @return The next transition for this client's state machine
-   */
-  Transition FlushWriteBuffer(common::ManagedPointer<WriteBuffer> wbuf);
-
-  /**
-   * @brief Flushes all writes to this IOWrapper
+   * @brief Flushes all writes to this IOWrapper, gathering the whole write queue into each write to the assigned fd
    * @return The next transition for this client's state machine
    */
   Transition FlushAllWrites();
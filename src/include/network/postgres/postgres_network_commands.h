@@ -41,14 +41,15 @@ class PostgresNetworkCommand : public NetworkCommand {
   PostgresNetworkCommand(const common::ManagedPointer<InputPacket> in, bool flush) : NetworkCommand(in, flush) {}
 };
 
-// Set all to force flush for now
 DEFINE_POSTGRES_COMMAND(SimpleQueryCommand, true);
-DEFINE_POSTGRES_COMMAND(ParseCommand, true);
-DEFINE_POSTGRES_COMMAND(BindCommand, true);
-DEFINE_POSTGRES_COMMAND(DescribeCommand, true);
-DEFINE_POSTGRES_COMMAND(ExecuteCommand, true);
+// Extended query messages are pipelined by clients up to a Sync (or Flush), so their responses are only flushed then
+DEFINE_POSTGRES_COMMAND(ParseCommand, false);
+DEFINE_POSTGRES_COMMAND(BindCommand, false);
+DEFINE_POSTGRES_COMMAND(DescribeCommand, false);
+DEFINE_POSTGRES_COMMAND(ExecuteCommand, false);
+DEFINE_POSTGRES_COMMAND(CloseCommand, false);
 DEFINE_POSTGRES_COMMAND(SyncCommand, true);
-DEFINE_POSTGRES_COMMAND(CloseCommand, true);
+DEFINE_POSTGRES_COMMAND(FlushCommand, true);
 DEFINE_POSTGRES_COMMAND(TerminateCommand, true);
 
 DEFINE_POSTGRES_COMMAND(EmptyCommand, true);
@@ -341,6 +341,11 @@ class PostgresPacketWriter : public PacketWriter {
    */
   void WriteBindComplete() { BeginPacket(NetworkMessageType::PG_BIND_COMPLETE).EndPacket(); }
 
+  /**
+   * Tells the client that the close command is complete.
+   */
+  void WriteCloseComplete() { BeginPacket(NetworkMessageType::PG_CLOSE_COMPLETE).EndPacket(); }
+
   /**
    * Write a data row from the execution engine back to the client
    * @param tuple pointer to the start of the row
@@ -375,6 +380,7 @@ class PostgresPacketWriter : public PacketWriter {
       if (val->is_null_) {
         // write a -1 for the length of the column value and continue to the next value
         AppendValue<int32_t>(static_cast<int32_t>(-1));
+        curr_offset += execution::sql::ValUtil::GetSqlSize(col.GetType());
         continue;
       }
 
@@ -441,6 +447,7 @@ class PostgresPacketWriter : public PacketWriter {
       if (val->is_null_) {
         // write a -1 for the length of the column value and continue to the next value
         AppendValue<int32_t>(static_cast<int32_t>(-1));
+        curr_offset += execution::sql::ValUtil::GetSqlSize(col.GetType());
         continue;
       }
 
@@ -4,6 +4,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "loggers/network_logger.h"
 #include "network/connection_context.h"
@@ -12,6 +13,8 @@
 #include "network/postgres/postgres_network_commands.h"
 #include "network/postgres/postgres_packet_writer.h"
 #include "network/protocol_interpreter.h"
+#include "traffic_cop/prepared_statement.h"
+#include "type/transient_value.h"
 
 namespace terrier::network {
 
@@ -101,6 +104,63 @@ class PostgresProtocolInterpreter : public ProtocolInterpreter {
                             common::ManagedPointer<trafficcop::TrafficCop> t_cop,
                             common::ManagedPointer<ConnectionContext> context);
 
+  /**
+   * A prepared statement bound to the values of its parameters by the Bind message
+   */
+  struct Portal {
+    /** statement the portal executes, owned by the interpreter */
+    common::ManagedPointer<trafficcop::PreparedStatement> statement_;
+    /** values of the statement's parameters */
+    std::vector<type::TransientValue> params_;
+  };
+
+  /**
+   * @return this connection's prepared statements, by statement name. The unnamed statement is "".
+   */
+  std::unordered_map<std::string, std::unique_ptr<trafficcop::PreparedStatement>> &Statements() { return statements_; }
+
+  /**
+   * @return this connection's portals, by portal name. The unnamed portal is "".
+   */
+  std::unordered_map<std::string, Portal> &Portals() { return portals_; }
+
+  /**
+   * Closes a prepared statement along with the portals that execute it. Closing one that does not exist does nothing.
+   * @param name name of the statement
+   */
+  void CloseStatement(const std::string &name) {
+    const auto statement = statements_.find(name);
+    if (statement == statements_.end()) return;
+    for (auto portal = portals_.begin(); portal != portals_.end();) {
+      portal = portal->second.statement_ == common::ManagedPointer(statement->second) ? portals_.erase(portal)
+                                                                                       : std::next(portal);
+    }
+    statements_.erase(statement);
+  }
+
+  /**
+   * Extended query messages outside of a transaction block run in one implicit transaction that the next Sync ends,
+   * like in postgres, so that a failed statement rolls back the ones before it in the pipeline.
+   * @return whether the connection's transaction is the implicit one
+   */
+  bool ImplicitTransaction() const { return implicit_txn_; }
+
+  /**
+   * @param implicit_txn whether the connection's transaction is the implicit one
+   */
+  void SetImplicitTransaction(const bool implicit_txn) { implicit_txn_ = implicit_txn; }
+
+  /**
+   * After an error in an extended query, postgres discards every message up to the next Sync
+   * @return whether messages are currently being discarded
+   */
+  bool SkipUntilSync() const { return skip_until_sync_; }
+
+  /**
+   * @param skip_until_sync whether to discard messages up to the next Sync
+   */
+  void SetSkipUntilSync(const bool skip_until_sync) { skip_until_sync_ = skip_until_sync; }
+
  protected:
   /**
    * @see ProtocolInterpreter::GetPacketHeaderSize
@@ -117,6 +177,10 @@ class PostgresProtocolInterpreter : public ProtocolInterpreter {
  private:
   bool startup_ = true;
   common::ManagedPointer<PostgresCommandFactory> command_factory_;
+  std::unordered_map<std::string, std::unique_ptr<trafficcop::PreparedStatement>> statements_;
+  std::unordered_map<std::string, Portal> portals_;
+  bool skip_until_sync_ = false;
+  bool implicit_txn_ = false;
 };
 
 }  // namespace terrier::network
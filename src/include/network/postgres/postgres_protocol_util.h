@@ -6,6 +6,7 @@
 #include "common/exception.h"
 #include "network/network_defs.h"
 #include "network/postgres/postgres_defs.h"
+#include "type/transient_value.h"
 
 namespace terrier::network {
 
@@ -31,6 +32,16 @@ class PostgresProtocolUtil {
    * @return output type
    */
   static PostgresValueType InternalValueTypeToPostgresValueType(type::TypeId type);
+
+  /**
+   * Convert the value of a parameter in a Bind message to the parameter's type.
+   * This will throw an exception if the value is malformed or does not fit the type.
+   * @param type type of the parameter
+   * @param format format of the value, text or binary (network byte order)
+   * @param value raw bytes of the value
+   * @return the value as a TransientValue of the given type
+   */
+  static type::TransientValue ParameterValue(type::TypeId type, FieldFormat format, const std::string &value);
 };
 
 }  // namespace terrier::network
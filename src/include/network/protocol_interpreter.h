@@ -107,18 +107,12 @@ class ProtocolInterpreter {
       throw NETWORK_PROCESS_EXCEPTION("Packet too large");
     }
 
-    TERRIER_ASSERT(!curr_input_packet_.extended_,
-                   "InputPacket shouldn't already be extended before beginning parsing of the body.");
-
-    // Extend the buffer as needed
+    // Grow the buffer as needed, so that the rest of the packet is read straight into it
     if (curr_input_packet_.len_ > in->Capacity()) {
-      // Allocate a larger buffer and copy bytes off from the I/O layer's buffer
-      curr_input_packet_.buf_ = new ReadBuffer(curr_input_packet_.len_);
       NETWORK_LOG_TRACE("Extended Buffer size required for packet of size {0}", curr_input_packet_.len_);
-      curr_input_packet_.extended_ = true;
-    } else {
-      curr_input_packet_.buf_ = in.Get();
     }
+    in->EnsureCapacity(curr_input_packet_.len_);
+    curr_input_packet_.buf_ = in.Get();
 
     curr_input_packet_.header_parsed_ = true;
     return true;
@@ -131,24 +125,7 @@ class ProtocolInterpreter {
    */
   bool TryBuildPacket(const common::ManagedPointer<ReadBuffer> in) {
     if (!TryReadPacketHeader(in)) return false;
-
-    size_t size_needed = curr_input_packet_.extended_
-                             ? curr_input_packet_.len_ - curr_input_packet_.buf_->BytesAvailable()
-                             : curr_input_packet_.len_;
-
-    size_t can_read = std::min(size_needed, in->BytesAvailable());
-    size_t remaining_bytes = size_needed - can_read;
-
-    // copy bytes only if the packet is longer than the read buffer,
-    // otherwise we can use the read buffer to save space
-    if (curr_input_packet_.extended_) {
-      TERRIER_ASSERT(curr_input_packet_.len_ == curr_input_packet_.buf_->Capacity(),
-                     "The buffer should have been extended to support the packet length. Otherwise, there's a mismatch "
-                     "between the extended_ flag.");
-      curr_input_packet_.buf_->FillBufferFrom(in, can_read);
-    }
-
-    return remaining_bytes <= 0;
+    return in->HasMore(curr_input_packet_.len_);
   }
 };
 //
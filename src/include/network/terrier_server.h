@@ -8,11 +8,14 @@
 #include <netinet/tcp.h>
 #include <pthread.h>
 #include <sys/file.h>
+#include <sys/stat.h>
+#include <sys/un.h>
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <memory>
+#include <string>
 #include <vector>
 #include "common/dedicated_thread_owner.h"
 #include "common/exception.h"
@@ -30,10 +33,18 @@ class TerrierServer : public common::DedicatedThreadOwner {
  public:
   /**
    * @brief Constructs a new TerrierServer instance.
+   * @param protocol_provider provider that constructs protocol interpreters
+   * @param connection_handle_factory factory for the handles of new connections
+   * @param thread_registry registry to run the acceptor and handler threads in
+   * @param port port to listen on
+   * @param num_acceptors number of threads that accept connections, each on its own SO_REUSEPORT socket
+   * @param num_handlers number of threads that serve the accepted connections
+   * @param socket_directory directory of the Unix domain socket to also listen on, or empty to only listen on TCP
    */
   TerrierServer(common::ManagedPointer<ProtocolInterpreter::Provider> protocol_provider,
                 common::ManagedPointer<ConnectionHandleFactory> connection_handle_factory,
-                common::ManagedPointer<common::DedicatedThreadRegistry> thread_registry, uint16_t port);
+                common::ManagedPointer<common::DedicatedThreadRegistry> thread_registry, uint16_t port,
+                uint32_t num_acceptors, uint32_t num_handlers, std::string socket_directory);
 
   ~TerrierServer() override = default;
 
@@ -54,6 +65,12 @@ class TerrierServer : public common::DedicatedThreadOwner {
    */
   void SetPort(uint16_t new_port);
 
+  /**
+   * @return path of the Unix domain socket the server listens on. This follows the Postgres naming convention, so that
+   * libpq clients can connect with host set to the socket directory.
+   */
+  std::string UnixSocketPath() const { return socket_directory_ + "/.s.PGSQL." + std::to_string(port_); }
+
   /**
    * @return true if the server is still running, false otherwise. Use as a predicate if you're waiting on the RunningCV
    * condition variable
@@ -83,12 +100,26 @@ class TerrierServer : public common::DedicatedThreadOwner {
   // For logging purposes
   // static void LogCallback(int severity, const char *msg);
 
-  uint16_t port_;                   // port number
-  int listen_fd_ = -1;              // server socket fd that TerrierServer is listening on
-  const uint32_t max_connections_;  // maximum number of connections
+  uint16_t port_;                       // port number
+  std::vector<int> listen_fds_;         // server socket fds that TerrierServer is listening on
+  const uint32_t num_acceptors_;        // number of acceptor threads on the TCP port
+  const uint32_t num_handlers_;         // number of connection handler threads
+  const std::string socket_directory_;  // directory of the Unix domain socket, empty if disabled
+  std::string socket_path_;             // path of the Unix domain socket while the server is running
+  ino_t socket_inode_ = 0;              // inode of the socket file this server created, to tell it from a newer one
+
+  // Opens a socket that accepts connections on port_ and shares the port with the sockets of the other acceptors
+  int OpenListenSocket();
+
+  // Opens a Unix domain socket that accepts connections from clients on the same host at UnixSocketPath()
+  int OpenUnixListenSocket();
+
+  // Removes the Unix domain socket file, but only if it is still the one this server created
+  void RemoveUnixSocketFile();
 
   common::ManagedPointer<ConnectionHandleFactory> connection_handle_factory_;
   common::ManagedPointer<ProtocolInterpreter::Provider> provider_;
-  common::ManagedPointer<ConnectionDispatcherTask> dispatcher_task_;
+  std::vector<common::ManagedPointer<ConnectionHandlerTask>> handlers_;
+  std::vector<common::ManagedPointer<ConnectionDispatcherTask>> dispatcher_tasks_;
 };
 }  // namespace terrier::network
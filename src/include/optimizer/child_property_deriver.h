@@ -134,6 +134,18 @@ class ChildPropertyDeriver : public OperatorVisitor {
    */
   void Visit(const OuterHashJoin *op) override;
 
+  /**
+   * Visitor function for LeftSemiHashJoin
+   * @param op LeftSemiHashJoin operator to visit
+   */
+  void Visit(const LeftSemiHashJoin *op) override;
+
+  /**
+   * Visitor function for LeftAntiHashJoin
+   * @param op LeftAntiHashJoin operator to visit
+   */
+  void Visit(const LeftAntiHashJoin *op) override;
+
   /**
    * Visitor function for Insert
    * @param op Insert operator to visit
@@ -15,7 +15,8 @@ class GroupExpression;
  * This cost model is meant to just be a trivial cost model. The decisions it makes are as follows
  * Always choose index scan (cost of 0) over sequential scan (cost of 1)
  * Choose NL if left rows is a single record (for single record lookup queries), else choose hash join
- * Choose hash group by over sort group by
+ * Choose sort group by when the input already comes sorted on the group by columns (e.g. from an index scan),
+ * otherwise choose hash group by, as sorting the input (cost of 2) costs more than hashing it (cost of 1)
  */
 class TrivialCostModel : public AbstractCostModel {
  public:
@@ -60,7 +61,7 @@ class TrivialCostModel : public AbstractCostModel {
    * Visit a OrderBy operator
    * @param op operator
    */
-  void Visit(UNUSED_ATTRIBUTE const OrderBy *op) override { output_cost_ = 0.f; }
+  void Visit(UNUSED_ATTRIBUTE const OrderBy *op) override { output_cost_ = 2.f; }
 
   /**
    * Visit a Limit operator
@@ -116,6 +117,18 @@ class TrivialCostModel : public AbstractCostModel {
    */
   void Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) override {}
 
+  /**
+   * Visit a LeftSemiHashJoin operator
+   * @param op operator
+   */
+  void Visit(UNUSED_ATTRIBUTE const LeftSemiHashJoin *op) override { output_cost_ = 1.f; }
+
+  /**
+   * Visit a LeftAntiHashJoin operator
+   * @param op operator
+   */
+  void Visit(UNUSED_ATTRIBUTE const LeftAntiHashJoin *op) override { output_cost_ = 1.f; }
+
   /**
    * Visit a Insert operator
    * @param op operator
@@ -144,13 +157,13 @@ class TrivialCostModel : public AbstractCostModel {
    * Visit a HashGroupBy operator
    * @param op operator
    */
-  void Visit(UNUSED_ATTRIBUTE const HashGroupBy *op) override { output_cost_ = 0.f; }
+  void Visit(UNUSED_ATTRIBUTE const HashGroupBy *op) override { output_cost_ = 1.f; }
 
   /**
    * Visit a SortGroupBy operator
    * @param op operator
    */
-  void Visit(UNUSED_ATTRIBUTE const SortGroupBy *op) override { output_cost_ = 1.f; }
+  void Visit(UNUSED_ATTRIBUTE const SortGroupBy *op) override { output_cost_ = 0.f; }
 
   /**
    * Visit a Aggregate operator
@@ -10,6 +10,7 @@
 #include "common/hash_util.h"
 #include "optimizer/group.h"
 #include "optimizer/operator_node_contents.h"
+#include "optimizer/optimizer_arena.h"
 #include "optimizer/optimizer_defs.h"
 #include "optimizer/property_set.h"
 #include "optimizer/rule.h"
@@ -19,9 +20,9 @@ namespace terrier::optimizer {
 /**
  * GroupExpression used to represent a particular logical or physical
  * operator expression within a group that abstracts away the specific
- * OperatorNode of a Group.
+ * OperatorNode of a Group. GroupExpressions are allocated from the OptimizerContext's arena.
  */
-class GroupExpression {
+class GroupExpression : public ArenaObject {
  public:
   /**
    * Constructor for GroupExpression
@@ -9,8 +9,10 @@
 #include "catalog/catalog_accessor.h"
 #include "catalog/index_schema.h"
 #include "optimizer/properties.h"
+#include "parser/expression/constant_value_expression.h"
 #include "parser/expression_util.h"
 #include "type/transient_value_factory.h"
+#include "type/transient_value_peeker.h"
 
 namespace terrier::optimizer {
 
@@ -32,10 +34,12 @@ class IndexUtil {
   static bool CheckSortProperty(const PropertySort *prop) {
     auto sort_col_size = prop->GetSortColumnSize();
     for (size_t idx = 0; idx < sort_col_size; idx++) {
-      // TODO(wz2): Consider descending when catalog/index support
-      auto is_asc = prop->GetSortAscending(static_cast<int>(idx)) == optimizer::OrderByOrderingType::ASC;
+      // Indexes are ascending, so they are scanned forwards for Sort(a ASC, b ASC) and backwards for
+      // Sort(a DESC, b DESC). Sort(a ASC, b DESC) cannot be fulfilled either way.
+      // TODO(wz2): Consider descending index columns when catalog/index support
+      auto same_dir = prop->GetSortAscending(static_cast<int>(idx)) == prop->GetSortAscending(0);
       auto is_base = IsBaseColumn(prop->GetSortColumn(static_cast<int>(idx)));
-      if (!is_asc || !is_base) {
+      if (!same_dir || !is_base) {
         return false;
       }
     }
@@ -43,10 +47,19 @@ class IndexUtil {
     return true;
   }
 
+  /**
+   * @param prop PropertySort that passed CheckSortProperty
+   * @returns TRUE if the sort is descending, i.e. needs a backward index scan
+   */
+  static bool IsDescendingSort(const PropertySort *prop) {
+    return prop->GetSortColumnSize() > 0 && prop->GetSortAscending(0) == optimizer::OrderByOrderingType::DESC;
+  }
+
   /**
    * Checks whether a given index can be used to satisfy a property.
    * For an index to fulfill the sort property, the columns sorted
-   * on must be in the same order and in the same direction.
+   * on must be in the same order. A descending sort is fulfilled
+   * by scanning the index backwards.
    *
    * @param accessor CatalogAccessor
    * @param prop PropertySort to satisfy
@@ -90,6 +103,16 @@ class IndexUtil {
       }
     }
 
+    // A backward scan covers the whole index, which the storage interface only takes as a range from the smallest to
+    // the largest key. Those bounds are only generated for non-nullable integer keys.
+    if (IsDescendingSort(prop)) {
+      for (const auto &col : index_schema.GetColumns()) {
+        if (!IsIntegralType(col.Type()) || col.Nullable()) {
+          return false;
+        }
+      }
+    }
+
     return true;
   }
 
@@ -144,10 +167,14 @@ class IndexUtil {
       planner::IndexScanType *idx_scan_type,
       std::unordered_map<catalog::indexkeycol_oid_t, std::vector<planner::IndexExpression>> *bounds) {
     // TODO(wz2): Eventually consider supporting concatenating/shrinking ranges
-    // Right now, this implementation only allows at most 1 range for an indexed column.
+    // Right now, this implementation only allows at most 1 range for an indexed column. Since every predicate is
+    // still evaluated by the scan predicate, any bound that holds is correct: the first one found for a side of the
+    // range is used, an equality takes precedence over ranges, and predicates that can't bound the index (e.g. ORs,
+    // IN lists) are simply left to the scan predicate.
     // To concatenate/shrink ranges, we would need to be able to compare TransientValues.
     std::unordered_map<catalog::indexkeycol_oid_t, planner::IndexExpression> open_highs;  // <index, low start>
     std::unordered_map<catalog::indexkeycol_oid_t, planner::IndexExpression> open_lows;   // <index, high end>
+    std::unordered_set<catalog::indexkeycol_oid_t> exacts;
     for (const auto &pred : predicates) {
       auto expr = pred.GetExpr();
       if (expr->HasSubquery()) return false;
@@ -188,30 +215,67 @@ class IndexUtil {
 
           auto col_oid = tv_expr->GetColumnOid();
           if (mapped_cols.find(col_oid) != mapped_cols.end()) {
-            // Try to insert into open_highs/open_lows depending on the comparison.
-            // Under iteration 1, if a bound already exists, then this fails.
-            // Revert to sequential scan
             auto idxkey = lookup.find(col_oid)->second;
-            bool ins_success = true;
             if (type == parser::ExpressionType::COMPARE_EQUAL) {
               // Exact is simulated as open high of idx_expr and open low of idx_expr
-              ins_success = ins_success && open_highs.insert(std::make_pair(idxkey, idx_expr)).second;
-              ins_success = ins_success && open_lows.insert(std::make_pair(idxkey, idx_expr)).second;
+              if (!exacts.insert(idxkey).second) continue;
+              open_highs[idxkey] = idx_expr;
+              open_lows[idxkey] = idx_expr;
+            } else if (exacts.find(idxkey) != exacts.end()) {
+              continue;
             } else if (type == parser::ExpressionType::COMPARE_LESS_THAN ||
                        type == parser::ExpressionType::COMPARE_LESS_THAN_OR_EQUAL_TO) {
-              ins_success = open_lows.insert(std::make_pair(idxkey, idx_expr)).second;
+              open_lows.insert(std::make_pair(idxkey, idx_expr));
             } else if (type == parser::ExpressionType::COMPARE_GREATER_THAN ||
                        type == parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO) {
-              ins_success = open_highs.insert(std::make_pair(idxkey, idx_expr)).second;
+              open_highs.insert(std::make_pair(idxkey, idx_expr));
             }
-
-            if (!ins_success) return false;
+          }
+          break;
+        }
+        case parser::ExpressionType::COMPARE_IN: {
+          // [column] IN ([value], ...) with integer constants is bounded by the smallest and the largest value. The
+          // values in between are filtered out by the scan predicate, which still evaluates the list.
+          if (expr->GetChild(0)->GetExpressionType() != parser::ExpressionType::COLUMN_VALUE) continue;
+          auto col_oid = expr->GetChild(0).CastManagedPointerTo<parser::ColumnValueExpression>()->GetColumnOid();
+          if (mapped_cols.find(col_oid) == mapped_cols.end()) continue;
+
+          size_t min_idx = 0;
+          size_t max_idx = 0;
+          int64_t min = 0;
+          int64_t max = 0;
+          bool constants = true;
+          for (size_t idx = 1; idx < expr->GetChildrenSize() && constants; idx++) {
+            int64_t value;
+            constants = PeekIntegralConstant(expr->GetChild(idx), &value);
+            if (constants && (min_idx == 0 || value < min)) {
+              min = value;
+              min_idx = idx;
+            }
+            if (constants && (max_idx == 0 || value > max)) {
+              max = value;
+              max_idx = idx;
+            }
+          }
+          if (!constants || min_idx == 0) continue;
+
+          auto idxkey = lookup.find(col_oid)->second;
+          if (exacts.find(idxkey) != exacts.end()) continue;
+          if (min == max) {
+            // A list of one value is an equality
+            exacts.insert(idxkey);
+            open_highs[idxkey] = expr->GetChild(min_idx);
+            open_lows[idxkey] = expr->GetChild(min_idx);
+          } else {
+            open_highs.insert(std::make_pair(idxkey, expr->GetChild(min_idx)));
+            open_lows.insert(std::make_pair(idxkey, expr->GetChild(max_idx)));
           }
           break;
         }
         default:
-          // If a predicate can enlarge the result set, then (for now), reject.
-          return false;
+          // Anything else (ORs, IN lists of other values, ...) can't bound the index, but as a conjunct it can't
+          // enlarge the result set either. It is left to the scan predicate.
+          continue;
       }
     }
 
@@ -233,6 +297,13 @@ class IndexUtil {
         break;
       }
 
+      // A range that is open on one side, after columns that are bounded on both sides (e.g. a = 1 AND b > 5 on an
+      // index over (a, b)), is closed with the smallest/largest value of the column's type. Otherwise the scan would
+      // run from (1, 5) to the end of the index, instead of stopping after (1, MAX).
+      bool close_range = !bounds->empty() && IsIntegralType(col.Type()) &&
+                         (scan_type == planner::IndexScanType::Exact ||
+                          scan_type == planner::IndexScanType::AscendingClosed);
+
       if (open_highs.find(oid) != open_highs.end() && open_lows.find(oid) != open_lows.end()) {
         bounds->insert(std::make_pair(oid, std::vector<planner::IndexExpression>{open_highs[oid], open_lows[oid]}));
 
@@ -241,6 +312,14 @@ class IndexUtil {
         // picking the right low/high key at the plan_generator stage of processing.
         if (open_highs[oid] != open_lows[oid] && scan_type == planner::IndexScanType::Exact)
           scan_type = planner::IndexScanType::AscendingClosed;
+      } else if (close_range) {
+        // The missing side of the range (nullptr) is filled in by the PlanGenerator. Any further column would be
+        // compared against that extreme value, so the remaining predicates are left to the scan predicate.
+        auto high = open_highs.find(oid) != open_highs.end() ? open_highs[oid] : planner::IndexExpression(nullptr);
+        auto low = open_lows.find(oid) != open_lows.end() ? open_lows[oid] : planner::IndexExpression(nullptr);
+        bounds->insert(std::make_pair(oid, std::vector<planner::IndexExpression>{high, low}));
+        scan_type = planner::IndexScanType::AscendingClosed;
+        break;
       } else if (open_highs.find(oid) != open_highs.end()) {
         if (scan_type == planner::IndexScanType::Exact || scan_type == planner::IndexScanType::AscendingClosed ||
             scan_type == planner::IndexScanType::AscendingOpenHigh) {
@@ -268,10 +347,15 @@ class IndexUtil {
       }
     }
 
+    // An exact lookup needs every key column
+    if (scan_type == planner::IndexScanType::Exact && bounds->size() != schema.GetColumns().size())
+      scan_type = planner::IndexScanType::AscendingClosed;
+
     *idx_scan_type = scan_type;
     return !bounds->empty();
   }
 
+ public:
   /**
    * Retrieves the catalog::col_oid_t equivalent for the index
    * @requires SatisfiesBaseColumnRequirement(schema)
@@ -344,6 +428,44 @@ class IndexUtil {
   static bool IsBaseColumn(common::ManagedPointer<parser::AbstractExpression> expr) {
     return (expr->GetExpressionType() == parser::ExpressionType::COLUMN_VALUE);
   }
+
+  /**
+   * Checks whether values of a type have a smallest and a largest value that can bound an index scan.
+   * @param type TypeId to evaluate
+   * @returns TRUE if type is an integer type
+   */
+  static bool IsIntegralType(type::TypeId type) {
+    return type == type::TypeId::TINYINT || type == type::TypeId::SMALLINT || type == type::TypeId::INTEGER ||
+           type == type::TypeId::BIGINT;
+  }
+
+  /**
+   * Reads the value of an integer constant, e.g. to order the values of an IN list
+   * @param expr expression to evaluate
+   * @param[out] value value of the constant
+   * @returns TRUE if expr is a non-NULL integer constant
+   */
+  static bool PeekIntegralConstant(common::ManagedPointer<parser::AbstractExpression> expr, int64_t *value) {
+    if (expr->GetExpressionType() != parser::ExpressionType::VALUE_CONSTANT) return false;
+    auto constant = expr.CastManagedPointerTo<parser::ConstantValueExpression>()->GetValue();
+    if (constant.Null()) return false;
+    switch (constant.Type()) {
+      case type::TypeId::TINYINT:
+        *value = type::TransientValuePeeker::PeekTinyInt(constant);
+        return true;
+      case type::TypeId::SMALLINT:
+        *value = type::TransientValuePeeker::PeekSmallInt(constant);
+        return true;
+      case type::TypeId::INTEGER:
+        *value = type::TransientValuePeeker::PeekInteger(constant);
+        return true;
+      case type::TypeId::BIGINT:
+        *value = type::TransientValuePeeker::PeekBigInt(constant);
+        return true;
+      default:
+        return false;
+    }
+  }
 };
 
 }  // namespace terrier::optimizer
@@ -138,6 +138,18 @@ class InputColumnDeriver : public OperatorVisitor {
    */
   void Visit(const OuterHashJoin *op) override;
 
+  /**
+   * Visit function to derive input/output columns for LeftSemiHashJoin
+   * @param op LeftSemiHashJoin operator to visit
+   */
+  void Visit(const LeftSemiHashJoin *op) override;
+
+  /**
+   * Visit function to derive input/output columns for LeftAntiHashJoin
+   * @param op LeftAntiHashJoin operator to visit
+   */
+  void Visit(const LeftAntiHashJoin *op) override;
+
   /**
    * Visit function to derive input/output columns for TableFreeScan
    * @param op TableFreeScan operator to visit
@@ -70,11 +70,12 @@ class LogicalGet : public OperatorNodeContents<LogicalGet> {
    * @param predicates predicates for get
    * @param table_alias alias of table to get from
    * @param is_for_update whether the scan is used for update
+   * @param scan_limit number of tuples the LIMIT above the get needs, 0 if there is no such limit
    * @return
    */
   static Operator Make(catalog::db_oid_t database_oid, catalog::namespace_oid_t namespace_oid,
                        catalog::table_oid_t table_oid, std::vector<AnnotatedExpression> predicates,
-                       std::string table_alias, bool is_for_update);
+                       std::string table_alias, bool is_for_update, uint32_t scan_limit = 0);
 
   /**
    * For select statement without a from table
@@ -122,6 +123,13 @@ class LogicalGet : public OperatorNodeContents<LogicalGet> {
    */
   bool GetIsForUpdate() const { return is_for_update_; }
 
+  /**
+   * The get is directly below a LIMIT with an ORDER BY, so an index scan that produces the sort order can stop after
+   * this many tuples (LIMIT + OFFSET).
+   * @return the scan limit, 0 if there is none
+   */
+  uint32_t GetScanLimit() const { return scan_limit_; }
+
  private:
   /**
    * OID of the database
@@ -152,6 +160,11 @@ class LogicalGet : public OperatorNodeContents<LogicalGet> {
    * Whether the scan is used for update
    */
   bool is_for_update_;
+
+  /**
+   * Number of tuples needed by the LIMIT above
+   */
+  uint32_t scan_limit_;
 };
 
 /**
@@ -619,7 +632,7 @@ class LogicalOuterJoin : public OperatorNodeContents<LogicalOuterJoin> {
 };
 
 /**
- * Logical operator for semi join
+ * Logical operator for semi join, which keeps the left tuples that have a match
  */
 class LogicalSemiJoin : public OperatorNodeContents<LogicalSemiJoin> {
  public:
@@ -656,6 +669,44 @@ class LogicalSemiJoin : public OperatorNodeContents<LogicalSemiJoin> {
   std::vector<AnnotatedExpression> join_predicates_;
 };
 
+/**
+ * Logical operator for anti join, which keeps the left tuples that have no match
+ */
+class LogicalAntiJoin : public OperatorNodeContents<LogicalAntiJoin> {
+ public:
+  /**
+   * @return an AntiJoin operator
+   */
+  static Operator Make();
+
+  /**
+   * @param join_predicates conditions of the join
+   * @return an AntiJoin operator
+   */
+  static Operator Make(std::vector<AnnotatedExpression> &&join_predicates);
+
+  /**
+   * Copy
+   * @returns copy of this
+   */
+  BaseOperatorNodeContents *Copy() const override;
+
+  bool operator==(const BaseOperatorNodeContents &r) override;
+
+  common::hash_t Hash() const override;
+
+  /**
+   * @return vector of join predicates
+   */
+  const std::vector<AnnotatedExpression> &GetJoinPredicates() const { return join_predicates_; }
+
+ private:
+  /**
+   * Join predicates
+   */
+  std::vector<AnnotatedExpression> join_predicates_;
+};
+
 /**
  * Logical operator for aggregation or group by operation
  */
@@ -723,12 +774,14 @@ class LogicalInsert : public OperatorNodeContents<LogicalInsert> {
    * @param table_oid OID of the table
    * @param columns list of columns to insert into
    * @param values list of expressions that provide the values to insert into columns
+   * @param constant_batch constant values to insert into columns instead of values, or nullptr
    * @return
    */
   static Operator Make(
       catalog::db_oid_t database_oid, catalog::namespace_oid_t namespace_oid, catalog::table_oid_t table_oid,
       std::vector<catalog::col_oid_t> &&columns,
-      common::ManagedPointer<std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>> values);
+      common::ManagedPointer<std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>> values,
+      common::ManagedPointer<parser::ConstantBatch> constant_batch);
 
   /**
    * Copy
@@ -767,6 +820,11 @@ class LogicalInsert : public OperatorNodeContents<LogicalInsert> {
     return values_;
   }
 
+  /**
+   * @return The constant values to insert, or nullptr if they are given by GetValues()
+   */
+  common::ManagedPointer<parser::ConstantBatch> GetConstantBatch() const { return constant_batch_; }
+
  private:
   /**
    * OID of the database
@@ -793,6 +851,12 @@ class LogicalInsert : public OperatorNodeContents<LogicalInsert> {
    * The offset of an entry in this list corresponds to the offset in the columns_ list.
    */
   common::ManagedPointer<std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>> values_;
+
+  /**
+   * The constant values to insert when the statement's VALUES list was parsed into a batch, nullptr otherwise.
+   * The offset of a column in the batch corresponds to the offset in the columns_ list.
+   */
+  common::ManagedPointer<parser::ConstantBatch> constant_batch_;
 };
 
 /**
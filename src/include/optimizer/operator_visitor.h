@@ -108,6 +108,18 @@ class OperatorVisitor {
    */
   virtual void Visit(const OuterHashJoin *outer_hash_join) {}
 
+  /**
+   * Visit a LeftSemiHashJoin operator
+   * @param left_semi_hash_join operator
+   */
+  virtual void Visit(const LeftSemiHashJoin *left_semi_hash_join) {}
+
+  /**
+   * Visit a LeftAntiHashJoin operator
+   * @param left_anti_hash_join operator
+   */
+  virtual void Visit(const LeftAntiHashJoin *left_anti_hash_join) {}
+
   /**
    * Visit a Insert operator
    * @param insert operator
@@ -311,6 +323,12 @@ class OperatorVisitor {
    */
   virtual void Visit(const LogicalSemiJoin *logical_semi_join) {}
 
+  /**
+   * Visit a LogicalAntiJoin operator
+   * @param logical_anti_join operator
+   */
+  virtual void Visit(const LogicalAntiJoin *logical_anti_join) {}
+
   /**
    * Visit a LogicalAggregateAndGroupBy operator
    * @param logical_aggregate_and_group_by operator
@@ -2,6 +2,7 @@
 
 #include <limits>
 
+#include "optimizer/optimizer_arena.h"
 #include "optimizer/optimizer_task.h"
 #include "optimizer/optimizer_task_pool.h"
 #include "optimizer/property_set.h"
@@ -12,9 +13,9 @@ class OptimizerContext;
 
 /**
  * OptimizationContext containing information for each optimization.
- * A new OptimizationContext is created when optimizing sub-groups.
+ * A new OptimizationContext is created when optimizing sub-groups, from the OptimizerContext's arena.
  */
-class OptimizationContext {
+class OptimizationContext : public ArenaObject {
  public:
   /**
    * Constructor
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "common/macros.h"
+#include "execution/util/region.h"
+
+namespace terrier::optimizer {
+
+/**
+ * Per-query arena for the objects the optimizer creates and destroys at a high rate while it searches the plan space:
+ * tasks, optimization contexts and group expressions. Memory is carved out of an execution::util::Region and returned
+ * to the system in one shot when the arena (i.e. the OptimizerContext that owns it) is destroyed at the end of the
+ * statement. Blocks that are freed before then go onto a free list for their size class, so the short-lived tasks keep
+ * reusing the same few blocks instead of growing the region.
+ *
+ * The parse tree, the binder's annotations on it and the plan node tree are not arena allocated. They own their nodes
+ * through unique_ptr, and a prepared statement keeps its parse tree and plan across executions, so they do not share
+ * the lifetime of one optimizer run.
+ */
+class OptimizerArena {
+ public:
+  OptimizerArena() : region_("optimizer") {}
+
+  DISALLOW_COPY_AND_MOVE(OptimizerArena)
+
+  /**
+   * @param size number of bytes to allocate
+   * @return block of at least size bytes, 8-byte aligned
+   */
+  void *Allocate(std::size_t size);
+
+  /**
+   * Hands a block back to the arena for reuse
+   * @param ptr block returned by Allocate
+   * @param size size the block was allocated with
+   */
+  void Free(void *ptr, std::size_t size);
+
+  /**
+   * @return the region the arena allocates from
+   */
+  const execution::util::Region &GetRegion() const { return region_; }
+
+ private:
+  // Blocks are handed out in multiples of SIZE_CLASS bytes, those larger than MAX_RECYCLED_SIZE are not reused
+  static constexpr std::size_t SIZE_CLASS = 16;
+  static constexpr std::size_t MAX_RECYCLED_SIZE = 512;
+
+  // A free block, linked into the free list of its size class
+  struct FreeBlock {
+    FreeBlock *next_;
+  };
+
+  static std::size_t RoundedSize(std::size_t size) { return (size + SIZE_CLASS - 1) / SIZE_CLASS * SIZE_CLASS; }
+
+  execution::util::Region region_;
+  std::array<FreeBlock *, MAX_RECYCLED_SIZE / SIZE_CLASS + 1> free_lists_{};
+};
+
+/**
+ * Base class for the optimizer objects that live in an OptimizerArena. They are created with new (arena) T(...) and
+ * destroyed with a plain delete, which runs the destructor and hands the memory back to the arena they came from.
+ */
+class ArenaObject {
+ public:
+  /**
+   * Should not be called, objects must come from an arena
+   */
+  void *operator new(std::size_t size) = delete;
+
+  /**
+   * @param size size of the object
+   * @param arena arena to allocate from
+   * @return memory for the object
+   */
+  void *operator new(std::size_t size, OptimizerArena *arena);
+
+  /**
+   * Hands the memory of a destroyed object back to its arena
+   * @param ptr object memory
+   * @param size size of the object
+   */
+  void operator delete(void *ptr, std::size_t size);
+
+  /**
+   * Called if the constructor of an object being allocated from arena throws. The memory just stays in the region.
+   * @param ptr object memory
+   * @param arena arena the memory came from
+   */
+  void operator delete(void *ptr, OptimizerArena *arena);
+
+ private:
+  // Every object is preceded by a pointer to its arena, so that delete can find it
+  static constexpr std::size_t HEADER_SIZE = sizeof(OptimizerArena *);
+};
+
+}  // namespace terrier::optimizer
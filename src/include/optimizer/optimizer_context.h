@@ -7,6 +7,7 @@
 #include "optimizer/cost_model/abstract_cost_model.h"
 #include "optimizer/group_expression.h"
 #include "optimizer/memo.h"
+#include "optimizer/optimizer_arena.h"
 #include "optimizer/rule.h"
 #include "optimizer/statistics/stats_storage.h"
 
@@ -51,6 +52,12 @@ class OptimizerContext {
     }
   }
 
+  /**
+   * Gets the arena that tasks, OptimizationContexts and GroupExpressions are allocated from
+   * @returns arena
+   */
+  OptimizerArena *GetArena() { return &arena_; }
+
   /**
    * Gets the Memo
    * @returns Memo
@@ -164,7 +171,7 @@ class OptimizerContext {
       }
     }
 
-    return new GroupExpression(expr->GetOp(), std::move(child_groups));
+    return new (&arena_) GroupExpression(expr->GetOp(), std::move(child_groups));
   }
 
   /**
@@ -215,6 +222,8 @@ class OptimizerContext {
   }
 
  private:
+  // Declared first so that it outlives everything allocated from it
+  OptimizerArena arena_;
   Memo memo_;
   RuleSet rule_set_;
   common::ManagedPointer<AbstractCostModel> cost_model_;
@@ -58,6 +58,7 @@ enum class OpType {
   LOGICALRIGHTJOIN,
   LOGICALOUTERJOIN,
   LOGICALSEMIJOIN,
+  LOGICALANTIJOIN,
   LOGICALAGGREGATEANDGROUPBY,
   LOGICALINSERT,
   LOGICALINSERTSELECT,
@@ -98,6 +99,8 @@ enum class OpType {
   LEFTHASHJOIN,
   RIGHTHASHJOIN,
   OUTERHASHJOIN,
+  LEFTSEMIHASHJOIN,
+  LEFTANTIHASHJOIN,
   INSERT,
   INSERTSELECT,
   DELETE,
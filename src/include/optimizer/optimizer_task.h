@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "optimizer/optimizer_arena.h"
 #include "optimizer/optimizer_defs.h"
 #include "optimizer/property_set.h"
 #include "parser/expression/abstract_expression.h"
@@ -43,9 +44,10 @@ enum class OptimizerTaskType {
 };
 
 /**
- * OptimizerTask is the base abstract class for optimization
+ * OptimizerTask is the base abstract class for optimization.
+ * Tasks are allocated from the OptimizerContext's arena.
  */
-class OptimizerTask {
+class OptimizerTask : public ArenaObject {
  public:
   /**
    * Constructor for OptimizerTask
@@ -89,6 +91,11 @@ class OptimizerTask {
    */
   void PushTask(OptimizerTask *task);
 
+  /**
+   * @returns arena to allocate new tasks from
+   */
+  OptimizerArena *GetArena() const;
+
   /**
    * Trivial destructor
    */
@@ -153,13 +153,15 @@ class IndexScan : public OperatorNodeContents<IndexScan> {
    * @param is_for_update whether the scan is used for update
    * @param scan_type IndexScanType
    * @param bounds Bounds for IndexScan
+   * @param scan_limit maximum number of tuples to fetch from the index, 0 for no limit
    * @return an IndexScan operator
    */
   static Operator Make(catalog::db_oid_t database_oid, catalog::namespace_oid_t namespace_oid,
                        catalog::table_oid_t tbl_oid, catalog::index_oid_t index_oid,
                        std::vector<AnnotatedExpression> &&predicates, bool is_for_update,
                        planner::IndexScanType scan_type,
-                       std::unordered_map<catalog::indexkeycol_oid_t, std::vector<planner::IndexExpression>> bounds);
+                       std::unordered_map<catalog::indexkeycol_oid_t, std::vector<planner::IndexExpression>> bounds,
+                       uint32_t scan_limit = 0);
 
   /**
    * Copy
@@ -213,6 +215,11 @@ class IndexScan : public OperatorNodeContents<IndexScan> {
     return bounds_;
   }
 
+  /**
+   * @return maximum number of tuples to fetch from the index, 0 for no limit
+   */
+  uint32_t GetScanLimit() const { return scan_limit_; }
+
  private:
   /**
    * OID of the database
@@ -253,6 +260,10 @@ class IndexScan : public OperatorNodeContents<IndexScan> {
    * Bounds
    */
   std::unordered_map<catalog::indexkeycol_oid_t, std::vector<planner::IndexExpression>> bounds_;
+  /**
+   * Scan limit
+   */
+  uint32_t scan_limit_;
 };
 
 /**
@@ -789,6 +800,122 @@ class OuterHashJoin : public OperatorNodeContents<OuterHashJoin> {
   common::ManagedPointer<parser::AbstractExpression> join_predicate_;
 };
 
+/**
+ * Physical operator for left semi hash join. The hash table is built on the right child and probed by the left child,
+ * whose tuples are emitted at most once, if they have a match
+ */
+class LeftSemiHashJoin : public OperatorNodeContents<LeftSemiHashJoin> {
+ public:
+  /**
+   * @param join_predicates predicates for join
+   * @param left_keys left keys to join
+   * @param right_keys right keys to join
+   * @return a LeftSemiHashJoin operator
+   */
+  static Operator Make(std::vector<AnnotatedExpression> &&join_predicates,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys);
+
+  /**
+   * Copy
+   * @returns copy of this
+   */
+  BaseOperatorNodeContents *Copy() const override;
+
+  bool operator==(const BaseOperatorNodeContents &r) override;
+
+  common::hash_t Hash() const override;
+
+  /**
+   * @return Left join keys
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetLeftKeys() const { return left_keys_; }
+
+  /**
+   * @return Right join keys
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetRightKeys() const { return right_keys_; }
+
+  /**
+   * @return Predicates for the Join
+   */
+  const std::vector<AnnotatedExpression> &GetJoinPredicates() const { return join_predicates_; }
+
+ private:
+  /**
+   * Left join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys_;
+
+  /**
+   * Right join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys_;
+
+  /**
+   * Predicate for join
+   */
+  std::vector<AnnotatedExpression> join_predicates_;
+};
+
+/**
+ * Physical operator for left anti hash join. The hash table is built on the right child and probed by the left child,
+ * whose tuples are emitted if they have no match
+ */
+class LeftAntiHashJoin : public OperatorNodeContents<LeftAntiHashJoin> {
+ public:
+  /**
+   * @param join_predicates predicates for join
+   * @param left_keys left keys to join
+   * @param right_keys right keys to join
+   * @return a LeftAntiHashJoin operator
+   */
+  static Operator Make(std::vector<AnnotatedExpression> &&join_predicates,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                       std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys);
+
+  /**
+   * Copy
+   * @returns copy of this
+   */
+  BaseOperatorNodeContents *Copy() const override;
+
+  bool operator==(const BaseOperatorNodeContents &r) override;
+
+  common::hash_t Hash() const override;
+
+  /**
+   * @return Left join keys
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetLeftKeys() const { return left_keys_; }
+
+  /**
+   * @return Right join keys
+   */
+  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &GetRightKeys() const { return right_keys_; }
+
+  /**
+   * @return Predicates for the Join
+   */
+  const std::vector<AnnotatedExpression> &GetJoinPredicates() const { return join_predicates_; }
+
+ private:
+  /**
+   * Left join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys_;
+
+  /**
+   * Right join keys
+   */
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys_;
+
+  /**
+   * Predicate for join
+   */
+  std::vector<AnnotatedExpression> join_predicates_;
+};
+
 /**
  * Physical operator for INSERT
  */
@@ -800,12 +927,14 @@ class Insert : public OperatorNodeContents<Insert> {
    * @param table_oid OID of the table
    * @param columns OIDs of columns to insert into
    * @param values expressions of values to insert
+   * @param constant_batch constant values to insert instead of values, or nullptr
    * @param index_oids the OIDs of the indexes to insert into
    * @return an Insert operator
    */
   static Operator Make(catalog::db_oid_t database_oid, catalog::namespace_oid_t namespace_oid,
                        catalog::table_oid_t table_oid, std::vector<catalog::col_oid_t> &&columns,
                        std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>> &&values,
+                       common::ManagedPointer<parser::ConstantBatch> constant_batch,
                        std::vector<catalog::index_oid_t> &&index_oids);
 
   /**
@@ -844,6 +973,11 @@ class Insert : public OperatorNodeContents<Insert> {
     return values_;
   }
 
+  /**
+   * @return Constant values to insert, or nullptr if they are given by GetValues()
+   */
+  common::ManagedPointer<parser::ConstantBatch> GetConstantBatch() const { return constant_batch_; }
+
   /**
    * @return Index oids to insert into
    */
@@ -875,6 +1009,11 @@ class Insert : public OperatorNodeContents<Insert> {
    */
   std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>> values_;
 
+  /**
+   * Constant values to insert, or nullptr
+   */
+  common::ManagedPointer<parser::ConstantBatch> constant_batch_;
+
   /**
    * Indexes to insert into
    */
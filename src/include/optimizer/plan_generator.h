@@ -55,6 +55,8 @@ class PlanGenerator : public OperatorVisitor {
    * @param output_cols Columns output by the Operator
    * @param children_plans Children plan nodes
    * @param children_expr_map Vector of children expression -> col offset mapping
+   * @param children_num_rows Estimated cardinality of each child (-1 if unknown), or empty if there are no estimates
+   * @param children_props Properties each child plan provides, or empty if they are unknown
    * @returns Output plan node
    */
   std::unique_ptr<planner::AbstractPlanNode> ConvertOpNode(
@@ -62,7 +64,8 @@ class PlanGenerator : public OperatorVisitor {
       PropertySet *required_props, const std::vector<common::ManagedPointer<parser::AbstractExpression>> &required_cols,
       const std::vector<common::ManagedPointer<parser::AbstractExpression>> &output_cols,
       std::vector<std::unique_ptr<planner::AbstractPlanNode>> &&children_plans,
-      std::vector<ExprMap> &&children_expr_map);
+      std::vector<ExprMap> &&children_expr_map, std::vector<int> &&children_num_rows = {},
+      std::vector<PropertySet *> children_props = {});
 
   /**
    * Visitor function for a TableFreeScan operator
@@ -154,6 +157,18 @@ class PlanGenerator : public OperatorVisitor {
    */
   void Visit(const OuterHashJoin *op) override;
 
+  /**
+   * Visitor function for a LeftSemiHashJoin operator
+   * @param op LeftSemiHashJoin operator being visited
+   */
+  void Visit(const LeftSemiHashJoin *op) override;
+
+  /**
+   * Visitor function for a LeftAntiHashJoin operator
+   * @param op LeftAntiHashJoin operator being visited
+   */
+  void Visit(const LeftAntiHashJoin *op) override;
+
   /**
    * Visitor function for a Insert operator
    * @param op Insert operator being visited
@@ -280,6 +295,11 @@ class PlanGenerator : public OperatorVisitor {
   void Visit(const DropView *drop_view) override;
 
  private:
+  /**
+   * Estimated number of build tuples from which a hash join uses a concise hash table
+   */
+  static constexpr int CONCISE_HT_MIN_BUILD_ROWS = 1 << 20;
+
   /**
    * Register a pointer to be deleted on transaction commit/abort
    * @param ptr Pointer to delete
@@ -297,6 +317,16 @@ class PlanGenerator : public OperatorVisitor {
     }
   }
 
+  /**
+   * Generates the missing side of an index range on an integer column
+   * @param index_oid OID of the index
+   * @param key_oid key column the bound is for
+   * @param max whether to generate the largest (high bound) or the smallest (low bound) value of the column's type
+   * @return constant holding the bound, freed with the transaction
+   */
+  planner::IndexExpression GenerateIndexBound(catalog::index_oid_t index_oid, catalog::indexkeycol_oid_t key_oid,
+                                              bool max);
+
   /**
    * Generate the column oids vector for a scan plan
    * @param predicate Predicate of the scan
@@ -326,6 +356,28 @@ class PlanGenerator : public OperatorVisitor {
    */
   std::unique_ptr<planner::OutputSchema> GenerateProjectionForJoin();
 
+  /**
+   * Decides whether a hash join should build a concise hash table. The concise table only pays off when the build side
+   * is large enough for the probes into a chained table to miss the cache, so this needs a cardinality estimate.
+   * @param build_child_idx index of the child the hash table is built on
+   * @returns true if the hash table should be concise
+   */
+  bool UseConciseHashTable(size_t build_child_idx) const;
+
+  /**
+   * Generates the hash join plan of a left semi or anti join. The execution engine builds the hash table on the first
+   * child and only emits tuples of the second one, so the children are swapped: the right child builds the table and
+   * the left child probes it.
+   * @param join_type SEMI or ANTI
+   * @param join_predicates predicates of the join
+   * @param left_keys join keys of the left child
+   * @param right_keys join keys of the right child
+   */
+  void BuildFilteringHashJoinPlan(planner::LogicalJoinType join_type,
+                                  const std::vector<AnnotatedExpression> &join_predicates,
+                                  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &left_keys,
+                                  const std::vector<common::ManagedPointer<parser::AbstractExpression>> &right_keys);
+
   /**
    * The Plan node's OutputSchema may not match the required columns. As such,
    * this function adds a projection on top of the output plan which will ensure
@@ -372,6 +424,16 @@ class PlanGenerator : public OperatorVisitor {
    */
   std::vector<ExprMap> children_expr_map_;
 
+  /**
+   * Estimated cardinality of each child, -1 (or missing) if unknown
+   */
+  std::vector<int> children_num_rows_;
+
+  /**
+   * Properties provided by each child plan (owned by the GroupExpression), empty if unknown
+   */
+  std::vector<PropertySet *> children_props_;
+
   /**
    * Final output plan
    */
@@ -14,6 +14,11 @@ class PropertySet;
  */
 class PropertyEnforcer : public PropertyVisitor {
  public:
+  /**
+   * @param arena arena to allocate the enforcing GroupExpressions from
+   */
+  explicit PropertyEnforcer(OptimizerArena *arena) : arena_(arena) {}
+
   /**
    * Enforces a property for a given GroupExpression
    * @param gexpr GroupExpression to enforce the property for
@@ -29,6 +34,11 @@ class PropertyEnforcer : public PropertyVisitor {
   void Visit(const PropertySort *prop) override;
 
  private:
+  /**
+   * Arena to allocate from
+   */
+  OptimizerArena *arena_;
+
   /**
    * Input GroupExpression to enforce
    */
@@ -99,6 +99,14 @@ class QueryToOperatorTransformer : public SqlNodeVisitor {
    */
   static bool IsSupportedConjunctivePredicate(common::ManagedPointer<parser::AbstractExpression> expr);
 
+  /**
+   * Decide if a supported conjunctive predicate is evaluated by a mark join, i.e. is an IN, EXISTS or NOT EXISTS
+   * over a sub-select
+   * @param expr The conjunctive predicate provided
+   * @return True if the predicate is evaluated by a mark join, false otherwise
+   */
+  static bool IsMarkJoinPredicate(common::ManagedPointer<parser::AbstractExpression> expr);
+
   /**
    * Check if a sub-select statement is supported.
    * @param op The select statement
@@ -155,6 +163,12 @@ class QueryToOperatorTransformer : public SqlNodeVisitor {
    * A set of predicates the current operator generated, we use them to generate filter operator
    */
   std::vector<AnnotatedExpression> predicates_;
+
+  /**
+   * The conjunctive predicate (IN, EXISTS or NOT EXISTS over a sub-select) whose sub-select is transformed next.
+   * It becomes the predicate of the generated mark join instead of a filter predicate.
+   */
+  common::ManagedPointer<parser::AbstractExpression> mark_join_predicate_;
 };
 
 }  // namespace optimizer
@@ -32,9 +32,12 @@ enum class RuleType : uint32_t {
   INSERT_TO_PHYSICAL,
   INSERT_SELECT_TO_PHYSICAL,
   AGGREGATE_TO_HASH_AGGREGATE,
+  AGGREGATE_TO_SORT_AGGREGATE,
   AGGREGATE_TO_PLAIN_AGGREGATE,
   INNER_JOIN_TO_NL_JOIN,
   INNER_JOIN_TO_HASH_JOIN,
+  SEMI_JOIN_TO_HASH_JOIN,
+  ANTI_JOIN_TO_HASH_JOIN,
   IMPLEMENT_DISTINCT,
   IMPLEMENT_LIMIT,
   EXPORT_EXTERNAL_FILE_TO_PHYSICAL,
@@ -60,11 +63,14 @@ enum class RuleType : uint32_t {
   // Rewrite rules (logical -> logical)
   PUSH_FILTER_THROUGH_JOIN,
   PUSH_FILTER_THROUGH_AGGREGATION,
+  PUSH_FILTER_THROUGH_SEMI_JOIN,
   COMBINE_CONSECUTIVE_FILTER,
   EMBED_FILTER_INTO_GET,
+  EMBED_LIMIT_INTO_GET,
   MARK_JOIN_GET_TO_INNER_JOIN,
   MARK_JOIN_INNER_JOIN_TO_INNER_JOIN,
   MARK_JOIN_FILTER_TO_INNER_JOIN,
+  MARK_JOIN_TO_SEMI_JOIN,
   PULL_FILTER_THROUGH_MARK_JOIN,
   PULL_FILTER_THROUGH_AGGREGATION,
 
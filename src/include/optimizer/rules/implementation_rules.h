@@ -288,6 +288,34 @@ class LogicalGroupByToPhysicalHashGroupBy : public Rule {
                  OptimizationContext *context) const override;
 };
 
+/**
+ * Rule transforms LogicalGroupBy -> SortGroupBy
+ */
+class LogicalGroupByToPhysicalSortGroupBy : public Rule {
+ public:
+  /**
+   * Constructor
+   */
+  LogicalGroupByToPhysicalSortGroupBy();
+
+  /**
+   * Checks whether the given rule can be applied
+   * @param plan OperatorNode to check
+   * @param context Current OptimizationContext executing under
+   * @returns Whether the input OperatorNode passes the check
+   */
+  bool Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const override;
+
+  /**
+   * Transforms the input expression using the given rule
+   * @param input Input OperatorNode to transform
+   * @param transformed Vector of transformed OperatorNodes
+   * @param context Current OptimizationContext executing under
+   */
+  void Transform(common::ManagedPointer<OperatorNode> input, std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                 OptimizationContext *context) const override;
+};
+
 /**
  * Rule transforms LogicalAggregate -> Aggregate
  */
@@ -372,6 +400,62 @@ class LogicalInnerJoinToPhysicalInnerHashJoin : public Rule {
                  OptimizationContext *context) const override;
 };
 
+/**
+ * Rule transforms Logical Semi Join to LeftSemiHashJoin
+ */
+class LogicalSemiJoinToPhysicalLeftSemiHashJoin : public Rule {
+ public:
+  /**
+   * Constructor
+   */
+  LogicalSemiJoinToPhysicalLeftSemiHashJoin();
+
+  /**
+   * Checks whether the given rule can be applied
+   * @param plan OperatorNode to check
+   * @param context Current OptimizationContext executing under
+   * @returns Whether the input OperatorNode passes the check
+   */
+  bool Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const override;
+
+  /**
+   * Transforms the input expression using the given rule
+   * @param input Input OperatorNode to transform
+   * @param transformed Vector of transformed OperatorNodes
+   * @param context Current OptimizationContext executing under
+   */
+  void Transform(common::ManagedPointer<OperatorNode> input, std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                 OptimizationContext *context) const override;
+};
+
+/**
+ * Rule transforms Logical Anti Join to LeftAntiHashJoin
+ */
+class LogicalAntiJoinToPhysicalLeftAntiHashJoin : public Rule {
+ public:
+  /**
+   * Constructor
+   */
+  LogicalAntiJoinToPhysicalLeftAntiHashJoin();
+
+  /**
+   * Checks whether the given rule can be applied
+   * @param plan OperatorNode to check
+   * @param context Current OptimizationContext executing under
+   * @returns Whether the input OperatorNode passes the check
+   */
+  bool Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const override;
+
+  /**
+   * Transforms the input expression using the given rule
+   * @param input Input OperatorNode to transform
+   * @param transformed Vector of transformed OperatorNodes
+   * @param context Current OptimizationContext executing under
+   */
+  void Transform(common::ManagedPointer<OperatorNode> input, std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                 OptimizationContext *context) const override;
+};
+
 /**
  * Rule transforms LogicalLimit -> Limit
  */
@@ -69,6 +69,36 @@ class RewritePushExplicitFilterThroughJoin : public Rule {
                  OptimizationContext *context) const override;
 };
 
+/**
+ * Rule performs predicate push-down to push a filter through a semi or anti join. Only the tuples of the left child
+ * are output, so the predicates on them are evaluated before the join.
+ */
+class RewritePushFilterThroughSemiJoin : public Rule {
+ public:
+  /**
+   * Constructor
+   * @param join_type OpType of the join, LOGICALSEMIJOIN or LOGICALANTIJOIN
+   */
+  explicit RewritePushFilterThroughSemiJoin(OpType join_type);
+
+  /**
+   * Checks whether the given rule can be applied
+   * @param plan OperatorNode to check
+   * @param context Current OptimizationContext executing under
+   * @returns Whether the input OperatorNode passes the check
+   */
+  bool Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const override;
+
+  /**
+   * Transforms the input expression using the given rule
+   * @param input Input OperatorNode to transform
+   * @param transformed Vector of transformed OperatorNodes
+   * @param context Current OptimizationContext executing under
+   */
+  void Transform(common::ManagedPointer<OperatorNode> input, std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                 OptimizationContext *context) const override;
+};
+
 /**
  * Rule transforms consecutive filters into a single filter
  */
@@ -156,6 +186,35 @@ class RewriteEmbedFilterIntoGet : public Rule {
                  OptimizationContext *context) const override;
 };
 
+/**
+ * Rule hands the number of tuples a sorted LIMIT needs to the get below it. If an index produces the sort order, the
+ * index scan implementing the get only has to fetch LIMIT + OFFSET tuples.
+ */
+class RewriteEmbedLimitIntoGet : public Rule {
+ public:
+  /**
+   * Constructor
+   */
+  RewriteEmbedLimitIntoGet();
+
+  /**
+   * Checks whether the given rule can be applied
+   * @param plan OperatorNode to check
+   * @param context Current OptimizationContext executing under
+   * @returns Whether the input OperatorNode passes the check
+   */
+  bool Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const override;
+
+  /**
+   * Transforms the input expression using the given rule
+   * @param input Input OperatorNode to transform
+   * @param transformed Vector of transformed OperatorNodes
+   * @param context Current OptimizationContext executing under
+   */
+  void Transform(common::ManagedPointer<OperatorNode> input, std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                 OptimizationContext *context) const override;
+};
+
 /**
  * Rewrite Pull Filter through Mark Join
  */
@@ -7,10 +7,46 @@
 
 namespace terrier::optimizer {
 
-// TODO(boweic): MarkJoin and SingleJoin should not be transformed into inner
-// join. Sometimes MarkJoin could be transformed into semi-join, but for now we
-// do not have these operators in the llvm cogen engine. Once we have those, we
-// should not use the following rules in the rewrite phase
+// TODO(boweic): SingleJoin should not be transformed into inner join. A MarkJoin
+// of an IN or (NOT) EXISTS is transformed into a semi (anti) join, the rule to
+// inner join is only used for a MarkJoin without a predicate
+
+/**
+ * Unnest Mark Join of an IN, EXISTS or NOT EXISTS predicate to Semi Join or Anti Join. The correlated predicates
+ * of the sub-select and the IN equality become the join predicates, and the remaining predicates of the
+ * sub-select stay in a filter over it.
+ */
+class UnnestMarkJoinToSemiJoin : public Rule {
+ public:
+  /**
+   * Constructor
+   */
+  UnnestMarkJoinToSemiJoin();
+
+  /**
+   * Gets the rule's promise to apply against a GroupExpression
+   * @param group_expr GroupExpression to compute promise from
+   * @returns The promise value of applying the rule for ordering
+   */
+  RulePromise Promise(GroupExpression *group_expr) const override;
+
+  /**
+   * Checks whether the given rule can be applied
+   * @param plan OperatorNode to check
+   * @param context Current OptimizationContext executing under
+   * @returns Whether the input OperatorNode passes the check
+   */
+  bool Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const override;
+
+  /**
+   * Transforms the input expression using the given rule
+   * @param input Input OperatorNode to transform
+   * @param transformed Vector of transformed OperatorNodes
+   * @param context Current OptimizationContext executing under
+   */
+  void Transform(common::ManagedPointer<OperatorNode> input, std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                 OptimizationContext *context) const override;
+};
 
 /**
  *  Unnest Mark Join to Inner Join
@@ -64,6 +64,12 @@ class ChildStatsDeriver : public OperatorVisitor {
    */
   void Visit(const LogicalSemiJoin *op) override;
 
+  /**
+   * Visit for a LogicalAntiJoin
+   * @param op Visiting LogicalAntiJoin
+   */
+  void Visit(const LogicalAntiJoin *op) override;
+
   /**
    * Visit for a LogicalAggregateAndGroupBy
    * @param op Visiting LogicalAggregateAndGroupBy
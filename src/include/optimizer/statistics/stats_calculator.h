@@ -45,6 +45,18 @@ class StatsCalculator : public OperatorVisitor {
    */
   void Visit(const LogicalInnerJoin *op) override;
 
+  /**
+   * Visit a LogicalSemiJoin
+   * @param op Operator being visited
+   */
+  void Visit(const LogicalSemiJoin *op) override;
+
+  /**
+   * Visit a LogicalAntiJoin
+   * @param op Operator being visited
+   */
+  void Visit(const LogicalAntiJoin *op) override;
+
   /**
    * Visit a LogicalAggregateAndGroupBy
    * @param op Operator being visited
@@ -58,6 +70,12 @@ class StatsCalculator : public OperatorVisitor {
   void Visit(const LogicalLimit *op) override;
 
  private:
+  /**
+   * Derive the stats of a join that only outputs tuples of its left child, i.e. a semi or anti join.
+   * At most all the left tuples are output, which is what is estimated for now.
+   */
+  void DeriveForFilteringJoin();
+
   /**
    * Add the base table stats if the base table maintain stats, or else
    * use default stats
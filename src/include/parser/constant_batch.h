@@ -0,0 +1,110 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/hash_util.h"
+#include "common/json.h"
+#include "common/macros.h"
+#include "type/transient_value.h"
+
+namespace terrier::parser {
+
+/**
+ * The rows of a multi-row INSERT ... VALUES whose values are all constants. Instead of one ConstantValueExpression per
+ * value, the values are kept column by column in a single vector of TransientValues: the value of column c in row r is
+ * at c * NumRows() + r. The InsertTranslator reads the batch at runtime through the ExecutionContext's parameters, so
+ * this is also the parameter index of the value.
+ */
+class ConstantBatch {
+ public:
+  /**
+   * @param num_rows number of rows in the batch
+   * @param num_columns number of values in each row
+   */
+  ConstantBatch(const uint32_t num_rows, const uint32_t num_columns)
+      : num_rows_(num_rows), num_columns_(num_columns), values_(static_cast<size_t>(num_rows) * num_columns) {}
+
+  DISALLOW_COPY_AND_MOVE(ConstantBatch)
+
+  /** @return number of rows in the batch */
+  uint32_t NumRows() const { return num_rows_; }
+
+  /** @return number of values in each row */
+  uint32_t NumColumns() const { return num_columns_; }
+
+  /**
+   * @param row row of the value
+   * @param col column of the value
+   * @return index of the value in GetValues()
+   */
+  uint32_t ValueIndex(const uint32_t row, const uint32_t col) const { return col * num_rows_ + row; }
+
+  /**
+   * @param row row of the value
+   * @param col column of the value
+   * @return the value
+   */
+  const type::TransientValue &GetValue(const uint32_t row, const uint32_t col) const {
+    return values_[ValueIndex(row, col)];
+  }
+
+  /**
+   * @param row row of the value
+   * @param col column of the value
+   * @param value new value
+   */
+  void SetValue(const uint32_t row, const uint32_t col, type::TransientValue &&value) {
+    values_[ValueIndex(row, col)] = std::move(value);
+  }
+
+  /** @return every value of the batch, column by column */
+  const std::vector<type::TransientValue> &GetValues() const { return values_; }
+
+  /** @return hash of the batch */
+  common::hash_t Hash() const {
+    common::hash_t hash = common::HashUtil::Hash(num_rows_);
+    hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(num_columns_));
+    for (const auto &value : values_) hash = common::HashUtil::CombineHashes(hash, value.Hash());
+    return hash;
+  }
+
+  /**
+   * @param other batch to compare with
+   * @return true if both batches hold the same values
+   */
+  bool operator==(const ConstantBatch &other) const {
+    return num_rows_ == other.num_rows_ && num_columns_ == other.num_columns_ && values_ == other.values_;
+  }
+
+  /** @return the batch serialized to json */
+  nlohmann::json ToJson() const {
+    nlohmann::json j;
+    j["num_rows"] = num_rows_;
+    j["num_columns"] = num_columns_;
+    std::vector<nlohmann::json> values;
+    values.reserve(values_.size());
+    for (const auto &value : values_) values.emplace_back(value.ToJson());
+    j["values"] = values;
+    return j;
+  }
+
+  /**
+   * @param j json to deserialize
+   * @return the deserialized batch
+   */
+  static std::unique_ptr<ConstantBatch> FromJson(const nlohmann::json &j) {
+    auto batch = std::make_unique<ConstantBatch>(j.at("num_rows").get<uint32_t>(), j.at("num_columns").get<uint32_t>());
+    const auto values = j.at("values").get<std::vector<nlohmann::json>>();
+    for (size_t i = 0; i < values.size(); i++) batch->values_[i].FromJson(values[i]);
+    return batch;
+  }
+
+ private:
+  const uint32_t num_rows_;
+  const uint32_t num_columns_;
+  std::vector<type::TransientValue> values_;
+};
+
+}  // namespace terrier::parser
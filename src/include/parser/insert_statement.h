@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 #include "common/sql_node_visitor.h"
+#include "parser/constant_batch.h"
 #include "parser/parser_defs.h"
 #include "parser/select_statement.h"
 #include "parser/sql_statement.h"
@@ -44,6 +45,21 @@ class InsertStatement : public SQLStatement {
         table_ref_(std::move(table_ref)),
         insert_values_(std::move(insert_values)) {}
 
+  /**
+   * Insert from VALUES, where every value is a constant
+   * @param columns columns to insert into
+   * @param table_ref table
+   * @param constant_batch values to be inserted
+   */
+  InsertStatement(std::unique_ptr<std::vector<std::string>> columns, std::unique_ptr<TableRef> table_ref,
+                  std::unique_ptr<ConstantBatch> constant_batch)
+      : SQLStatement(StatementType::INSERT),
+        type_(InsertType::VALUES),
+        columns_(std::move(columns)),
+        table_ref_(std::move(table_ref)),
+        insert_values_(std::make_unique<std::vector<std::vector<common::ManagedPointer<AbstractExpression>>>>()),
+        constant_batch_(std::move(constant_batch)) {}
+
   /** @param type insert type (SELECT or VALUES) */
   explicit InsertStatement(InsertType type) : SQLStatement(StatementType::INSERT), type_(type) {}
 
@@ -63,17 +79,21 @@ class InsertStatement : public SQLStatement {
   /** @return select statement we're inserting from */
   common::ManagedPointer<SelectStatement> GetSelect() const { return common::ManagedPointer(select_); }
 
-  /** @return values that we're inserting */
+  /** @return values that we're inserting, empty if they are in the constant batch */
   common::ManagedPointer<std::vector<std::vector<common::ManagedPointer<AbstractExpression>>>> GetValues() {
     return common::ManagedPointer(insert_values_);
   }
 
+  /** @return values that we're inserting if they are all constants, nullptr otherwise */
+  common::ManagedPointer<ConstantBatch> GetConstantBatch() { return common::ManagedPointer(constant_batch_); }
+
  private:
   const InsertType type_;
   const std::unique_ptr<std::vector<std::string>> columns_;
   const std::unique_ptr<TableRef> table_ref_;
   const std::unique_ptr<SelectStatement> select_;
   const std::unique_ptr<std::vector<std::vector<common::ManagedPointer<AbstractExpression>>>> insert_values_;
+  const std::unique_ptr<ConstantBatch> constant_batch_;
 };
 
 }  // namespace parser
@@ -114,6 +114,11 @@ class PostgresParser {
    */
   static std::unique_ptr<parser::ParseResult> BuildParseTree(const std::string &query_string);
 
+  /**
+   * INSERT ... VALUES lists of at least this many rows, all made of constants, are transformed into a ConstantBatch
+   */
+  static constexpr uint32_t CONSTANT_BATCH_MIN_ROWS = 32;
+
  private:
   static FKConstrActionType CharToActionType(const char &type) {
     switch (type) {
@@ -178,6 +183,7 @@ class PostgresParser {
   static std::unique_ptr<AbstractExpression> SubqueryExprTransform(ParseResult *parse_result, SubLink *node);
   static std::unique_ptr<AbstractExpression> TypeCastTransform(ParseResult *parse_result, TypeCast *root);
   static std::unique_ptr<AbstractExpression> ValueTransform(ParseResult *parse_result, value val);
+  static type::TransientValue TransientValueTransform(value val);
 
   // SELECT statements
   static std::unique_ptr<SelectStatement> SelectTransform(ParseResult *parse_result, SelectStmt *root);
@@ -249,6 +255,7 @@ class PostgresParser {
   static std::unique_ptr<std::vector<std::string>> ColumnNameTransform(List *root);
   static std::unique_ptr<std::vector<std::vector<common::ManagedPointer<AbstractExpression>>>> ValueListsTransform(
       ParseResult *parse_result, List *root);
+  static std::unique_ptr<ConstantBatch> ConstantBatchTransform(List *root);
 
   // PREPARE statements
   static std::unique_ptr<PrepareStatement> PrepareTransform(ParseResult *parse_result, PrepareStmt *root);
@@ -451,6 +451,9 @@ class SelectStatement : public SQLStatement {
    */
   void SetUnionSelect(std::unique_ptr<SelectStatement> select_stmt) { union_select_ = std::move(select_stmt); }
 
+  /** @return select statement this one is unioned with, if any */
+  common::ManagedPointer<SelectStatement> GetUnionSelect() { return common::ManagedPointer(union_select_); }
+
   /**
    * @return the hashed value of this select statement
    */
@@ -45,6 +45,15 @@ class HashJoinPlanNode : public AbstractJoinPlanNode {
       return *this;
     }
 
+    /**
+     * @param use_concise_ht whether to build the hash table as a concise hash table
+     * @return builder object
+     */
+    Builder &SetUseConciseHashTable(bool use_concise_ht) {
+      use_concise_ht_ = use_concise_ht;
+      return *this;
+    }
+
     // TODO(WAN) do we want to invalidate the builder after build?
     /**
      * Build the hash join plan node
@@ -53,7 +62,7 @@ class HashJoinPlanNode : public AbstractJoinPlanNode {
     std::unique_ptr<HashJoinPlanNode> Build() {
       return std::unique_ptr<HashJoinPlanNode>(
           new HashJoinPlanNode(std::move(children_), std::move(output_schema_), join_type_, join_predicate_,
-                               std::move(left_hash_keys_), std::move(right_hash_keys_)));
+                               std::move(left_hash_keys_), std::move(right_hash_keys_), use_concise_ht_));
     }
 
    protected:
@@ -65,6 +74,10 @@ class HashJoinPlanNode : public AbstractJoinPlanNode {
      * right side hash keys
      */
     std::vector<common::ManagedPointer<parser::AbstractExpression>> right_hash_keys_;
+    /**
+     * whether to build a concise hash table
+     */
+    bool use_concise_ht_ = false;
   };
 
  private:
@@ -75,15 +88,18 @@ class HashJoinPlanNode : public AbstractJoinPlanNode {
    * @param predicate join predicate
    * @param left_hash_keys left side keys to be hashed on
    * @param right_hash_keys right side keys to be hashed on
+   * @param use_concise_ht whether to build a concise hash table
    */
   HashJoinPlanNode(std::vector<std::unique_ptr<AbstractPlanNode>> &&children,
                    std::unique_ptr<OutputSchema> output_schema, LogicalJoinType join_type,
                    common::ManagedPointer<parser::AbstractExpression> predicate,
                    std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_hash_keys,
-                   std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_hash_keys)
+                   std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_hash_keys,
+                   bool use_concise_ht)
       : AbstractJoinPlanNode(std::move(children), std::move(output_schema), join_type, predicate),
         left_hash_keys_(std::move(left_hash_keys)),
-        right_hash_keys_(std::move(right_hash_keys)) {}
+        right_hash_keys_(std::move(right_hash_keys)),
+        use_concise_ht_(use_concise_ht) {}
 
  public:
   /**
@@ -112,6 +128,13 @@ class HashJoinPlanNode : public AbstractJoinPlanNode {
     return right_hash_keys_;
   }
 
+  /**
+   * A concise hash table is smaller and cheaper to probe than the default chained hash table when the build side is
+   * large, but it takes an extra pass over the build side to construct.
+   * @return whether to build the hash table as a concise hash table
+   */
+  bool UseConciseHashTable() const { return use_concise_ht_; }
+
   /**
    * @return the hashed value of this plan node
    */
@@ -126,6 +149,8 @@ class HashJoinPlanNode : public AbstractJoinPlanNode {
   // The left and right expressions that constitute the join keys
   std::vector<common::ManagedPointer<parser::AbstractExpression>> left_hash_keys_;
   std::vector<common::ManagedPointer<parser::AbstractExpression>> right_hash_keys_;
+  // Whether to build a concise hash table
+  bool use_concise_ht_ = false;
 };
 
 DEFINE_JSON_DECLARATIONS(HashJoinPlanNode);
@@ -68,6 +68,15 @@ class InsertPlanNode : public AbstractPlanNode {
       return *this;
     }
 
+    /**
+     * @param constant_batch constant values to insert instead of the values added by AddValues, or nullptr
+     * @return builder object
+     */
+    Builder &SetConstantBatch(common::ManagedPointer<parser::ConstantBatch> constant_batch) {
+      constant_batch_ = constant_batch;
+      return *this;
+    }
+
     /**
      * @param col_oid oid of column where value at value_idx should be inserted
      * @return builder object
@@ -93,12 +102,15 @@ class InsertPlanNode : public AbstractPlanNode {
      * @return plan node
      */
     std::unique_ptr<InsertPlanNode> Build() {
-      TERRIER_ASSERT(!children_.empty() || !values_.empty(), "Can't have an empty insert plan");
-      TERRIER_ASSERT(!children_.empty() || values_[0].size() == parameter_info_.size(),
+      TERRIER_ASSERT(!children_.empty() || !values_.empty() || constant_batch_ != nullptr,
+                     "Can't have an empty insert plan");
+      TERRIER_ASSERT(!children_.empty() || values_.empty() || values_[0].size() == parameter_info_.size(),
+                     "Must have parameter info for each value");
+      TERRIER_ASSERT(constant_batch_ == nullptr || constant_batch_->NumColumns() == parameter_info_.size(),
                      "Must have parameter info for each value");
-      return std::unique_ptr<InsertPlanNode>(new InsertPlanNode(std::move(children_), std::move(output_schema_),
-                                                                database_oid_, namespace_oid_, table_oid_,
-                                                                std::move(values_), std::move(parameter_info_)));
+      return std::unique_ptr<InsertPlanNode>(new InsertPlanNode(
+          std::move(children_), std::move(output_schema_), database_oid_, namespace_oid_, table_oid_,
+          std::move(values_), constant_batch_, std::move(parameter_info_)));
     }
 
    protected:
@@ -123,6 +135,11 @@ class InsertPlanNode : public AbstractPlanNode {
      */
     std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>> values_;
 
+    /**
+     * constant values to insert, column i of the batch goes to column parameter_info_[i]
+     */
+    common::ManagedPointer<parser::ConstantBatch> constant_batch_ = nullptr;
+
     /**
      * parameter information. Provides which column a value should be inserted into. For example, for a tuple t at
      * values_[t], the value at index i (values_[t][i]) should be inserted into column parameter_info_[i]
@@ -144,17 +161,20 @@ class InsertPlanNode : public AbstractPlanNode {
    * @param namespace_oid OID of the namespace
    * @param table_oid the OID of the target SQL table
    * @param values values to insert
+   * @param constant_batch constant values to insert, or nullptr
    * @param parameter_info parameters information
    */
   InsertPlanNode(std::vector<std::unique_ptr<AbstractPlanNode>> &&children, std::unique_ptr<OutputSchema> output_schema,
                  catalog::db_oid_t database_oid, catalog::namespace_oid_t namespace_oid, catalog::table_oid_t table_oid,
                  std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>> &&values,
+                 common::ManagedPointer<parser::ConstantBatch> constant_batch,
                  std::vector<catalog::col_oid_t> &&parameter_info)
       : AbstractPlanNode(std::move(children), std::move(output_schema)),
         database_oid_(database_oid),
         namespace_oid_(namespace_oid),
         table_oid_(table_oid),
         values_(std::move(values)),
+        constant_batch_(constant_batch),
         parameter_info_(std::move(parameter_info)) {}
 
  public:
@@ -204,10 +224,17 @@ class InsertPlanNode : public AbstractPlanNode {
   catalog::col_oid_t GetColumnOidForValue(const uint32_t value_idx) const { return parameter_info_.at(value_idx); }
 
   /**
-   * @return number of tuples to insert
+   * @return number of tuples to insert from GetValues()
    */
   size_t GetBulkInsertCount() const { return values_.size(); }
 
+  /**
+   * The constant values of a large INSERT ... VALUES. When present, the tuples are read from the batch at runtime
+   * instead of from GetValues(). Column i of the batch goes to column GetColumnOidForValue(i).
+   * @return constant values to insert, or nullptr
+   */
+  common::ManagedPointer<parser::ConstantBatch> GetConstantBatch() const { return constant_batch_; }
+
   /**
    * @return the index_oids used
    */
@@ -246,6 +273,16 @@ class InsertPlanNode : public AbstractPlanNode {
    */
   std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>> values_;
 
+  /**
+   * constant values to insert, column i of the batch goes to column parameter_info_[i]
+   */
+  common::ManagedPointer<parser::ConstantBatch> constant_batch_ = nullptr;
+
+  /**
+   * owns the constant batch of a deserialized plan node
+   */
+  std::unique_ptr<parser::ConstantBatch> deserialized_constant_batch_;
+
   /**
    * parameter information. Provides which column a value should be inserted into. For example, for a tuple t at
    * values_[t], the value at index i (values_[t][i]) should be inserted into column parameter_info_[i]
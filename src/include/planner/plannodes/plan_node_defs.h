@@ -88,7 +88,8 @@ enum class LogicalJoinType {
   INNER = 3,                  // inner
   OUTER = 4,                  // outer
   SEMI = 5,                   // IN+Subquery is SEMI
-  LEFT_SEMI = 6               // LEFT SEMI join
+  LEFT_SEMI = 6,              // LEFT SEMI join
+  ANTI = 7                    // NOT IN/NOT EXISTS+Subquery is ANTI
 };
 
 //===--------------------------------------------------------------------===//
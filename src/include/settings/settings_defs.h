@@ -11,6 +11,37 @@ SETTING_int(
     terrier::settings::Callbacks::NoOp
 )
 
+// Number of network threads accepting new connections
+SETTING_int(
+    network_acceptor_threads,
+    "Number of threads that accept connections, each on its own SO_REUSEPORT socket (default: 1)",
+    1,
+    1,
+    64,
+    false,
+    terrier::settings::Callbacks::NoOp
+)
+
+// Number of network threads serving connections
+SETTING_int(
+    connection_thread_count,
+    "Number of threads that serve client connections (default: 4)",
+    4,
+    1,
+    256,
+    false,
+    terrier::settings::Callbacks::NoOp
+)
+
+// Directory of the Unix domain socket for local clients
+SETTING_string(
+    uds_file_directory,
+    "The directory of the Unix domain socket to listen on, empty to disable it (default: /tmp)",
+    "/tmp",
+    false,
+    terrier::settings::Callbacks::NoOp
+)
+
 // RecordBufferSegmentPool size limit
 SETTING_int(
     record_buffer_segment_size,
@@ -66,6 +97,17 @@ SETTING_int(
     terrier::settings::Callbacks::NoOp
 )
 
+// Number of threads that share the work of one garbage collection invocation
+SETTING_int(
+    gc_num_threads,
+    "Number of garbage collector worker threads (default: 1)",
+    1,
+    1,
+    64,
+    false,
+    terrier::settings::Callbacks::NoOp
+)
+
 // Path to log file for WAL
 SETTING_string(
     log_file_path,
@@ -149,3 +191,11 @@ SETTING_bool(
     true,
     terrier::settings::Callbacks::MetricsTransaction
 )
+
+SETTING_bool(
+    metrics_gc,
+    "Metrics collection for the GarbageCollector component.",
+    false,
+    true,
+    terrier::settings::Callbacks::MetricsGC
+)
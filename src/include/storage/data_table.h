@@ -1,5 +1,7 @@
 #pragma once
-#include <list>
+#include <tbb/enumerable_thread_specific.h>
+#include <atomic>
+#include <set>
 #include <unordered_map>
 #include <vector>
 
@@ -33,7 +35,9 @@ class BPlusTreeIndex;
   f(uint64_t, NumUpdate) \
   f(uint64_t, NumInsert) \
   f(uint64_t, NumDelete) \
-  f(uint64_t, NumNewBlock)
+  f(uint64_t, NumNewBlock) \
+  f(uint64_t, NumSlotReuse) \
+  f(uint64_t, NumVersionChainPrune)
 // clang-format on
 DEFINE_PERFORMANCE_CLASS(DataTableCounter, DataTableCounterMembers)
 #undef DataTableCounterMembers
@@ -44,6 +48,15 @@ DEFINE_PERFORMANCE_CLASS(DataTableCounter, DataTableCounterMembers)
  * as SQL types, varlens and nullabilities are still not meaningful at this level.
  */
 class DataTable {
+ private:
+  // Node of the lock-free, append-only list of blocks in a DataTable. Nodes are only freed when the table is destroyed,
+  // so readers can follow next_ pointers without synchronization while inserters append new blocks.
+  struct BlockNode {
+    explicit BlockNode(RawBlock *block) : block_(block) {}
+    RawBlock *const block_;
+    std::atomic<BlockNode *> next_{nullptr};
+  };
+
  public:
   /**
    * Iterator for all the slots, claimed or otherwise, in the data table. This is useful for sequential scans.
@@ -95,18 +108,18 @@ class DataTable {
 
    private:
     friend class DataTable;
-    /**
-     * @warning MUST BE CALLED ONLY WHEN CALLER HOLDS LOCK TO THE LIST OF RAW BLOCKS IN THE DATA TABLE
-     */
-    SlotIterator(const DataTable *table, std::list<RawBlock *>::const_iterator block, uint32_t offset_in_block)
+    // The SqlTable chains the iterators of its DataTables (one per layout version) into a single scan
+    friend class SqlTable;
+    SlotIterator(const DataTable *table, const BlockNode *block, uint32_t offset_in_block)
         : table_(table), block_(block) {
-      current_slot_ = {block == table->blocks_.end() ? nullptr : *block, offset_in_block};
+      current_slot_ = {block == nullptr ? nullptr : block->block_, offset_in_block};
     }
 
     // TODO(Tianyu): Can potentially collapse this information into the RawBlock so we don't have to hold a pointer to
     // the table anymore. Right now we need the table to know how many slots there are in the block
     const DataTable *table_;
-    std::list<RawBlock *>::const_iterator block_;
+    // nullptr denotes one past the last block in the table
+    const BlockNode *block_;
     TupleSlot current_slot_;
   };
   /**
@@ -146,7 +159,8 @@ class DataTable {
    * fit into the given buffer, as visible to the transaction given, according to the format described by the given
    * output buffer. The tuples materialized are guaranteed to be visible and valid, and the function makes best effort
    * to fill the buffer, unless there are no more tuples. The given iterator is mutated to point to one slot passed the
-   * last slot scanned in the invocation.
+   * last slot scanned in the invocation. The scan takes no latches, so it never waits on concurrent inserts, and stops
+   * at the end of the table as of the start of the invocation.
    *
    * @param txn the calling transaction
    * @param start_pos iterator to the starting location for the sequential scan
@@ -160,8 +174,7 @@ class DataTable {
    * @return the first tuple slot contained in the data table
    */
   SlotIterator begin() const {  // NOLINT for STL name compability
-    common::SpinLatch::ScopedSpinLatch guard(&blocks_latch_);
-    return {this, blocks_.begin(), 0};
+    return {this, blocks_head_.next_.load(), 0};
   }
 
   /**
@@ -219,6 +232,11 @@ class DataTable {
    */
   const BlockLayout &GetBlockLayout() const { return accessor_.GetBlockLayout(); }
 
+  /**
+   * @return the layout version of this DataTable, which is also stamped onto every block it allocates
+   */
+  layout_version_t GetLayoutVersion() const { return layout_version_; }
+
  private:
   // The GarbageCollector needs to modify VersionPtrs when pruning version chains
   friend class GarbageCollector;
@@ -240,25 +258,47 @@ class DataTable {
   const layout_version_t layout_version_;
   const TupleAccessStrategy accessor_;
 
-  // TODO(Tianyu): For now, on insertion, we simply sequentially go through a block and allocate a
-  // new one when the current one is full. Needless to say, we will need to revisit this when extending GC to handle
-  // deleted tuples and recycle slots
-  // TODO(Tianyu): Now that we are switching to a linked list, there probably isn't a reason for it
-  // to be latched. Could just easily write a lock-free one if there's performance gain(probably not). vector->list has
-  // negligible difference in insert performance (within margin of error) when benchmarked.
-  // We also might need our own implementation because we need to handle GC of an unlinked block, as a sequential scan
-  // might be on it
-  std::list<RawBlock *> blocks_;
-  // latch used to protect block list
-  mutable common::SpinLatch blocks_latch_;
-  // latch used to protect insertion_head_
-  mutable common::SpinLatch header_latch_;
-  std::list<RawBlock *>::iterator insertion_head_;
-  // Check if we need to advance the insertion_head_
-  // This function uses header_latch_ to ensure correctness
-  void CheckMoveHead(std::list<RawBlock *>::iterator block);
+  // On insertion, we first try to reuse a slot from the free-space map. Failing that, every thread sequentially fills
+  // its own insertion block, and claims a new one when the current one is full. No two threads ever insert into the
+  // same block, so the block list is the only structure inserters share, and appending to it is lock-free.
+  // TODO(Tianyu): We might need to handle GC of an unlinked block, as a sequential scan might be on it
+
+  // Sentinel node of the block list. blocks_head_.next_ is the first block in the table.
+  BlockNode blocks_head_{nullptr};
+  // Last (or close to last) node of the block list. Appenders start from here and walk forward to the actual end.
+  std::atomic<BlockNode *> blocks_tail_{&blocks_head_};
+  // The insertion block of every thread that has inserted into this table
+  tbb::enumerable_thread_specific<RawBlock *> insertion_blocks_{static_cast<RawBlock *>(nullptr)};
+  // A block that is part of the table but not yet claimed by any thread (the one allocated on construction)
+  std::atomic<RawBlock *> unclaimed_block_{nullptr};
   mutable DataTableCounter data_table_counter_;
 
+  // Free-space map. Holds, for every hot block with reusable space, the offsets of slots that were deallocated and are
+  // safe to hand out to a new insert again. Offsets are kept sorted so reused slots are packed towards the start of the
+  // block. Only the GC and the block compactor feed this map, see ReleaseSlots.
+  std::unordered_map<RawBlock *, std::set<uint32_t>> free_slots_;
+  // latch used to protect free_slots_
+  mutable common::SpinLatch free_slots_latch_;
+  // number of offsets in free_slots_, so inserts can skip the latch when there is nothing to reuse
+  std::atomic<uint64_t> num_free_slots_{0};
+
+  // Readers that have to apply at least this many deltas to reconstruct their version of a tuple consider it hot, and
+  // prune the part of its version chain no running transaction can see instead of leaving it to the next GC run.
+  static constexpr uint32_t VERSION_CHAIN_PRUNE_THRESHOLD = 8;
+
+  // Tries to allocate a slot from the free-space map. Returns false if there is no reusable slot in any hot block.
+  bool AllocateFromFreeSlots(TupleSlot *slot);
+
+  // Hands deallocated slots back to the free-space map so later inserts can reuse them. The caller must guarantee that
+  // no running transaction or index can still reach the old tuple in any of these slots, i.e. this should be called
+  // from a deferred action registered after the slots are deallocated. Slots that were reallocated in the meantime, or
+  // that belong to blocks that are no longer hot, are ignored.
+  void ReleaseSlots(const std::vector<TupleSlot> &slots);
+
+  // Removes the given block from the free-space map, so no insert will allocate into it until slots are released again.
+  // Used by the block compactor, which needs exclusive control over the empty slots of the blocks it compacts.
+  void ClearFreeSlots(RawBlock *block);
+
   // A templatized version for select, so that we can use the same code for both row and column access.
   // the method is explicitly instantiated for ProjectedRow and ProjectedColumns::RowView
   template <class RowType>
@@ -267,6 +307,22 @@ class DataTable {
 
   void InsertInto(common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &redo,
                   TupleSlot dest);
+
+  // Scan fast path for blocks that have no versions at all. Copies the visible tuples from the iterator up to the end
+  // of its block, end_pos or until the buffer is full into the buffer starting at filled, and advances both. Returns
+  // false and leaves both untouched if the block has versions, in which case the caller has to read it tuple by tuple.
+  bool ScanVersionFreeBlock(SlotIterator *start_pos, const SlotIterator &end_pos, ProjectedColumns *out_buffer,
+                            uint32_t *filled) const;
+
+  // Copies num_tuples consecutive tuples of a version-free block, starting at offset, into the buffer at out_offset
+  void CopyVersionFreeRange(RawBlock *block, uint32_t offset, uint32_t num_tuples, ProjectedColumns *out_buffer,
+                            uint32_t out_offset) const;
+  // Cuts the version chain after from at the first record older than the given timestamp, which must be older than
+  // every running transaction. Never touches the head of the chain, so it only races with other pruners and the GC,
+  // all of which only ever shorten the invisible tail. The unlinked records still belong to their transactions, which
+  // the GC has yet to unlink and deallocate, so they stay valid for any reader still traversing them.
+  void PruneVersionChain(UndoRecord *from, transaction::timestamp_t oldest) const;
+
   // Atomically read out the version pointer value.
   UndoRecord *AtomicallyReadVersionPtr(TupleSlot slot, const TupleAccessStrategy &accessor) const;
 
@@ -291,9 +347,18 @@ class DataTable {
   bool CompareAndSwapVersionPtr(TupleSlot slot, const TupleAccessStrategy &accessor, UndoRecord *expected,
                                 UndoRecord *desired);
 
-  // Allocates a new block to be used as insertion head.
+  // Allocates a new block to be used as an insertion block.
   RawBlock *NewBlock();
 
+  // Lock-free append of a block to the end of the block list
+  void AppendBlock(RawBlock *block);
+
+  // @return the last node in the block list, or nullptr if the table has no blocks
+  const BlockNode *LastBlock() const;
+
+  // Claims a block for the calling thread to insert into, either the unclaimed block or a new one from the block store
+  RawBlock *ClaimInsertionBlock();
+
   /**
    * Determine if a Tuple is visible (present and not deleted) to the given transaction. It's effectively Select's logic
    * (follow a version chain if present) without the materialization. If the logic of Select changes, this should change
@@ -1,10 +1,15 @@
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "common/shared_latch.h"
+#include "common/worker_pool.h"
 #include "storage/access_observer.h"
 #include "storage/index/index.h"
 #include "transaction/transaction_context.h"
@@ -31,22 +36,33 @@ class GarbageCollector {
    *                 it is not null. The observer can then gain insight invoke other components to perform actions.
    *                 The observer's function implementation needs to be lightweight because it is called on the GC
    *                 thread.
+   * @param num_workers number of threads that share the work of a GC invocation. With a single worker everything runs
+   *                    on the thread invoking the GC; otherwise unlinking, deallocation and index GC are partitioned
+   *                    across a pool of this many threads.
    */
   // TODO(Tianyu): Eventually the GC will be re-written to be purely on the deferred action manager. which will
   //  eliminate this perceived redundancy of taking in a transaction manager.
   GarbageCollector(const common::ManagedPointer<transaction::TimestampManager> timestamp_manager,
                    const common::ManagedPointer<transaction::DeferredActionManager> deferred_action_manager,
-                   const common::ManagedPointer<transaction::TransactionManager> txn_manager, AccessObserver *observer)
+                   const common::ManagedPointer<transaction::TransactionManager> txn_manager, AccessObserver *observer,
+                   const uint32_t num_workers = 1)
       : timestamp_manager_(timestamp_manager),
         deferred_action_manager_(deferred_action_manager),
         txn_manager_(txn_manager),
         observer_(observer),
+        num_workers_(num_workers),
         last_unlinked_{0} {
     TERRIER_ASSERT(txn_manager_->GCEnabled(),
                    "The TransactionManager needs to be instantiated with gc_enabled true for GC to work!");
+    TERRIER_ASSERT(num_workers_ > 0, "GC needs at least one worker.");
+    if (num_workers_ > 1) {
+      worker_pool_ = std::make_unique<common::WorkerPool>(num_workers_, common::TaskQueue());
+      worker_pool_->Startup();
+    }
   }
 
   ~GarbageCollector() {
+    if (worker_pool_ != nullptr) worker_pool_->Shutdown();
     TERRIER_ASSERT(txns_to_deallocate_.empty(), "Not all txns have been deallocated");
     TERRIER_ASSERT(txns_to_unlink_.empty(), "Not all txns have been unlinked");
   }
@@ -74,7 +90,33 @@ class GarbageCollector {
    */
   void UnregisterIndexForGC(common::ManagedPointer<index::Index> index);
 
+  /**
+   * @return number of threads that share the work of a GC invocation
+   */
+  uint32_t NumWorkers() const { return num_workers_; }
+
  private:
+  // Slots deallocated in one GC invocation, grouped by the table they belong to
+  using ReclaimedSlots = std::unordered_map<DataTable *, std::vector<TupleSlot>>;
+
+  // State a single worker accumulates while unlinking its partition. Partitions are disjoint in the blocks they cover,
+  // so every version chain is only ever truncated by one worker, and the results are merged on the GC thread.
+  struct UnlinkPartition {
+    // The undo records in this partition, with whether the transaction that wrote them aborted. They are split out
+    // on the GC thread, so that every worker only walks its own records.
+    std::vector<std::pair<UndoRecord *, bool>> records_;
+    // It is sufficient to truncate each version chain once in a GC invocation because we only read the maximal safe
+    // timestamp once, and the version chain is sorted by timestamp. Here we keep a set of slots to truncate to avoid
+    // wasteful traversals of the version chain.
+    std::unordered_set<TupleSlot> visited_slots_;
+    // Slots of deleted tuples that are handed back to their tables' free-space maps at the end of this invocation
+    ReclaimedSlots reclaimed_slots_;
+    // Outdated varlen buffers, freed along with the transactions unlinked in this invocation
+    std::vector<const byte *> loose_ptrs_;
+    // Blocks written by the unlinked records, reported to the observer from the GC thread
+    std::vector<RawBlock *> observed_blocks_;
+  };
+
   /**
    * Process the deallocate queue
    * @return number of txns (not UndoRecords) processed for debugging/testing
@@ -92,9 +134,17 @@ class GarbageCollector {
    */
   void ProcessDeferredActions(transaction::timestamp_t oldest_txn);
 
-  void ReclaimSlotIfDeleted(UndoRecord *undo_record) const;
+  void UnlinkPartitionOf(transaction::timestamp_t oldest_txn, UnlinkPartition *partition) const;
+
+  uint32_t PartitionOf(const UndoRecord &undo_record) const;
+
+  void RunOnWorkers(uint32_t num_tasks, const std::function<void(uint32_t)> &task);
+
+  void ReclaimSlotIfDeleted(UndoRecord *undo_record, ReclaimedSlots *reclaimed) const;
+
+  void ReleaseReclaimedSlots(ReclaimedSlots *reclaimed) const;
 
-  void ReclaimBufferIfVarlen(transaction::TransactionContext *txn, UndoRecord *undo_record) const;
+  void ReclaimBufferIfVarlen(std::vector<const byte *> *loose_ptrs, UndoRecord *undo_record) const;
 
   void TruncateVersionChain(DataTable *table, TupleSlot slot, transaction::timestamp_t oldest) const;
 
@@ -104,8 +154,13 @@ class GarbageCollector {
   const common::ManagedPointer<transaction::DeferredActionManager> deferred_action_manager_;
   const common::ManagedPointer<transaction::TransactionManager> txn_manager_;
   AccessObserver *observer_;
+  const uint32_t num_workers_;
+  // only allocated when there is more than one worker, the GC thread does all the work otherwise
+  std::unique_ptr<common::WorkerPool> worker_pool_;
   // timestamp of the last time GC unlinked anything. We need this to know when unlinked versions are safe to deallocate
   transaction::timestamp_t last_unlinked_;
+  // number of txns the last invocation could not unlink yet because they were still visible, reported as GC lag
+  uint32_t unlink_backlog_ = 0;
   // queue of txns that have been unlinked, and should possible be deleted on next GC run
   transaction::TransactionQueue txns_to_deallocate_;
   // queue of txns that need to be unlinked
@@ -3,6 +3,7 @@
 #include <chrono>  //NOLINT
 #include <thread>  //NOLINT
 
+#include "metrics/metrics_manager.h"
 #include "storage/garbage_collector.h"
 #include "transaction/deferred_action_manager.h"
 
@@ -17,8 +18,10 @@ class GarbageCollectorThread {
   /**
    * @param gc pointer to the garbage collector object to be run on this thread
    * @param gc_period sleep time between GC invocations
+   * @param metrics_manager if not DISABLED, the GC thread registers with it to record GC metrics
    */
-  GarbageCollectorThread(common::ManagedPointer<GarbageCollector> gc, std::chrono::milliseconds gc_period);
+  GarbageCollectorThread(common::ManagedPointer<GarbageCollector> gc, std::chrono::milliseconds gc_period,
+                         common::ManagedPointer<metrics::MetricsManager> metrics_manager = DISABLED);
 
   ~GarbageCollectorThread() { StopGC(); }
 
@@ -70,13 +73,16 @@ class GarbageCollectorThread {
   volatile bool run_gc_;
   volatile bool gc_paused_;
   std::chrono::milliseconds gc_period_;
+  const common::ManagedPointer<metrics::MetricsManager> metrics_manager_;
   std::thread gc_thread_;
 
   void GCThreadLoop() {
+    if (metrics_manager_ != DISABLED) metrics_manager_->RegisterThread();
     while (run_gc_) {
       std::this_thread::sleep_for(gc_period_);
       if (!gc_paused_) gc_->PerformGarbageCollection();
     }
+    if (metrics_manager_ != DISABLED) metrics_manager_->UnregisterThread();
   }
 };
 
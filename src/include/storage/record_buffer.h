@@ -41,6 +41,16 @@ class RecordBufferSegment {
     return result;
   }
 
+  /**
+   * Gives back the space of the most recently reserved record, so that the next reservation reuses it.
+   *
+   * @param size the size the record was reserved with
+   */
+  void Unreserve(const uint32_t size) {
+    TERRIER_ASSERT(size <= size_, "cannot give back more than was reserved");
+    size_ -= size;
+  }
+
   /**
    * Clears the buffer segment.
    *
@@ -340,6 +350,12 @@ class RedoBuffer {
    */
   byte *NewEntry(uint32_t size);
 
+  /**
+   * Removes the last redo record requested, which has not been handed to the log manager yet as it is always in the
+   * current segment. Used to stage a write again in a different form. The next NewEntry reuses the record's space.
+   */
+  void DiscardLastEntry();
+
   /**
    * Flush all contents of the redo buffer to be logged out, effectively closing this redo buffer. No further entries
    * can be written to this redo buffer after the function returns.
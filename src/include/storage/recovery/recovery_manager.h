@@ -333,7 +333,8 @@ class RecoveryManager : public common::DedicatedThreadOwner {
 
   /**
    * Returns the list of col oids this redo record modified
-   * @param sql_table sql table that redo record modifies
+   * @param sql_table sql table that redo record modifies. Must be a catalog table, which stays on its initial layout
+   * version.
    * @param record record we want oids for
    * @return list of oids
    */
@@ -1,10 +1,14 @@
 #pragma once
+#include <atomic>
 #include <list>
+#include <memory>
 #include <set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "catalog/schema.h"
+#include "common/container/concurrent_map.h"
 #include "storage/data_table.h"
 #include "storage/projected_columns.h"
 #include "storage/projected_row.h"
@@ -25,6 +29,12 @@ namespace terrier::storage {
  * concepts like Schema. The goal is to hide concepts like col_id_t and BlockLayout above the SqlTable level.
  * The SqlTable API should only refer to storage concepts via things like Schema and col_oid_t, and then perform the
  * translation to BlockLayout and col_id_t to talk to the DataTable and other areas of the storage layer.
+ *
+ * Every schema change (e.g. ALTER TABLE ADD/DROP COLUMN) creates a new layout version with its own DataTable, which
+ * only costs the metadata. Existing tuples stay where they are. Callers pass the layout version their projections were
+ * built against, and tuples stored under another version are translated on the fly: columns added since are filled
+ * with their default value (or NULL), and columns dropped since are simply not read. New tuples always go into the
+ * latest version, and an update that touches a column the stored tuple does not have migrates the tuple there.
  */
 class SqlTable {
   /**
@@ -36,6 +46,23 @@ class SqlTable {
     DataTable *data_table_;
     BlockLayout layout_;
     ColumnMap column_map_;
+    // Inverse of column_map_, indexed by col_id. Reserved columns map to an invalid oid.
+    std::vector<catalog::col_oid_t> col_oids_;
+    // Default value of every column that has a constant, non-NULL default, in the column's storage format. Used to fill
+    // in columns that tuples stored under older versions do not have. Missing entries mean NULL.
+    std::unordered_map<catalog::col_oid_t, std::unique_ptr<byte[]>> defaults_;
+  };
+
+  /**
+   * Maps the columns of a projection built against one layout version onto a projection built against another.
+   */
+  struct VersionTranslation {
+    // (index in the source projection, index in the target projection) of every column both versions have
+    std::vector<std::pair<uint16_t, uint16_t>> shared_;
+    // (index in the target projection, default value or nullptr for NULL) of every column the source version lacks
+    std::vector<std::pair<uint16_t, const byte *>> missing_;
+    // attribute size of every column in the target projection
+    std::vector<uint16_t> attr_sizes_;
   };
 
  public:
@@ -51,7 +78,22 @@ class SqlTable {
   /**
    * Destructs a SqlTable, frees all its members.
    */
-  ~SqlTable() { delete table_.data_table_; }
+  ~SqlTable();
+
+  /**
+   * Installs a new layout version for the given Schema. This only builds the metadata for the new version, existing
+   * tuples are translated when read and migrated lazily when updated. Columns are matched across versions by oid.
+   * Schema changes must be serialized by the caller (the catalog), but may run concurrently with reads and writes.
+   *
+   * @param schema the new Schema of this SqlTable
+   * @return the layout version of the new Schema
+   */
+  layout_version_t UpdateSchema(const catalog::Schema &schema);
+
+  /**
+   * @return the layout version of the most recent Schema of this SqlTable
+   */
+  layout_version_t LatestLayoutVersion() const { return latest_.load()->data_table_->GetLayoutVersion(); }
 
   /**
    * Materializes a single tuple from the given slot, as visible at the timestamp of the calling txn.
@@ -59,11 +101,14 @@ class SqlTable {
    * @param txn the calling transaction
    * @param slot the tuple slot to read
    * @param out_buffer output buffer. The object should already contain projection list information. @see ProjectedRow.
+   * @param layout_version the layout version out_buffer was initialized against
    * @return true if tuple is visible to this txn and ProjectedRow has been populated, false otherwise
    */
   bool Select(const common::ManagedPointer<transaction::TransactionContext> txn, const TupleSlot slot,
-              ProjectedRow *const out_buffer) const {
-    return table_.data_table_->Select(txn, slot, out_buffer);
+              ProjectedRow *const out_buffer, const layout_version_t layout_version) const {
+    if (slot.GetBlock()->layout_version_ == layout_version)
+      return slot.GetBlock()->data_table_->Select(txn, slot, out_buffer);
+    return SelectFromOtherVersion(txn, slot, out_buffer, layout_version);
   }
 
   /**
@@ -73,15 +118,28 @@ class SqlTable {
    * @param txn the calling transaction
    * @param redo the desired change to be applied. This should be the after-image of the attributes of interest. The
    * TupleSlot in this RedoRecord must be set to the intended tuple.
+   * @param layout_version the layout version the delta in redo was initialized against
+   * @param migrated_slot if not nullptr, set to the slot the tuple lives in after the update
    * @return true if successful, false otherwise
+   * @warning if the tuple is stored under another layout version than the given one, the write is staged again in the
+   * layout it is stored under and redo must not be used after this call. If the update also sets a column the stored
+   * tuple does not have, the tuple is moved to the latest layout version, which is logged as a delete and an insert.
+   * Its new slot is then returned through migrated_slot, and callers must treat the update like a delete and insert,
+   * i.e. move any index entries pointing at the old slot.
    */
-  bool Update(const common::ManagedPointer<transaction::TransactionContext> txn, RedoRecord *const redo) const {
+  bool Update(const common::ManagedPointer<transaction::TransactionContext> txn, RedoRecord *const redo,
+              const layout_version_t layout_version,
+              TupleSlot *const migrated_slot = nullptr) const {
     TERRIER_ASSERT(redo->GetTupleSlot() != TupleSlot(nullptr, 0), "TupleSlot was never set in this RedoRecord.");
     TERRIER_ASSERT(redo == reinterpret_cast<LogRecord *>(txn->redo_buffer_.LastRecord())
                                ->LogRecord::GetUnderlyingRecordBodyAs<RedoRecord>(),
                    "This RedoRecord is not the most recent entry in the txn's RedoBuffer. Was StageWrite called "
                    "immediately before?");
-    const auto result = table_.data_table_->Update(txn, redo->GetTupleSlot(), *(redo->Delta()));
+    const TupleSlot slot = redo->GetTupleSlot();
+    if (migrated_slot != nullptr) *migrated_slot = slot;
+    const auto result = slot.GetBlock()->layout_version_ == layout_version
+                            ? slot.GetBlock()->data_table_->Update(txn, slot, *(redo->Delta()))
+                            : UpdateFromOtherVersion(txn, redo, layout_version, migrated_slot);
     if (!result) {
       // For MVCC correctness, this txn must now abort for the GC to clean up the version chain in the DataTable
       // correctly.
@@ -96,15 +154,22 @@ class SqlTable {
    *
    * @param txn the calling transaction
    * @param redo after-image of the inserted tuple.
+   * @param layout_version the layout version the after-image in redo was initialized against. The tuple is always
+   * stored under the latest layout version, with defaults filled in for columns the given version does not have.
    * @return TupleSlot for the inserted tuple
+   * @warning if the given layout version is not the latest one, the write is staged again in the latest layout and
+   * redo must not be used after this call
    */
-  TupleSlot Insert(const common::ManagedPointer<transaction::TransactionContext> txn, RedoRecord *const redo) const {
+  TupleSlot Insert(const common::ManagedPointer<transaction::TransactionContext> txn, RedoRecord *const redo,
+                   const layout_version_t layout_version) const {
     TERRIER_ASSERT(redo->GetTupleSlot() == TupleSlot(nullptr, 0), "TupleSlot was set in this RedoRecord.");
     TERRIER_ASSERT(redo == reinterpret_cast<LogRecord *>(txn->redo_buffer_.LastRecord())
                                ->LogRecord::GetUnderlyingRecordBodyAs<RedoRecord>(),
                    "This RedoRecord is not the most recent entry in the txn's RedoBuffer. Was StageWrite called "
                    "immediately before?");
-    const auto slot = table_.data_table_->Insert(txn, *(redo->Delta()));
+    DataTable *const latest = latest_.load()->data_table_;
+    if (latest->GetLayoutVersion() != layout_version) return InsertFromOtherVersion(txn, redo, layout_version);
+    const auto slot = latest->Insert(txn, *(redo->Delta()));
     redo->SetTupleSlot(slot);
     return slot;
   }
@@ -124,7 +189,7 @@ class SqlTable {
                 ->GetTupleSlot() == slot,
         "This Delete is not the most recent entry in the txn's RedoBuffer. Was StageDelete called immediately before?");
 
-    const auto result = table_.data_table_->Delete(txn, slot);
+    const auto result = slot.GetBlock()->data_table_->Delete(txn, slot);
     if (!result) {
       // For MVCC correctness, this txn must now abort for the GC to clean up the version chain in the DataTable
       // correctly.
@@ -138,68 +203,85 @@ class SqlTable {
    * fit into the given buffer, as visible to the transaction given, according to the format described by the given
    * output buffer. The tuples materialized are guaranteed to be visible and valid, and the function makes best effort
    * to fill the buffer, unless there are no more tuples. The given iterator is mutated to point to one slot past the
-   * last slot scanned in the invocation.
+   * last slot scanned in the invocation. A single invocation never crosses from one layout version into the next.
    *
    * @param txn the calling transaction
    * @param start_pos iterator to the starting location for the sequential scan
    * @param out_buffer output buffer. The object should already contain projection list information. This buffer is
    *                   always cleared of old values.
+   * @param layout_version the layout version out_buffer was initialized against
    */
   void Scan(const common::ManagedPointer<transaction::TransactionContext> txn, DataTable::SlotIterator *const start_pos,
-            ProjectedColumns *const out_buffer) const {
-    return table_.data_table_->Scan(txn, start_pos, out_buffer);
+            ProjectedColumns *const out_buffer, const layout_version_t layout_version) const {
+    if (start_pos->table_->GetLayoutVersion() == layout_version)
+      start_pos->table_->Scan(txn, start_pos, out_buffer);
+    else
+      ScanFromOtherVersion(txn, start_pos, out_buffer, layout_version);
+    SkipExhaustedVersions(start_pos);
   }
 
   /**
-   * @return the first tuple slot contained in the underlying DataTable
+   * @return the first tuple slot contained in the underlying DataTables
    */
-  DataTable::SlotIterator begin() const { return table_.data_table_->begin(); }  // NOLINT for STL name compability
+  DataTable::SlotIterator begin() const {  // NOLINT for STL name compability
+    // Tuples may live in any version, so iteration always starts at the first one and walks up to the latest
+    DataTable::SlotIterator it = GetVersion(INITIAL_LAYOUT_VERSION).data_table_->begin();
+    SkipExhaustedVersions(&it);
+    return it;
+  }
 
   /**
-   * @return one past the last tuple slot contained in the underlying DataTable
+   * @return one past the last tuple slot contained in the underlying DataTables
    */
-  DataTable::SlotIterator end() const { return table_.data_table_->end(); }  // NOLINT for STL name compability
+  DataTable::SlotIterator end() const { return latest_.load()->data_table_->end(); }  // NOLINT for STL name compability
 
   /**
    * Generates an ProjectedColumnsInitializer for the execution layer to use. This performs the translation from col_oid
    * to col_id for the Initializer's constructor so that the execution layer doesn't need to know anything about col_id.
    * @param col_oids set of col_oids to be projected
    * @param max_tuples the maximum number of tuples to store in the ProjectedColumn
+   * @param layout_version the layout version to project against
    * @return initializer to create ProjectedColumns
    * @warning col_oids must be a set (no repeats)
    */
-  ProjectedColumnsInitializer InitializerForProjectedColumns(const std::vector<catalog::col_oid_t> &col_oids,
-                                                             const uint32_t max_tuples) const {
+  ProjectedColumnsInitializer InitializerForProjectedColumns(
+      const std::vector<catalog::col_oid_t> &col_oids, const uint32_t max_tuples,
+      const layout_version_t layout_version) const {
     TERRIER_ASSERT((std::set<catalog::col_oid_t>(col_oids.cbegin(), col_oids.cend())).size() == col_oids.size(),
                    "There should not be any duplicated in the col_ids!");
-    auto col_ids = ColIdsForOids(col_oids);
+    auto col_ids = ColIdsForOids(col_oids, layout_version);
     TERRIER_ASSERT(col_ids.size() == col_oids.size(),
                    "Projection should be the same number of columns as requested col_oids.");
-    return ProjectedColumnsInitializer(table_.layout_, col_ids, max_tuples);
+    return ProjectedColumnsInitializer(GetVersion(layout_version).layout_, col_ids, max_tuples);
   }
 
   /**
    * Generates an ProjectedRowInitializer for the execution layer to use. This performs the translation from col_oid to
    * col_id for the Initializer's constructor so that the execution layer doesn't need to know anything about col_id.
    * @param col_oids set of col_oids to be projected
+   * @param layout_version the layout version to project against
    * @return initializer to create ProjectedRow
    * @warning col_oids must be a set (no repeats)
    */
-  ProjectedRowInitializer InitializerForProjectedRow(const std::vector<catalog::col_oid_t> &col_oids) const {
+  ProjectedRowInitializer InitializerForProjectedRow(
+      const std::vector<catalog::col_oid_t> &col_oids,
+      const layout_version_t layout_version) const {
     TERRIER_ASSERT((std::set<catalog::col_oid_t>(col_oids.cbegin(), col_oids.cend())).size() == col_oids.size(),
                    "There should not be any duplicated in the col_ids!");
-    auto col_ids = ColIdsForOids(col_oids);
+    auto col_ids = ColIdsForOids(col_oids, layout_version);
     TERRIER_ASSERT(col_ids.size() == col_oids.size(),
                    "Projection should be the same number of columns as requested col_oids.");
-    return ProjectedRowInitializer::Create(table_.layout_, col_ids);
+    return ProjectedRowInitializer::Create(GetVersion(layout_version).layout_, col_ids);
   }
 
   /**
    * Generate a projection map given column oids
    * @param col_oids oids that will be scanned.
+   * @param layout_version the layout version to project against
    * @return the projection map
    */
-  ProjectionMap ProjectionMapForOids(const std::vector<catalog::col_oid_t> &col_oids);
+  ProjectionMap ProjectionMapForOids(const std::vector<catalog::col_oid_t> &col_oids,
+                                     layout_version_t layout_version);
 
  private:
   friend class RecoveryManager;  // Needs access to OID and ID mappings
@@ -210,22 +292,139 @@ class SqlTable {
   const common::ManagedPointer<BlockStore>
       block_store_;  // TODO(Matt): do we need this stashed at this layer? We don't use it.
 
-  // Eventually we'll support adding more tables when schema changes. For now we'll always access the one DataTable.
-  DataTableVersion table_;
+  // One DataTable per layout version. Versions are numbered densely from 0 and are never removed while the SqlTable
+  // is alive, since older tuples may still live in them.
+  common::ConcurrentMap<layout_version_t, DataTableVersion *> tables_;
+  std::atomic<DataTableVersion *> latest_;
+
+  /**
+   * Builds the metadata and the DataTable of a layout version
+   * @param schema Schema of the layout version
+   * @param layout_version number of the layout version
+   * @return the new layout version, owned by the caller
+   */
+  DataTableVersion *CreateVersion(const catalog::Schema &schema, layout_version_t layout_version) const;
+
+  /**
+   * @param layout_version a layout version that exists in this SqlTable
+   * @return the metadata of the given layout version
+   */
+  const DataTableVersion &GetVersion(const layout_version_t layout_version) const {
+    const auto it = tables_.Find(layout_version);
+    TERRIER_ASSERT(it != tables_.cend(), "Requested layout version does not exist in this SqlTable.");
+    return *(it->second);
+  }
+
+  /**
+   * @param layout_version a layout version that exists in this SqlTable
+   * @return the layout of the given version
+   */
+  const BlockLayout &GetBlockLayout(const layout_version_t layout_version) const {
+    return GetVersion(layout_version).layout_;
+  }
 
   /**
    * Given a set of col_oids, return a vector of corresponding col_ids to use for ProjectionInitialization
    * @param col_oids set of col_oids, they must be in the table's ColumnMap
+   * @param layout_version the layout version to resolve the col_oids in
    * @return vector of col_ids for these col_oids
    */
-  std::vector<col_id_t> ColIdsForOids(const std::vector<catalog::col_oid_t> &col_oids) const;
+  std::vector<col_id_t> ColIdsForOids(const std::vector<catalog::col_oid_t> &col_oids,
+                                      layout_version_t layout_version) const;
 
   /**
-   * @warning This function is expensive to call and should be used with caution and sparingly.
    * Returns the col oid for the given col id
    * @param col_id given col id
+   * @param layout_version the layout version the col_id belongs to
    * @return col oid for the provided col id
    */
-  catalog::col_oid_t OidForColId(col_id_t col_id) const;
+  catalog::col_oid_t OidForColId(col_id_t col_id, layout_version_t layout_version) const;
+
+  /**
+   * Computes how the columns of a projection in one version map onto the columns of a projection in another
+   * @param from version of the source projection
+   * @param from_col_ids column ids of the source projection
+   * @param num_from number of columns in the source projection
+   * @param to version of the target projection
+   * @param to_col_ids column ids of the target projection
+   * @param num_to number of columns in the target projection
+   * @return the translation from the source projection to the target projection
+   */
+  static VersionTranslation Translate(const DataTableVersion &from, const col_id_t *from_col_ids, uint16_t num_from,
+                                      const DataTableVersion &to, const col_id_t *to_col_ids, uint16_t num_to);
+
+  /**
+   * @param from version the columns are given in
+   * @param col_ids column ids in from
+   * @param num_cols number of column ids
+   * @param to version to look the columns up in
+   * @return the column ids in to of the given columns, skipping the ones to does not have
+   */
+  static std::vector<col_id_t> ColIdsInVersion(const DataTableVersion &from, const col_id_t *col_ids, uint16_t num_cols,
+                                               const DataTableVersion &to);
+
+  /**
+   * Copies the shared columns of from into to, and fills the columns from does not have with their defaults
+   */
+  template <class RowType>
+  static void ApplyTranslation(const VersionTranslation &translation, const ProjectedRow &from, RowType *to);
+
+  /**
+   * Select of a tuple whose layout version differs from the one out_buffer was initialized against
+   */
+  template <class RowType>
+  bool SelectFromOtherVersion(common::ManagedPointer<transaction::TransactionContext> txn, TupleSlot slot,
+                              RowType *out_buffer, layout_version_t layout_version) const;
+
+  /**
+   * Update of a tuple whose layout version differs from the one the delta was initialized against. May migrate the
+   * tuple to the latest version, @see Update.
+   */
+  bool UpdateFromOtherVersion(common::ManagedPointer<transaction::TransactionContext> txn, RedoRecord *redo,
+                              layout_version_t layout_version, TupleSlot *migrated_slot) const;
+
+  /**
+   * Insert of an after-image that was not initialized against the latest layout version, @see Insert
+   */
+  TupleSlot InsertFromOtherVersion(common::ManagedPointer<transaction::TransactionContext> txn, RedoRecord *redo,
+                                   layout_version_t layout_version) const;
+
+  /**
+   * Takes the delta out of the txn's last staged write, so that the write can be staged again in another layout. The
+   * log and the abort path read a redo record in the layout of the block its slot is in, so it must not stay in the
+   * caller's layout.
+   * @param txn the calling transaction
+   * @param redo the last write staged by txn
+   * @return copy of the delta, to be freed with delete[]
+   */
+  static byte *UnstageDelta(common::ManagedPointer<transaction::TransactionContext> txn, const RedoRecord &redo);
+
+  /**
+   * Makes every varlen in row that the translation did not copy over from the delta point to its own copy of the
+   * content, as the tuple the row is written into will own and free it
+   */
+  static void CopyUnsharedVarlens(const DataTableVersion &version, const VersionTranslation &translation,
+                                  ProjectedRow *row);
+
+  /**
+   * Frees the varlen content of the columns of delta that the translation did not copy, or of all of them if
+   * translation is nullptr. These values never made it into a staged write, so nothing else would reclaim them.
+   */
+  static void DeallocateUnsharedVarlens(const DataTableVersion &version, const ProjectedRow &delta,
+                                        const VersionTranslation *translation);
+
+  /**
+   * Scan of a layout version other than the one out_buffer was initialized against. Translates tuple-at-a-time.
+   */
+  void ScanFromOtherVersion(common::ManagedPointer<transaction::TransactionContext> txn,
+                            DataTable::SlotIterator *start_pos, ProjectedColumns *out_buffer,
+                            layout_version_t layout_version) const;
+
+  /**
+   * Moves an iterator that is at the end of one layout version to the first slot of the next non-empty version, so
+   * that comparing against end() (the end of the latest version) is enough to detect the end of the whole SqlTable.
+   * @param it iterator to normalize
+   */
+  void SkipExhaustedVersions(DataTable::SlotIterator *it) const;
 };
 }  // namespace terrier::storage
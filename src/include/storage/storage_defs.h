@@ -33,6 +33,9 @@ constexpr uint8_t NUM_ATTR_BOUNDARIES = 4;
 STRONG_TYPEDEF(col_id_t, uint16_t);
 STRONG_TYPEDEF(layout_version_t, uint16_t);
 
+// The layout version every SqlTable starts with. Catalog tables never change their schema and stay on it.
+constexpr layout_version_t INITIAL_LAYOUT_VERSION = layout_version_t(0);
+
 // All tuples potentially visible to txns should have a non-null attribute of version vector.
 // This is not to be confused with a non-null version vector that has value nullptr (0).
 
@@ -69,9 +72,6 @@ class alignas(common::Constants::BLOCK_SIZE) RawBlock {
    * The insert head tells us where the next insertion should take place. Notice that this counter is never
    * decreased as slot recycling does not happen on the fly with insertions. A background compaction process
    * scans through blocks and free up slots.
-   * Since the block size is less then (1<<20) the uppper 12 bits of insert_head_ is free. We use the first bit (1<<31)
-   * to indicate if the block is insertable.
-   * If the first bit is 0, the block is insertable, otherwise one txn is inserting to this block
    */
   std::atomic<uint32_t> insert_head_;
   /**
@@ -79,21 +79,25 @@ class alignas(common::Constants::BLOCK_SIZE) RawBlock {
    * and the transformation thread. In practice this can be used almost like a lock.
    */
   BlockAccessController controller_;
+  /**
+   * Version synopsis of the block: the number of slots in it whose version pointer is not null. Writers bump this
+   * before installing a version and the GC drops it when it truncates a version chain, so a sequential scan that sees
+   * zero can read the block in place without looking at any version chains.
+   */
+  std::atomic<uint64_t> num_versions_;
 
   /**
    * Contents of the raw block.
    */
   byte content_[common::Constants::BLOCK_SIZE - sizeof(uintptr_t) - sizeof(uint16_t) - sizeof(layout_version_t) -
-                sizeof(uint32_t) - sizeof(BlockAccessController)];
+                sizeof(uint32_t) - sizeof(BlockAccessController) - sizeof(uint64_t)];
   // A Block needs to always be aligned to 1 MB, so we can get free bytes to
   // store offsets within a block in one 8-byte word
 
   /**
-   * Get the offset of this block. Because the first bit insert_head_ is used to indicate the status
-   * of the block, we need to clear the status bit to get the real offset
    * @return the offset which tells us where the next insertion should take place
    */
-  uint32_t GetInsertHead() { return INT32_MAX & insert_head_.load(); }
+  uint32_t GetInsertHead() { return insert_head_.load(); }
 };
 
 /**
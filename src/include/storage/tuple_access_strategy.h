@@ -46,6 +46,8 @@ class TupleAccessStrategy {
    * -----------------------------------------------------------------------------------------------------------------
    * | data_table *(64) | padding (16) | layout_version (16) | insert_head (32) |        control_block (64)          |
    * -----------------------------------------------------------------------------------------------------------------
+   * | num_versions (64) |
+   * -----------------------------------------------------------------------------------------------------------------
    * | ArrowBlockMetadata | attr_offsets[num_col] (32) | bitmap for slots (64-bit aligned) | data (64-bit aligned)   |
    * -----------------------------------------------------------------------------------------------------------------
    *
@@ -205,11 +207,12 @@ class TupleAccessStrategy {
    * Flip a deallocated slot to be allocated again. This is useful when compacting a block,
    * as we want to make decisions in the compactor on what slot to use, not in this class.
    * This method should not be called other than that.
-   * @param slot the tuple slot to reallocate. Must be currently deallocated.
+   * @param slot the tuple slot to reallocate.
+   * @return true if the slot was reallocated, false if it was already allocated (e.g. an insert reused it through the
+   *         free-space map of the table)
    */
-  void Reallocate(TupleSlot slot) const {
-    TERRIER_ASSERT(!Allocated(slot), "Can only reallocate slots that are deallocated");
-    reinterpret_cast<Block *>(slot.GetBlock())->SlotAllocationBitmap(layout_)->Flip(slot.GetOffset(), false);
+  bool Reallocate(TupleSlot slot) const {
+    return reinterpret_cast<Block *>(slot.GetBlock())->SlotAllocationBitmap(layout_)->Flip(slot.GetOffset(), false);
   }
 
   /**
@@ -235,8 +238,8 @@ class TupleAccessStrategy {
   void Deallocate(const TupleSlot slot) const {
     TERRIER_ASSERT(Allocated(slot), "Can only deallocate slots that are allocated");
     reinterpret_cast<Block *>(slot.GetBlock())->SlotAllocationBitmap(layout_)->Flip(slot.GetOffset(), true);
-    // TODO(Tianyu): Make explicit that this operation does not reset the insertion head, and the block
-    // is still considered "full" and will not be inserted into.
+    // This operation does not reset the insertion head. A deallocated slot is only inserted into again once it is
+    // released to the free-space map of the DataTable.
   }
 
   /**
@@ -245,41 +248,6 @@ class TupleAccessStrategy {
    */
   const BlockLayout &GetBlockLayout() const { return layout_; }
 
-  /**
-   * Compare and swap block status to busy. Expect that block to be idle, if yes, set the block status to be busy
-   * @param block the block to compare and set
-   * @return true if the set operation succeeded, false if the block is already busy
-   */
-  bool SetBlockBusyStatus(RawBlock *block) const {
-    uint32_t old_val = ClearBit(block->insert_head_.load());
-    return block->insert_head_.compare_exchange_strong(old_val, SetBit(old_val));
-  }
-
-  /**
-   * Compare and swap block status to idle. Expect that block to be busy, if yes, set the block status to be idle
-   * @param block the block to compare and set
-   * @return true if the set operation succeeded, false if the block is already idle
-   */
-  bool ClearBlockBusyStatus(RawBlock *block) const {
-    uint32_t val = block->insert_head_.load();
-    TERRIER_ASSERT(val == SetBit(val), "The busy bit should be set ");
-    return block->insert_head_.compare_exchange_strong(val, ClearBit(val));
-  }
-
-  /**
-   * Set the first bit of given val to 0, helper function used by ClearBlockBusyStatus
-   * @param val the value to be set
-   * @return the changed value with first bit set to 0
-   */
-  static uint32_t ClearBit(uint32_t val) { return val & INT32_MAX; }
-
-  /**
-   * Set the first bit of given val to 1, helper function used by SetBlockBusyStatus
-   * @param val val the value to be set
-   * @return the changed value with first bit set to 1
-   */
-  static uint32_t SetBit(uint32_t val) { return val | INT32_MIN; }
-
  private:
   const BlockLayout layout_;
   // Start of each mini block, in offset to the start of the block
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "catalog/catalog_defs.h"
+#include "common/managed_pointer.h"
+#include "network/network_defs.h"
+#include "planner/plannodes/output_schema.h"
+#include "storage/projected_row.h"
+#include "storage/storage_defs.h"
+#include "type/type_id.h"
+
+namespace terrier::catalog {
+class CatalogAccessor;
+}
+
+namespace terrier::network {
+class PostgresPacketWriter;
+}
+
+namespace terrier::parser {
+class AbstractExpression;
+class ConstantValueExpression;
+class SelectStatement;
+class SQLStatement;
+class UpdateStatement;
+}  // namespace terrier::parser
+
+namespace terrier::storage {
+class SqlTable;
+namespace index {
+class Index;
+}
+}  // namespace terrier::storage
+
+namespace terrier::transaction {
+class TransactionContext;
+}
+
+namespace terrier::type {
+class TransientValue;
+}
+
+namespace terrier::trafficcop {
+
+/**
+ * A single-table SELECT or UPDATE whose WHERE clause pins every key column of a unique index to a constant, and
+ * nothing else, e.g. "SELECT b FROM foo WHERE a = 1" or "UPDATE foo SET b = 2 WHERE a = 1". Such a statement touches at
+ * most one tuple, so instead of going through the optimizer and codegen the TrafficCop runs it directly against the
+ * index and the SqlTable. Everything that can be resolved ahead of time (table, index, key layout, projection and the
+ * constants in storage format) is resolved once by Match, so Execute only does the index probe and the tuple access.
+ */
+class PointQuery {
+ public:
+  /**
+   * Checks whether a bound statement qualifies for the point query fast path
+   * @param accessor used to look up the table and its indexes
+   * @param db_oid database the statement runs in
+   * @param statement bound SELECT or UPDATE statement
+   * @return the prepared point query, or nullptr if the statement has to go through the optimizer
+   */
+  static std::unique_ptr<PointQuery> Match(common::ManagedPointer<catalog::CatalogAccessor> accessor,
+                                           catalog::db_oid_t db_oid, common::ManagedPointer<parser::SQLStatement> statement);
+
+  /**
+   * Runs the point query. For a SELECT, the DataRow of the tuple found (if any) is written to out, the caller is
+   * responsible for the RowDescription and CommandComplete.
+   * @param txn transaction to run in. Like any other update, a failed UPDATE flags it for abort.
+   * @param out packet writer for the results
+   * @return number of tuples returned or updated
+   */
+  uint32_t Execute(common::ManagedPointer<transaction::TransactionContext> txn,
+                   common::ManagedPointer<network::PostgresPacketWriter> out) const;
+
+  /**
+   * @return QUERY_SELECT or QUERY_UPDATE
+   */
+  network::QueryType GetQueryType() const { return query_type_; }
+
+  /**
+   * @return output columns of a SELECT, empty for an UPDATE
+   */
+  const std::vector<planner::OutputSchema::Column> &GetOutputColumns() const { return output_columns_; }
+
+ private:
+  // A constant from the statement, converted to the storage format of the column it is compared with or assigned to
+  struct StoredValue {
+    bool is_null_ = false;
+    type::TypeId type_ = type::TypeId::INVALID;
+    // Fixed-length values, in storage format
+    uint64_t fixed_ = 0;
+    // VARCHAR values
+    std::string varlen_;
+  };
+
+  PointQuery(network::QueryType query_type, catalog::db_oid_t db_oid, catalog::table_oid_t table_oid,
+             common::ManagedPointer<storage::SqlTable> table, storage::layout_version_t layout_version)
+      : query_type_(query_type),
+        db_oid_(db_oid),
+        table_oid_(table_oid),
+        table_(table),
+        layout_version_(layout_version) {}
+
+  static std::unique_ptr<PointQuery> MatchSelect(common::ManagedPointer<catalog::CatalogAccessor> accessor,
+                                                 catalog::db_oid_t db_oid,
+                                                 common::ManagedPointer<parser::SelectStatement> statement);
+
+  static std::unique_ptr<PointQuery> MatchUpdate(common::ManagedPointer<catalog::CatalogAccessor> accessor,
+                                                 catalog::db_oid_t db_oid,
+                                                 common::ManagedPointer<parser::UpdateStatement> statement);
+
+  /**
+   * Collects the "column = constant" conjuncts of a WHERE clause
+   * @param expr WHERE clause
+   * @param table_oid table the columns must belong to
+   * @param equalities column to constant map to fill
+   * @return false if the WHERE clause contains anything else, or constrains a column twice
+   */
+  static bool CollectEqualities(
+      common::ManagedPointer<parser::AbstractExpression> expr, catalog::table_oid_t table_oid,
+      std::unordered_map<catalog::col_oid_t, common::ManagedPointer<parser::ConstantValueExpression>> *equalities);
+
+  /**
+   * Finds a unique index whose key columns are exactly the constrained columns, and converts the key
+   * @return true if such an index exists and every constant fits its key column
+   */
+  bool MatchIndex(
+      common::ManagedPointer<catalog::CatalogAccessor> accessor,
+      const std::unordered_map<catalog::col_oid_t, common::ManagedPointer<parser::ConstantValueExpression>>
+          &equalities);
+
+  /**
+   * Converts a constant to the storage format of the given type
+   * @return false if the constant is not of a compatible type, or does not fit
+   */
+  static bool ConvertConstant(const type::TransientValue &value, type::TypeId type, StoredValue *result);
+
+  /**
+   * Writes a converted constant into a ProjectedRow
+   * @param value value to write
+   * @param row row to write into
+   * @param projection_list_index index of the attribute in row
+   * @param owned_varlen true if the row is written into a table, which then owns (and eventually frees) the varlen
+   */
+  static void WriteValue(const StoredValue &value, storage::ProjectedRow *row, uint16_t projection_list_index,
+                         bool owned_varlen);
+
+  uint32_t ExecuteSelect(common::ManagedPointer<transaction::TransactionContext> txn,
+                         common::ManagedPointer<network::PostgresPacketWriter> out, storage::TupleSlot slot) const;
+
+  uint32_t ExecuteUpdate(common::ManagedPointer<transaction::TransactionContext> txn, storage::TupleSlot slot) const;
+
+  const network::QueryType query_type_;
+  const catalog::db_oid_t db_oid_;
+  const catalog::table_oid_t table_oid_;
+  const common::ManagedPointer<storage::SqlTable> table_;
+  // Layout version of the table's schema the projections below were built against
+  const storage::layout_version_t layout_version_;
+
+  common::ManagedPointer<storage::index::Index> index_ = nullptr;
+  // Key to probe the index with, as (index in the key's ProjectedRow, value)
+  std::vector<std::pair<uint16_t, StoredValue>> key_;
+
+  // Projection read from (SELECT) or written to (UPDATE) the table
+  std::unique_ptr<storage::ProjectedRowInitializer> initializer_;
+
+  // SELECT: output columns, and the index in the projection of each of them
+  std::vector<planner::OutputSchema::Column> output_columns_;
+  std::vector<uint16_t> output_indexes_;
+
+  // UPDATE: the value of every attribute in the projection
+  std::vector<std::pair<uint16_t, StoredValue>> update_values_;
+};
+
+}  // namespace terrier::trafficcop
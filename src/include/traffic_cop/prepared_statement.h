@@ -0,0 +1,88 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/macros.h"
+#include "common/managed_pointer.h"
+#include "execution/executable_query.h"
+#include "network/network_defs.h"
+#include "parser/postgresparser.h"
+#include "planner/plannodes/abstract_plan_node.h"
+#include "traffic_cop/point_query.h"
+#include "transaction/transaction_defs.h"
+#include "type/type_id.h"
+
+namespace terrier::trafficcop {
+
+/**
+ * A statement prepared by the Parse message of the extended query protocol. A DML statement is parsed and bound once
+ * when it is prepared, and planned and compiled on its first execution. Every later execution (e.g. of another portal
+ * with other parameter values) reuses the plan and the compiled code. They refer to catalog objects by OID, so they are
+ * rebuilt from the query string once a DDL change has committed since the statement was bound.
+ *
+ * Other statements (transaction control, DDL) are cheap to plan and are only ever run once, so they are still parsed,
+ * bound and planned again on every execution.
+ */
+class PreparedStatement {
+ public:
+  /**
+   * @param query the query string of the statement
+   * @param parse_result the parsed query, holding at most one statement
+   * @param query_type type of the statement, QUERY_INVALID for an empty query
+   */
+  PreparedStatement(std::string &&query, std::unique_ptr<parser::ParseResult> &&parse_result,
+                    const network::QueryType query_type)
+      : query_(std::move(query)), parse_result_(std::move(parse_result)), query_type_(query_type) {}
+
+  DISALLOW_COPY_AND_MOVE(PreparedStatement)
+
+  /**
+   * @return the query string of the statement
+   */
+  const std::string &GetQuery() const { return query_; }
+
+  /**
+   * @return true if the query string holds no statement
+   */
+  bool Empty() const { return parse_result_->Empty(); }
+
+  /**
+   * @return type of the statement
+   */
+  network::QueryType GetQueryType() const { return query_type_; }
+
+  /**
+   * @return whether the statement is a SELECT, INSERT, UPDATE or DELETE, i.e. is bound when prepared and keeps its plan
+   */
+  bool IsCached() const {
+    // This logic relies on ordering of values in the enum's definition and is documented there as well.
+    return query_type_ >= network::QueryType::QUERY_SELECT && query_type_ <= network::QueryType::QUERY_DELETE;
+  }
+
+  /**
+   * @return type of each parameter ($1 is at index 0). Only known for cached statements, others take no parameters.
+   */
+  const std::vector<type::TypeId> &GetParameterTypes() const { return parameter_types_; }
+
+ private:
+  friend class TrafficCop;
+
+  const std::string query_;
+  std::unique_ptr<parser::ParseResult> parse_result_;
+  const network::QueryType query_type_;
+  std::vector<type::TypeId> parameter_types_;
+
+  // Start time of the txn that bound the statement. DDL committed after it may have invalidated the binding.
+  transaction::timestamp_t bound_at_ = transaction::INITIAL_TXN_TIMESTAMP;
+
+  // Set on the first execution or Describe, at most one of them
+  std::unique_ptr<PointQuery> point_query_;
+  std::unique_ptr<planner::AbstractPlanNode> physical_plan_;
+  // Compiled on the first execution of physical_plan_
+  std::unique_ptr<execution::ExecutableQuery> executable_query_;
+};
+
+}  // namespace terrier::trafficcop
@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -10,6 +11,8 @@
 #include "parser/drop_statement.h"
 #include "parser/transaction_statement.h"
 #include "storage/recovery/replication_log_provider.h"
+#include "transaction/transaction_defs.h"
+#include "type/type_id.h"
 
 namespace terrier::network {
 class ConnectionContext;
@@ -24,8 +27,19 @@ namespace terrier::planner {
 class AbstractPlanNode;
 }
 
+namespace terrier::execution {
+class ExecutableQuery;
+}
+
+namespace terrier::type {
+class TransientValue;
+}
+
 namespace terrier::trafficcop {
 
+class PointQuery;
+class PreparedStatement;
+
 /**
  *
  * Traffic Cop of the database. It provides access to all the backend components.
@@ -93,12 +107,70 @@ class TrafficCop {
    * @param connection_ctx used to maintain state
    * @param out used to write out results if necessary
    * @param parse_result parser's valid ParseResult
+   * @param statement statement of parse_result to execute
    * @param query_type type of the query, can be re-derived but should already be known
+   * @param row_description whether to write the RowDescription before the rows. The extended query protocol sends it
+   * in response to Describe instead, @see DescribeStatement.
+   * @return false if the statement failed, i.e. an error was written to out
    */
-  void ExecuteStatement(common::ManagedPointer<network::ConnectionContext> connection_ctx,
+  bool ExecuteStatement(common::ManagedPointer<network::ConnectionContext> connection_ctx,
                         common::ManagedPointer<network::PostgresPacketWriter> out,
                         common::ManagedPointer<parser::ParseResult> parse_result,
-                        terrier::network::QueryType query_type) const;
+                        common::ManagedPointer<parser::SQLStatement> statement, terrier::network::QueryType query_type,
+                        bool row_description) const;
+
+  /**
+   * Binds a prepared SELECT, INSERT, UPDATE or DELETE, which decides the types of its parameters. A statement that is
+   * already bound is only bound again (from its query string) if DDL has committed since, @see PreparedStatement.
+   * @param connection_ctx used to maintain state, must be in a transaction
+   * @param out used to write out an error if necessary
+   * @param statement statement to bind
+   * @return false if binding failed, i.e. an error was written to out and the txn flagged for abort
+   */
+  bool BindPreparedStatement(common::ManagedPointer<network::ConnectionContext> connection_ctx,
+                             common::ManagedPointer<network::PostgresPacketWriter> out,
+                             common::ManagedPointer<PreparedStatement> statement) const;
+
+  /**
+   * Writes the RowDescription of the rows a prepared statement returns, or NoData if it returns none. The output
+   * columns are only known once the statement is planned, so a SELECT is planned (once) without being executed.
+   * @param connection_ctx used to maintain state, must be in a transaction for a SELECT
+   * @param out used to write out results
+   * @param statement statement to describe
+   * @return false if the statement failed to bind, i.e. an error was written to out
+   */
+  bool DescribePreparedStatement(common::ManagedPointer<network::ConnectionContext> connection_ctx,
+                                 common::ManagedPointer<network::PostgresPacketWriter> out,
+                                 common::ManagedPointer<PreparedStatement> statement) const;
+
+  /**
+   * Executes a prepared statement. A SELECT, INSERT, UPDATE or DELETE is planned and compiled on its first execution
+   * and reuses both afterwards. The RowDescription is not written, @see DescribePreparedStatement.
+   * @param connection_ctx used to maintain state, must be in a transaction for a SELECT, INSERT, UPDATE or DELETE
+   * @param out used to write out results
+   * @param statement statement to execute
+   * @param params values of the statement's parameters, of the types the binder gave them
+   * @return false if the statement failed, i.e. an error was written to out
+   */
+  bool ExecutePreparedStatement(common::ManagedPointer<network::ConnectionContext> connection_ctx,
+                                common::ManagedPointer<network::PostgresPacketWriter> out,
+                                common::ManagedPointer<PreparedStatement> statement,
+                                common::ManagedPointer<const std::vector<type::TransientValue>> params) const;
+
+  /**
+   * Begins the implicit transaction that all statements of a multi-statement simple query run in, like in postgres
+   * @param connection_ctx used to maintain state, must not be in a transaction
+   */
+  void BeginImplicitTransaction(const common::ManagedPointer<network::ConnectionContext> connection_ctx) const {
+    BeginTransaction(connection_ctx);
+  }
+
+  /**
+   * Ends the implicit transaction of a multi-statement simple query. It is committed if every statement succeeded, and
+   * rolled back otherwise.
+   * @param connection_ctx used to maintain state
+   */
+  void EndImplicitTransaction(common::ManagedPointer<network::ConnectionContext> connection_ctx) const;
 
   /**
    * Adjust the TrafficCop's optimizer timeout value (for use by SettingsManager)
@@ -121,11 +193,21 @@ class TrafficCop {
                                    common::ManagedPointer<network::PostgresPacketWriter> out,
                                    terrier::network::QueryType query_type) const;
 
-  // Contains logic to reason about binding, and basic IF EXISTS logic. Responsible for outputting results.
+  // Contains logic to reason about binding, and basic IF EXISTS logic. Responsible for outputting results. If
+  // parameter_types is given, it receives the types the binder gave the statement's parameters.
   bool BindStatement(common::ManagedPointer<network::ConnectionContext> connection_ctx,
                      common::ManagedPointer<network::PostgresPacketWriter> out,
                      common::ManagedPointer<parser::ParseResult> parse_result,
-                     terrier::network::QueryType query_type) const;
+                     common::ManagedPointer<parser::SQLStatement> statement, terrier::network::QueryType query_type,
+                     std::vector<type::TypeId> *parameter_types) const;
+
+  // Binds a prepared statement if necessary, and matches it as a point query or optimizes it if it has no plan yet
+  bool PlanPreparedStatement(common::ManagedPointer<network::ConnectionContext> connection_ctx,
+                             common::ManagedPointer<network::PostgresPacketWriter> out,
+                             common::ManagedPointer<PreparedStatement> statement) const;
+
+  // Makes the end of a txn that runs DDL invalidate the prepared statements bound before it, @see last_ddl_end_
+  void InvalidatePreparedStatementsOnEnd(common::ManagedPointer<transaction::TransactionContext> txn) const;
 
   // Contains the logic to reason about CREATE execution. Responsible for outputting results.
   void ExecuteCreateStatement(common::ManagedPointer<network::ConnectionContext> connection_ctx,
@@ -139,11 +221,23 @@ class TrafficCop {
                             common::ManagedPointer<planner::AbstractPlanNode> physical_plan,
                             terrier::network::QueryType query_type, bool single_statement_txn) const;
 
-  // Contains the logic to reason about DML execution. Responsible for outputting results.
+  // Contains the logic to reason about DML execution. Responsible for outputting results. params holds the values of
+  // the statement's parameters, if it has any. If cached_query is given, the compiled query is taken from it, or
+  // compiled and stored in it if it is still empty.
   void CodegenAndRunPhysicalPlan(common::ManagedPointer<network::ConnectionContext> connection_ctx,
                                  common::ManagedPointer<network::PostgresPacketWriter> out,
                                  common::ManagedPointer<planner::AbstractPlanNode> physical_plan,
-                                 terrier::network::QueryType query_type) const;
+                                 terrier::network::QueryType query_type, bool row_description,
+                                 common::ManagedPointer<const std::vector<type::TransientValue>> params,
+                                 std::unique_ptr<execution::ExecutableQuery> *cached_query) const;
+
+  // Ends the statement's txn if it was a single statement txn. Returns false if the statement failed.
+  bool EndStatement(common::ManagedPointer<network::ConnectionContext> connection_ctx, bool single_statement_txn) const;
+
+  // Runs a statement recognized by PointQuery::Match. Responsible for outputting results.
+  void RunPointQuery(common::ManagedPointer<network::ConnectionContext> connection_ctx,
+                     common::ManagedPointer<network::PostgresPacketWriter> out,
+                     common::ManagedPointer<PointQuery> point_query, bool row_description) const;
 
   common::ManagedPointer<transaction::TransactionManager> txn_manager_;
   common::ManagedPointer<catalog::Catalog> catalog_;
@@ -151,6 +245,9 @@ class TrafficCop {
   common::ManagedPointer<storage::ReplicationLogProvider> replication_log_provider_;
   common::ManagedPointer<optimizer::StatsStorage> stats_storage_;
   uint64_t optimizer_timeout_;
+  // Latest end (commit or abort) of a txn that ran DDL. A prepared statement bound by a txn that started before it may
+  // refer to catalog objects that changed, and is bound and planned again.
+  mutable std::atomic<transaction::timestamp_t> last_ddl_end_{transaction::INITIAL_TXN_TIMESTAMP};
 };
 
 }  // namespace terrier::trafficcop
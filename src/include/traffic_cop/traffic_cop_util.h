@@ -40,6 +40,7 @@ class TrafficCopUtil {
    * @param txn used by optimizer
    * @param accessor used by optimizer
    * @param query bound ParseResult
+   * @param statement statement of query to optimize
    * @param stats_storage used by optimizer
    * @param optimizer_timeout used by optimizer
    * @return physical plan that can be executed
@@ -47,6 +48,7 @@ class TrafficCopUtil {
   static std::unique_ptr<planner::AbstractPlanNode> Optimize(
       common::ManagedPointer<transaction::TransactionContext> txn,
       common::ManagedPointer<catalog::CatalogAccessor> accessor, common::ManagedPointer<parser::ParseResult> query,
+      common::ManagedPointer<parser::SQLStatement> statement,
       common::ManagedPointer<optimizer::StatsStorage> stats_storage, uint64_t optimizer_timeout);
 
   /**
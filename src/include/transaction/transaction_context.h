@@ -82,6 +82,14 @@ class TransactionContext {
    */
   timestamp_t FinishTime() const { return finish_time_.load(); }
 
+  /**
+   * @return the cached oldest active transaction start time when this transaction began. It is older than any
+   * transaction that can still be running alongside this one, so versions older than it can be pruned.
+   * TransactionContexts generated outside of the TransactionManager (i.e. in tests) leave this at 0, which disables
+   * pruning.
+   */
+  timestamp_t OldestActiveAtStart() const { return oldest_active_at_start_; }
+
   /**
    * Reserve space on this transaction's undo buffer for a record to log the update given
    * @param table pointer to the updated DataTable object
@@ -214,6 +222,8 @@ class TransactionContext {
   friend class storage::RecoveryTests;           // Needs access to redo buffer
   const timestamp_t start_time_;
   std::atomic<timestamp_t> finish_time_;
+  // snapshot of TimestampManager::CachedOldestTransactionStartTime taken in TransactionManager::BeginTransaction
+  timestamp_t oldest_active_at_start_{0};
   storage::UndoBuffer undo_buffer_;
   storage::RedoBuffer redo_buffer_;
   // TODO(Tianyu): Maybe not so much of a good idea to do this. Make explicit queue in GC?
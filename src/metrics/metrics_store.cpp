@@ -12,6 +12,7 @@ MetricsStore::MetricsStore(const common::ManagedPointer<metrics::MetricsManager>
     : metrics_manager_(metrics_manager), enabled_metrics_{enabled_metrics} {
   logging_metric_ = std::make_unique<LoggingMetric>();
   txn_metric_ = std::make_unique<TransactionMetric>();
+  gc_metric_ = std::make_unique<GarbageCollectionMetric>();
 }
 
 std::array<std::unique_ptr<AbstractRawData>, NUM_COMPONENTS> MetricsStore::GetDataToAggregate() {
@@ -34,6 +35,13 @@ std::array<std::unique_ptr<AbstractRawData>, NUM_COMPONENTS> MetricsStore::GetDa
           result[component] = txn_metric_->Swap();
           break;
         }
+        case MetricsComponent::GARBAGECOLLECTION: {
+          TERRIER_ASSERT(
+              gc_metric_ != nullptr,
+              "GarbageCollectionMetric cannot be a nullptr. Check the MetricsStore constructor that it was allocated.");
+          result[component] = gc_metric_->Swap();
+          break;
+        }
       }
     }
   }
@@ -181,6 +181,8 @@ Transition ConnectionHandle::TryCloseConnection() {
   // connection handle and we will need to destruct and exit.
   conn_handler_->UnregisterEvent(network_event_);
   conn_handler_->UnregisterEvent(workpool_event_);
+  SetBusy(false);
+  conn_handler_->ConnectionClosed();
 
   return Transition::NONE;
 }
@@ -20,7 +20,9 @@ void ConnectionHandlerTask::Notify(int conn_fd, std::unique_ptr<ProtocolInterpre
      */
     common::SpinLatch::ScopedSpinLatch guard(&jobs_latch_);
     jobs_.emplace_back(conn_fd, std::move(protocol_interpreter));
+    num_queued_++;
   }
+  num_connections_++;
   int res = 0;         // Flags, unused attribute in event_active
   int16_t ncalls = 0;  // Unused attribute in event_active
   event_active(notify_event_, res, ncalls);
@@ -32,6 +34,7 @@ void ConnectionHandlerTask::HandleDispatch(int, int16_t) {  // NOLINT as we don'
     connection_handle_factory_->NewConnectionHandle(job.first, std::move(job.second), common::ManagedPointer(this))
         .RegisterToReceiveEvents();
   }
+  num_queued_ -= static_cast<uint32_t>(jobs_.size());
   jobs_.clear();
 }
 
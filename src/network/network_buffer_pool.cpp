@@ -0,0 +1,36 @@
+#include "network/network_buffer_pool.h"
+
+#include <utility>
+
+namespace terrier::network {
+
+ByteBuf NetworkBufferPool::Get(const size_t capacity) {
+  uint32_t size_class = 0;
+  while (size_class < NUM_SIZE_CLASSES && ClassCapacity(size_class) < capacity) size_class++;
+  // Larger than any packet we accept, so there is no point in pooling it
+  if (size_class == NUM_SIZE_CLASSES) return ByteBuf(capacity);
+
+  {
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
+    auto &free_buffers = free_buffers_[size_class];
+    if (!free_buffers.empty()) {
+      ByteBuf result = std::move(free_buffers.back());
+      free_buffers.pop_back();
+      return result;
+    }
+  }
+  return ByteBuf(ClassCapacity(size_class));
+}
+
+void NetworkBufferPool::Release(ByteBuf buf) {
+  for (uint32_t size_class = 0; size_class < NUM_SIZE_CLASSES; size_class++) {
+    if (buf.size() != ClassCapacity(size_class)) continue;
+    common::SpinLatch::ScopedSpinLatch guard(&latch_);
+    auto &free_buffers = free_buffers_[size_class];
+    if ((free_buffers.size() + 1) * buf.size() <= MAX_POOLED_BYTES_PER_CLASS) free_buffers.emplace_back(std::move(buf));
+    return;
+  }
+  // Not from a size class, let it be freed
+}
+
+}  // namespace terrier::network
@@ -1,6 +1,7 @@
 #include <arpa/inet.h>
 #include <netinet/tcp.h>
 #include <sys/file.h>
+#include <sys/socket.h>
 
 #include <memory>
 #include <utility>
@@ -10,10 +11,22 @@
 
 namespace terrier::network {
 Transition NetworkIoWrapper::FlushAllWrites() {
-  for (auto flush_head = out_->FlushHead(); flush_head != nullptr; out_->MarkHeadFlushed()) {
-    const auto result = FlushWriteBuffer(flush_head);
-    if (result != Transition::PROCEED) return result;
-    flush_head = out_->FlushHead();
+  while (!out_->Flushed()) {
+    auto bytes_written = out_->WriteOutTo(sock_fd_);
+    if (bytes_written < 0) {
+      switch (errno) {
+        case EINTR:
+          continue;
+        case EAGAIN:
+          return Transition::NEED_WRITE;
+        case EPIPE:
+          NETWORK_LOG_TRACE("Client closed during write");
+          return Transition::TERMINATE;
+        default:
+          NETWORK_LOG_ERROR("Error writing: %s", strerror(errno));
+          throw NETWORK_PROCESS_EXCEPTION("Fatal error during write");
+      }
+    }
   }
   out_->Reset();
   return Transition::PROCEED;
@@ -48,28 +61,6 @@ Transition NetworkIoWrapper::FillReadBuffer() {
   return result;
 }
 
-Transition NetworkIoWrapper::FlushWriteBuffer(const common::ManagedPointer<WriteBuffer> wbuf) {
-  while (wbuf->HasMore()) {
-    auto bytes_written = wbuf->WriteOutTo(sock_fd_);
-    if (bytes_written < 0) {
-      switch (errno) {
-        case EINTR:
-          continue;
-        case EAGAIN:
-          return Transition::NEED_WRITE;
-        case EPIPE:
-          NETWORK_LOG_TRACE("Client closed during write");
-          return Transition::TERMINATE;
-        default:
-          NETWORK_LOG_ERROR("Error writing: %s", strerror(errno));
-          throw NETWORK_PROCESS_EXCEPTION("Fatal error during write");
-      }
-    }
-  }
-  wbuf->Reset();
-  return Transition::PROCEED;
-}
-
 void NetworkIoWrapper::RestartState() {
   // Set Non Blocking
   auto flags = fcntl(sock_fd_, F_GETFL);
@@ -77,9 +68,13 @@ void NetworkIoWrapper::RestartState() {
   if (fcntl(sock_fd_, F_SETFL, flags) < 0) {
     NETWORK_LOG_ERROR("Failed to set non-blocking socket");
   }
-  // Set TCP No Delay
-  int one = 1;
-  setsockopt(sock_fd_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  // Set TCP No Delay, which only applies to TCP sockets and not to clients on the Unix domain socket
+  struct sockaddr_storage addr;
+  socklen_t addr_len = sizeof(addr);
+  if (getsockname(sock_fd_, reinterpret_cast<struct sockaddr *>(&addr), &addr_len) == 0 && addr.ss_family != AF_UNIX) {
+    int one = 1;
+    setsockopt(sock_fd_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  }
 
   in_->Reset();
   out_->Reset();
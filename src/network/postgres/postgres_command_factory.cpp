@@ -19,6 +19,8 @@ std::unique_ptr<PostgresNetworkCommand> PostgresCommandFactory::PacketToCommand(
       return MAKE_POSTGRES_COMMAND(SyncCommand);
     case NetworkMessageType::PG_CLOSE_COMMAND:
       return MAKE_POSTGRES_COMMAND(CloseCommand);
+    case NetworkMessageType::PG_FLUSH_COMMAND:
+      return MAKE_POSTGRES_COMMAND(FlushCommand);
     case NetworkMessageType::PG_TERMINATE_COMMAND:
       return MAKE_POSTGRES_COMMAND(TerminateCommand);
     default:
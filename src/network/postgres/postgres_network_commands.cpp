@@ -2,11 +2,16 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "network/postgres/postgres_protocol_interpreter.h"
+#include "network/postgres/postgres_protocol_util.h"
 #include "parser/postgresparser.h"
+#include "traffic_cop/prepared_statement.h"
 #include "traffic_cop/traffic_cop.h"
 #include "traffic_cop/traffic_cop_util.h"
+#include "type/transient_value_factory.h"
 
 namespace terrier::network {
 
@@ -22,6 +27,71 @@ static Transition FinishSimpleQueryCommand(const common::ManagedPointer<Postgres
   return Transition::PROCEED;
 }
 
+/**
+ * Runs the statements of a ParseResult one after the other, stopping at the first one that fails like postgres does
+ * @return false if a statement failed
+ */
+static bool ExecuteStatements(const common::ManagedPointer<parser::ParseResult> parse_result,
+                              const common::ManagedPointer<PostgresPacketWriter> out,
+                              const common::ManagedPointer<trafficcop::TrafficCop> t_cop,
+                              const common::ManagedPointer<ConnectionContext> connection) {
+  for (const auto statement : parse_result->GetStatements()) {
+    const auto query_type = trafficcop::TrafficCopUtil::QueryTypeForStatement(statement);
+
+    // Check if we're in a must-abort situation first before attempting to issue any statement other than ROLLBACK
+    if (connection->TransactionState() == network::NetworkTransactionStateType::FAIL &&
+        query_type != QueryType::QUERY_COMMIT && query_type != QueryType::QUERY_ROLLBACK) {
+      out->WriteErrorResponse(
+          "ERROR:  current transaction is aborted, commands ignored until end of transaction block");
+      return false;
+    }
+
+    // Pass the statement to be executed by the traffic cop
+    if (!t_cop->ExecuteStatement(connection, out, parse_result, statement, query_type, true)) return false;
+  }
+  return true;
+}
+
+/**
+ * @return true if the ParseResult holds a BEGIN, COMMIT or ROLLBACK
+ */
+static bool HasTransactionStatement(const common::ManagedPointer<parser::ParseResult> parse_result) {
+  for (const auto statement : parse_result->GetStatements()) {
+    // This logic relies on ordering of values in the enum's definition and is documented there as well.
+    if (trafficcop::TrafficCopUtil::QueryTypeForStatement(statement) <= QueryType::QUERY_ROLLBACK) return true;
+  }
+  return false;
+}
+
+/**
+ * An error in an extended query makes the backend discard every message up to the next Sync
+ * @return the transition for the failed command
+ */
+static Transition FailExtendedQueryCommand(const common::ManagedPointer<PostgresProtocolInterpreter> interpreter,
+                                           const common::ManagedPointer<PostgresPacketWriter> out,
+                                           const common::ManagedPointer<ConnectionContext> connection,
+                                           const std::string &message) {
+  out->WriteErrorResponse(message);
+  if (connection->TransactionState() == network::NetworkTransactionStateType::BLOCK) {
+    connection->Transaction()->SetMustAbort();
+  }
+  interpreter->SetSkipUntilSync(true);
+  return Transition::PROCEED;
+}
+
+/**
+ * Begins the implicit transaction of the extended query messages up to the next Sync, unless there is a transaction
+ * already. Only statements that keep their plan start it, others still run in their own transaction if there is none
+ * (e.g. CREATE DATABASE, which cannot run in a transaction block).
+ */
+static void BeginImplicitTransaction(const common::ManagedPointer<PostgresProtocolInterpreter> interpreter,
+                                     const common::ManagedPointer<trafficcop::TrafficCop> t_cop,
+                                     const common::ManagedPointer<ConnectionContext> connection) {
+  if (connection->TransactionState() != network::NetworkTransactionStateType::IDLE) return;
+  t_cop->BeginImplicitTransaction(connection);
+  interpreter->SetImplicitTransaction(true);
+}
+
 Transition SimpleQueryCommand::Exec(common::ManagedPointer<ProtocolInterpreter> interpreter,
                                     common::ManagedPointer<PostgresPacketWriter> out,
                                     common::ManagedPointer<trafficcop::TrafficCop> t_cop,
@@ -40,32 +110,22 @@ Transition SimpleQueryCommand::Exec(common::ManagedPointer<ProtocolInterpreter>
     return FinishSimpleQueryCommand(out, connection);
   }
 
-  TERRIER_ASSERT(parse_result->GetStatements().size() <= 1,
-                 "We currently expect one statement per string (psql and oltpbench).");
-
-  // TODO(Matt:) some clients may send multiple statements in a single SimpleQuery packet/string. Handling that would
-  // probably exist here, looping over all of the elements in the ParseResult. It's not clear to me how the binder would
-  // handle that though since you pass the ParseResult in for binding. Maybe bind ParseResult once?
-
   // Empty queries get a special response in postgres and do not care if they're in a failed txn block
   if (parse_result->Empty()) {
     out->WriteEmptyQueryResponse();
     return FinishSimpleQueryCommand(out, connection);
   }
 
-  // It parsed and we've got our single statement
-  const auto statement = parse_result->GetStatement(0);
-  const auto query_type = trafficcop::TrafficCopUtil::QueryTypeForStatement(statement);
-
-  // Check if we're in a must-abort situation first before attempting to issue any statement other than ROLLBACK
-  if (connection->TransactionState() == network::NetworkTransactionStateType::FAIL &&
-      query_type != QueryType::QUERY_COMMIT && query_type != QueryType::QUERY_ROLLBACK) {
-    out->WriteErrorResponse("ERROR:  current transaction is aborted, commands ignored until end of transaction block");
-    return FinishSimpleQueryCommand(out, connection);
-  }
-
-  // Pass the statement to be executed by the traffic cop
-  t_cop->ExecuteStatement(connection, out, common::ManagedPointer(parse_result), query_type);
+  // The string may hold several statements (e.g. a batch of INSERTs from an ORM). They all run now, and their results
+  // go out in the same flush as the ReadyForQuery. Outside of a transaction block they run in one implicit transaction
+  // like in postgres, so that a failed statement rolls back the ones before it. Queries that control transactions
+  // themselves keep running each statement on its own.
+  const bool implicit_txn = connection->TransactionState() == network::NetworkTransactionStateType::IDLE &&
+                            parse_result->GetStatements().size() > 1 &&
+                            !HasTransactionStatement(common::ManagedPointer(parse_result));
+  if (implicit_txn) t_cop->BeginImplicitTransaction(connection);
+  ExecuteStatements(common::ManagedPointer(parse_result), out, t_cop, connection);
+  if (implicit_txn) t_cop->EndImplicitTransaction(connection);
 
   return FinishSimpleQueryCommand(out, connection);
 }
@@ -74,8 +134,51 @@ Transition ParseCommand::Exec(common::ManagedPointer<ProtocolInterpreter> interp
                               common::ManagedPointer<PostgresPacketWriter> out,
                               common::ManagedPointer<trafficcop::TrafficCop> t_cop,
                               common::ManagedPointer<ConnectionContext> connection) {
-  // TODO(Matt): Implement this for prepared statement support
-  NETWORK_LOG_TRACE("Parse Command");
+  const auto postgres_interpreter = interpreter.CastManagedPointerTo<PostgresProtocolInterpreter>();
+  if (postgres_interpreter->SkipUntilSync()) return Transition::PROCEED;
+
+  const std::string statement_name = in_.ReadString();
+  std::string query = in_.ReadString();
+  NETWORK_LOG_TRACE("Parse Command: {0}", query.c_str());
+  // TODO(Matt): the parameter types that follow are ignored, the binder infers them from where the parameters are used
+
+  if (connection->TransactionState() == network::NetworkTransactionStateType::FAIL) {
+    return FailExtendedQueryCommand(
+        postgres_interpreter, out, connection,
+        "ERROR:  current transaction is aborted, commands ignored until end of transaction block");
+  }
+  // The unnamed statement is replaced by every Parse, named ones have to be closed first
+  if (!statement_name.empty() &&
+      postgres_interpreter->Statements().find(statement_name) != postgres_interpreter->Statements().end()) {
+    return FailExtendedQueryCommand(postgres_interpreter, out, connection,
+                                    "ERROR:  prepared statement \"" + statement_name + "\" already exists");
+  }
+
+  auto parse_result = t_cop->ParseQuery(query, connection, out);
+  if (parse_result == nullptr) {
+    return FailExtendedQueryCommand(postgres_interpreter, out, connection, "ERROR:  syntax error");
+  }
+  if (parse_result->GetStatements().size() > 1) {
+    return FailExtendedQueryCommand(postgres_interpreter, out, connection,
+                                    "ERROR:  cannot insert multiple commands into a prepared statement");
+  }
+
+  const auto query_type = parse_result->Empty()
+                              ? QueryType::QUERY_INVALID
+                              : trafficcop::TrafficCopUtil::QueryTypeForStatement(parse_result->GetStatement(0));
+  auto statement =
+      std::make_unique<trafficcop::PreparedStatement>(std::move(query), std::move(parse_result), query_type);
+  if (statement->IsCached()) {
+    // Binding now tells Describe the types of the parameters, and Bind how to read their values
+    BeginImplicitTransaction(postgres_interpreter, t_cop, connection);
+    if (!t_cop->BindPreparedStatement(connection, out, common::ManagedPointer(statement))) {
+      postgres_interpreter->SetSkipUntilSync(true);
+      return Transition::PROCEED;
+    }
+  }
+
+  postgres_interpreter->CloseStatement(statement_name);
+  postgres_interpreter->Statements()[statement_name] = std::move(statement);
   out->WriteParseComplete();
   return Transition::PROCEED;
 }
@@ -84,8 +187,55 @@ Transition BindCommand::Exec(common::ManagedPointer<ProtocolInterpreter> interpr
                              common::ManagedPointer<PostgresPacketWriter> out,
                              common::ManagedPointer<trafficcop::TrafficCop> t_cop,
                              common::ManagedPointer<ConnectionContext> connection) {
-  // TODO(Matt): Implement this for prepared statement support
-  NETWORK_LOG_TRACE("Bind Command");
+  const auto postgres_interpreter = interpreter.CastManagedPointerTo<PostgresProtocolInterpreter>();
+  if (postgres_interpreter->SkipUntilSync()) return Transition::PROCEED;
+
+  const std::string portal_name = in_.ReadString();
+  const std::string statement_name = in_.ReadString();
+  NETWORK_LOG_TRACE("Bind Command: {0}", statement_name.c_str());
+
+  const auto statement = postgres_interpreter->Statements().find(statement_name);
+  if (statement == postgres_interpreter->Statements().end()) {
+    return FailExtendedQueryCommand(postgres_interpreter, out, connection, "ERROR:  prepared statement does not exist");
+  }
+  const auto &param_types = statement->second->GetParameterTypes();
+
+  // No format code means every parameter is in text, a single one applies to all of them
+  std::vector<FieldFormat> param_formats(in_.ReadValue<int16_t>());
+  for (auto &param_format : param_formats) param_format = static_cast<FieldFormat>(in_.ReadValue<int16_t>());
+
+  const auto num_params = static_cast<size_t>(in_.ReadValue<int16_t>());
+  if (num_params != param_types.size()) {
+    return FailExtendedQueryCommand(postgres_interpreter, out, connection,
+                                    "ERROR:  bind message supplies " + std::to_string(num_params) +
+                                        " parameters, but prepared statement \"" + statement_name + "\" requires " +
+                                        std::to_string(param_types.size()));
+  }
+  if (param_formats.size() > 1 && param_formats.size() != num_params) {
+    return FailExtendedQueryCommand(postgres_interpreter, out, connection,
+                                    "ERROR:  bind message has " + std::to_string(param_formats.size()) +
+                                        " parameter formats but " + std::to_string(num_params) + " parameters");
+  }
+
+  std::vector<type::TransientValue> params;
+  params.reserve(num_params);
+  for (size_t i = 0; i < num_params; i++) {
+    const auto length = in_.ReadValue<int32_t>();
+    if (length == -1) {
+      params.emplace_back(type::TransientValueFactory::GetNull(param_types[i]));
+      continue;
+    }
+    const auto format = param_formats.empty() ? FieldFormat::text
+                                              : param_formats[param_formats.size() == 1 ? 0 : i];
+    try {
+      params.emplace_back(PostgresProtocolUtil::ParameterValue(param_types[i], format, in_.ReadString(length)));
+    } catch (const NetworkProcessException &e) {
+      return FailExtendedQueryCommand(postgres_interpreter, out, connection, std::string("ERROR:  ") + e.what());
+    }
+  }
+  // The result format codes that follow are ignored, results are always written in text format
+
+  postgres_interpreter->Portals()[portal_name] = {common::ManagedPointer(statement->second), std::move(params)};
   out->WriteBindComplete();
   return Transition::PROCEED;
 }
@@ -94,9 +244,43 @@ Transition DescribeCommand::Exec(common::ManagedPointer<ProtocolInterpreter> int
                                  common::ManagedPointer<PostgresPacketWriter> out,
                                  common::ManagedPointer<trafficcop::TrafficCop> t_cop,
                                  common::ManagedPointer<ConnectionContext> connection) {
-  // TODO(Matt): Implement this for prepared statement support
-  out->WriteNoData();
-  NETWORK_LOG_TRACE("Describe Command");
+  const auto postgres_interpreter = interpreter.CastManagedPointerTo<PostgresProtocolInterpreter>();
+  if (postgres_interpreter->SkipUntilSync()) return Transition::PROCEED;
+
+  const auto type = in_.ReadRawValue<DescribeCommandObjectType>();
+  const std::string name = in_.ReadString();
+  NETWORK_LOG_TRACE("Describe Command: {0}", name.c_str());
+
+  common::ManagedPointer<trafficcop::PreparedStatement> statement = nullptr;
+  if (type == DescribeCommandObjectType::STATEMENT) {
+    const auto prepared = postgres_interpreter->Statements().find(name);
+    if (prepared != postgres_interpreter->Statements().end()) statement = common::ManagedPointer(prepared->second);
+  } else {
+    const auto portal = postgres_interpreter->Portals().find(name);
+    if (portal != postgres_interpreter->Portals().end()) statement = portal->second.statement_;
+  }
+  if (statement == nullptr) {
+    return FailExtendedQueryCommand(postgres_interpreter, out, connection,
+                                    type == DescribeCommandObjectType::STATEMENT
+                                        ? "ERROR:  prepared statement does not exist"
+                                        : "ERROR:  portal does not exist");
+  }
+  if (connection->TransactionState() == network::NetworkTransactionStateType::FAIL) {
+    return FailExtendedQueryCommand(
+        postgres_interpreter, out, connection,
+        "ERROR:  current transaction is aborted, commands ignored until end of transaction block");
+  }
+
+  if (type == DescribeCommandObjectType::STATEMENT) {
+    std::vector<PostgresValueType> param_types;
+    for (const auto param_type : statement->GetParameterTypes()) {
+      param_types.emplace_back(PostgresProtocolUtil::InternalValueTypeToPostgresValueType(param_type));
+    }
+    out->WriteParameterDescription(param_types);
+  }
+
+  if (statement->IsCached()) BeginImplicitTransaction(postgres_interpreter, t_cop, connection);
+  if (!t_cop->DescribePreparedStatement(connection, out, statement)) postgres_interpreter->SetSkipUntilSync(true);
   return Transition::PROCEED;
 }
 
@@ -104,9 +288,53 @@ Transition ExecuteCommand::Exec(common::ManagedPointer<ProtocolInterpreter> inte
                                 common::ManagedPointer<PostgresPacketWriter> out,
                                 common::ManagedPointer<trafficcop::TrafficCop> t_cop,
                                 common::ManagedPointer<ConnectionContext> connection) {
-  // TODO(Matt): Implement this for prepared statement support
-  NETWORK_LOG_TRACE("Exec Command");
-  out->WriteCommandComplete("");
+  const auto postgres_interpreter = interpreter.CastManagedPointerTo<PostgresProtocolInterpreter>();
+  if (postgres_interpreter->SkipUntilSync()) return Transition::PROCEED;
+
+  const std::string portal_name = in_.ReadString();
+  // TODO(Matt): the row limit that follows is ignored, portals always run to completion
+  NETWORK_LOG_TRACE("Exec Command: {0}", portal_name.c_str());
+
+  const auto portal = postgres_interpreter->Portals().find(portal_name);
+  if (portal == postgres_interpreter->Portals().end()) {
+    return FailExtendedQueryCommand(postgres_interpreter, out, connection, "ERROR:  portal does not exist");
+  }
+  const auto statement = portal->second.statement_;
+
+  // Empty queries get a special response in postgres and do not care if they're in a failed txn block
+  if (statement->Empty()) {
+    out->WriteEmptyQueryResponse();
+    return Transition::PROCEED;
+  }
+
+  const auto query_type = statement->GetQueryType();
+  // This logic relies on ordering of values in the enum's definition and is documented there as well.
+  const bool transaction_statement = query_type <= QueryType::QUERY_ROLLBACK;
+  if (connection->TransactionState() == network::NetworkTransactionStateType::FAIL &&
+      query_type != QueryType::QUERY_COMMIT && query_type != QueryType::QUERY_ROLLBACK) {
+    return FailExtendedQueryCommand(
+        postgres_interpreter, out, connection,
+        "ERROR:  current transaction is aborted, commands ignored until end of transaction block");
+  }
+
+  if (transaction_statement && postgres_interpreter->ImplicitTransaction()) {
+    // Like in postgres, BEGIN turns the implicit transaction into a transaction block that outlives the Sync, and
+    // COMMIT or ROLLBACK end it
+    postgres_interpreter->SetImplicitTransaction(false);
+    if (query_type == QueryType::QUERY_BEGIN) {
+      out->WriteCommandComplete(query_type, 0);
+      return Transition::PROCEED;
+    }
+  } else if (statement->IsCached()) {
+    BeginImplicitTransaction(postgres_interpreter, t_cop, connection);
+  }
+
+  // The results stay in the write queue with those of the rest of the pipeline until the Sync. The RowDescription was
+  // written by Describe, if the client asked for it.
+  const common::ManagedPointer<const std::vector<type::TransientValue>> params(&portal->second.params_);
+  if (!t_cop->ExecutePreparedStatement(connection, out, statement, params)) {
+    postgres_interpreter->SetSkipUntilSync(true);
+  }
   return Transition::PROCEED;
 }
 
@@ -115,18 +343,43 @@ Transition SyncCommand::Exec(common::ManagedPointer<ProtocolInterpreter> interpr
                              common::ManagedPointer<trafficcop::TrafficCop> t_cop,
                              common::ManagedPointer<ConnectionContext> connection) {
   NETWORK_LOG_TRACE("Sync query");
+  const auto postgres_interpreter = interpreter.CastManagedPointerTo<PostgresProtocolInterpreter>();
+  postgres_interpreter->SetSkipUntilSync(false);
+  if (postgres_interpreter->ImplicitTransaction()) {
+    // Commits the pipeline's statements, or rolls them all back if one of them failed
+    postgres_interpreter->SetImplicitTransaction(false);
+    t_cop->EndImplicitTransaction(connection);
+  }
   out->WriteReadyForQuery(connection->TransactionState());
   return Transition::PROCEED;
 }
 
+Transition FlushCommand::Exec(common::ManagedPointer<ProtocolInterpreter> interpreter,
+                              common::ManagedPointer<PostgresPacketWriter> out,
+                              common::ManagedPointer<trafficcop::TrafficCop> t_cop,
+                              common::ManagedPointer<ConnectionContext> connection) {
+  // Nothing to write, the command only forces the responses of the pipeline so far to be flushed
+  NETWORK_LOG_TRACE("Flush Command");
+  return Transition::PROCEED;
+}
+
 Transition CloseCommand::Exec(common::ManagedPointer<ProtocolInterpreter> interpreter,
                               common::ManagedPointer<PostgresPacketWriter> out,
                               common::ManagedPointer<trafficcop::TrafficCop> t_cop,
                               common::ManagedPointer<ConnectionContext> connection) {
-  // TODO(Matt): Implement this for prepared statement support
-  NETWORK_LOG_TRACE("Close Command");
-  // Send close complete response
-  out->WriteCloseCommand(DescribeCommandObjectType::PORTAL, "");
+  const auto postgres_interpreter = interpreter.CastManagedPointerTo<PostgresProtocolInterpreter>();
+  if (postgres_interpreter->SkipUntilSync()) return Transition::PROCEED;
+
+  const auto type = in_.ReadRawValue<DescribeCommandObjectType>();
+  const std::string name = in_.ReadString();
+  NETWORK_LOG_TRACE("Close Command: {0}", name.c_str());
+  // Closing an object that does not exist is not an error
+  if (type == DescribeCommandObjectType::STATEMENT) {
+    postgres_interpreter->CloseStatement(name);
+  } else {
+    postgres_interpreter->Portals().erase(name);
+  }
+  out->WriteCloseComplete();
   return Transition::PROCEED;
 }
 
@@ -28,7 +28,9 @@ Transition PostgresProtocolInterpreter::Process(common::ManagedPointer<ReadBuffe
     // Always flush startup packet response
     out->ForceFlush();
     curr_input_packet_.Clear();
-    return ProcessStartup(in, out, t_cop, context);
+    Transition ret = ProcessStartup(in, out, t_cop, context);
+    in->Shrink();
+    return ret;
   }
   auto command = command_factory_->PacketToCommand(common::ManagedPointer<InputPacket>(&curr_input_packet_));
   PostgresPacketWriter writer(out, FieldFormat::text);
@@ -37,6 +39,8 @@ Transition PostgresProtocolInterpreter::Process(common::ManagedPointer<ReadBuffe
   Transition ret = command->Exec(common::ManagedPointer<ProtocolInterpreter>(this),
                                  common::ManagedPointer<PostgresPacketWriter>(&writer), t_cop, context);
   curr_input_packet_.Clear();
+  // No header is pending now that the packet is consumed, so storage grown for a large packet can go back to the pool
+  in->Shrink();
   return ret;
 }
 
@@ -1,6 +1,12 @@
 #include "network/postgres/postgres_protocol_util.h"
 
+#include <cstring>
+#include <limits>
+#include <string>
+
 #include "loggers/network_logger.h"
+#include "type/transient_value_factory.h"
+#include "util/time_util.h"
 
 namespace terrier::network {
 
@@ -89,4 +95,127 @@ PostgresValueType PostgresProtocolUtil::InternalValueTypeToPostgresValueType(con
   }
 }
 
+/**
+ * Reads a big-endian integer of 1, 2, 4 or 8 bytes, sign-extended
+ */
+static int64_t ReadBinaryInteger(const std::string &value) {
+  if (value.size() != 1 && value.size() != 2 && value.size() != 4 && value.size() != 8) {
+    throw NETWORK_PROCESS_EXCEPTION("invalid length of binary integer parameter");
+  }
+  uint64_t bits = 0;
+  for (const char byte : value) bits = (bits << 8) | static_cast<uint8_t>(byte);
+  const auto unused_bits = static_cast<uint32_t>(64 - 8 * value.size());
+  return static_cast<int64_t>(bits << unused_bits) >> unused_bits;
+}
+
+/**
+ * Parses a whole string as an integer
+ */
+static int64_t ParseTextInteger(const std::string &value) {
+  size_t end = 0;
+  int64_t result;
+  try {
+    result = std::stoll(value, &end);
+  } catch (const std::exception &e) {
+    throw NETWORK_PROCESS_EXCEPTION("invalid input syntax for integer parameter");
+  }
+  if (end != value.size()) throw NETWORK_PROCESS_EXCEPTION("invalid input syntax for integer parameter");
+  return result;
+}
+
+template <typename T>
+static T CheckedInteger(const int64_t value) {
+  if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max()) {
+    throw NETWORK_PROCESS_EXCEPTION("integer parameter out of range");
+  }
+  return static_cast<T>(value);
+}
+
+type::TransientValue PostgresProtocolUtil::ParameterValue(const type::TypeId type, const FieldFormat format,
+                                                         const std::string &value) {
+  const bool text = format == FieldFormat::text;
+  switch (type) {
+    case type::TypeId::BOOLEAN: {
+      if (!text) {
+        if (value.size() != 1) throw NETWORK_PROCESS_EXCEPTION("invalid length of binary boolean parameter");
+        return type::TransientValueFactory::GetBoolean(value[0] != 0);
+      }
+      if (value == "t" || value == "true" || value == "y" || value == "yes" || value == "on" || value == "1") {
+        return type::TransientValueFactory::GetBoolean(true);
+      }
+      if (value == "f" || value == "false" || value == "n" || value == "no" || value == "off" || value == "0") {
+        return type::TransientValueFactory::GetBoolean(false);
+      }
+      throw NETWORK_PROCESS_EXCEPTION("invalid input syntax for boolean parameter");
+    }
+
+    case type::TypeId::TINYINT:
+    case type::TypeId::SMALLINT:
+    case type::TypeId::INTEGER:
+    case type::TypeId::BIGINT: {
+      // Clients may send a narrower or wider integer than the column's, as long as the value fits
+      const int64_t integer = text ? ParseTextInteger(value) : ReadBinaryInteger(value);
+      switch (type) {
+        case type::TypeId::TINYINT:
+          return type::TransientValueFactory::GetTinyInt(CheckedInteger<int8_t>(integer));
+        case type::TypeId::SMALLINT:
+          return type::TransientValueFactory::GetSmallInt(CheckedInteger<int16_t>(integer));
+        case type::TypeId::INTEGER:
+          return type::TransientValueFactory::GetInteger(CheckedInteger<int32_t>(integer));
+        default:
+          return type::TransientValueFactory::GetBigInt(integer);
+      }
+    }
+
+    case type::TypeId::DECIMAL: {
+      if (text) {
+        size_t end = 0;
+        double result;
+        try {
+          result = std::stod(value, &end);
+        } catch (const std::exception &e) {
+          throw NETWORK_PROCESS_EXCEPTION("invalid input syntax for decimal parameter");
+        }
+        if (end != value.size()) throw NETWORK_PROCESS_EXCEPTION("invalid input syntax for decimal parameter");
+        return type::TransientValueFactory::GetDecimal(result);
+      }
+      // float4 or float8
+      const auto bits = static_cast<uint64_t>(ReadBinaryInteger(value));
+      if (value.size() == sizeof(float)) {
+        const auto bits32 = static_cast<uint32_t>(bits);
+        float result;
+        std::memcpy(&result, &bits32, sizeof(float));
+        return type::TransientValueFactory::GetDecimal(result);
+      }
+      if (value.size() == sizeof(double)) {
+        double result;
+        std::memcpy(&result, &bits, sizeof(double));
+        return type::TransientValueFactory::GetDecimal(result);
+      }
+      throw NETWORK_PROCESS_EXCEPTION("invalid length of binary decimal parameter");
+    }
+
+    case type::TypeId::VARCHAR:
+      // Both formats send the characters as they are
+      return type::TransientValueFactory::GetVarChar(value);
+
+    case type::TypeId::DATE: {
+      if (!text) throw NETWORK_PROCESS_EXCEPTION("binary date parameters are not supported");
+      const auto parsed = util::TimeConvertor::ParseDate(value);
+      if (!parsed.first) throw NETWORK_PROCESS_EXCEPTION("invalid input syntax for date parameter");
+      return type::TransientValueFactory::GetDate(parsed.second);
+    }
+
+    case type::TypeId::TIMESTAMP: {
+      if (!text) throw NETWORK_PROCESS_EXCEPTION("binary timestamp parameters are not supported");
+      const auto parsed = util::TimeConvertor::ParseTimestamp(value);
+      if (!parsed.first) throw NETWORK_PROCESS_EXCEPTION("invalid input syntax for timestamp parameter");
+      return type::TransientValueFactory::GetTimestamp(parsed.second);
+    }
+
+    default:
+      throw NETWORK_PROCESS_EXCEPTION("unsupported parameter type");
+  }
+}
+
 }  // namespace terrier::network
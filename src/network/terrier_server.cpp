@@ -2,6 +2,8 @@
 
 #include <fstream>
 #include <memory>
+#include <string>
+#include <utility>
 
 #include "common/dedicated_thread_registry.h"
 #include "common/settings.h"
@@ -16,11 +18,14 @@ namespace terrier::network {
 TerrierServer::TerrierServer(common::ManagedPointer<ProtocolInterpreter::Provider> protocol_provider,
                              common::ManagedPointer<ConnectionHandleFactory> connection_handle_factory,
                              common::ManagedPointer<common::DedicatedThreadRegistry> thread_registry,
-                             const uint16_t port)
+                             const uint16_t port, const uint32_t num_acceptors, const uint32_t num_handlers,
+                             std::string socket_directory)
     : DedicatedThreadOwner(thread_registry),
       running_(false),
       port_(port),
-      max_connections_(CONNECTION_THREAD_COUNT),
+      num_acceptors_(num_acceptors),
+      num_handlers_(num_handlers),
+      socket_directory_(std::move(socket_directory)),
       connection_handle_factory_(connection_handle_factory),
       provider_(protocol_provider) {
   // For logging purposes
@@ -37,10 +42,7 @@ TerrierServer::TerrierServer(common::ManagedPointer<ProtocolInterpreter::Provide
   signal(SIGPIPE, SIG_IGN);
 }
 
-void TerrierServer::RunServer() {
-  // This line is critical to performance for some reason
-  evthread_use_pthreads();
-
+int TerrierServer::OpenListenSocket() {
   int conn_backlog = common::Settings::CONNECTION_BACKLOG;
 
   struct sockaddr_in sin;
@@ -49,32 +51,127 @@ void TerrierServer::RunServer() {
   sin.sin_addr.s_addr = INADDR_ANY;
   sin.sin_port = htons(port_);
 
-  listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+  int listen_fd = socket(AF_INET, SOCK_STREAM, 0);
 
-  if (listen_fd_ < 0) {
+  if (listen_fd < 0) {
     NETWORK_LOG_ERROR("Failed to open socket: {}", strerror(errno));
     throw NETWORK_PROCESS_EXCEPTION("Failed to open socket.");
   }
 
   int reuse = 1;
-  setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  // Every acceptor binds its own socket to the port, and the kernel balances incoming connections across them. A
+  // single acceptor leaves the option off, so that a second server on the same port still fails to bind.
+  if (num_acceptors_ > 1) setsockopt(listen_fd, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse));
 
-  int retval = bind(listen_fd_, reinterpret_cast<struct sockaddr *>(&sin), sizeof(sin));
+  int retval = bind(listen_fd, reinterpret_cast<struct sockaddr *>(&sin), sizeof(sin));
   if (retval < 0) {
     NETWORK_LOG_ERROR("Failed to bind socket: {}", strerror(errno));
+    TerrierClose(listen_fd);
     throw NETWORK_PROCESS_EXCEPTION("Failed to bind socket.");
   }
-  retval = listen(listen_fd_, conn_backlog);
+  retval = listen(listen_fd, conn_backlog);
   if (retval < 0) {
     NETWORK_LOG_ERROR("Failed to create listen socket: {}", strerror(errno));
+    TerrierClose(listen_fd);
     throw NETWORK_PROCESS_EXCEPTION("Failed to create listen socket.");
   }
+  return listen_fd;
+}
+
+int TerrierServer::OpenUnixListenSocket() {
+  int conn_backlog = common::Settings::CONNECTION_BACKLOG;
+
+  socket_path_ = UnixSocketPath();
+  struct sockaddr_un sun;
+  std::memset(&sun, 0, sizeof(sun));
+  if (socket_path_.size() >= sizeof(sun.sun_path)) {
+    NETWORK_LOG_ERROR("Unix domain socket path {} is too long", socket_path_);
+    throw NETWORK_PROCESS_EXCEPTION("Unix domain socket path is too long.");
+  }
+  sun.sun_family = AF_UNIX;
+  std::strncpy(sun.sun_path, socket_path_.c_str(), sizeof(sun.sun_path) - 1);
+
+  int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+  if (listen_fd < 0) {
+    NETWORK_LOG_ERROR("Failed to open Unix domain socket: {}", strerror(errno));
+    throw NETWORK_PROCESS_EXCEPTION("Failed to open Unix domain socket.");
+  }
+
+  // A socket file left behind by a server that did not shut down cleanly makes bind fail, so remove it. Only a file
+  // that refuses connections is stale: a live server still accepts on it, and its socket must be left alone.
+  if (connect(listen_fd, reinterpret_cast<struct sockaddr *>(&sun), sizeof(sun)) == 0) {
+    TerrierClose(listen_fd);
+    NETWORK_LOG_ERROR("Unix domain socket {} is in use by another server", socket_path_);
+    throw NETWORK_PROCESS_EXCEPTION("Unix domain socket is in use by another server.");
+  }
+  if (errno == ECONNREFUSED) unlink(socket_path_.c_str());
+  // A failed connect leaves the socket unusable for bind on some platforms, so start over with a fresh one
+  TerrierClose(listen_fd);
+  listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listen_fd < 0) {
+    NETWORK_LOG_ERROR("Failed to open Unix domain socket: {}", strerror(errno));
+    throw NETWORK_PROCESS_EXCEPTION("Failed to open Unix domain socket.");
+  }
+
+  int retval = bind(listen_fd, reinterpret_cast<struct sockaddr *>(&sun), sizeof(sun));
+  if (retval < 0) {
+    NETWORK_LOG_ERROR("Failed to bind Unix domain socket: {}", strerror(errno));
+    TerrierClose(listen_fd);
+    throw NETWORK_PROCESS_EXCEPTION("Failed to bind Unix domain socket.");
+  }
+  // Connecting needs write permission on the file, which bind creates subject to the umask. Like postgres, let every
+  // local user connect and leave authentication to the protocol.
+  if (chmod(socket_path_.c_str(), 0777) < 0) {
+    NETWORK_LOG_ERROR("Failed to set the permissions of Unix domain socket {}: {}", socket_path_, strerror(errno));
+    TerrierClose(listen_fd);
+    unlink(socket_path_.c_str());
+    throw NETWORK_PROCESS_EXCEPTION("Failed to set the permissions of Unix domain socket.");
+  }
+  // Remember which file this server created, so that StopServer never removes a socket another server replaced it with
+  struct stat socket_stat;
+  socket_inode_ = stat(socket_path_.c_str(), &socket_stat) == 0 ? socket_stat.st_ino : 0;
+
+  retval = listen(listen_fd, conn_backlog);
+  if (retval < 0) {
+    NETWORK_LOG_ERROR("Failed to create Unix domain listen socket: {}", strerror(errno));
+    TerrierClose(listen_fd);
+    RemoveUnixSocketFile();
+    throw NETWORK_PROCESS_EXCEPTION("Failed to create Unix domain listen socket.");
+  }
+  return listen_fd;
+}
+
+void TerrierServer::RemoveUnixSocketFile() {
+  struct stat socket_stat;
+  if (socket_inode_ != 0 && stat(socket_path_.c_str(), &socket_stat) == 0 && socket_stat.st_ino == socket_inode_) {
+    unlink(socket_path_.c_str());
+  }
+  socket_inode_ = 0;
+}
+
+void TerrierServer::RunServer() {
+  // This line is critical to performance for some reason
+  evthread_use_pthreads();
 
-  dispatcher_task_ = thread_registry_->RegisterDedicatedThread<ConnectionDispatcherTask>(
-      this /* requester */, max_connections_, listen_fd_, this, common::ManagedPointer(provider_.Get()),
-      connection_handle_factory_, thread_registry_);
+  for (uint32_t i = 0; i < num_acceptors_; i++) listen_fds_.push_back(OpenListenSocket());
+  // Local clients skip the TCP stack on their own socket, which gets its own dispatcher like any other listen socket
+  if (!socket_directory_.empty()) listen_fds_.push_back(OpenUnixListenSocket());
 
-  NETWORK_LOG_INFO("Listening on port {0}", port_);
+  // The handlers are shared by all acceptors, so they are owned by the server rather than by any one dispatcher
+  for (uint32_t task_id = 0; task_id < num_handlers_; task_id++) {
+    handlers_.push_back(thread_registry_->RegisterDedicatedThread<ConnectionHandlerTask>(
+        this /* requester */, static_cast<int>(task_id), connection_handle_factory_));
+  }
+  for (const int listen_fd : listen_fds_) {
+    dispatcher_tasks_.push_back(thread_registry_->RegisterDedicatedThread<ConnectionDispatcherTask>(
+        this /* requester */, listen_fd, common::ManagedPointer(&std::as_const(handlers_)),
+        common::ManagedPointer(provider_.Get())));
+  }
+
+  NETWORK_LOG_INFO("Listening on port {0} with {1} acceptors and {2} handlers", port_, num_acceptors_, num_handlers_);
+  if (!socket_path_.empty()) NETWORK_LOG_INFO("Listening on Unix domain socket {0}", socket_path_);
 
   // Set the running_ flag for any waiting threads
   {
@@ -85,10 +182,25 @@ void TerrierServer::RunServer() {
 
 void TerrierServer::StopServer() {
   NETWORK_LOG_TRACE("Begin to stop server");
-  const bool result UNUSED_ATTRIBUTE =
-      thread_registry_->StopTask(this, dispatcher_task_.CastManagedPointerTo<common::DedicatedThreadTask>());
-  TERRIER_ASSERT(result, "Failed to stop ConnectionDispatcherTask.");
-  TerrierClose(listen_fd_);
+  // Stop accepting before the handlers go away, so that no connection is dispatched to a stopped handler
+  for (const auto &dispatcher_task : dispatcher_tasks_) {
+    const bool result UNUSED_ATTRIBUTE =
+        thread_registry_->StopTask(this, dispatcher_task.CastManagedPointerTo<common::DedicatedThreadTask>());
+    TERRIER_ASSERT(result, "Failed to stop ConnectionDispatcherTask.");
+  }
+  for (const auto &handler_task : handlers_) {
+    const bool result UNUSED_ATTRIBUTE =
+        thread_registry_->StopTask(this, handler_task.CastManagedPointerTo<common::DedicatedThreadTask>());
+    TERRIER_ASSERT(result, "Failed to stop ConnectionHandlerTask.");
+  }
+  dispatcher_tasks_.clear();
+  handlers_.clear();
+  for (const int listen_fd : listen_fds_) TerrierClose(listen_fd);
+  listen_fds_.clear();
+  if (!socket_path_.empty()) {
+    RemoveUnixSocketFile();
+    socket_path_.clear();
+  }
   NETWORK_LOG_INFO("Server Closed");
 
   // Clear the running_ flag for any waiting threads and wake up them up with the condition variable
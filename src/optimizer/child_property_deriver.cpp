@@ -43,6 +43,13 @@ void ChildPropertyDeriver::Visit(const IndexScan *op) {
         continue;
       }
 
+      // Only a backward scan of the index produces a descending order
+      auto type = op->GetIndexScanType();
+      auto desc_scan = type == planner::IndexScanType::Descending || type == planner::IndexScanType::DescendingLimit;
+      if (IndexUtil::IsDescendingSort(sort_prop) != desc_scan) {
+        continue;
+      }
+
       auto idx_oid = op->GetIndexOID();
       if (IndexUtil::SatisfiesSortWithIndex(accessor_, sort_prop, tbl_id, idx_oid)) {
         property_set->AddProperty(prop->Copy());
@@ -95,6 +102,10 @@ void ChildPropertyDeriver::Visit(const Limit *op) {
     const std::vector<common::ManagedPointer<parser::AbstractExpression>> &exprs = op->GetSortExpressions();
     const std::vector<OrderByOrderingType> &sorts{op->GetSortAscending()};
     provided_prop->AddProperty(new PropertySort(exprs, sorts));
+
+    // Or the child already produces the sort order (e.g. an index scan) and the limit doesn't sort at all. This comes
+    // first, so that it wins when both cost the same.
+    output_.emplace_back(provided_prop->Copy(), std::vector<PropertySet *>{provided_prop->Copy()});
   }
 
   output_.emplace_back(provided_prop, std::move(child_input_properties));
@@ -111,6 +122,15 @@ void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const LeftHashJoin *op) {}
 void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const RightHashJoin *op) {}
 void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) {}
 
+// The hash table is built on the right child and the left child probes it, so a sort of the left child is not kept
+void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const LeftSemiHashJoin *op) {
+  output_.emplace_back(new PropertySet(), std::vector<PropertySet *>{new PropertySet(), new PropertySet()});
+}
+
+void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const LeftAntiHashJoin *op) {
+  output_.emplace_back(new PropertySet(), std::vector<PropertySet *>{new PropertySet(), new PropertySet()});
+}
+
 void ChildPropertyDeriver::Visit(UNUSED_ATTRIBUTE const Insert *op) {
   std::vector<PropertySet *> child_input_properties;
   output_.emplace_back(requirements_->Copy(), std::move(child_input_properties));
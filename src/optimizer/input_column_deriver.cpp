@@ -156,6 +156,10 @@ void InputColumnDeriver::Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) {
   TERRIER_ASSERT(0, "OuterHashJoin not supported");
 }
 
+void InputColumnDeriver::Visit(const LeftSemiHashJoin *op) { JoinHelper(op); }
+
+void InputColumnDeriver::Visit(const LeftAntiHashJoin *op) { JoinHelper(op); }
+
 void InputColumnDeriver::Visit(UNUSED_ATTRIBUTE const Insert *op) {
   auto input = std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>{};
   output_input_cols_ = std::make_pair(std::move(required_cols_), std::move(input));
@@ -298,6 +302,16 @@ void InputColumnDeriver::JoinHelper(const BaseOperatorNodeContents *op) {
     join_conds = join_op->GetJoinPredicates();
     left_keys = join_op->GetLeftKeys();
     right_keys = join_op->GetRightKeys();
+  } else if (op->GetType() == OpType::LEFTSEMIHASHJOIN) {
+    auto join_op = reinterpret_cast<const LeftSemiHashJoin *>(op);
+    join_conds = join_op->GetJoinPredicates();
+    left_keys = join_op->GetLeftKeys();
+    right_keys = join_op->GetRightKeys();
+  } else if (op->GetType() == OpType::LEFTANTIHASHJOIN) {
+    auto join_op = reinterpret_cast<const LeftAntiHashJoin *>(op);
+    join_conds = join_op->GetJoinPredicates();
+    left_keys = join_op->GetLeftKeys();
+    right_keys = join_op->GetRightKeys();
   }
 
   ExprSet input_cols_set;
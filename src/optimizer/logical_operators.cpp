@@ -40,7 +40,7 @@ BaseOperatorNodeContents *LogicalGet::Copy() const { return new LogicalGet(*this
 
 Operator LogicalGet::Make(catalog::db_oid_t database_oid, catalog::namespace_oid_t namespace_oid,
                           catalog::table_oid_t table_oid, std::vector<AnnotatedExpression> predicates,
-                          std::string table_alias, bool is_for_update) {
+                          std::string table_alias, bool is_for_update, uint32_t scan_limit) {
   auto get = std::make_unique<LogicalGet>();
   get->database_oid_ = database_oid;
   get->namespace_oid_ = namespace_oid;
@@ -48,6 +48,7 @@ Operator LogicalGet::Make(catalog::db_oid_t database_oid, catalog::namespace_oid
   get->predicates_ = std::move(predicates);
   get->table_alias_ = std::move(table_alias);
   get->is_for_update_ = is_for_update;
+  get->scan_limit_ = scan_limit;
   return Operator(std::move(get));
 }
 
@@ -57,6 +58,7 @@ Operator LogicalGet::Make() {
   get->namespace_oid_ = catalog::INVALID_NAMESPACE_OID;
   get->table_oid_ = catalog::INVALID_TABLE_OID;
   get->is_for_update_ = false;
+  get->scan_limit_ = 0;
   return Operator(std::move(get));
 }
 
@@ -68,6 +70,7 @@ common::hash_t LogicalGet::Hash() const {
   hash = common::HashUtil::CombineHashInRange(hash, predicates_.begin(), predicates_.end());
   hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(table_alias_));
   hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(is_for_update_));
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(scan_limit_));
   return hash;
 }
 
@@ -82,6 +85,7 @@ bool LogicalGet::operator==(const BaseOperatorNodeContents &r) {
     if (predicates_[i].GetExpr() != node.predicates_[i].GetExpr()) return false;
   }
   if (table_alias_ != node.table_alias_) return false;
+  if (scan_limit_ != node.scan_limit_) return false;
   return is_for_update_ == node.is_for_update_;
 }
 
@@ -218,13 +222,16 @@ BaseOperatorNodeContents *LogicalInsert::Copy() const { return new LogicalInsert
 Operator LogicalInsert::Make(
     catalog::db_oid_t database_oid, catalog::namespace_oid_t namespace_oid, catalog::table_oid_t table_oid,
     std::vector<catalog::col_oid_t> &&columns,
-    common::ManagedPointer<std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>> values) {
+    common::ManagedPointer<std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>> values,
+    common::ManagedPointer<parser::ConstantBatch> constant_batch) {
 #ifndef NDEBUG
   // We need to check whether the number of values for each insert vector
   // matches the number of columns
   for (const auto &insert_vals : *values) {
     TERRIER_ASSERT(columns.size() == insert_vals.size(), "Mismatched number of columns and values");
   }
+  TERRIER_ASSERT(constant_batch == nullptr || columns.size() == constant_batch->NumColumns(),
+                 "Mismatched number of columns and values");
 #endif
 
   auto op = std::make_unique<LogicalInsert>();
@@ -233,6 +240,7 @@ Operator LogicalInsert::Make(
   op->table_oid_ = table_oid;
   op->columns_ = std::move(columns);
   op->values_ = values;
+  op->constant_batch_ = constant_batch;
   return Operator(std::move(op));
 }
 
@@ -247,6 +255,7 @@ common::hash_t LogicalInsert::Hash() const {
   for (const auto &insert_vals : *values_) {
     hash = common::HashUtil::CombineHashInRange(hash, insert_vals.begin(), insert_vals.end());
   }
+  if (constant_batch_ != nullptr) hash = common::HashUtil::CombineHashes(hash, constant_batch_->Hash());
 
   return hash;
 }
@@ -259,6 +268,7 @@ bool LogicalInsert::operator==(const BaseOperatorNodeContents &r) {
   if (table_oid_ != node.table_oid_) return false;
   if (columns_ != node.columns_) return false;
   if (values_ != node.values_) return false;
+  if (constant_batch_ != node.constant_batch_) return false;
   return (true);
 }
 
@@ -698,6 +708,38 @@ bool LogicalSemiJoin::operator==(const BaseOperatorNodeContents &r) {
   return (join_predicates_ == node.join_predicates_);
 }
 
+//===--------------------------------------------------------------------===//
+// AntiJoin
+//===--------------------------------------------------------------------===//
+BaseOperatorNodeContents *LogicalAntiJoin::Copy() const { return new LogicalAntiJoin(*this); }
+
+Operator LogicalAntiJoin::Make() { return Operator(std::make_unique<LogicalAntiJoin>()); }
+
+Operator LogicalAntiJoin::Make(std::vector<AnnotatedExpression> &&join_predicates) {
+  auto join = std::make_unique<LogicalAntiJoin>();
+  join->join_predicates_ = join_predicates;
+  return Operator(std::move(join));
+}
+
+common::hash_t LogicalAntiJoin::Hash() const {
+  common::hash_t hash = BaseOperatorNodeContents::Hash();
+  for (auto &pred : join_predicates_) {
+    auto expr = pred.GetExpr();
+    if (expr) {
+      hash = common::HashUtil::SumHashes(hash, expr->Hash());
+    } else {
+      hash = common::HashUtil::SumHashes(hash, BaseOperatorNodeContents::Hash());
+    }
+  }
+  return hash;
+}
+
+bool LogicalAntiJoin::operator==(const BaseOperatorNodeContents &r) {
+  if (r.GetType() != OpType::LOGICALANTIJOIN) return false;
+  const LogicalAntiJoin &node = *static_cast<const LogicalAntiJoin *>(&r);
+  return (join_predicates_ == node.join_predicates_);
+}
+
 //===--------------------------------------------------------------------===//
 // Aggregate
 //===--------------------------------------------------------------------===//
@@ -1228,6 +1270,8 @@ const char *OperatorNodeContents<LogicalOuterJoin>::name = "LogicalOuterJoin";
 template <>
 const char *OperatorNodeContents<LogicalSemiJoin>::name = "LogicalSemiJoin";
 template <>
+const char *OperatorNodeContents<LogicalAntiJoin>::name = "LogicalAntiJoin";
+template <>
 const char *OperatorNodeContents<LogicalAggregateAndGroupBy>::name = "LogicalAggregateAndGroupBy";
 template <>
 const char *OperatorNodeContents<LogicalInsert>::name = "LogicalInsert";
@@ -1298,6 +1342,8 @@ OpType OperatorNodeContents<LogicalOuterJoin>::type = OpType::LOGICALOUTERJOIN;
 template <>
 OpType OperatorNodeContents<LogicalSemiJoin>::type = OpType::LOGICALSEMIJOIN;
 template <>
+OpType OperatorNodeContents<LogicalAntiJoin>::type = OpType::LOGICALANTIJOIN;
+template <>
 OpType OperatorNodeContents<LogicalAggregateAndGroupBy>::type = OpType::LOGICALAGGREGATEANDGROUPBY;
 template <>
 OpType OperatorNodeContents<LogicalInsert>::type = OpType::LOGICALINSERT;
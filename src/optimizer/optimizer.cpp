@@ -90,6 +90,7 @@ std::unique_ptr<planner::AbstractPlanNode> Optimizer::ChooseBestPlan(
   // root plan. Also keep propagate expression to column offset mapping
   std::vector<std::unique_ptr<planner::AbstractPlanNode>> children_plans;
   std::vector<ExprMap> children_expr_map;
+  std::vector<int> children_num_rows;
   for (size_t i = 0; i < child_groups.size(); ++i) {
     ExprMap child_expr_map;
     for (unsigned offset = 0; offset < input_cols[i].size(); ++offset) {
@@ -102,37 +103,40 @@ std::unique_ptr<planner::AbstractPlanNode> Optimizer::ChooseBestPlan(
 
     children_plans.emplace_back(std::move(child_plan));
     children_expr_map.push_back(child_expr_map);
+    children_num_rows.push_back(context_->GetMemo().GetGroupByID(child_groups[i])->GetNumRows());
   }
 
   // Derive root plan
-  OperatorNode *op = new OperatorNode(Operator(gexpr->Op()), {});
+  OperatorNode op(Operator(gexpr->Op()), {});
 
   PlanGenerator generator;
-  auto plan = generator.ConvertOpNode(txn, accessor, op, required_props, required_cols, output_cols,
-                                      std::move(children_plans), std::move(children_expr_map));
+  auto plan = generator.ConvertOpNode(txn, accessor, &op, required_props, required_cols, output_cols,
+                                      std::move(children_plans), std::move(children_expr_map),
+                                      std::move(children_num_rows), required_input_props);
   OPTIMIZER_LOG_TRACE("Finish Choosing best plan for group {0}", id);
-
-  delete op;
   return plan;
 }
 
 void Optimizer::OptimizeLoop(group_id_t root_group_id, PropertySet *required_props) {
-  auto root_context = new OptimizationContext(context_.get(), required_props->Copy());
+  auto *arena = context_->GetArena();
+  auto root_context = new (arena) OptimizationContext(context_.get(), required_props->Copy());
   auto task_stack = new OptimizerTaskStack();
   context_->SetTaskPool(task_stack);
   context_->AddOptimizationContext(root_context);
 
   // Perform rewrite first
-  task_stack->Push(new TopDownRewrite(root_group_id, root_context, RuleSetName::PREDICATE_PUSH_DOWN));
-  task_stack->Push(new BottomUpRewrite(root_group_id, root_context, RuleSetName::UNNEST_SUBQUERY, false));
+  task_stack->Push(new (arena) TopDownRewrite(root_group_id, root_context, RuleSetName::PREDICATE_PUSH_DOWN));
+  task_stack->Push(
+      new (arena) BottomUpRewrite(root_group_id, root_context, RuleSetName::UNNEST_SUBQUERY, false));
   ExecuteTaskStack(task_stack, root_group_id, root_context);
 
   // Perform optimization after the rewrite
   Memo &memo = context_->GetMemo();
-  task_stack->Push(new OptimizeGroup(memo.GetGroupByID(root_group_id), root_context));
+  task_stack->Push(new (arena) OptimizeGroup(memo.GetGroupByID(root_group_id), root_context));
 
   // Derive stats for the only one logical expression before optimizing
-  task_stack->Push(new DeriveStats(memo.GetGroupByID(root_group_id)->GetLogicalExpression(), ExprSet{}, root_context));
+  task_stack->Push(
+      new (arena) DeriveStats(memo.GetGroupByID(root_group_id)->GetLogicalExpression(), ExprSet{}, root_context));
   ExecuteTaskStack(task_stack, root_group_id, root_context);
 }
 
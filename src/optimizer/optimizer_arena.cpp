@@ -0,0 +1,43 @@
+#include "optimizer/optimizer_arena.h"
+
+#include "common/strong_typedef.h"
+
+namespace terrier::optimizer {
+
+void *OptimizerArena::Allocate(std::size_t size) {
+  size = RoundedSize(size);
+  if (size <= MAX_RECYCLED_SIZE) {
+    auto &free_list = free_lists_[size / SIZE_CLASS];
+    if (free_list != nullptr) {
+      auto *block = free_list;
+      free_list = block->next_;
+      return block;
+    }
+  }
+  return region_.Allocate(size);
+}
+
+void OptimizerArena::Free(void *ptr, std::size_t size) {
+  size = RoundedSize(size);
+  if (size > MAX_RECYCLED_SIZE) return;
+  auto &free_list = free_lists_[size / SIZE_CLASS];
+  auto *block = reinterpret_cast<FreeBlock *>(ptr);
+  block->next_ = free_list;
+  free_list = block;
+}
+
+void *ArenaObject::operator new(std::size_t size, OptimizerArena *arena) {
+  auto *block = reinterpret_cast<byte *>(arena->Allocate(HEADER_SIZE + size));
+  *reinterpret_cast<OptimizerArena **>(block) = arena;
+  return block + HEADER_SIZE;
+}
+
+void ArenaObject::operator delete(void *ptr, std::size_t size) {
+  if (ptr == nullptr) return;
+  auto *block = reinterpret_cast<byte *>(ptr) - HEADER_SIZE;
+  (*reinterpret_cast<OptimizerArena **>(block))->Free(block, HEADER_SIZE + size);
+}
+
+void ArenaObject::operator delete(UNUSED_ATTRIBUTE void *ptr, UNUSED_ATTRIBUTE OptimizerArena *arena) {}
+
+}  // namespace terrier::optimizer
@@ -41,6 +41,8 @@ void OptimizerTask::ConstructValidRules(GroupExpression *group_expr, const std::
 
 void OptimizerTask::PushTask(OptimizerTask *task) { context_->GetOptimizerContext()->PushTask(task); }
 
+OptimizerArena *OptimizerTask::GetArena() const { return context_->GetOptimizerContext()->GetArena(); }
+
 Memo &OptimizerTask::GetMemo() const { return context_->GetOptimizerContext()->GetMemo(); }
 
 RuleSet &OptimizerTask::GetRuleSet() const { return context_->GetOptimizerContext()->GetRuleSet(); }
@@ -56,12 +58,14 @@ void OptimizeGroup::Execute() {
 
   // Push explore task first for logical expressions if the group has not been explored
   if (!group_->HasExplored()) {
-    for (auto &logical_expr : group_->GetLogicalExpressions()) PushTask(new OptimizeExpression(logical_expr, context_));
+    for (auto &logical_expr : group_->GetLogicalExpressions()) {
+      PushTask(new (GetArena()) OptimizeExpression(logical_expr, context_));
+    }
   }
 
   // Push implement tasks to ensure that they are run first (for early pruning)
   for (auto &physical_expr : group_->GetPhysicalExpressions()) {
-    PushTask(new OptimizeExpressionCostWithEnforcedProperty(physical_expr, context_));
+    PushTask(new (GetArena()) OptimizeExpressionCostWithEnforcedProperty(physical_expr, context_));
   }
 
   // Since there is no cycle in the tree, it is safe to set the flag even before
@@ -86,14 +90,14 @@ void OptimizeExpression::Execute() {
                       static_cast<int>(group_expr_->Op().GetType()), valid_rules.size());
   // Apply rule
   for (auto &r : valid_rules) {
-    PushTask(new ApplyRule(group_expr_, r.GetRule(), context_));
+    PushTask(new (GetArena()) ApplyRule(group_expr_, r.GetRule(), context_));
     int child_group_idx = 0;
     for (auto &child_pattern : r.GetRule()->GetMatchPattern()->Children()) {
       // If child_pattern has any more children (i.e non-leaf), then we will explore the
       // child before applying the rule. (assumes task pool is effectively a stack)
       if (child_pattern->GetChildPatternsSize() > 0) {
         Group *group = GetMemo().GetGroupByID(group_expr_->GetChildGroupIDs()[child_group_idx]);
-        PushTask(new ExploreGroup(group, context_));
+        PushTask(new (GetArena()) ExploreGroup(group, context_));
       }
 
       child_group_idx++;
@@ -109,7 +113,7 @@ void ExploreGroup::Execute() {
   OPTIMIZER_LOG_TRACE("ExploreGroup::Execute() ");
 
   for (auto &logical_expr : group_->GetLogicalExpressions()) {
-    PushTask(new ExploreExpression(logical_expr, context_));
+    PushTask(new (GetArena()) ExploreExpression(logical_expr, context_));
   }
 
   // Since there is no cycle in the tree, it is safe to set the flag even before
@@ -131,14 +135,14 @@ void ExploreExpression::Execute() {
 
   // Apply rule
   for (auto &r : valid_rules) {
-    PushTask(new ApplyRule(group_expr_, r.GetRule(), context_, true));
+    PushTask(new (GetArena()) ApplyRule(group_expr_, r.GetRule(), context_, true));
     int child_group_idx = 0;
     for (auto &child_pattern : r.GetRule()->GetMatchPattern()->Children()) {
       // Only need to explore non-leaf children before applying rule to the
       // current group. this condition is important for early-pruning
       if (child_pattern->GetChildPatternsSize() > 0) {
         Group *group = GetMemo().GetGroupByID(group_expr_->GetChildGroupIDs()[child_group_idx]);
-        PushTask(new ExploreGroup(group, context_));
+        PushTask(new (GetArena()) ExploreGroup(group, context_));
       }
 
       child_group_idx++;
@@ -171,17 +175,17 @@ void ApplyRule::Execute() {
         // A new group expression is generated
         if (new_gexpr->Op().IsLogical()) {
           // Derive stats for the *logical expression*
-          PushTask(new DeriveStats(new_gexpr, ExprSet{}, context_));
+          PushTask(new (GetArena()) DeriveStats(new_gexpr, ExprSet{}, context_));
           if (explore_only_) {
             // Explore this logical expression
-            PushTask(new ExploreExpression(new_gexpr, context_));
+            PushTask(new (GetArena()) ExploreExpression(new_gexpr, context_));
           } else {
             // Optimize this logical expression
-            PushTask(new OptimizeExpression(new_gexpr, context_));
+            PushTask(new (GetArena()) OptimizeExpression(new_gexpr, context_));
           }
         } else {
           // Cost this physical expression and optimize its inputs
-          PushTask(new OptimizeExpressionCostWithEnforcedProperty(new_gexpr, context_));
+          PushTask(new (GetArena()) OptimizeExpressionCostWithEnforcedProperty(new_gexpr, context_));
         }
       }
     }
@@ -219,9 +223,9 @@ void DeriveStats::Execute() {
       if (!derive_children) {
         derive_children = true;
         // Derive stats for root later
-        PushTask(new DeriveStats(this));
+        PushTask(new (GetArena()) DeriveStats(this));
       }
-      PushTask(new DeriveStats(child_group_gexpr, child_required_stats, context_));
+      PushTask(new (GetArena()) DeriveStats(child_group_gexpr, child_required_stats, context_));
     }
   }
 
@@ -291,11 +295,12 @@ void OptimizeExpressionCostWithEnforcedProperty::Execute() {
         if (cur_total_cost_ > context_->GetCostUpperBound()) break;
       } else if (prev_child_idx_ != cur_child_idx_) {  // We haven't optimized child group
         prev_child_idx_ = cur_child_idx_;
-        PushTask(new OptimizeExpressionCostWithEnforcedProperty(this));
+        PushTask(new (GetArena()) OptimizeExpressionCostWithEnforcedProperty(this));
 
         auto cost_high = context_->GetCostUpperBound() - cur_total_cost_;
-        auto ctx = new OptimizationContext(context_->GetOptimizerContext(), i_prop->Copy(), cost_high);
-        PushTask(new OptimizeGroup(child_group, ctx));
+        auto ctx =
+            new (GetArena()) OptimizationContext(context_->GetOptimizerContext(), i_prop->Copy(), cost_high);
+        PushTask(new (GetArena()) OptimizeGroup(child_group, ctx));
         context_->GetOptimizerContext()->AddOptimizationContext(ctx);
         return;
       } else {  // If we return from OptimizeGroup, then there is no expr for the context
@@ -321,7 +326,7 @@ void OptimizeExpressionCostWithEnforcedProperty::Execute() {
       cur_group->SetExpressionCost(group_expr_, cur_total_cost_, output_prop->Copy());
 
       // Enforce property if the requirement does not meet
-      PropertyEnforcer prop_enforcer;
+      PropertyEnforcer prop_enforcer(GetArena());
       GroupExpression *memo_enforced_expr = nullptr;
       bool meet_requirement = true;
 
@@ -404,7 +409,7 @@ void TopDownRewrite::Execute() {
       if (!after.empty()) {
         auto &new_expr = after[0];
         context_->GetOptimizerContext()->ReplaceRewriteExpression(common::ManagedPointer(new_expr.get()), group_id_);
-        PushTask(new TopDownRewrite(group_id_, context_, rule_set_name_));
+        PushTask(new (GetArena()) TopDownRewrite(group_id_, context_, rule_set_name_));
         return;
       }
     }
@@ -416,7 +421,7 @@ void TopDownRewrite::Execute() {
   for (size_t child_group_idx = 0; child_group_idx < size; child_group_idx++) {
     // Need to rewrite all sub trees first
     auto id = cur_group_expr->GetChildGroupId(static_cast<int>(child_group_idx));
-    auto task = new TopDownRewrite(id, context_, rule_set_name_);
+    auto task = new (GetArena()) TopDownRewrite(id, context_, rule_set_name_);
     PushTask(task);
   }
 }
@@ -428,13 +433,13 @@ void BottomUpRewrite::Execute() {
   auto cur_group_expr = cur_group->GetLogicalExpression();
 
   if (!has_optimized_child_) {
-    PushTask(new BottomUpRewrite(group_id_, context_, rule_set_name_, true));
+    PushTask(new (GetArena()) BottomUpRewrite(group_id_, context_, rule_set_name_, true));
 
     size_t size = cur_group_expr->GetChildrenGroupsSize();
     for (size_t child_group_idx = 0; child_group_idx < size; child_group_idx++) {
       // Need to rewrite all sub trees first
       auto id = cur_group_expr->GetChildGroupId(static_cast<int>(child_group_idx));
-      auto task = new BottomUpRewrite(id, context_, rule_set_name_, false);
+      auto task = new (GetArena()) BottomUpRewrite(id, context_, rule_set_name_, false);
       PushTask(task);
     }
     return;
@@ -464,7 +469,7 @@ void BottomUpRewrite::Execute() {
       if (!after.empty()) {
         auto &new_expr = after[0];
         context_->GetOptimizerContext()->ReplaceRewriteExpression(common::ManagedPointer(new_expr.get()), group_id_);
-        PushTask(new BottomUpRewrite(group_id_, context_, rule_set_name_, false));
+        PushTask(new (GetArena()) BottomUpRewrite(group_id_, context_, rule_set_name_, false));
         return;
       }
     }
@@ -82,7 +82,8 @@ Operator IndexScan::Make(catalog::db_oid_t database_oid, catalog::namespace_oid_
                          catalog::table_oid_t tbl_oid, catalog::index_oid_t index_oid,
                          std::vector<AnnotatedExpression> &&predicates, bool is_for_update,
                          planner::IndexScanType scan_type,
-                         std::unordered_map<catalog::indexkeycol_oid_t, std::vector<planner::IndexExpression>> bounds) {
+                         std::unordered_map<catalog::indexkeycol_oid_t, std::vector<planner::IndexExpression>> bounds,
+                         uint32_t scan_limit) {
   auto scan = std::make_unique<IndexScan>();
   scan->database_oid_ = database_oid;
   scan->namespace_oid_ = namespace_oid;
@@ -92,6 +93,7 @@ Operator IndexScan::Make(catalog::db_oid_t database_oid, catalog::namespace_oid_
   scan->predicates_ = std::move(predicates);
   scan->scan_type_ = scan_type;
   scan->bounds_ = std::move(bounds);
+  scan->scan_limit_ = scan_limit;
   return Operator(std::move(scan));
 }
 
@@ -100,7 +102,7 @@ bool IndexScan::operator==(const BaseOperatorNodeContents &r) {
   const IndexScan &node = *dynamic_cast<const IndexScan *>(&r);
   if (database_oid_ != node.database_oid_ || namespace_oid_ != node.namespace_oid_ || index_oid_ != node.index_oid_ ||
       tbl_oid_ != node.tbl_oid_ || predicates_.size() != node.predicates_.size() ||
-      is_for_update_ != node.is_for_update_ || scan_type_ != node.scan_type_)
+      is_for_update_ != node.is_for_update_ || scan_type_ != node.scan_type_ || scan_limit_ != node.scan_limit_)
     return false;
 
   for (size_t i = 0; i < predicates_.size(); i++) {
@@ -132,6 +134,7 @@ common::hash_t IndexScan::Hash() const {
   hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(index_oid_));
   hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(is_for_update_));
   hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(scan_type_));
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(scan_limit_));
   for (auto &pred : predicates_) {
     auto expr = pred.GetExpr();
     if (expr)
@@ -497,6 +500,96 @@ bool OuterHashJoin::operator==(const BaseOperatorNodeContents &r) {
   return (*join_predicate_ == *(node.join_predicate_));
 }
 
+//===--------------------------------------------------------------------===//
+// LeftSemiHashJoin
+//===--------------------------------------------------------------------===//
+BaseOperatorNodeContents *LeftSemiHashJoin::Copy() const { return new LeftSemiHashJoin(*this); }
+
+Operator LeftSemiHashJoin::Make(std::vector<AnnotatedExpression> &&join_predicates,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys) {
+  auto join = std::make_unique<LeftSemiHashJoin>();
+  join->join_predicates_ = std::move(join_predicates);
+  join->left_keys_ = std::move(left_keys);
+  join->right_keys_ = std::move(right_keys);
+  return Operator(std::move(join));
+}
+
+common::hash_t LeftSemiHashJoin::Hash() const {
+  common::hash_t hash = BaseOperatorNodeContents::Hash();
+  for (auto &expr : left_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &expr : right_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &pred : join_predicates_) {
+    auto expr = pred.GetExpr();
+    if (expr)
+      hash = common::HashUtil::SumHashes(hash, expr->Hash());
+    else
+      hash = common::HashUtil::SumHashes(hash, BaseOperatorNodeContents::Hash());
+  }
+  return hash;
+}
+
+bool LeftSemiHashJoin::operator==(const BaseOperatorNodeContents &r) {
+  if (r.GetType() != OpType::LEFTSEMIHASHJOIN) return false;
+  const LeftSemiHashJoin &node = *dynamic_cast<const LeftSemiHashJoin *>(&r);
+  if (left_keys_.size() != node.left_keys_.size() || right_keys_.size() != node.right_keys_.size() ||
+      join_predicates_.size() != node.join_predicates_.size())
+    return false;
+  if (join_predicates_ != node.join_predicates_) return false;
+  for (size_t i = 0; i < left_keys_.size(); i++) {
+    if (*(left_keys_[i]) != *(node.left_keys_[i])) return false;
+  }
+  for (size_t i = 0; i < right_keys_.size(); i++) {
+    if (*(right_keys_[i]) != *(node.right_keys_[i])) return false;
+  }
+  return true;
+}
+
+//===--------------------------------------------------------------------===//
+// LeftAntiHashJoin
+//===--------------------------------------------------------------------===//
+BaseOperatorNodeContents *LeftAntiHashJoin::Copy() const { return new LeftAntiHashJoin(*this); }
+
+Operator LeftAntiHashJoin::Make(std::vector<AnnotatedExpression> &&join_predicates,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&left_keys,
+                             std::vector<common::ManagedPointer<parser::AbstractExpression>> &&right_keys) {
+  auto join = std::make_unique<LeftAntiHashJoin>();
+  join->join_predicates_ = std::move(join_predicates);
+  join->left_keys_ = std::move(left_keys);
+  join->right_keys_ = std::move(right_keys);
+  return Operator(std::move(join));
+}
+
+common::hash_t LeftAntiHashJoin::Hash() const {
+  common::hash_t hash = BaseOperatorNodeContents::Hash();
+  for (auto &expr : left_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &expr : right_keys_) hash = common::HashUtil::CombineHashes(hash, expr->Hash());
+  for (auto &pred : join_predicates_) {
+    auto expr = pred.GetExpr();
+    if (expr)
+      hash = common::HashUtil::SumHashes(hash, expr->Hash());
+    else
+      hash = common::HashUtil::SumHashes(hash, BaseOperatorNodeContents::Hash());
+  }
+  return hash;
+}
+
+bool LeftAntiHashJoin::operator==(const BaseOperatorNodeContents &r) {
+  if (r.GetType() != OpType::LEFTANTIHASHJOIN) return false;
+  const LeftAntiHashJoin &node = *dynamic_cast<const LeftAntiHashJoin *>(&r);
+  if (left_keys_.size() != node.left_keys_.size() || right_keys_.size() != node.right_keys_.size() ||
+      join_predicates_.size() != node.join_predicates_.size())
+    return false;
+  if (join_predicates_ != node.join_predicates_) return false;
+  for (size_t i = 0; i < left_keys_.size(); i++) {
+    if (*(left_keys_[i]) != *(node.left_keys_[i])) return false;
+  }
+  for (size_t i = 0; i < right_keys_.size(); i++) {
+    if (*(right_keys_[i]) != *(node.right_keys_[i])) return false;
+  }
+  return true;
+}
+
 //===--------------------------------------------------------------------===//
 // Insert
 //===--------------------------------------------------------------------===//
@@ -505,6 +598,7 @@ BaseOperatorNodeContents *Insert::Copy() const { return new Insert(*this); }
 Operator Insert::Make(catalog::db_oid_t database_oid, catalog::namespace_oid_t namespace_oid,
                       catalog::table_oid_t table_oid, std::vector<catalog::col_oid_t> &&columns,
                       std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>> &&values,
+                      common::ManagedPointer<parser::ConstantBatch> constant_batch,
                       std::vector<catalog::index_oid_t> &&index_oids) {
 #ifndef NDEBUG
   // We need to check whether the number of values for each insert vector
@@ -512,6 +606,8 @@ Operator Insert::Make(catalog::db_oid_t database_oid, catalog::namespace_oid_t n
   for (const auto &insert_vals : values) {
     TERRIER_ASSERT(columns.size() == insert_vals.size(), "Mismatched number of columns and values");
   }
+  TERRIER_ASSERT(constant_batch == nullptr || columns.size() == constant_batch->NumColumns(),
+                 "Mismatched number of columns and values");
 #endif
 
   auto op = std::make_unique<Insert>();
@@ -520,6 +616,7 @@ Operator Insert::Make(catalog::db_oid_t database_oid, catalog::namespace_oid_t n
   op->table_oid_ = table_oid;
   op->columns_ = std::move(columns);
   op->values_ = std::move(values);
+  op->constant_batch_ = constant_batch;
   op->index_oids_ = std::move(index_oids);
   return Operator(std::move(op));
 }
@@ -535,6 +632,7 @@ common::hash_t Insert::Hash() const {
   for (const auto &insert_vals : values_) {
     hash = common::HashUtil::CombineHashInRange(hash, insert_vals.begin(), insert_vals.end());
   }
+  if (constant_batch_ != nullptr) hash = common::HashUtil::CombineHashes(hash, constant_batch_->Hash());
 
   return hash;
 }
@@ -547,6 +645,7 @@ bool Insert::operator==(const BaseOperatorNodeContents &r) {
   if (table_oid_ != node.table_oid_) return false;
   if (columns_ != node.columns_) return false;
   if (values_ != node.values_) return false;
+  if (constant_batch_ != node.constant_batch_) return false;
   return (true);
 }
 
@@ -1258,6 +1357,10 @@ const char *OperatorNodeContents<RightHashJoin>::name = "RightHashJoin";
 template <>
 const char *OperatorNodeContents<OuterHashJoin>::name = "OuterHashJoin";
 template <>
+const char *OperatorNodeContents<LeftSemiHashJoin>::name = "LeftSemiHashJoin";
+template <>
+const char *OperatorNodeContents<LeftAntiHashJoin>::name = "LeftAntiHashJoin";
+template <>
 const char *OperatorNodeContents<Insert>::name = "Insert";
 template <>
 const char *OperatorNodeContents<InsertSelect>::name = "InsertSelect";
@@ -1332,6 +1435,10 @@ OpType OperatorNodeContents<RightHashJoin>::type = OpType::RIGHTHASHJOIN;
 template <>
 OpType OperatorNodeContents<OuterHashJoin>::type = OpType::OUTERHASHJOIN;
 template <>
+OpType OperatorNodeContents<LeftSemiHashJoin>::type = OpType::LEFTSEMIHASHJOIN;
+template <>
+OpType OperatorNodeContents<LeftAntiHashJoin>::type = OpType::LEFTANTIHASHJOIN;
+template <>
 OpType OperatorNodeContents<Insert>::type = OpType::INSERT;
 template <>
 OpType OperatorNodeContents<InsertSelect>::type = OpType::INSERTSELECT;
@@ -55,12 +55,15 @@ std::unique_ptr<planner::AbstractPlanNode> PlanGenerator::ConvertOpNode(
     PropertySet *required_props, const std::vector<common::ManagedPointer<parser::AbstractExpression>> &required_cols,
     const std::vector<common::ManagedPointer<parser::AbstractExpression>> &output_cols,
     std::vector<std::unique_ptr<planner::AbstractPlanNode>> &&children_plans,
-    std::vector<ExprMap> &&children_expr_map) {
+    std::vector<ExprMap> &&children_expr_map, std::vector<int> &&children_num_rows,
+    std::vector<PropertySet *> children_props) {
   required_props_ = required_props;
   required_cols_ = required_cols;
   output_cols_ = output_cols;
   children_plans_ = std::move(children_plans);
   children_expr_map_ = children_expr_map;
+  children_num_rows_ = std::move(children_num_rows);
+  children_props_ = std::move(children_props);
   accessor_ = accessor;
   txn_ = txn;
 
@@ -224,6 +227,7 @@ void PlanGenerator::Visit(const IndexScan *op) {
   builder.SetIndexOid(op->GetIndexOID());
   builder.SetTableOid(tbl_oid);
   builder.SetColumnOids(std::move(column_ids));
+  builder.SetScanLimit(op->GetScanLimit());
 
   auto type = op->GetIndexScanType();
   builder.SetScanType(type);
@@ -232,9 +236,13 @@ void PlanGenerator::Visit(const IndexScan *op) {
       // Exact lookup
       builder.AddIndexColumn(bound.first, bound.second[0]);
     } else if (type == planner::IndexScanType::AscendingClosed) {
-      // Range lookup, so use lo and hi
-      builder.AddLoIndexColumn(bound.first, bound.second[0]);
-      builder.AddHiIndexColumn(bound.first, bound.second[1]);
+      // Range lookup, so use lo and hi. The last column of a composite prefix may be bounded on one side only
+      auto lo = bound.second[0];
+      auto hi = bound.second[1];
+      if (lo == nullptr) lo = GenerateIndexBound(op->GetIndexOID(), bound.first, false);
+      if (hi == nullptr) hi = GenerateIndexBound(op->GetIndexOID(), bound.first, true);
+      builder.AddLoIndexColumn(bound.first, lo);
+      builder.AddHiIndexColumn(bound.first, hi);
     } else if (type == planner::IndexScanType::AscendingOpenHigh) {
       // Open high scan, so use only lo
       builder.AddLoIndexColumn(bound.first, bound.second[0]);
@@ -246,9 +254,47 @@ void PlanGenerator::Visit(const IndexScan *op) {
     }
   }
 
+  if (type == planner::IndexScanType::Descending || type == planner::IndexScanType::DescendingLimit) {
+    // Backward scan of the whole index, from the largest key down to the smallest one
+    for (const auto &col : accessor_->GetIndexSchema(op->GetIndexOID()).GetColumns()) {
+      builder.AddLoIndexColumn(col.Oid(), GenerateIndexBound(op->GetIndexOID(), col.Oid(), false));
+      builder.AddHiIndexColumn(col.Oid(), GenerateIndexBound(op->GetIndexOID(), col.Oid(), true));
+    }
+  }
+
   output_plan_ = builder.Build();
 }
 
+planner::IndexExpression PlanGenerator::GenerateIndexBound(catalog::index_oid_t index_oid,
+                                                           catalog::indexkeycol_oid_t key_oid, bool max) {
+  type::TypeId type = type::TypeId::INVALID;
+  for (const auto &col : accessor_->GetIndexSchema(index_oid).GetColumns()) {
+    if (col.Oid() == key_oid) type = col.Type();
+  }
+
+  type::TransientValue value;
+  switch (type) {
+    case type::TypeId::TINYINT:
+      value = type::TransientValueFactory::GetTinyInt(max ? INT8_MAX : INT8_MIN);
+      break;
+    case type::TypeId::SMALLINT:
+      value = type::TransientValueFactory::GetSmallInt(max ? INT16_MAX : INT16_MIN);
+      break;
+    case type::TypeId::INTEGER:
+      value = type::TransientValueFactory::GetInteger(max ? INT32_MAX : INT32_MIN);
+      break;
+    case type::TypeId::BIGINT:
+      value = type::TransientValueFactory::GetBigInt(max ? INT64_MAX : INT64_MIN);
+      break;
+    default:
+      throw OPTIMIZER_EXCEPTION("Index bounds can only be generated for integer columns");
+  }
+
+  auto bound = new parser::ConstantValueExpression(std::move(value));
+  RegisterPointerCleanup<parser::AbstractExpression>(bound, true, true);
+  return planner::IndexExpression(bound);
+}
+
 void PlanGenerator::Visit(const ExternalFileScan *op) {
   switch (op->GetFormat()) {
     case parser::ExternalFileFormat::CSV: {
@@ -318,7 +364,9 @@ void PlanGenerator::Visit(const Limit *op) {
   TERRIER_ASSERT(children_plans_.size() == 1, "Limit needs 1 child plan");
   output_plan_ = std::move(children_plans_[0]);
 
-  if (!op->GetSortExpressions().empty()) {
+  // No need to sort if the child plan already produces the order (e.g. an index scan)
+  bool child_sorted = !children_props_.empty() && children_props_[0]->GetPropertyOfType(PropertyType::SORT) != nullptr;
+  if (!op->GetSortExpressions().empty() && !child_sorted) {
     // Build order by clause
     TERRIER_ASSERT(children_expr_map_.size() == 1, "Limit needs 1 child expr map");
     auto &child_cols_map = children_expr_map_[0];
@@ -545,11 +593,20 @@ void PlanGenerator::Visit(const InnerHashJoin *op) {
     builder.AddRightHashKey(common::ManagedPointer(right_key));
   }
 
+  // The hash table is built on the left child
+  builder.SetUseConciseHashTable(UseConciseHashTable(0));
+
   builder.AddChild(std::move(children_plans_[0]));
   builder.AddChild(std::move(children_plans_[1]));
   output_plan_ = builder.Build();
 }
 
+bool PlanGenerator::UseConciseHashTable(size_t build_child_idx) const {
+  // Without an estimate, stick to the generic hash table
+  if (build_child_idx >= children_num_rows_.size()) return false;
+  return children_num_rows_[build_child_idx] >= CONCISE_HT_MIN_BUILD_ROWS;
+}
+
 void PlanGenerator::Visit(UNUSED_ATTRIBUTE const LeftHashJoin *op) {
   TERRIER_ASSERT(0, "LeftHashJoin not implemented");
 }
@@ -562,6 +619,70 @@ void PlanGenerator::Visit(UNUSED_ATTRIBUTE const OuterHashJoin *op) {
   TERRIER_ASSERT(0, "OuterHashJoin not implemented");
 }
 
+void PlanGenerator::Visit(const LeftSemiHashJoin *op) {
+  BuildFilteringHashJoinPlan(planner::LogicalJoinType::SEMI, op->GetJoinPredicates(), op->GetLeftKeys(),
+                             op->GetRightKeys());
+}
+
+void PlanGenerator::Visit(const LeftAntiHashJoin *op) {
+  BuildFilteringHashJoinPlan(planner::LogicalJoinType::ANTI, op->GetJoinPredicates(), op->GetLeftKeys(),
+                             op->GetRightKeys());
+}
+
+void PlanGenerator::BuildFilteringHashJoinPlan(
+    planner::LogicalJoinType join_type, const std::vector<AnnotatedExpression> &join_predicates,
+    const std::vector<common::ManagedPointer<parser::AbstractExpression>> &left_keys,
+    const std::vector<common::ManagedPointer<parser::AbstractExpression>> &right_keys) {
+  TERRIER_ASSERT(children_expr_map_.size() == 2, "Join needs 2 children");
+  TERRIER_ASSERT(children_plans_.size() == 2, "Join needs 2 children");
+  // Column maps in the order of the plan's children: the right child builds, the left child probes
+  std::vector<ExprMap> plan_children_maps{children_expr_map_[1], children_expr_map_[0]};
+
+  // Only the columns of the left child are output
+  std::vector<planner::OutputSchema::Column> columns;
+  for (auto &expr : output_cols_) {
+    auto type = expr->GetReturnValueType();
+    if (children_expr_map_[0].count(expr) != 0U) {
+      auto dve = std::make_unique<parser::DerivedValueExpression>(type, 1, children_expr_map_[0][expr]);
+      columns.emplace_back(expr->GetExpressionName(), type, std::move(dve));
+    } else {
+      auto eval = parser::ExpressionUtil::EvaluateExpression(plan_children_maps, expr);
+      columns.emplace_back(expr->GetExpressionName(), type, std::move(eval));
+    }
+  }
+
+  // The predicate decides whether a build tuple matches, beyond having the same hash
+  auto comb_pred = parser::ExpressionUtil::JoinAnnotatedExprs(join_predicates);
+  auto eval_pred =
+      parser::ExpressionUtil::EvaluateExpression(plan_children_maps, common::ManagedPointer(comb_pred.get()));
+  auto join_predicate =
+      parser::ExpressionUtil::ConvertExprCVNodes(common::ManagedPointer(eval_pred.get()), plan_children_maps).release();
+  RegisterPointerCleanup<parser::AbstractExpression>(join_predicate, true, true);
+
+  auto builder = planner::HashJoinPlanNode::Builder();
+  builder.SetOutputSchema(std::make_unique<planner::OutputSchema>(std::move(columns)));
+  builder.SetJoinType(join_type);
+  builder.SetJoinPredicate(common::ManagedPointer(join_predicate));
+
+  for (auto &expr : right_keys) {
+    auto build_key = parser::ExpressionUtil::EvaluateExpression({children_expr_map_[1]}, expr).release();
+    RegisterPointerCleanup<parser::AbstractExpression>(build_key, true, true);
+    builder.AddLeftHashKey(common::ManagedPointer(build_key));
+  }
+
+  for (auto &expr : left_keys) {
+    auto probe_key = parser::ExpressionUtil::EvaluateExpression({children_expr_map_[0]}, expr).release();
+    RegisterPointerCleanup<parser::AbstractExpression>(probe_key, true, true);
+    builder.AddRightHashKey(common::ManagedPointer(probe_key));
+  }
+
+  builder.SetUseConciseHashTable(UseConciseHashTable(1));
+
+  builder.AddChild(std::move(children_plans_[1]));
+  builder.AddChild(std::move(children_plans_[0]));
+  output_plan_ = builder.Build();
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Aggregations (when the groups are greater than individuals)
 ///////////////////////////////////////////////////////////////////////////////
@@ -641,7 +762,6 @@ void PlanGenerator::Visit(const HashGroupBy *op) {
 }
 
 void PlanGenerator::Visit(const SortGroupBy *op) {
-  // Don't think this is ever visited since rule_impls.cpp does not create SortGroupBy
   auto having_predicates = parser::ExpressionUtil::JoinAnnotatedExprs(op->GetHaving());
   BuildAggregatePlan(planner::AggregateStrategyType::SORTED, &op->GetColumns(),
                      common::ManagedPointer(having_predicates.get()));
@@ -669,6 +789,7 @@ void PlanGenerator::Visit(const Insert *op) {
   for (auto &tuple_value : values) {
     builder.AddValues(std::move(tuple_value));
   }
+  builder.SetConstantBatch(op->GetConstantBatch());
 
   // This is based on what Peloton does/did with query_to_operator_transformer.cpp
   TERRIER_ASSERT(!op->GetColumns().empty(), "Transformer should added columns");
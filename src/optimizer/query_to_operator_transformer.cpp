@@ -378,14 +378,23 @@ void QueryToOperatorTransformer::Visit(parser::InsertStatement *op, parser::Pars
   // vector of column oids
   std::vector<catalog::col_oid_t> col_ids;
 
+  // number of values in each tuple to insert, all the tuples of a constant batch have the same number
+  std::vector<size_t> tuple_sizes;
+  const auto constant_batch = op->GetConstantBatch();
+  if (constant_batch != nullptr) {
+    tuple_sizes.push_back(constant_batch->NumColumns());
+  } else {
+    for (const auto &values : *(op->GetValues())) tuple_sizes.push_back(values.size());
+  }
+
   // INSERT INTO table_name VALUES (val1, val2, ...), (val_a, val_b, ...), ...
   if (op->GetInsertColumns()->empty()) {
-    for (const auto &values : *(op->GetValues())) {
-      if (values.size() > column_objects.size()) {
+    for (const auto tuple_size : tuple_sizes) {
+      if (tuple_size > column_objects.size()) {
         throw CATALOG_EXCEPTION("INSERT has more expressions than target columns");
       }
-      if (values.size() < column_objects.size()) {
-        for (auto i = values.size(); i != column_objects.size(); ++i) {
+      if (tuple_size < column_objects.size()) {
+        for (auto i = tuple_size; i != column_objects.size(); ++i) {
           // check whether null values or default values can be used in the rest of the columns
           if (!column_objects[i].Nullable() && column_objects[i].StoredExpression() == nullptr) {
             throw CATALOG_EXCEPTION(
@@ -399,11 +408,11 @@ void QueryToOperatorTransformer::Visit(parser::InsertStatement *op, parser::Pars
   } else {
     // INSERT INTO table_name (col1, col2, ...) VALUES (val1, val2, ...), ...
     auto num_columns = op->GetInsertColumns()->size();
-    for (const auto &tuple : *(op->GetValues())) {  // check size of each tuple
-      if (tuple.size() > num_columns) {
+    for (const auto tuple_size : tuple_sizes) {  // check size of each tuple
+      if (tuple_size > num_columns) {
         throw CATALOG_EXCEPTION("INSERT has more expressions than target columns");
       }
-      if (tuple.size() < num_columns) {
+      if (tuple_size < num_columns) {
         throw CATALOG_EXCEPTION("INSERT has more target columns than expressions");
       }
     }
@@ -434,7 +443,8 @@ void QueryToOperatorTransformer::Visit(parser::InsertStatement *op, parser::Pars
   }
 
   auto insert_expr = std::make_unique<OperatorNode>(
-      LogicalInsert::Make(target_db_id, target_ns_id, target_table_id, std::move(col_ids), op->GetValues()),
+      LogicalInsert::Make(target_db_id, target_ns_id, target_table_id, std::move(col_ids), op->GetValues(),
+                          constant_batch),
       std::vector<std::unique_ptr<OperatorNode>>{});
   output_expr_ = std::move(insert_expr);
 }
@@ -608,12 +618,9 @@ void QueryToOperatorTransformer::Visit(parser::ComparisonExpression *expr, parse
 
 void QueryToOperatorTransformer::Visit(parser::OperatorExpression *expr, parser::ParseResult *parse_result) {
   OPTIMIZER_LOG_DEBUG("Transforming OperatorNode to operators ...");
-  // TODO(boweic): We may want to do the rewrite (exist -> in) in the binder
+  // The EXISTS is evaluated by the mark join, which is unnested into a semi or anti join
   if (expr->GetExpressionType() == parser::ExpressionType::OPERATOR_EXISTS) {
-    if (GenerateSubqueryTree(expr, 0, parse_result, false)) {
-      // Already reset the child to column, we need to transform exist to not-null to preserve semantic
-      expr->SetExpressionType(parser::ExpressionType::OPERATOR_IS_NOT_NULL);
-    }
+    GenerateSubqueryTree(expr, 0, parse_result, false);
   }
 
   expr->AcceptChildren(this, parse_result);
@@ -661,10 +668,18 @@ void QueryToOperatorTransformer::CollectPredicates(common::ManagedPointer<parser
     }
   }
   // Accept will change the expression, e.g. (a in (select b from test)) into
-  // (a IN test.b), after the rewrite, we can extract the table aliases
-  // information correctly
-  expr->Accept(this, parse_result);
-  QueryToOperatorTransformer::ExtractPredicates(expr, predicates);
+  // (a = test.b), after the rewrite, we can extract the table aliases
+  // information correctly. The predicates over a sub-select that a mark join
+  // evaluates are not filter predicates.
+  for (const auto &pred : predicate_ptrs) {
+    if (QueryToOperatorTransformer::IsMarkJoinPredicate(pred)) {
+      mark_join_predicate_ = pred;
+      pred->Accept(this, parse_result);
+    } else {
+      pred->Accept(this, parse_result);
+      QueryToOperatorTransformer::ExtractPredicates(pred, predicates);
+    }
+  }
 }
 
 bool QueryToOperatorTransformer::IsSupportedConjunctivePredicate(
@@ -688,6 +703,12 @@ bool QueryToOperatorTransformer::IsSupportedConjunctivePredicate(
       expr->GetChild(0)->GetExpressionType() == parser::ExpressionType::ROW_SUBQUERY) {
     return true;
   }
+  // Subquery with NOT EXIST
+  if (expr_type == parser::ExpressionType::OPERATOR_NOT &&
+      expr->GetChild(0)->GetExpressionType() == parser::ExpressionType::OPERATOR_EXISTS &&
+      expr->GetChild(0)->GetChild(0)->GetExpressionType() == parser::ExpressionType::ROW_SUBQUERY) {
+    return true;
+  }
   // Subquery with other operator
   if (expr_type == parser::ExpressionType::COMPARE_EQUAL || expr_type == parser::ExpressionType::COMPARE_GREATER_THAN ||
       expr_type == parser::ExpressionType::COMPARE_GREATER_THAN_OR_EQUAL_TO ||
@@ -704,6 +725,21 @@ bool QueryToOperatorTransformer::IsSupportedConjunctivePredicate(
   return false;
 }
 
+bool QueryToOperatorTransformer::IsMarkJoinPredicate(common::ManagedPointer<parser::AbstractExpression> expr) {
+  if (!expr->HasSubquery()) {
+    return false;
+  }
+  auto expr_type = expr->GetExpressionType();
+  if (expr_type == parser::ExpressionType::OPERATOR_NOT) {
+    expr = expr->GetChild(0);
+    expr_type = expr->GetExpressionType();
+    return expr_type == parser::ExpressionType::OPERATOR_EXISTS &&
+           expr->GetChild(0)->GetExpressionType() == parser::ExpressionType::ROW_SUBQUERY;
+  }
+  return (expr_type == parser::ExpressionType::COMPARE_IN || expr_type == parser::ExpressionType::OPERATOR_EXISTS) &&
+         expr->GetChild(expr->GetChildrenSize() - 1)->GetExpressionType() == parser::ExpressionType::ROW_SUBQUERY;
+}
+
 bool QueryToOperatorTransformer::IsSupportedSubSelect(common::ManagedPointer<parser::SelectStatement> op) {
   // Supported if 1. No aggregation. 2. With aggregation and WHERE clause only
   // have correlated columns in conjunctive predicates in the form of
@@ -745,26 +781,41 @@ bool QueryToOperatorTransformer::GenerateSubqueryTree(parser::AbstractExpression
   // We only support subselect with single row
   if (sub_select->GetSelectColumns().size() != 1) throw NOT_IMPLEMENTED_EXCEPTION("Array in predicates not supported");
 
-  std::vector<parser::AbstractExpression *> select_list;
+  // The sub-select may have mark joins of its own
+  auto mark_join_predicate = mark_join_predicate_;
+  mark_join_predicate_ = nullptr;
+
+  auto outer_expr = std::move(output_expr_);
+  sub_select->Accept(this, parse_result);
+
+  // Convert subquery to the selected column in the sub-select
+  expr->SetChild(child_id, sub_select->GetSelectColumns().at(0));
+
   // Construct join
   std::unique_ptr<OperatorNode> op_expr;
   if (single_join) {
     op_expr = std::make_unique<OperatorNode>(LogicalSingleJoin::Make(), std::vector<std::unique_ptr<OperatorNode>>{});
-    op_expr->PushChild(std::move(output_expr_));
   } else {
-    op_expr = std::make_unique<OperatorNode>(LogicalMarkJoin::Make(), std::vector<std::unique_ptr<OperatorNode>>{});
-    op_expr->PushChild(std::move(output_expr_));
+    // The mark join evaluates the predicate over the sub-select, e.g. (a in (select b from test)) becomes
+    // (a = test.b), (exists (select b from test)) is kept as it is and is only true if there is a match
+    std::vector<AnnotatedExpression> join_predicates;
+    if (mark_join_predicate != nullptr) {
+      if (expr->GetExpressionType() == parser::ExpressionType::COMPARE_IN) {
+        expr->SetExpressionType(parser::ExpressionType::COMPARE_EQUAL);
+      }
+      std::unordered_set<std::string> table_alias_set;
+      QueryToOperatorTransformer::GenerateTableAliasSet(mark_join_predicate, &table_alias_set);
+      join_predicates.emplace_back(mark_join_predicate, std::move(table_alias_set));
+    }
+    op_expr = std::make_unique<OperatorNode>(LogicalMarkJoin::Make(std::move(join_predicates)),
+                                             std::vector<std::unique_ptr<OperatorNode>>{});
   }
-
-  sub_select->Accept(this, parse_result);
+  op_expr->PushChild(std::move(outer_expr));
 
   // Push subquery output
   op_expr->PushChild(std::move(output_expr_));
 
   output_expr_ = std::move(op_expr);
-
-  // Convert subquery to the selected column in the sub-select
-  expr->SetChild(child_id, sub_select->GetSelectColumns().at(0));
   return true;
 }
 
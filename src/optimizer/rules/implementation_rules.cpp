@@ -124,10 +124,17 @@ void LogicalGetToPhysicalIndexScan::Transform(common::ManagedPointer<OperatorNod
       auto indexes = accessor->GetIndexOids(get->GetTableOid());
       for (auto index : indexes) {
         if (IndexUtil::SatisfiesSortWithIndex(accessor, sort_prop, get->GetTableOid(), index)) {
+          // The sort comes from the LIMIT above the get (if it has a scan limit), so the scan can stop once the LIMIT
+          // has all of its tuples
+          auto scan_type = planner::IndexScanType::AscendingOpenBoth;
+          if (IndexUtil::IsDescendingSort(sort_prop)) {
+            scan_type = get->GetScanLimit() > 0 ? planner::IndexScanType::DescendingLimit
+                                                : planner::IndexScanType::Descending;
+          }
           std::vector<AnnotatedExpression> preds = get->GetPredicates();
           auto op = std::make_unique<OperatorNode>(
-              IndexScan::Make(db_oid, ns_oid, get->GetTableOid(), index, std::move(preds), is_update,
-                              planner::IndexScanType::AscendingOpenBoth, {}),
+              IndexScan::Make(db_oid, ns_oid, get->GetTableOid(), index, std::move(preds), is_update, scan_type, {},
+                              get->GetScanLimit()),
               std::vector<std::unique_ptr<OperatorNode>>());
           transformed->emplace_back(std::move(op));
         }
@@ -319,7 +326,7 @@ void LogicalInsertToPhysicalInsert::Transform(common::ManagedPointer<OperatorNod
   std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>> vals = *(insert_op->GetValues());
   auto result = std::make_unique<OperatorNode>(
       Insert::Make(insert_op->GetDatabaseOid(), insert_op->GetNamespaceOid(), insert_op->GetTableOid(), std::move(cols),
-                   std::move(vals), std::move(indexes)),
+                   std::move(vals), insert_op->GetConstantBatch(), std::move(indexes)),
       std::move(c));
   transformed->emplace_back(std::move(result));
 }
@@ -397,6 +404,43 @@ void LogicalGroupByToPhysicalHashGroupBy::Transform(common::ManagedPointer<Opera
   transformed->emplace_back(std::move(result));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// LogicalAggregateAndGroupByToSortGroupBy
+///////////////////////////////////////////////////////////////////////////////
+LogicalGroupByToPhysicalSortGroupBy::LogicalGroupByToPhysicalSortGroupBy() {
+  type_ = RuleType::AGGREGATE_TO_SORT_AGGREGATE;
+  match_pattern_ = new Pattern(OpType::LOGICALAGGREGATEANDGROUPBY);
+
+  auto child = new Pattern(OpType::LEAF);
+  match_pattern_->AddChild(child);
+}
+
+bool LogicalGroupByToPhysicalSortGroupBy::Check(common::ManagedPointer<OperatorNode> plan,
+                                                OptimizationContext *context) const {
+  (void)context;
+  const auto agg_op = plan->GetOp().As<LogicalAggregateAndGroupBy>();
+  return !agg_op->GetColumns().empty();
+}
+
+void LogicalGroupByToPhysicalSortGroupBy::Transform(common::ManagedPointer<OperatorNode> input,
+                                                    std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                                                    UNUSED_ATTRIBUTE OptimizationContext *context) const {
+  const auto agg_op = input->GetOp().As<LogicalAggregateAndGroupBy>();
+  TERRIER_ASSERT(input->GetChildren().size() == 1, "LogicalAggregateAndGroupBy should have 1 child");
+
+  // The child is required to be sorted on the group by columns (see ChildPropertyDeriver), so that the groups can be
+  // aggregated as they stream by.
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> cols = agg_op->GetColumns();
+  std::vector<AnnotatedExpression> having = agg_op->GetHaving();
+
+  std::vector<std::unique_ptr<OperatorNode>> c;
+  auto child = input->GetChildren()[0]->Copy();
+  c.emplace_back(std::move(child));
+
+  auto result = std::make_unique<OperatorNode>(SortGroupBy::Make(std::move(cols), std::move(having)), std::move(c));
+  transformed->emplace_back(std::move(result));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// LogicalAggregateToPhysicalAggregate
 ///////////////////////////////////////////////////////////////////////////////
@@ -533,6 +577,98 @@ void LogicalInnerJoinToPhysicalInnerHashJoin::Transform(common::ManagedPointer<O
   }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// LogicalSemiJoinToPhysicalLeftSemiHashJoin
+///////////////////////////////////////////////////////////////////////////////
+LogicalSemiJoinToPhysicalLeftSemiHashJoin::LogicalSemiJoinToPhysicalLeftSemiHashJoin() {
+  type_ = RuleType::SEMI_JOIN_TO_HASH_JOIN;
+
+  match_pattern_ = new Pattern(OpType::LOGICALSEMIJOIN);
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+}
+
+bool LogicalSemiJoinToPhysicalLeftSemiHashJoin::Check(common::ManagedPointer<OperatorNode> plan,
+                                                      OptimizationContext *context) const {
+  (void)context;
+  (void)plan;
+  return true;
+}
+
+void LogicalSemiJoinToPhysicalLeftSemiHashJoin::Transform(common::ManagedPointer<OperatorNode> input,
+                                                          std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                                                          OptimizationContext *context) const {
+  const auto semi_join = input->GetOp().As<LogicalSemiJoin>();
+
+  auto children = input->GetChildren();
+  TERRIER_ASSERT(children.size() == 2, "Semi Join should have two child");
+  auto left_group_id = children[0]->GetOp().As<LeafOperator>()->GetOriginGroup();
+  auto right_group_id = children[1]->GetOp().As<LeafOperator>()->GetOriginGroup();
+  auto &left_group_alias = context->GetOptimizerContext()->GetMemo().GetGroupByID(left_group_id)->GetTableAliases();
+  auto &right_group_alias = context->GetOptimizerContext()->GetMemo().GetGroupByID(right_group_id)->GetTableAliases();
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys;
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys;
+
+  std::vector<AnnotatedExpression> join_preds = semi_join->GetJoinPredicates();
+  OptimizerUtil::ExtractEquiJoinKeys(join_preds, &left_keys, &right_keys, left_group_alias, right_group_alias);
+
+  TERRIER_ASSERT(right_keys.size() == left_keys.size(), "# left/right keys should equal");
+  std::vector<std::unique_ptr<OperatorNode>> child;
+  child.emplace_back(children[0]->Copy());
+  child.emplace_back(children[1]->Copy());
+  if (!left_keys.empty()) {
+    auto result = std::make_unique<OperatorNode>(
+        LeftSemiHashJoin::Make(std::move(join_preds), std::move(left_keys), std::move(right_keys)), std::move(child));
+    transformed->emplace_back(std::move(result));
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// LogicalAntiJoinToPhysicalLeftAntiHashJoin
+///////////////////////////////////////////////////////////////////////////////
+LogicalAntiJoinToPhysicalLeftAntiHashJoin::LogicalAntiJoinToPhysicalLeftAntiHashJoin() {
+  type_ = RuleType::ANTI_JOIN_TO_HASH_JOIN;
+
+  match_pattern_ = new Pattern(OpType::LOGICALANTIJOIN);
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+}
+
+bool LogicalAntiJoinToPhysicalLeftAntiHashJoin::Check(common::ManagedPointer<OperatorNode> plan,
+                                                      OptimizationContext *context) const {
+  (void)context;
+  (void)plan;
+  return true;
+}
+
+void LogicalAntiJoinToPhysicalLeftAntiHashJoin::Transform(common::ManagedPointer<OperatorNode> input,
+                                                          std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                                                          OptimizationContext *context) const {
+  const auto anti_join = input->GetOp().As<LogicalAntiJoin>();
+
+  auto children = input->GetChildren();
+  TERRIER_ASSERT(children.size() == 2, "Anti Join should have two child");
+  auto left_group_id = children[0]->GetOp().As<LeafOperator>()->GetOriginGroup();
+  auto right_group_id = children[1]->GetOp().As<LeafOperator>()->GetOriginGroup();
+  auto &left_group_alias = context->GetOptimizerContext()->GetMemo().GetGroupByID(left_group_id)->GetTableAliases();
+  auto &right_group_alias = context->GetOptimizerContext()->GetMemo().GetGroupByID(right_group_id)->GetTableAliases();
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys;
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys;
+
+  std::vector<AnnotatedExpression> join_preds = anti_join->GetJoinPredicates();
+  OptimizerUtil::ExtractEquiJoinKeys(join_preds, &left_keys, &right_keys, left_group_alias, right_group_alias);
+
+  TERRIER_ASSERT(right_keys.size() == left_keys.size(), "# left/right keys should equal");
+  std::vector<std::unique_ptr<OperatorNode>> child;
+  child.emplace_back(children[0]->Copy());
+  child.emplace_back(children[1]->Copy());
+  if (!left_keys.empty()) {
+    auto result = std::make_unique<OperatorNode>(
+        LeftAntiHashJoin::Make(std::move(join_preds), std::move(left_keys), std::move(right_keys)), std::move(child));
+    transformed->emplace_back(std::move(result));
+  }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// LogicalLimitToPhysicalLimit
 ///////////////////////////////////////////////////////////////////////////////
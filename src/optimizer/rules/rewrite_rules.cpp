@@ -207,6 +207,72 @@ void RewritePushExplicitFilterThroughJoin::Transform(common::ManagedPointer<Oper
   transformed->emplace_back(std::move(output));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// RewritePushFilterThroughSemiJoin
+///////////////////////////////////////////////////////////////////////////////
+RewritePushFilterThroughSemiJoin::RewritePushFilterThroughSemiJoin(OpType join_type) {
+  TERRIER_ASSERT(join_type == OpType::LOGICALSEMIJOIN || join_type == OpType::LOGICALANTIJOIN,
+                 "Join should be a semi or anti join");
+  type_ = RuleType::PUSH_FILTER_THROUGH_SEMI_JOIN;
+
+  auto *join_pattern = new Pattern(join_type);
+  join_pattern->AddChild(new Pattern(OpType::LEAF));
+  join_pattern->AddChild(new Pattern(OpType::LEAF));
+
+  match_pattern_ = new Pattern(OpType::LOGICALFILTER);
+  match_pattern_->AddChild(join_pattern);
+}
+
+bool RewritePushFilterThroughSemiJoin::Check(common::ManagedPointer<OperatorNode> plan,
+                                             OptimizationContext *context) const {
+  (void)plan;
+  (void)context;
+  return true;
+}
+
+void RewritePushFilterThroughSemiJoin::Transform(common::ManagedPointer<OperatorNode> input,
+                                                 std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                                                 OptimizationContext *context) const {
+  OPTIMIZER_LOG_TRACE("RewritePushFilterThroughSemiJoin::Transform");
+
+  auto &memo = context->GetOptimizerContext()->GetMemo();
+  auto join_op_expr = input->GetChildren()[0];
+  auto join_children = join_op_expr->GetChildren();
+  auto left_group_id = join_children[0]->GetOp().As<LeafOperator>()->GetOriginGroup();
+  const auto &left_group_aliases_set = memo.GetGroupByID(left_group_id)->GetTableAliases();
+
+  std::vector<AnnotatedExpression> left_predicates;
+  std::vector<AnnotatedExpression> filter_predicates;
+  for (auto &predicate : input->GetOp().As<LogicalFilter>()->GetPredicates()) {
+    if (OptimizerUtil::IsSubset(left_group_aliases_set, predicate.GetTableAliasSet())) {
+      left_predicates.emplace_back(predicate);
+    } else {
+      filter_predicates.emplace_back(predicate);
+    }
+  }
+
+  if (left_predicates.empty()) {
+    // Nothing to push down
+    return;
+  }
+
+  std::vector<std::unique_ptr<OperatorNode>> c;
+  c.emplace_back(join_children[0]->Copy());
+  auto left_branch = std::make_unique<OperatorNode>(LogicalFilter::Make(std::move(left_predicates)), std::move(c));
+
+  std::vector<std::unique_ptr<OperatorNode>> cj;
+  cj.emplace_back(std::move(left_branch));
+  cj.emplace_back(join_children[1]->Copy());
+  auto output = std::make_unique<OperatorNode>(Operator(join_op_expr->GetOp()), std::move(cj));
+
+  if (!filter_predicates.empty()) {
+    std::vector<std::unique_ptr<OperatorNode>> cf;
+    cf.emplace_back(std::move(output));
+    output = std::make_unique<OperatorNode>(LogicalFilter::Make(std::move(filter_predicates)), std::move(cf));
+  }
+  transformed->emplace_back(std::move(output));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// RewritePushFilterThroughAggregation
 ///////////////////////////////////////////////////////////////////////////////
@@ -348,6 +414,48 @@ void RewriteEmbedFilterIntoGet::Transform(common::ManagedPointer<OperatorNode> i
   transformed->emplace_back(std::move(output));
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// RewriteEmbedLimitIntoGet
+///////////////////////////////////////////////////////////////////////////////
+RewriteEmbedLimitIntoGet::RewriteEmbedLimitIntoGet() {
+  type_ = RuleType::EMBED_LIMIT_INTO_GET;
+
+  match_pattern_ = new Pattern(OpType::LOGICALLIMIT);
+  auto child = new Pattern(OpType::LOGICALGET);
+
+  match_pattern_->AddChild(child);
+}
+
+bool RewriteEmbedLimitIntoGet::Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const {
+  (void)context;
+  auto limit = plan->GetOp().As<LogicalLimit>();
+  auto get = plan->GetChildren()[0]->GetOp().As<LogicalGet>();
+
+  // Without a sort, any LIMIT tuples will do and the scan isn't asked for an order. With predicates, the index scan
+  // fetches tuples before they are filtered, so it can't stop early.
+  if (limit->GetSortExpressions().empty() || limit->GetLimit() == 0) return false;
+  if (get->GetTableOid() == catalog::INVALID_TABLE_OID || !get->GetPredicates().empty()) return false;
+  return get->GetScanLimit() == 0;
+}
+
+void RewriteEmbedLimitIntoGet::Transform(common::ManagedPointer<OperatorNode> input,
+                                         std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                                         UNUSED_ATTRIBUTE OptimizationContext *context) const {
+  auto limit = input->GetOp().As<LogicalLimit>();
+  auto get = input->GetChildren()[0]->GetOp().As<LogicalGet>();
+  auto scan_limit = static_cast<uint32_t>(limit->GetOffset() + limit->GetLimit());
+
+  std::vector<std::unique_ptr<OperatorNode>> c;
+  c.emplace_back(std::make_unique<OperatorNode>(
+      LogicalGet::Make(get->GetDatabaseOid(), get->GetNamespaceOid(), get->GetTableOid(), get->GetPredicates(),
+                       get->GetTableAlias(), get->GetIsForUpdate(), scan_limit),
+      std::vector<std::unique_ptr<OperatorNode>>()));
+
+  // The limit stays on top, it still applies the OFFSET
+  auto output = std::make_unique<OperatorNode>(Operator(input->GetOp()), std::move(c));
+  transformed->emplace_back(std::move(output));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// RewritePullFilterThroughMarkJoin
 ///////////////////////////////////////////////////////////////////////////////
@@ -382,8 +490,11 @@ void RewritePullFilterThroughMarkJoin::Transform(common::ManagedPointer<Operator
                                                  std::vector<std::unique_ptr<OperatorNode>> *transformed,
                                                  UNUSED_ATTRIBUTE OptimizationContext *context) const {
   OPTIMIZER_LOG_TRACE("RewritePullFilterThroughMarkJoin::Transform");
-  UNUSED_ATTRIBUTE auto mark_join = input->GetOp().As<LogicalMarkJoin>();
-  TERRIER_ASSERT(mark_join->GetJoinPredicates().empty(), "MarkJoin should have zero children");
+  auto mark_join = input->GetOp().As<LogicalMarkJoin>();
+  if (!mark_join->GetJoinPredicates().empty()) {
+    // The filter is split up by UnnestMarkJoinToSemiJoin
+    return;
+  }
 
   auto join_children = input->GetChildren();
   auto filter_children = join_children[1]->GetChildren();
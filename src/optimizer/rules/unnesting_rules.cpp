@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "catalog/catalog_accessor.h"
+#include "common/exception.h"
 #include "loggers/optimizer_logger.h"
 #include "optimizer/group_expression.h"
 #include "optimizer/index_util.h"
@@ -20,6 +21,113 @@
 
 namespace terrier::optimizer {
 
+///////////////////////////////////////////////////////////////////////////////
+/// UnnestMarkJoinToSemiJoin
+///////////////////////////////////////////////////////////////////////////////
+UnnestMarkJoinToSemiJoin::UnnestMarkJoinToSemiJoin() {
+  type_ = RuleType::MARK_JOIN_TO_SEMI_JOIN;
+
+  match_pattern_ = new Pattern(OpType::LOGICALMARKJOIN);
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+  match_pattern_->AddChild(new Pattern(OpType::LEAF));
+}
+
+RulePromise UnnestMarkJoinToSemiJoin::Promise(GroupExpression *group_expr) const {
+  return RulePromise::UNNEST_PROMISE_HIGH;
+}
+
+bool UnnestMarkJoinToSemiJoin::Check(common::ManagedPointer<OperatorNode> plan, OptimizationContext *context) const {
+  (void)context;
+  (void)plan;
+
+  UNUSED_ATTRIBUTE auto children = plan->GetChildren();
+  TERRIER_ASSERT(children.size() == 2, "LogicalMarkJoin should have 2 children");
+  return true;
+}
+
+void UnnestMarkJoinToSemiJoin::Transform(common::ManagedPointer<OperatorNode> input,
+                                         std::vector<std::unique_ptr<OperatorNode>> *transformed,
+                                         OptimizationContext *context) const {
+  OPTIMIZER_LOG_TRACE("UnnestMarkJoinToSemiJoin::Transform");
+  auto mark_join = input->GetOp().As<LogicalMarkJoin>();
+  if (mark_join->GetJoinPredicates().empty()) {
+    // Not generated for a predicate, unnested by UnnestMarkJoinToInnerJoin
+    return;
+  }
+
+  auto &memo = context->GetOptimizerContext()->GetMemo();
+  auto join_children = input->GetChildren();
+  auto left_group_id = join_children[0]->GetOp().As<LeafOperator>()->GetOriginGroup();
+  auto right_group_id = join_children[1]->GetOp().As<LeafOperator>()->GetOriginGroup();
+
+  // The correlated predicates of the sub-select, i.e. the ones that reference the outer query, become join
+  // predicates. The rewrite phase keeps a single expression per group, which we can look at.
+  std::vector<AnnotatedExpression> join_predicates;
+  std::vector<AnnotatedExpression> right_predicates;
+  group_id_t right_child_group_id = right_group_id;
+  auto right_expr = memo.GetGroupByID(right_group_id)->GetLogicalExpression();
+  if (right_expr->Op().GetType() == OpType::LOGICALFILTER) {
+    right_child_group_id = right_expr->GetChildGroupId(0);
+    const auto &right_child_aliases = memo.GetGroupByID(right_child_group_id)->GetTableAliases();
+    for (auto &predicate : right_expr->Op().As<LogicalFilter>()->GetPredicates()) {
+      if (OptimizerUtil::IsSubset(right_child_aliases, predicate.GetTableAliasSet())) {
+        right_predicates.emplace_back(predicate);
+      } else {
+        join_predicates.emplace_back(predicate);
+      }
+    }
+  }
+
+  std::unique_ptr<OperatorNode> right_branch;
+  if (join_predicates.empty()) {
+    // Not correlated, the sub-select is kept as it is
+    right_branch = join_children[1]->Copy();
+  } else if (right_predicates.empty()) {
+    right_branch = std::make_unique<OperatorNode>(LeafOperator::Make(right_child_group_id),
+                                                  std::vector<std::unique_ptr<OperatorNode>>{});
+  } else {
+    std::vector<std::unique_ptr<OperatorNode>> c;
+    c.emplace_back(std::make_unique<OperatorNode>(LeafOperator::Make(right_child_group_id),
+                                                  std::vector<std::unique_ptr<OperatorNode>>{}));
+    right_branch = std::make_unique<OperatorNode>(LogicalFilter::Make(std::move(right_predicates)), std::move(c));
+  }
+
+  // (a IN (select b ...)) was turned into (a = b) and is a join predicate, (EXISTS b) holds for any match
+  bool anti = false;
+  for (auto &predicate : mark_join->GetJoinPredicates()) {
+    auto expr_type = predicate.GetExpr()->GetExpressionType();
+    if (expr_type == parser::ExpressionType::OPERATOR_NOT) {
+      anti = true;
+    } else if (expr_type != parser::ExpressionType::OPERATOR_EXISTS) {
+      join_predicates.emplace_back(predicate);
+    }
+  }
+
+  // Semi and anti joins are only implemented as hash joins
+  const auto &left_group_aliases = memo.GetGroupByID(left_group_id)->GetTableAliases();
+  const auto &right_group_aliases = memo.GetGroupByID(right_group_id)->GetTableAliases();
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> left_keys;
+  std::vector<common::ManagedPointer<parser::AbstractExpression>> right_keys;
+  OptimizerUtil::ExtractEquiJoinKeys(join_predicates, &left_keys, &right_keys, left_group_aliases,
+                                     right_group_aliases);
+
+  std::vector<std::unique_ptr<OperatorNode>> c;
+  c.emplace_back(join_children[0]->Copy());
+  c.emplace_back(std::move(right_branch));
+  std::unique_ptr<OperatorNode> output;
+  if (!left_keys.empty()) {
+    auto join = anti ? LogicalAntiJoin::Make(std::move(join_predicates))
+                     : LogicalSemiJoin::Make(std::move(join_predicates));
+    output = std::make_unique<OperatorNode>(std::move(join), std::move(c));
+  } else if (anti) {
+    throw NOT_IMPLEMENTED_EXCEPTION("NOT EXISTS without an equality between the sub-select and the query");
+  } else {
+    // TODO(boweic): An inner join outputs an outer tuple once per match of the sub-select
+    output = std::make_unique<OperatorNode>(LogicalInnerJoin::Make(std::move(join_predicates)), std::move(c));
+  }
+  transformed->emplace_back(std::move(output));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// UnnestMarkJoinToInnerJoin
 ///////////////////////////////////////////////////////////////////////////////
@@ -48,8 +156,11 @@ void UnnestMarkJoinToInnerJoin::Transform(common::ManagedPointer<OperatorNode> i
                                           std::vector<std::unique_ptr<OperatorNode>> *transformed,
                                           UNUSED_ATTRIBUTE OptimizationContext *context) const {
   OPTIMIZER_LOG_TRACE("UnnestMarkJoinToInnerJoin::Transform");
-  UNUSED_ATTRIBUTE auto mark_join = input->GetOp().As<LogicalMarkJoin>();
-  TERRIER_ASSERT(mark_join->GetJoinPredicates().empty(), "MarkJoin should have 0 predicates");
+  auto mark_join = input->GetOp().As<LogicalMarkJoin>();
+  if (!mark_join->GetJoinPredicates().empty()) {
+    // Unnested by UnnestMarkJoinToSemiJoin
+    return;
+  }
 
   auto join_children = input->GetChildren();
   std::vector<std::unique_ptr<OperatorNode>> c;
@@ -146,6 +146,34 @@ void StatsCalculator::Visit(const LogicalInnerJoin *op) {
   // TODO(boweic): calculate stats based on predicates other than join conditions
 }
 
+void StatsCalculator::Visit(UNUSED_ATTRIBUTE const LogicalSemiJoin *op) { DeriveForFilteringJoin(); }
+
+void StatsCalculator::Visit(UNUSED_ATTRIBUTE const LogicalAntiJoin *op) { DeriveForFilteringJoin(); }
+
+void StatsCalculator::DeriveForFilteringJoin() {
+  TERRIER_ASSERT(gexpr_->GetChildrenGroupsSize() == 2, "Join must have two children");
+  auto left_child_group = context_->GetMemo().GetGroupByID(gexpr_->GetChildGroupId(0));
+  auto root_group = context_->GetMemo().GetGroupByID(gexpr_->GetGroupID());
+  if (root_group->GetNumRows() == -1) {
+    root_group->SetNumRows(left_child_group->GetNumRows());
+  }
+
+  for (auto &col : required_cols_) {
+    TERRIER_ASSERT(col->GetExpressionType() == parser::ExpressionType::COLUMN_VALUE, "CVE expected");
+    auto col_name = col.CastManagedPointerTo<parser::ColumnValueExpression>()->GetFullName();
+
+    // Make a copy from the child stats
+    auto child_group = left_child_group;
+    if (!child_group->HasColumnStats(col_name)) {
+      child_group = context_->GetMemo().GetGroupByID(gexpr_->GetChildGroupId(1));
+      TERRIER_ASSERT(child_group->HasColumnStats(col_name), "Name must be in right group");
+    }
+    auto stats = std::make_unique<ColumnStats>(*child_group->GetStats(col_name));
+    stats->SetNumRows(root_group->GetNumRows());
+    root_group->AddStats(col_name, std::move(stats));
+  }
+}
+
 void StatsCalculator::Visit(UNUSED_ATTRIBUTE const LogicalAggregateAndGroupBy *op) {
   // TODO(boweic): For now we just pass the stats needed without any computation, need implement aggregate stats
   TERRIER_ASSERT(gexpr_->GetChildrenGroupsSize() == 1, "Aggregate must have 1 child");
@@ -404,6 +404,18 @@ std::unique_ptr<AbstractExpression> PostgresParser::AExprTransform(ParseResult *
     children.emplace_back(ExprTransform(parse_result, root->rexpr_, nullptr));
   } else if (root->kind_ == AEXPR_OP && root->type_ == T_TypeCast) {
     target_type = ExpressionType::OPERATOR_CAST;
+  } else if (root->kind_ == AEXPR_IN) {
+    // a [NOT] IN (b, c, ...), the name is "=" for IN and "<>" for NOT IN
+    children.emplace_back(ExprTransform(parse_result, root->lexpr_, nullptr));
+    auto list = reinterpret_cast<List *>(root->rexpr_);
+    for (auto cell = list->head; cell != nullptr; cell = cell->next) {
+      children.emplace_back(ExprTransform(parse_result, reinterpret_cast<Node *>(cell->data.ptr_value), nullptr));
+    }
+    auto name = (reinterpret_cast<value *>(root->name_->head->data.ptr_value))->val_.str_;
+    if (std::string(name) != "=") {
+      throw NOT_IMPLEMENTED_EXCEPTION("AExprTransform: NOT IN is not supported");
+    }
+    return std::make_unique<ComparisonExpression>(ExpressionType::COMPARE_IN, std::move(children));
   } else {
     auto name = (reinterpret_cast<value *>(root->name_->head->data.ptr_value))->val_.str_;
     target_type = StringToExpressionType(name);
@@ -690,36 +702,24 @@ std::unique_ptr<AbstractExpression> PostgresParser::TypeCastTransform(ParseResul
 
 // Postgres.value -> terrier.ConstantValueExpression
 std::unique_ptr<AbstractExpression> PostgresParser::ValueTransform(ParseResult *parse_result, value val) {
-  std::unique_ptr<AbstractExpression> result;
-  switch (val.type_) {
-    case T_Integer: {
-      auto v = type::TransientValueFactory::GetInteger(val.val_.ival_);
-      result = std::make_unique<ConstantValueExpression>(std::move(v));
-      break;
-    }
-
-    case T_String: {
-      auto v = type::TransientValueFactory::GetVarChar(val.val_.str_);
-      result = std::make_unique<ConstantValueExpression>(std::move(v));
-      break;
-    }
-
-    case T_Float: {
-      auto v = type::TransientValueFactory::GetDecimal(std::stod(val.val_.str_));
-      result = std::make_unique<ConstantValueExpression>(std::move(v));
-      break;
-    }
+  return std::make_unique<ConstantValueExpression>(TransientValueTransform(val));
+}
 
-    case T_Null: {
-      auto v = type::TransientValueFactory::GetNull(type::TypeId::INVALID);
-      result = std::make_unique<ConstantValueExpression>(std::move(v));
-      break;
-    }
+// Postgres.value -> terrier.TransientValue
+type::TransientValue PostgresParser::TransientValueTransform(value val) {
+  switch (val.type_) {
+    case T_Integer:
+      return type::TransientValueFactory::GetInteger(val.val_.ival_);
+    case T_String:
+      return type::TransientValueFactory::GetVarChar(val.val_.str_);
+    case T_Float:
+      return type::TransientValueFactory::GetDecimal(std::stod(val.val_.str_));
+    case T_Null:
+      return type::TransientValueFactory::GetNull(type::TypeId::INVALID);
     default: {
       PARSER_LOG_AND_THROW("ValueTransform", "Value type", val.type_);
     }
   }
-  return result;
 }
 
 std::unique_ptr<SelectStatement> PostgresParser::SelectTransform(ParseResult *parse_result, SelectStmt *root) {
@@ -1836,8 +1836,15 @@ std::unique_ptr<InsertStatement> PostgresParser::InsertTransform(ParseResult *pa
   } else {
     // directly insert some values
     TERRIER_ASSERT(select_stmt->values_lists_ != nullptr, "Must have values to insert.");
-    auto insert_values = ValueListsTransform(parse_result, select_stmt->values_lists_);
-    result = std::make_unique<InsertStatement>(std::move(column_names), std::move(table_ref), std::move(insert_values));
+    auto constant_batch = ConstantBatchTransform(select_stmt->values_lists_);
+    if (constant_batch != nullptr) {
+      result =
+          std::make_unique<InsertStatement>(std::move(column_names), std::move(table_ref), std::move(constant_batch));
+    } else {
+      auto insert_values = ValueListsTransform(parse_result, select_stmt->values_lists_);
+      result =
+          std::make_unique<InsertStatement>(std::move(column_names), std::move(table_ref), std::move(insert_values));
+    }
   }
 
   return result;
@@ -1905,6 +1912,33 @@ PostgresParser::ValueListsTransform(ParseResult *parse_result, List *root) {
   return result;
 }
 
+// Transforms value lists made only of constants into a ConstantBatch. A bulk INSERT of thousands of rows would
+// otherwise allocate (and then bind, plan and generate code for) one expression per value.
+std::unique_ptr<ConstantBatch> PostgresParser::ConstantBatchTransform(List *root) {
+  if (root->length < static_cast<int>(CONSTANT_BATCH_MIN_ROWS)) return nullptr;
+
+  const auto num_columns = reinterpret_cast<List *>(root->head->data.ptr_value)->length;
+  for (auto value_list = root->head; value_list != nullptr; value_list = value_list->next) {
+    auto target = reinterpret_cast<List *>(value_list->data.ptr_value);
+    if (target->length != num_columns) return nullptr;
+    for (auto cell = target->head; cell != nullptr; cell = cell->next) {
+      if (reinterpret_cast<Node *>(cell->data.ptr_value)->type != T_A_Const) return nullptr;
+    }
+  }
+
+  auto result =
+      std::make_unique<ConstantBatch>(static_cast<uint32_t>(root->length), static_cast<uint32_t>(num_columns));
+  uint32_t row = 0;
+  for (auto value_list = root->head; value_list != nullptr; value_list = value_list->next, row++) {
+    uint32_t col = 0;
+    auto target = reinterpret_cast<List *>(value_list->data.ptr_value);
+    for (auto cell = target->head; cell != nullptr; cell = cell->next, col++) {
+      result->SetValue(row, col, TransientValueTransform(reinterpret_cast<A_Const *>(cell->data.ptr_value)->val_));
+    }
+  }
+  return result;
+}
+
 std::unique_ptr<TransactionStatement> PostgresParser::TransactionTransform(TransactionStmt *transaction_stmt) {
   std::unique_ptr<TransactionStatement> result;
 
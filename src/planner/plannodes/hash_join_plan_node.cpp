@@ -19,6 +19,8 @@ common::hash_t HashJoinPlanNode::Hash() const {
     hash = common::HashUtil::CombineHashes(hash, right_hash_key->Hash());
   }
 
+  hash = common::HashUtil::CombineHashes(hash, common::HashUtil::Hash(use_concise_ht_));
+
   return hash;
 }
 
@@ -39,13 +41,14 @@ bool HashJoinPlanNode::operator==(const AbstractPlanNode &rhs) const {
     if (*right_hash_keys_[i] != *other.right_hash_keys_[i]) return false;
   }
 
-  return true;
+  return use_concise_ht_ == other.use_concise_ht_;
 }
 
 nlohmann::json HashJoinPlanNode::ToJson() const {
   nlohmann::json j = AbstractJoinPlanNode::ToJson();
   j["left_hash_keys"] = left_hash_keys_;
   j["right_hash_keys"] = right_hash_keys_;
+  j["use_concise_ht"] = use_concise_ht_;
   return j;
 }
 
@@ -78,6 +81,7 @@ std::vector<std::unique_ptr<parser::AbstractExpression>> HashJoinPlanNode::FromJ
     }
   }
 
+  use_concise_ht_ = j.at("use_concise_ht").get<bool>();
   return exprs;
 }
 
@@ -34,6 +34,7 @@ common::hash_t InsertPlanNode::Hash() const {
       hash = common::HashUtil::CombineHashes(hash, val->Hash());
     }
   }
+  if (constant_batch_ != nullptr) hash = common::HashUtil::CombineHashes(hash, constant_batch_->Hash());
 
   return hash;
 }
@@ -64,6 +65,10 @@ bool InsertPlanNode::operator==(const AbstractPlanNode &rhs) const {
     }
   }
 
+  // Constant batch
+  if ((constant_batch_ == nullptr) != (other.constant_batch_ == nullptr)) return false;
+  if (constant_batch_ != nullptr && !(*constant_batch_ == *other.constant_batch_)) return false;
+
   // Parameter info
   if (parameter_info_.size() != other.parameter_info_.size()) return false;
 
@@ -90,6 +95,7 @@ nlohmann::json InsertPlanNode::ToJson() const {
     values.emplace_back(std::move(tuple_json));
   }
   j["values"] = values;
+  j["constant_batch"] = constant_batch_ == nullptr ? nlohmann::json(nullptr) : constant_batch_->ToJson();
   j["parameter_info"] = parameter_info_;
   return j;
 }
@@ -116,6 +122,11 @@ std::vector<std::unique_ptr<parser::AbstractExpression>> InsertPlanNode::FromJso
     values_.push_back(std::move(tuple));
   }
 
+  if (!j.at("constant_batch").is_null()) {
+    deserialized_constant_batch_ = parser::ConstantBatch::FromJson(j.at("constant_batch"));
+    constant_batch_ = common::ManagedPointer<parser::ConstantBatch>(deserialized_constant_batch_.get());
+  }
+
   parameter_info_ = j.at("parameter_info").get<std::vector<catalog::col_oid_t>>();
   return exprs;
 }
@@ -30,8 +30,12 @@ void BlockCompactor::ProcessCompactionQueue(transaction::DeferredActionManager *
         // frozen blocks. Although code can be reused for doing the compaction, some logic needs to be
         // written to enqueue these frozen blocks into the compaction queue.
         cg.blocks_to_compact_.emplace(block, std::vector<uint32_t>());
+        // Take the block out of the free-space map, so inserts do not race with us for its empty slots.
+        block->data_table_->ClearFreeSlots(block);
         if (EliminateGaps(&cg)) {
           controller.GetBlockState()->store(BlockState::COOLING);
+          // Slots may have been released while we were compacting. Gaps in cooling blocks are ours to fill.
+          block->data_table_->ClearFreeSlots(block);
           // If no compaction was performed, we still need to shut out any potentially racey transactions that
           // are alive at the same time as us flipping the block status flag to cooling. However, we must manually
           // ask the GC to enqueue this block, because no access will be observed from the empty compaction transaction.
@@ -40,6 +44,16 @@ void BlockCompactor::ProcessCompactionQueue(transaction::DeferredActionManager *
           txn_manager->Commit(cg.txn_, transaction::TransactionUtil::EmptyCallback, nullptr);
         } else {
           txn_manager->Abort(cg.txn_);
+          // The block stays hot, so hand its gaps back to the free-space map once the aborted moves are no longer
+          // visible to anyone.
+          DataTable *table = block->data_table_;
+          auto *slots = new std::vector<TupleSlot>;
+          for (auto &entry : cg.blocks_to_compact_)
+            for (uint32_t offset : entry.second) slots->emplace_back(entry.first, offset);
+          deferred_action_manager->RegisterDeferredAction([=]() {
+            table->ReleaseSlots(*slots);
+            delete slots;
+          });
         }
         break;
       }
@@ -183,8 +197,8 @@ bool BlockCompactor::MoveTuple(CompactionGroup *cg, TupleSlot from, TupleSlot to
   }
 
   // Copy the tuple into the empty slot
-  // This operation cannot fail since a logically deleted slot can only be reclaimed by the compaction thread
-  accessor.Reallocate(to);
+  // This can only fail if an insert reused the slot through the free-space map after we started compacting
+  if (!accessor.Reallocate(to)) return false;
   cg->table_->InsertInto(common::ManagedPointer(cg->txn_), *record->Delta(), to);
 
   // The delete can fail if a concurrent transaction is updating said tuple. We will have to abort if this is
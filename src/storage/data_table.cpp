@@ -1,6 +1,8 @@
 #include "storage/data_table.h"
 
-#include <list>
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 #include "common/allocator.h"
 #include "storage/block_access_controller.h"
@@ -19,18 +21,22 @@ DataTable::DataTable(const common::ManagedPointer<BlockStore> store, const Block
   if (block_store_ != nullptr) {
     RawBlock *new_block = NewBlock();
     // insert block
-    blocks_.push_back(new_block);
+    AppendBlock(new_block);
+    unclaimed_block_.store(new_block);
   }
-  insertion_head_ = blocks_.begin();
 }
 
 DataTable::~DataTable() {
-  common::SpinLatch::ScopedSpinLatch guard(&blocks_latch_);
-  for (RawBlock *block : blocks_) {
+  BlockNode *node = blocks_head_.next_.load();
+  while (node != nullptr) {
+    RawBlock *block = node->block_;
     StorageUtil::DeallocateVarlens(block, accessor_);
     for (col_id_t i : accessor_.GetBlockLayout().Varlens())
       accessor_.GetArrowBlockMetadata(block).GetColumnInfo(accessor_.GetBlockLayout(), i).Deallocate();
     block_store_->Release(block);
+    BlockNode *next = node->next_.load();
+    delete node;
+    node = next;
   }
 }
 
@@ -42,11 +48,13 @@ bool DataTable::Select(const common::ManagedPointer<transaction::TransactionCont
 
 void DataTable::Scan(const common::ManagedPointer<transaction::TransactionContext> txn, SlotIterator *const start_pos,
                      ProjectedColumns *const out_buffer) const {
-  // TODO(Tianyu): So far this is not that much better than tuple-at-a-time access,
-  // but can be improved if block is read-only, or if we implement version synopsis, to just use std::memcpy when it's
-  // safe
+  // Take the end of the table once. Tuples inserted after this point cannot be visible to the caller anyway, and the
+  // rest of the scan then only follows next_ pointers of the block list and reads the blocks themselves.
+  const SlotIterator end_pos = end();
   uint32_t filled = 0;
-  while (filled < out_buffer->MaxTuples() && *start_pos != end()) {
+  while (filled < out_buffer->MaxTuples() && *start_pos != end_pos) {
+    // Blocks without versions are copied a range of slots at a time, everything else is read tuple by tuple
+    if (ScanVersionFreeBlock(start_pos, end_pos, out_buffer, &filled)) continue;
     ProjectedColumns::RowView row = out_buffer->InterpretAsRow(filled);
     const TupleSlot slot = **start_pos;
     // Only fill the buffer with valid, visible tuples
@@ -59,32 +67,90 @@ void DataTable::Scan(const common::ManagedPointer<transaction::TransactionContex
   out_buffer->SetNumTuples(filled);
 }
 
+bool DataTable::ScanVersionFreeBlock(SlotIterator *const start_pos, const SlotIterator &end_pos,
+                                     ProjectedColumns *const out_buffer, uint32_t *const filled) const {
+  RawBlock *const block = start_pos->current_slot_.GetBlock();
+  if (block->num_versions_.load() != 0) return false;
+
+  const uint32_t num_slots = accessor_.GetBlockLayout().NumSlots();
+  const uint32_t limit = end_pos.block_ == start_pos->block_ ? end_pos.current_slot_.GetOffset() : num_slots;
+  common::RawConcurrentBitmap *const allocated = accessor_.AllocationBitmap(block);
+  common::RawConcurrentBitmap *const present = accessor_.ColumnNullBitmap(block, VERSION_POINTER_COLUMN_ID);
+
+  // With no version chains in the block, a tuple is visible exactly if its slot is allocated and it is not deleted.
+  // Every run of such tuples is copied one column at a time.
+  const uint32_t first_filled = *filled;
+  uint32_t offset = start_pos->current_slot_.GetOffset();
+  while (offset < limit && *filled < out_buffer->MaxTuples()) {
+    if (!allocated->Test(offset) || !present->Test(offset)) {
+      offset++;
+      continue;
+    }
+    const uint32_t run_start = offset;
+    const uint32_t run_limit = std::min(limit, run_start + out_buffer->MaxTuples() - *filled);
+    while (offset < run_limit && allocated->Test(offset) && present->Test(offset)) offset++;
+    CopyVersionFreeRange(block, run_start, offset - run_start, out_buffer, *filled);
+    *filled += offset - run_start;
+  }
+
+  // A writer always counts its version before it installs it and touches the tuple, and the GC cannot remove a version
+  // newer than the calling transaction. If the count is still zero, nothing we copied has changed underneath us.
+  // Otherwise, we throw away what we copied and let the caller read the block tuple by tuple.
+  if (block->num_versions_.load() != 0) {
+    *filled = first_filled;
+    return false;
+  }
+
+  if (offset == num_slots) {
+    start_pos->block_ = start_pos->block_->next_.load();
+    start_pos->current_slot_ = {start_pos->block_ == nullptr ? nullptr : start_pos->block_->block_, 0};
+  } else {
+    start_pos->current_slot_ = {block, offset};
+  }
+  return true;
+}
+
+void DataTable::CopyVersionFreeRange(RawBlock *const block, const uint32_t offset, const uint32_t num_tuples,
+                                     ProjectedColumns *const out_buffer, const uint32_t out_offset) const {
+  for (uint16_t i = 0; i < out_buffer->NumColumns(); i++) {
+    const col_id_t col_id = out_buffer->ColumnIds()[i];
+    TERRIER_ASSERT(col_id != VERSION_POINTER_COLUMN_ID, "Output buffer should not read the version pointer column.");
+    const uint16_t attr_size = accessor_.GetBlockLayout().AttrSize(col_id);
+    // Values of null attributes are copied along with the rest, the null bitmap tells readers to ignore them
+    std::memcpy(out_buffer->ColumnStart(i) + out_offset * attr_size,
+                accessor_.ColumnStart(block, col_id) + offset * attr_size, num_tuples * attr_size);
+    common::RawConcurrentBitmap *const nulls = accessor_.ColumnNullBitmap(block, col_id);
+    common::RawBitmap *const out_nulls = out_buffer->ColumnNullBitmap(i);
+    for (uint32_t j = 0; j < num_tuples; j++) out_nulls->Set(out_offset + j, nulls->Test(offset + j));
+  }
+  for (uint32_t j = 0; j < num_tuples; j++) out_buffer->TupleSlots()[out_offset + j] = {block, offset + j};
+}
+
 DataTable::SlotIterator &DataTable::SlotIterator::operator++() {
-  common::SpinLatch::ScopedSpinLatch guard(&table_->blocks_latch_);
   // Jump to the next block if already the last slot in the block.
   if (current_slot_.GetOffset() == table_->accessor_.GetBlockLayout().NumSlots() - 1) {
-    ++block_;
+    block_ = block_->next_.load();
     // Cannot dereference if the next block is end(), so just use nullptr to denote
-    current_slot_ = {block_ == table_->blocks_.end() ? nullptr : *block_, 0};
+    current_slot_ = {block_ == nullptr ? nullptr : block_->block_, 0};
   } else {
-    current_slot_ = {*block_, current_slot_.GetOffset() + 1};
+    current_slot_ = {block_->block_, current_slot_.GetOffset() + 1};
   }
   return *this;
 }
 
 DataTable::SlotIterator DataTable::end() const {  // NOLINT for STL name compability
-  common::SpinLatch::ScopedSpinLatch guard(&blocks_latch_);
   // TODO(Tianyu): Need to look in detail at how this interacts with compaction when that gets in.
 
   // The end iterator could either point to an unfilled slot in a block, or point to nothing if every block in the
-  // table is full. In the case that it points to nothing, we will use the end-iterator of the blocks list and
-  // 0 to denote that this is the case. This solution makes increment logic simple and natural.
-  if (blocks_.empty()) return {this, blocks_.end(), 0};
-  auto last_block = --blocks_.end();
-  uint32_t insert_head = (*last_block)->GetInsertHead();
+  // table is full. In the case that it points to nothing, we will use nullptr as the block and 0 to denote that this is
+  // the case. This solution makes increment logic simple and natural.
+  const BlockNode *last_block = LastBlock();
+  if (last_block == nullptr) return {this, nullptr, 0};
+  uint32_t insert_head = last_block->block_->GetInsertHead();
   // Last block is full, return the default end iterator that doesn't point to anything
-  if (insert_head == accessor_.GetBlockLayout().NumSlots()) return {this, blocks_.end(), 0};
-  // Otherwise, insert head points to the slot that will be inserted next, which would be exactly what we want.
+  if (insert_head == accessor_.GetBlockLayout().NumSlots()) return {this, nullptr, 0};
+  // Otherwise, insert head points to the slot that will be inserted next, which would be exactly what we want. Blocks
+  // before the last one may still be filled by their owning threads, but those inserts cannot be visible to the caller.
   return {this, last_block, insert_head};
 }
 
@@ -130,82 +196,83 @@ bool DataTable::Update(const common::ManagedPointer<transaction::TransactionCont
   return true;
 }
 
-void DataTable::CheckMoveHead(std::list<RawBlock *>::iterator block) {
-  // Assume block is full
-  common::SpinLatch::ScopedSpinLatch guard_head(&header_latch_);
-  if (block == insertion_head_) {
-    // If the header block is full, move the header to point to the next block
-    insertion_head_++;
-  }
-
-  // If there are no more free blocks, create a new empty block and  point the insertion_head to it
-  if (insertion_head_ == blocks_.end()) {
-    RawBlock *new_block = NewBlock();
-    // take latch
-    common::SpinLatch::ScopedSpinLatch guard_block(&blocks_latch_);
-    // insert block
-    blocks_.push_back(new_block);
-    // set insertion header to --end()
-    insertion_head_ = --blocks_.end();
-  }
-}
-
 TupleSlot DataTable::Insert(const common::ManagedPointer<transaction::TransactionContext> txn,
                             const ProjectedRow &redo) {
   TERRIER_ASSERT(redo.NumColumns() == accessor_.GetBlockLayout().NumColumns() - NUM_RESERVED_COLUMNS,
                  "The input buffer never changes the version pointer column, so it should have  exactly 1 fewer "
                  "attribute than the DataTable's layout.");
 
-  // Insertion header points to the first block that has free tuple slots
-  // Once a txn arrives, it will start from the insertion header to find the first
-  // idle (no other txn is trying to get tuple slots in that block) and non-full block.
-  // If no such block is found, the txn will create a new block.
-  // Before the txn writes to the block, it will set block status to busy.
-  // The first bit of block insert_head_ is used to indicate if the block is busy
-  // If the first bit is 1, it indicates one txn is writing to the block.
-
   TupleSlot result;
-  auto block = insertion_head_;
-  while (true) {
-    // No free block left
-    if (block == blocks_.end()) {
-      RawBlock *new_block = NewBlock();
-      TERRIER_ASSERT(accessor_.SetBlockBusyStatus(new_block), "Status of new block should not be busy");
-      // No need to flip the busy status bit
-      accessor_.Allocate(new_block, &result);
-      // take latch
-      common::SpinLatch::ScopedSpinLatch guard(&blocks_latch_);
-      // insert block
-      blocks_.push_back(new_block);
-      block = --blocks_.end();
-      break;
-    }
-
-    if (accessor_.SetBlockBusyStatus(*block)) {
-      // No one is inserting into this block
-      if (accessor_.Allocate(*block, &result)) {
-        // The block is not full, succeed
-        break;
-      }
-      // Fail to insert into the block, flip back the status bit
-      accessor_.ClearBlockBusyStatus(*block);
-      // if the full block is the insertion_header, move the insertion_header
-      // Next insert txn will search from the new insertion_header
-      CheckMoveHead(block);
-    }
-    // The block is full or the block is being inserted by other txn, try next block
-    ++block;
+  // Slots reclaimed by the GC are reused before we try to append to the end of the table, so that table size stays
+  // proportional to the number of live tuples.
+  if (AllocateFromFreeSlots(&result)) {
+    // The block could have been picked up by the compactor since it was put into the free-space map. We follow the
+    // same protocol as other writers and heat it back up.
+    result.GetBlock()->controller_.WaitUntilHot();
+    InsertInto(txn, redo, result);
+    data_table_counter_.IncrementNumInsert(1);
+    data_table_counter_.IncrementNumSlotReuse(1);
+    return result;
   }
 
-  // Do not need to wait unit finish inserting,
-  // can flip back the status bit once the thread gets the allocated tuple slot
-  accessor_.ClearBlockBusyStatus(*block);
+  // Every thread fills its own insertion block, so concurrent inserts into the same table never contend for a block.
+  // Allocate only fails once the block is full, at which point the thread claims a new one.
+  RawBlock *&insertion_block = insertion_blocks_.local();
+  while (insertion_block == nullptr || !accessor_.Allocate(insertion_block, &result))
+    insertion_block = ClaimInsertionBlock();
+
   InsertInto(txn, redo, result);
 
   data_table_counter_.IncrementNumInsert(1);
   return result;
 }
 
+bool DataTable::AllocateFromFreeSlots(TupleSlot *const slot) {
+  // Cheap check so that tables without churn never touch the latch
+  if (num_free_slots_.load() == 0) return false;
+  common::SpinLatch::ScopedSpinLatch guard(&free_slots_latch_);
+  while (!free_slots_.empty()) {
+    auto entry = free_slots_.begin();
+    RawBlock *const block = entry->first;
+    std::set<uint32_t> &offsets = entry->second;
+    // Cooling and frozen blocks are owned by the compactor, which is responsible for filling their gaps.
+    if (block->controller_.GetBlockState()->load() == BlockState::HOT) {
+      common::RawConcurrentBitmap *bitmap = accessor_.AllocationBitmap(block);
+      while (!offsets.empty()) {
+        const uint32_t offset = *offsets.begin();
+        offsets.erase(offsets.begin());
+        num_free_slots_--;
+        // The flip can only fail if someone else reallocated the slot behind our back, in which case we skip it.
+        if (bitmap->Flip(offset, false)) {
+          if (offsets.empty()) free_slots_.erase(entry);
+          *slot = {block, offset};
+          return true;
+        }
+      }
+    }
+    num_free_slots_ -= offsets.size();
+    free_slots_.erase(entry);
+  }
+  return false;
+}
+
+void DataTable::ReleaseSlots(const std::vector<TupleSlot> &slots) {
+  common::SpinLatch::ScopedSpinLatch guard(&free_slots_latch_);
+  for (const TupleSlot slot : slots) {
+    TERRIER_ASSERT(slot.GetBlock()->data_table_ == this, "Can only release slots that belong to this table");
+    if (slot.GetBlock()->controller_.GetBlockState()->load() != BlockState::HOT || accessor_.Allocated(slot)) continue;
+    if (free_slots_[slot.GetBlock()].insert(slot.GetOffset()).second) num_free_slots_++;
+  }
+}
+
+void DataTable::ClearFreeSlots(RawBlock *const block) {
+  common::SpinLatch::ScopedSpinLatch guard(&free_slots_latch_);
+  auto entry = free_slots_.find(block);
+  if (entry == free_slots_.end()) return;
+  num_free_slots_ -= entry->second.size();
+  free_slots_.erase(entry);
+}
+
 void DataTable::InsertInto(const common::ManagedPointer<transaction::TransactionContext> txn, const ProjectedRow &redo,
                            TupleSlot dest) {
   TERRIER_ASSERT(accessor_.Allocated(dest), "destination slot must already be allocated");
@@ -312,6 +379,8 @@ bool DataTable::SelectIntoBuffer(const common::ManagedPointer<transaction::Trans
   }
 
   // Apply deltas until we reconstruct a version safe for us to read
+  UndoRecord *last_applied = nullptr;
+  uint32_t num_applied = 0;
   while (version_ptr != nullptr &&
          transaction::TransactionUtil::NewerThan(version_ptr->Timestamp().load(), txn->StartTime())) {
     switch (version_ptr->Type()) {
@@ -328,12 +397,30 @@ bool DataTable::SelectIntoBuffer(const common::ManagedPointer<transaction::Trans
       default:
         throw std::runtime_error("unexpected delta record type");
     }
+    last_applied = version_ptr;
+    num_applied++;
     version_ptr = version_ptr->Next();
   }
 
+  if (num_applied >= VERSION_CHAIN_PRUNE_THRESHOLD) PruneVersionChain(last_applied, txn->OldestActiveAtStart());
   return visible;
 }
 
+void DataTable::PruneVersionChain(UndoRecord *const from, const transaction::timestamp_t oldest) const {
+  UndoRecord *curr = from;
+  UndoRecord *next;
+  // The version chain is sorted newest-to-oldest, so everything from the first record older than oldest on is
+  // invisible to all running transactions.
+  while ((next = curr->Next().load()) != nullptr) {
+    if (transaction::TransactionUtil::NewerThan(oldest, next->Timestamp().load())) break;
+    curr = next;
+  }
+  // An uncommitted record may still be rolled back, leave its successors to the GC, which handles that case.
+  if (next == nullptr || !transaction::TransactionUtil::Committed(curr->Timestamp().load())) return;
+  curr->Next().store(nullptr);
+  data_table_counter_.IncrementNumVersionChainPrune(1);
+}
+
 template bool DataTable::SelectIntoBuffer<ProjectedRow>(
     const common::ManagedPointer<transaction::TransactionContext> txn, const TupleSlot slot,
     ProjectedRow *const out_buffer) const;
@@ -351,7 +438,11 @@ void DataTable::AtomicallyWriteVersionPtr(const TupleSlot slot, const TupleAcces
                                           UndoRecord *const desired) {
   // Okay to ignore presence bit, because we use that for logical delete, not for validity of the version pointer value
   byte *ptr_location = accessor.AccessWithoutNullCheck(slot, VERSION_POINTER_COLUMN_ID);
-  reinterpret_cast<std::atomic<UndoRecord *> *>(ptr_location)->store(desired);
+  std::atomic<uint64_t> &num_versions = slot.GetBlock()->num_versions_;
+  // Count the new version before it is visible, so that scans relying on the version synopsis notice it
+  if (desired != nullptr) num_versions++;
+  UndoRecord *const previous = reinterpret_cast<std::atomic<UndoRecord *> *>(ptr_location)->exchange(desired);
+  if (previous != nullptr) num_versions--;
 }
 
 bool DataTable::Visible(const TupleSlot slot, const TupleAccessStrategy &accessor) const {
@@ -376,7 +467,17 @@ bool DataTable::CompareAndSwapVersionPtr(const TupleSlot slot, const TupleAccess
                                          UndoRecord *expected, UndoRecord *const desired) {
   // Okay to ignore presence bit, because we use that for logical delete, not for validity of the version pointer value
   byte *ptr_location = accessor.AccessWithoutNullCheck(slot, VERSION_POINTER_COLUMN_ID);
-  return reinterpret_cast<std::atomic<UndoRecord *> *>(ptr_location)->compare_exchange_strong(expected, desired);
+  // Keep the block's version synopsis in sync. A version chain that starts is counted before it is installed, so the
+  // count is never lower than the number of non-null version pointers in the block.
+  std::atomic<uint64_t> &num_versions = slot.GetBlock()->num_versions_;
+  const bool starts_chain = expected == nullptr && desired != nullptr;
+  const bool ends_chain = expected != nullptr && desired == nullptr;
+  if (starts_chain) num_versions++;
+  const bool swapped =
+      reinterpret_cast<std::atomic<UndoRecord *> *>(ptr_location)->compare_exchange_strong(expected, desired);
+  if (starts_chain && !swapped) num_versions--;
+  if (ends_chain && swapped) num_versions--;
+  return swapped;
 }
 
 RawBlock *DataTable::NewBlock() {
@@ -386,6 +487,33 @@ RawBlock *DataTable::NewBlock() {
   return new_block;
 }
 
+void DataTable::AppendBlock(RawBlock *const block) {
+  auto *const node = new BlockNode(block);
+  BlockNode *tail = blocks_tail_.load();
+  BlockNode *expected = nullptr;
+  // The tail may lag behind the actual end of the list, in which case we walk forward until we find the last node
+  while (!tail->next_.compare_exchange_weak(expected, node)) {
+    if (expected != nullptr) tail = expected;
+    expected = nullptr;
+  }
+  // Best effort. If this fails, a concurrent append has already linked its node after ours and will move the tail.
+  blocks_tail_.compare_exchange_strong(tail, node);
+}
+
+const DataTable::BlockNode *DataTable::LastBlock() const {
+  const BlockNode *node = blocks_tail_.load();
+  for (const BlockNode *next = node->next_.load(); next != nullptr; next = next->next_.load()) node = next;
+  return node == &blocks_head_ ? nullptr : node;
+}
+
+RawBlock *DataTable::ClaimInsertionBlock() {
+  RawBlock *block = unclaimed_block_.exchange(nullptr);
+  if (block != nullptr) return block;
+  block = NewBlock();
+  AppendBlock(block);
+  return block;
+}
+
 bool DataTable::HasConflict(const transaction::TransactionContext &txn, const TupleSlot slot) const {
   UndoRecord *const version_ptr = AtomicallyReadVersionPtr(slot, accessor_);
   return HasConflict(txn, version_ptr);
@@ -1,8 +1,12 @@
 #include "storage/garbage_collector.h"
 #include <unordered_set>
 #include <utility>
+#include <vector>
 #include "common/macros.h"
+#include "common/scoped_timer.h"
+#include "common/thread_context.h"
 #include "loggers/storage_logger.h"
+#include "metrics/metrics_store.h"
 #include "storage/data_table.h"
 #include "transaction/deferred_action_manager.h"
 #include "transaction/transaction_context.h"
@@ -13,22 +17,30 @@
 namespace terrier::storage {
 
 std::pair<uint32_t, uint32_t> GarbageCollector::PerformGarbageCollection() {
-  if (observer_ != nullptr) observer_->ObserveGCInvocation();
-  timestamp_manager_->CheckOutTimestamp();
-  const transaction::timestamp_t oldest_txn = timestamp_manager_->OldestTransactionStartTime();
-  uint32_t txns_deallocated = ProcessDeallocateQueue(oldest_txn);
-  STORAGE_LOG_TRACE("GarbageCollector::PerformGarbageCollection(): txns_deallocated: {}", txns_deallocated);
-  uint32_t txns_unlinked = ProcessUnlinkQueue(oldest_txn);
-  STORAGE_LOG_TRACE("GarbageCollector::PerformGarbageCollection(): txns_unlinked: {}", txns_unlinked);
-  if (txns_unlinked > 0) {
-    // Only update this field if we actually unlinked anything, otherwise we're being too conservative about when it's
-    // safe to deallocate the transactions in our queue.
-    last_unlinked_ = timestamp_manager_->CheckOutTimestamp();
+  uint64_t elapsed_us = 0;
+  uint32_t txns_deallocated, txns_unlinked;
+  {
+    common::ScopedTimer<std::chrono::microseconds> timer(&elapsed_us);
+    if (observer_ != nullptr) observer_->ObserveGCInvocation();
+    timestamp_manager_->CheckOutTimestamp();
+    const transaction::timestamp_t oldest_txn = timestamp_manager_->OldestTransactionStartTime();
+    txns_deallocated = ProcessDeallocateQueue(oldest_txn);
+    STORAGE_LOG_TRACE("GarbageCollector::PerformGarbageCollection(): txns_deallocated: {}", txns_deallocated);
+    txns_unlinked = ProcessUnlinkQueue(oldest_txn);
+    STORAGE_LOG_TRACE("GarbageCollector::PerformGarbageCollection(): txns_unlinked: {}", txns_unlinked);
+    if (txns_unlinked > 0) {
+      // Only update this field if we actually unlinked anything, otherwise we're being too conservative about when
+      // it's safe to deallocate the transactions in our queue.
+      last_unlinked_ = timestamp_manager_->CheckOutTimestamp();
+    }
+    STORAGE_LOG_TRACE("GarbageCollector::PerformGarbageCollection(): last_unlinked_: {}",
+                      static_cast<uint64_t>(last_unlinked_));
+    ProcessDeferredActions(oldest_txn);
+    ProcessIndexes();
   }
-  STORAGE_LOG_TRACE("GarbageCollector::PerformGarbageCollection(): last_unlinked_: {}",
-                    static_cast<uint64_t>(last_unlinked_));
-  ProcessDeferredActions(oldest_txn);
-  ProcessIndexes();
+  if (common::thread_context.metrics_store_ != nullptr &&
+      common::thread_context.metrics_store_->ComponentEnabled(metrics::MetricsComponent::GARBAGECOLLECTION))
+    common::thread_context.metrics_store_->RecordGCData(elapsed_us, txns_deallocated, txns_unlinked, unlink_backlog_);
   return std::make_pair(txns_deallocated, txns_unlinked);
 }
 
@@ -39,11 +51,12 @@ uint32_t GarbageCollector::ProcessDeallocateQueue(transaction::timestamp_t oldes
     // All of the transactions in my deallocation queue were unlinked before the oldest running txn in the system, and
     // have been serialized by the log manager. We are now safe to deallocate these txns because no running
     // transaction should hold a reference to them anymore
-    for (auto &txn : txns_to_deallocate_) {
-      delete txn;
-      txns_processed++;
-    }
+    const std::vector<transaction::TransactionContext *> txns(txns_to_deallocate_.begin(), txns_to_deallocate_.end());
     txns_to_deallocate_.clear();
+    RunOnWorkers(num_workers_, [&](const uint32_t worker) {
+      for (size_t i = worker; i < txns.size(); i += num_workers_) delete txns[i];
+    });
+    txns_processed = static_cast<uint32_t>(txns.size());
   }
   return txns_processed;
 }
@@ -58,15 +71,13 @@ uint32_t GarbageCollector::ProcessUnlinkQueue(transaction::timestamp_t oldest_tx
     txns_to_unlink_.splice_after(txns_to_unlink_.cbefore_begin(), std::move(completed_txns));
   }
 
-  uint32_t txns_processed = 0;
+  uint32_t txns_processed = 0, txns_requeued = 0;
   // Certain transactions might not be yet safe to gc. Need to requeue them
   transaction::TransactionQueue requeue;
-  // It is sufficient to truncate each version chain once in a GC invocation because we only read the maximal safe
-  // timestamp once, and the version chain is sorted by timestamp. Here we keep a set of slots to truncate to avoid
-  // wasteful traversals of the version chain.
-  std::unordered_set<TupleSlot> visited_slots;
+  // Transactions whose versions are invisible to every running transaction, unlinked by the workers below
+  std::vector<transaction::TransactionContext *> safe_txns;
 
-  // Process every transaction in the unlink queue
+  // Sort out every transaction in the unlink queue
   while (!txns_to_unlink_.empty()) {
     txn = txns_to_unlink_.front();
     txns_to_unlink_.pop_front();
@@ -77,35 +88,84 @@ uint32_t GarbageCollector::ProcessUnlinkQueue(transaction::timestamp_t oldest_tx
       txns_processed++;
     } else if (transaction::TransactionUtil::NewerThan(oldest_txn, txn->FinishTime())) {
       // Safe to garbage collect.
-      for (auto &undo_record : txn->undo_buffer_) {
-        // It is possible for the table field to be null, for aborted transaction's last conflicting record
-        DataTable *&table = undo_record.Table();
-        // Each version chain needs to be traversed and truncated at most once every GC period. Check
-        // if we have already visited this tuple slot; if not, proceed to prune the version chain.
-        if (table != nullptr && visited_slots.insert(undo_record.Slot()).second)
-          TruncateVersionChain(table, undo_record.Slot(), oldest_txn);
-        // Regardless of the version chain we will need to reclaim deleted slots and any dangling pointers to varlens,
-        // unless the transaction is aborted, and the record holds a version that is still visible.
-        if (!txn->Aborted()) {
-          ReclaimSlotIfDeleted(&undo_record);
-          ReclaimBufferIfVarlen(txn, &undo_record);
-        }
-        if (observer_ != nullptr) observer_->ObserveWrite(undo_record.Slot().GetBlock());
-      }
-      txns_to_deallocate_.push_front(txn);
-      txns_processed++;
+      safe_txns.push_back(txn);
     } else {
       // This is a committed txn that is still visible, requeue for next GC run
       requeue.push_front(txn);
+      txns_requeued++;
     }
   }
 
   // Requeue any txns that we were still visible to running transactions
   txns_to_unlink_ = transaction::TransactionQueue(std::move(requeue));
+  unlink_backlog_ = txns_requeued;
+  if (safe_txns.empty()) return txns_processed;
+
+  std::vector<UnlinkPartition> partitions(num_workers_);
+  for (transaction::TransactionContext *const safe_txn : safe_txns) {
+    for (auto &undo_record : safe_txn->undo_buffer_)
+      partitions[PartitionOf(undo_record)].records_.emplace_back(&undo_record, safe_txn->Aborted());
+  }
+  RunOnWorkers(num_workers_,
+               [&](const uint32_t partition) { UnlinkPartitionOf(oldest_txn, &partitions[partition]); });
+
+  ReclaimedSlots reclaimed_slots;
+  // Every transaction unlinked in this invocation is deallocated in the same later invocation, so it does not matter
+  // which of them ends up owning the outdated varlen buffers.
+  std::vector<const byte *> &loose_ptrs = safe_txns.front()->loose_ptrs_;
+  for (auto &partition : partitions) {
+    for (auto &entry : partition.reclaimed_slots_) {
+      std::vector<TupleSlot> &slots = reclaimed_slots[entry.first];
+      slots.insert(slots.end(), entry.second.begin(), entry.second.end());
+    }
+    loose_ptrs.insert(loose_ptrs.end(), partition.loose_ptrs_.begin(), partition.loose_ptrs_.end());
+    // The observer is not thread-safe, so it only ever hears from the GC thread
+    if (observer_ != nullptr)
+      for (RawBlock *const block : partition.observed_blocks_) observer_->ObserveWrite(block);
+  }
+  for (transaction::TransactionContext *const unlinked : safe_txns) txns_to_deallocate_.push_front(unlinked);
+  txns_processed += static_cast<uint32_t>(safe_txns.size());
+
+  ReleaseReclaimedSlots(&reclaimed_slots);
 
   return txns_processed;
 }
 
+void GarbageCollector::UnlinkPartitionOf(const transaction::timestamp_t oldest_txn,
+                                         UnlinkPartition *const partition) const {
+  for (const auto &[undo_record, aborted] : partition->records_) {
+    // It is possible for the table field to be null, for aborted transaction's last conflicting record
+    DataTable *&table = undo_record->Table();
+    // Each version chain needs to be traversed and truncated at most once every GC period. Check
+    // if we have already visited this tuple slot; if not, proceed to prune the version chain.
+    if (table != nullptr && partition->visited_slots_.insert(undo_record->Slot()).second)
+      TruncateVersionChain(table, undo_record->Slot(), oldest_txn);
+    // Regardless of the version chain we will need to reclaim deleted slots and any dangling pointers to varlens,
+    // unless the transaction is aborted, and the record holds a version that is still visible.
+    if (!aborted) {
+      ReclaimSlotIfDeleted(undo_record, &partition->reclaimed_slots_);
+      ReclaimBufferIfVarlen(&partition->loose_ptrs_, undo_record);
+    }
+    if (observer_ != nullptr) partition->observed_blocks_.push_back(undo_record->Slot().GetBlock());
+  }
+}
+
+uint32_t GarbageCollector::PartitionOf(const UndoRecord &undo_record) const {
+  if (num_workers_ == 1) return 0;
+  // Blocks are aligned to their size, so the low bits of their address carry no information
+  const auto block = reinterpret_cast<uintptr_t>(undo_record.Slot().GetBlock());
+  return static_cast<uint32_t>(block / common::Constants::BLOCK_SIZE % num_workers_);
+}
+
+void GarbageCollector::RunOnWorkers(const uint32_t num_tasks, const std::function<void(uint32_t)> &task) {
+  if (worker_pool_ == nullptr) {
+    for (uint32_t i = 0; i < num_tasks; i++) task(i);
+    return;
+  }
+  for (uint32_t i = 0; i < num_tasks; i++) worker_pool_->SubmitTask([&task, i] { task(i); });
+  worker_pool_->WaitUntilAllFinished();
+}
+
 void GarbageCollector::ProcessDeferredActions(transaction::timestamp_t oldest_txn) {
   if (deferred_action_manager_ != DISABLED) {
     // TODO(Tianyu): Eventually we will remove the GC and implement version chain pruning with deferred actions
@@ -132,15 +192,17 @@ void GarbageCollector::TruncateVersionChain(DataTable *const table, const TupleS
     return;
   }
 
-  // a version chain is guaranteed to not change when not at the head (assuming single-threaded GC), so we are safe
-  // to traverse and update pointers without CAS
+  // Past the head, the only other writers are readers pruning in DataTable::PruneVersionChain. They, like us, only
+  // ever store nullptr into the part of the chain no running transaction can see, so the chain only gets shorter
+  // under us. Re-reading every link is enough to traverse it, and a blind store is safe: if a pruner cut the chain
+  // above curr in the meantime, curr is already unreachable and our store has no effect on readers.
   UndoRecord *curr = version_ptr;
   UndoRecord *next;
   // Traverse until we find the earliest UndoRecord that can be unlinked.
   while (true) {
-    next = curr->Next();
+    next = curr->Next().load();
     // This is a legitimate case where we truncated the version chain but had to restart because the previous head
-    // was aborted.
+    // was aborted, or where a reader already pruned the rest of the chain.
     if (next == nullptr) return;
     if (transaction::TransactionUtil::NewerThan(oldest, next->Timestamp().load())) break;
     curr = next;
@@ -155,11 +217,31 @@ void GarbageCollector::TruncateVersionChain(DataTable *const table, const TupleS
     TruncateVersionChain(table, slot, oldest);
 }
 
-void GarbageCollector::ReclaimSlotIfDeleted(UndoRecord *const undo_record) const {
-  if (undo_record->Type() == DeltaRecordType::DELETE) undo_record->Table()->accessor_.Deallocate(undo_record->Slot());
+void GarbageCollector::ReclaimSlotIfDeleted(UndoRecord *const undo_record, ReclaimedSlots *const reclaimed) const {
+  if (undo_record->Type() != DeltaRecordType::DELETE) return;
+  undo_record->Table()->accessor_.Deallocate(undo_record->Slot());
+  (*reclaimed)[undo_record->Table()].push_back(undo_record->Slot());
+}
+
+void GarbageCollector::ReleaseReclaimedSlots(ReclaimedSlots *const reclaimed) const {
+  for (auto &entry : *reclaimed) {
+    DataTable *const table = entry.first;
+    if (deferred_action_manager_ == DISABLED) {
+      table->ReleaseSlots(entry.second);
+      continue;
+    }
+    // Indexes may still point to the deleted tuples until their deferred deletes are processed, so the slots only
+    // become available to inserts after every action registered before this point has run. The table itself is dropped
+    // with a double deferral, which guarantees it is still around when this action runs.
+    auto *slots = new std::vector<TupleSlot>(std::move(entry.second));
+    deferred_action_manager_->RegisterDeferredAction([=]() {
+      table->ReleaseSlots(*slots);
+      delete slots;
+    });
+  }
 }
 
-void GarbageCollector::ReclaimBufferIfVarlen(transaction::TransactionContext *const txn,
+void GarbageCollector::ReclaimBufferIfVarlen(std::vector<const byte *> *const loose_ptrs,
                                              UndoRecord *const undo_record) const {
   const TupleAccessStrategy &accessor = undo_record->Table()->accessor_;
   const BlockLayout &layout = accessor.GetBlockLayout();
@@ -173,7 +255,7 @@ void GarbageCollector::ReclaimBufferIfVarlen(transaction::TransactionContext *co
         // Okay to include version vector, as it is never varlen
         if (layout.IsVarlen(col_id)) {
           auto *varlen = reinterpret_cast<VarlenEntry *>(accessor.AccessWithNullCheck(undo_record->Slot(), col_id));
-          if (varlen != nullptr && varlen->NeedReclaim()) txn->loose_ptrs_.push_back(varlen->Content());
+          if (varlen != nullptr && varlen->NeedReclaim()) loose_ptrs->push_back(varlen->Content());
         }
       }
       break;
@@ -183,7 +265,7 @@ void GarbageCollector::ReclaimBufferIfVarlen(transaction::TransactionContext *co
         col_id_t col_id = undo_record->Delta()->ColumnIds()[i];
         if (layout.IsVarlen(col_id)) {
           auto *varlen = reinterpret_cast<VarlenEntry *>(undo_record->Delta()->AccessWithNullCheck(i));
-          if (varlen != nullptr && varlen->NeedReclaim()) txn->loose_ptrs_.push_back(varlen->Content());
+          if (varlen != nullptr && varlen->NeedReclaim()) loose_ptrs->push_back(varlen->Content());
         }
       }
       break;
@@ -208,7 +290,11 @@ void GarbageCollector::UnregisterIndexForGC(const common::ManagedPointer<index::
 
 void GarbageCollector::ProcessIndexes() {
   common::SharedLatch::ScopedSharedLatch guard(&indexes_latch_);
-  for (const auto &index : indexes_) index->PerformGarbageCollection();
+  // Indexes collect their garbage independently of each other, so each worker takes a disjoint subset of them
+  const std::vector<common::ManagedPointer<index::Index>> indexes(indexes_.begin(), indexes_.end());
+  RunOnWorkers(num_workers_, [&](const uint32_t worker) {
+    for (size_t i = worker; i < indexes.size(); i += num_workers_) indexes[i]->PerformGarbageCollection();
+  });
 }
 
 }  // namespace terrier::storage
@@ -2,11 +2,13 @@
 
 namespace terrier::storage {
 GarbageCollectorThread::GarbageCollectorThread(const common::ManagedPointer<GarbageCollector> gc,
-                                               const std::chrono::milliseconds gc_period)
+                                               const std::chrono::milliseconds gc_period,
+                                               const common::ManagedPointer<metrics::MetricsManager> metrics_manager)
     : gc_(gc),
       run_gc_(true),
       gc_paused_(false),
       gc_period_(gc_period),
+      metrics_manager_(metrics_manager),
       gc_thread_(std::thread([this] { GCThreadLoop(); })) {}
 
 }  // namespace terrier::storage
@@ -33,6 +33,12 @@ byte *RedoBuffer::NewEntry(const uint32_t size) {
   return last_record_;
 }
 
+void RedoBuffer::DiscardLastEntry() {
+  TERRIER_ASSERT(last_record_ != nullptr, "There is no redo record to discard");
+  buffer_seg_->Unreserve(reinterpret_cast<LogRecord *>(last_record_)->Size());
+  last_record_ = nullptr;
+}
+
 void RedoBuffer::Finalize(bool flush_buffer) {
   if (buffer_seg_ == nullptr) return;  // If we never initialized a buffer (logging was disabled), we don't do anything
   if (log_manager_ != DISABLED && flush_buffer) {
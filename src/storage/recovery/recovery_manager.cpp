@@ -149,8 +149,9 @@ void RecoveryManager::ReplayRedoRecord(transaction::TransactionContext *txn, Log
                    "Redo record must be the same size after staging in recovery");
     TERRIER_ASSERT(memcmp(redo_record->Delta(), staged_record->Delta(), redo_record->Delta()->Size()) == 0,
                    "ProjectedRow of original and staged records must be identical");
-    // Insert will always succeed
-    auto new_tuple_slot = sql_table_ptr->Insert(common::ManagedPointer(txn), staged_record);
+    // Insert will always succeed. Inserts are always logged in the layout of the latest version.
+    auto new_tuple_slot =
+        sql_table_ptr->Insert(common::ManagedPointer(txn), staged_record, sql_table_ptr->LatestLayoutVersion());
     UpdateIndexesOnTable(txn, staged_record->GetDatabaseOid(), staged_record->GetTableOid(), sql_table_ptr,
                          new_tuple_slot, staged_record->Delta(), true /* insert */);
     TERRIER_ASSERT(staged_record->GetTupleSlot() == new_tuple_slot,
@@ -163,7 +164,9 @@ void RecoveryManager::ReplayRedoRecord(transaction::TransactionContext *txn, Log
     // Stage the write. This way the recovery operation is logged if logging is enabled
     auto staged_record = txn->StageRecoveryWrite(record);
     TERRIER_ASSERT(staged_record->GetTupleSlot() == new_tuple_slot, "Staged record must have the mapped tuple slot");
-    bool result UNUSED_ATTRIBUTE = sql_table_ptr->Update(common::ManagedPointer(txn), staged_record);
+    // Updates are logged in the layout of the version the tuple is stored under
+    bool result UNUSED_ATTRIBUTE = sql_table_ptr->Update(common::ManagedPointer(txn), staged_record,
+                                                         new_tuple_slot.GetBlock()->layout_version_);
     TERRIER_ASSERT(result, "Buffered changes should always succeed during commit");
   }
 }
@@ -184,10 +187,10 @@ void RecoveryManager::ReplayDeleteRecord(transaction::TransactionContext *txn, L
   for (const auto &col : schema.GetColumns()) {
     all_table_oids.push_back(col.Oid());
   }
-  auto initializer = sql_table_ptr->InitializerForProjectedRow(all_table_oids);
+  auto initializer = sql_table_ptr->InitializerForProjectedRow(all_table_oids, schema.GetVersion());
   auto *buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
   auto pr = initializer.InitializeRow(buffer);
-  sql_table_ptr->Select(common::ManagedPointer(txn), new_tuple_slot, pr);
+  sql_table_ptr->Select(common::ManagedPointer(txn), new_tuple_slot, pr, schema.GetVersion());
 
   // Delete from the table
   bool result UNUSED_ATTRIBUTE = sql_table_ptr->Delete(common::ManagedPointer(txn), new_tuple_slot);
@@ -315,7 +318,7 @@ void RecoveryManager::UpdateIndexesOnTable(transaction::TransactionContext *txn,
   for (const auto &col : table_schema.GetColumns()) {
     all_table_oids.push_back(col.Oid());
   }
-  auto pr_map = table_ptr->ProjectionMapForOids(all_table_oids);
+  auto pr_map = table_ptr->ProjectionMapForOids(all_table_oids, table_schema.GetVersion());
   TERRIER_ASSERT(pr_map.size() == table_pr->NumColumns(), "Projected row should contain all attributes");
 
   // TODO(Gus): We are going to assume no indexes on expressions below. Having indexes on expressions would require to
@@ -422,7 +425,8 @@ uint32_t RecoveryManager::ProcessSpecialCasePGDatabaseRecord(
 
     // Step 1: Extract inserted values from the PR in redo record
     storage::SqlTable *pg_database = catalog_->databases_;
-    auto pr_map = pg_database->ProjectionMapForOids(GetOidsForRedoRecord(pg_database, redo_record));
+    auto pr_map =
+        pg_database->ProjectionMapForOids(GetOidsForRedoRecord(pg_database, redo_record), INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(pr_map.find(catalog::postgres::DATOID_COL_OID) != pr_map.end(), "PR Map must contain database oid");
     TERRIER_ASSERT(pr_map.find(catalog::postgres::DATNAME_COL_OID) != pr_map.end(),
                    "PR Map must contain database name");
@@ -463,11 +467,12 @@ uint32_t RecoveryManager::ProcessSpecialCasePGDatabaseRecord(
 
   // Step 1: Determine the database oid for the database that is being deleted
   storage::SqlTable *pg_database = catalog_->databases_;
-  auto pr_init = pg_database->InitializerForProjectedRow({catalog::postgres::DATOID_COL_OID});
-  auto pr_map = pg_database->ProjectionMapForOids({catalog::postgres::DATOID_COL_OID});
+  auto pr_init = pg_database->InitializerForProjectedRow({catalog::postgres::DATOID_COL_OID}, INITIAL_LAYOUT_VERSION);
+  auto pr_map = pg_database->ProjectionMapForOids({catalog::postgres::DATOID_COL_OID}, INITIAL_LAYOUT_VERSION);
   auto *buffer = common::AllocationUtil::AllocateAligned(pr_init.ProjectedRowSize());
   auto *pr = pr_init.InitializeRow(buffer);
-  pg_database->Select(common::ManagedPointer(txn), GetTupleSlotMapping(delete_record->GetTupleSlot()), pr);
+  pg_database->Select(common::ManagedPointer(txn), GetTupleSlotMapping(delete_record->GetTupleSlot()), pr,
+                      INITIAL_LAYOUT_VERSION);
   auto db_oid =
       *(reinterpret_cast<catalog::db_oid_t *>(pr->AccessWithNullCheck(pr_map[catalog::postgres::DATOID_COL_OID])));
   delete[] buffer;
@@ -483,7 +488,8 @@ uint32_t RecoveryManager::ProcessSpecialCasePGDatabaseRecord(
           next_redo_record->GetTableOid() == delete_record->GetTableOid() &&
           IsInsertRecord(next_redo_record)) {  // next record is an insert into the same pg_class
         // Step 3: Get the oid and name for the database being created
-        pr_map = pg_database->ProjectionMapForOids(GetOidsForRedoRecord(pg_database, next_redo_record));
+        pr_map = pg_database->ProjectionMapForOids(GetOidsForRedoRecord(pg_database, next_redo_record),
+                                                   INITIAL_LAYOUT_VERSION);
         TERRIER_ASSERT(pr_map.find(catalog::postgres::DATOID_COL_OID) != pr_map.end(), "PR Map must contain class oid");
         TERRIER_ASSERT(pr_map.find(catalog::postgres::DATNAME_COL_OID) != pr_map.end(),
                        "PR Map must contain class name");
@@ -574,11 +580,12 @@ uint32_t RecoveryManager::ProcessSpecialCasePGClassRecord(
         // Step 1: Get the class oid and kind for the object we're updating
         std::vector<catalog::col_oid_t> col_oids = {catalog::postgres::RELOID_COL_OID,
                                                     catalog::postgres::RELKIND_COL_OID};
-        auto pr_init = pg_class_ptr->InitializerForProjectedRow(col_oids);
-        auto pr_map = pg_class_ptr->ProjectionMapForOids(col_oids);
+        auto pr_init = pg_class_ptr->InitializerForProjectedRow(col_oids, INITIAL_LAYOUT_VERSION);
+        auto pr_map = pg_class_ptr->ProjectionMapForOids(col_oids, INITIAL_LAYOUT_VERSION);
         auto *buffer = common::AllocationUtil::AllocateAligned(pr_init.ProjectedRowSize());
         auto *pr = pr_init.InitializeRow(buffer);
-        pg_class_ptr->Select(common::ManagedPointer(txn), GetTupleSlotMapping(redo_record->GetTupleSlot()), pr);
+        pg_class_ptr->Select(common::ManagedPointer(txn), GetTupleSlotMapping(redo_record->GetTupleSlot()), pr,
+                             INITIAL_LAYOUT_VERSION);
         auto class_oid =
             *(reinterpret_cast<uint32_t *>(pr->AccessWithNullCheck(pr_map[catalog::postgres::RELOID_COL_OID])));
         auto class_kind = *(reinterpret_cast<catalog::postgres::ClassKind *>(
@@ -635,13 +642,14 @@ uint32_t RecoveryManager::ProcessSpecialCasePGClassRecord(
             col_oids = {catalog::postgres::INDISUNIQUE_COL_OID, catalog::postgres::INDISPRIMARY_COL_OID,
                         catalog::postgres::INDISEXCLUSION_COL_OID, catalog::postgres::INDIMMEDIATE_COL_OID,
                         catalog::postgres::IND_TYPE_COL_OID};
-            auto pg_index_pr_init = db_catalog->indexes_->InitializerForProjectedRow(col_oids);
-            auto pg_index_pr_map = db_catalog->indexes_->ProjectionMapForOids(col_oids);
+            auto pg_index_pr_init = db_catalog->indexes_->InitializerForProjectedRow(col_oids, INITIAL_LAYOUT_VERSION);
+            auto pg_index_pr_map = db_catalog->indexes_->ProjectionMapForOids(col_oids, INITIAL_LAYOUT_VERSION);
             delete[] buffer;  // Delete old buffer, it won't be large enough for this PR
             buffer = common::AllocationUtil::AllocateAligned(pg_index_pr_init.ProjectedRowSize());
             pr = pg_index_pr_init.InitializeRow(buffer);
             bool result UNUSED_ATTRIBUTE =
-                db_catalog->indexes_->Select(common::ManagedPointer(txn), tuple_slot_result[0], pr);
+                db_catalog->indexes_->Select(common::ManagedPointer(txn), tuple_slot_result[0], pr,
+                                             INITIAL_LAYOUT_VERSION);
             TERRIER_ASSERT(result, "Select into pg_index should succeed during recovery");
             bool is_unique = *(reinterpret_cast<bool *>(
                 pr->AccessWithNullCheck(pg_index_pr_map[catalog::postgres::INDISUNIQUE_COL_OID])));
@@ -704,11 +712,12 @@ uint32_t RecoveryManager::ProcessSpecialCasePGClassRecord(
   auto db_catalog_ptr = GetDatabaseCatalog(txn, delete_record->GetDatabaseOid());
   storage::SqlTable *pg_class = db_catalog_ptr->classes_;
   std::vector<catalog::col_oid_t> col_oids = {catalog::postgres::RELOID_COL_OID, catalog::postgres::RELKIND_COL_OID};
-  auto pr_init = pg_class->InitializerForProjectedRow(col_oids);
-  auto pr_map = pg_class->ProjectionMapForOids(col_oids);
+  auto pr_init = pg_class->InitializerForProjectedRow(col_oids, INITIAL_LAYOUT_VERSION);
+  auto pr_map = pg_class->ProjectionMapForOids(col_oids, INITIAL_LAYOUT_VERSION);
   auto *buffer = common::AllocationUtil::AllocateAligned(pr_init.ProjectedRowSize());
   auto *pr = pr_init.InitializeRow(buffer);
-  pg_class->Select(common::ManagedPointer(txn), GetTupleSlotMapping(delete_record->GetTupleSlot()), pr);
+  pg_class->Select(common::ManagedPointer(txn), GetTupleSlotMapping(delete_record->GetTupleSlot()), pr,
+                   INITIAL_LAYOUT_VERSION);
   auto class_oid = *(reinterpret_cast<uint32_t *>(pr->AccessWithNullCheck(pr_map[catalog::postgres::RELOID_COL_OID])));
   auto class_kind = *(reinterpret_cast<catalog::postgres::ClassKind *>(
       pr->AccessWithNullCheck(pr_map[catalog::postgres::RELKIND_COL_OID])));
@@ -724,7 +733,8 @@ uint32_t RecoveryManager::ProcessSpecialCasePGClassRecord(
           next_redo_record->GetTableOid() == delete_record->GetTableOid() &&
           IsInsertRecord(next_redo_record)) {  // Condition 3: next record is an insert into the same pg_class
         // Step 3: Get the oid and kind of the object being inserted
-        auto pr_map = pg_class->ProjectionMapForOids(GetOidsForRedoRecord(pg_class, next_redo_record));
+        auto pr_map =
+            pg_class->ProjectionMapForOids(GetOidsForRedoRecord(pg_class, next_redo_record), INITIAL_LAYOUT_VERSION);
         TERRIER_ASSERT(pr_map.find(catalog::postgres::RELOID_COL_OID) != pr_map.end(), "PR Map must contain class oid");
         TERRIER_ASSERT(pr_map.find(catalog::postgres::RELNAME_COL_OID) != pr_map.end(),
                        "PR Map must contain class name");
@@ -853,7 +863,7 @@ std::vector<catalog::col_oid_t> RecoveryManager::GetOidsForRedoRecord(storage::S
     col_id_t col_id = record->Delta()->ColumnIds()[i];
     // We should ingore the version pointer column, this is a hidden storage layer column
     if (col_id != VERSION_POINTER_COLUMN_ID) {
-      result.emplace_back(sql_table->OidForColId(col_id));
+      result.emplace_back(sql_table->OidForColId(col_id, INITIAL_LAYOUT_VERSION));
     }
   }
   return result;
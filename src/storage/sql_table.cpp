@@ -1,16 +1,103 @@
 #include "storage/sql_table.h"
 
+#include <cstring>
 #include <map>
+#include <memory>
 #include <set>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "common/allocator.h"
 #include "common/macros.h"
+#include "parser/expression/constant_value_expression.h"
 #include "storage/storage_util.h"
+#include "type/transient_value_peeker.h"
 
 namespace terrier::storage {
 
+namespace {
+// Materializes the default value of a column in its storage format. Returns nullptr if the default is NULL, or is not a
+// constant of the column's type.
+// TODO(Matt): non-constant defaults (e.g. function calls) should be evaluated once per backfilled tuple instead
+std::unique_ptr<byte[]> MaterializeDefault(const catalog::Schema::Column &column) {
+  const auto expr = column.StoredExpression();
+  if (expr == nullptr || expr->GetExpressionType() != parser::ExpressionType::VALUE_CONSTANT) return nullptr;
+  const type::TransientValue value = expr.CastManagedPointerTo<const parser::ConstantValueExpression>()->GetValue();
+  if (value.Null() || value.Type() != column.Type()) return nullptr;
+
+  if (column.Type() == type::TypeId::VARCHAR) {
+    // The VarlenEntry is followed by the content it points to, which lives as long as the SqlTable does
+    const std::string_view content = type::TransientValuePeeker::PeekVarChar(value);
+    const auto size = static_cast<uint32_t>(content.size());
+    auto result = std::make_unique<byte[]>(sizeof(VarlenEntry) + size);
+    byte *const varlen_content = result.get() + sizeof(VarlenEntry);
+    std::memcpy(varlen_content, content.data(), size);
+    *reinterpret_cast<VarlenEntry *>(result.get()) = size <= VarlenEntry::InlineThreshold()
+                                                          ? VarlenEntry::CreateInline(varlen_content, size)
+                                                          : VarlenEntry::Create(varlen_content, size, false);
+    return result;
+  }
+
+  auto result = std::make_unique<byte[]>(column.AttrSize());
+  switch (column.Type()) {
+    case type::TypeId::BOOLEAN:
+      *reinterpret_cast<bool *>(result.get()) = type::TransientValuePeeker::PeekBoolean(value);
+      break;
+    case type::TypeId::TINYINT:
+      *reinterpret_cast<int8_t *>(result.get()) = type::TransientValuePeeker::PeekTinyInt(value);
+      break;
+    case type::TypeId::SMALLINT:
+      *reinterpret_cast<int16_t *>(result.get()) = type::TransientValuePeeker::PeekSmallInt(value);
+      break;
+    case type::TypeId::INTEGER:
+      *reinterpret_cast<int32_t *>(result.get()) = type::TransientValuePeeker::PeekInteger(value);
+      break;
+    case type::TypeId::BIGINT:
+      *reinterpret_cast<int64_t *>(result.get()) = type::TransientValuePeeker::PeekBigInt(value);
+      break;
+    case type::TypeId::DECIMAL:
+      *reinterpret_cast<double *>(result.get()) = type::TransientValuePeeker::PeekDecimal(value);
+      break;
+    case type::TypeId::TIMESTAMP:
+      *reinterpret_cast<type::timestamp_t *>(result.get()) = type::TransientValuePeeker::PeekTimestamp(value);
+      break;
+    case type::TypeId::DATE:
+      *reinterpret_cast<type::date_t *>(result.get()) = type::TransientValuePeeker::PeekDate(value);
+      break;
+    default:
+      return nullptr;
+  }
+  return result;
+}
+}  // namespace
+
 SqlTable::SqlTable(const common::ManagedPointer<BlockStore> store, const catalog::Schema &schema)
     : block_store_(store) {
+  DataTableVersion *const version = CreateVersion(schema, INITIAL_LAYOUT_VERSION);
+  tables_.Insert(INITIAL_LAYOUT_VERSION, version);
+  latest_.store(version);
+}
+
+SqlTable::~SqlTable() {
+  for (auto it = tables_.cbegin(); it != tables_.cend(); ++it) {
+    delete it->second->data_table_;
+    delete it->second;
+  }
+}
+
+layout_version_t SqlTable::UpdateSchema(const catalog::Schema &schema) {
+  const layout_version_t layout_version = LatestLayoutVersion() + 1;
+  DataTableVersion *const version = CreateVersion(schema, layout_version);
+  tables_.Insert(layout_version, version);
+  // Only publish the version once it can be found in tables_, as slots in it will be looked up there
+  latest_.store(version);
+  return layout_version;
+}
+
+SqlTable::DataTableVersion *SqlTable::CreateVersion(const catalog::Schema &schema,
+                                                    const layout_version_t layout_version) const {
   // Begin with the NUM_RESERVED_COLUMNS in the attr_sizes
   std::vector<uint16_t> attr_sizes;
   attr_sizes.reserve(NUM_RESERVED_COLUMNS + schema.GetColumns().size());
@@ -53,26 +140,37 @@ SqlTable::SqlTable(const common::ManagedPointer<BlockStore> store, const catalog
   }
 
   auto layout = storage::BlockLayout(attr_sizes);
-  table_ = {new DataTable(block_store_, layout, layout_version_t(0)), layout, col_oid_to_id};
+  std::vector<catalog::col_oid_t> col_oids(layout.NumColumns(), catalog::INVALID_COLUMN_OID);
+  for (const auto &oid_to_id : col_oid_to_id) col_oids[!oid_to_id.second] = oid_to_id.first;
+  auto *const version = new DataTableVersion{new DataTable(block_store_, layout, layout_version), layout, col_oid_to_id,
+                                             std::move(col_oids), {}};
+  for (const auto &column : schema.GetColumns()) {
+    auto default_value = MaterializeDefault(column);
+    if (default_value != nullptr) version->defaults_.emplace(column.Oid(), std::move(default_value));
+  }
+  return version;
 }
 
-std::vector<col_id_t> SqlTable::ColIdsForOids(const std::vector<catalog::col_oid_t> &col_oids) const {
+std::vector<col_id_t> SqlTable::ColIdsForOids(const std::vector<catalog::col_oid_t> &col_oids,
+                                              const layout_version_t layout_version) const {
   TERRIER_ASSERT(!col_oids.empty(), "Should be used to access at least one column.");
+  const DataTableVersion &version = GetVersion(layout_version);
   std::vector<col_id_t> col_ids;
 
   // Build the input to the initializer constructor
   for (const catalog::col_oid_t col_oid : col_oids) {
-    TERRIER_ASSERT(table_.column_map_.count(col_oid) > 0, "Provided col_oid does not exist in the table.");
-    const col_id_t col_id = table_.column_map_.at(col_oid);
+    TERRIER_ASSERT(version.column_map_.count(col_oid) > 0, "Provided col_oid does not exist in the table.");
+    const col_id_t col_id = version.column_map_.at(col_oid);
     col_ids.push_back(col_id);
   }
 
   return col_ids;
 }
 
-ProjectionMap SqlTable::ProjectionMapForOids(const std::vector<catalog::col_oid_t> &col_oids) {
+ProjectionMap SqlTable::ProjectionMapForOids(const std::vector<catalog::col_oid_t> &col_oids,
+                                             const layout_version_t layout_version) {
   // Resolve OIDs to storage IDs
-  auto col_ids = ColIdsForOids(col_oids);
+  auto col_ids = ColIdsForOids(col_oids, layout_version);
 
   // Use std::map to effectively sort OIDs by their corresponding ID
   std::map<col_id_t, catalog::col_oid_t> inverse_map;
@@ -86,9 +184,265 @@ ProjectionMap SqlTable::ProjectionMapForOids(const std::vector<catalog::col_oid_
   return projection_map;
 }
 
-catalog::col_oid_t SqlTable::OidForColId(const col_id_t col_id) const {
-  const auto oid_to_id = std::find_if(table_.column_map_.cbegin(), table_.column_map_.cend(),
-                                      [&](const auto &oid_to_id) -> bool { return oid_to_id.second == col_id; });
-  return oid_to_id->first;
+catalog::col_oid_t SqlTable::OidForColId(const col_id_t col_id, const layout_version_t layout_version) const {
+  return GetVersion(layout_version).col_oids_[!col_id];
+}
+
+std::vector<col_id_t> SqlTable::ColIdsInVersion(const DataTableVersion &from, const col_id_t *const col_ids,
+                                                const uint16_t num_cols, const DataTableVersion &to) {
+  std::vector<col_id_t> result;
+  result.reserve(num_cols);
+  for (uint16_t i = 0; i < num_cols; i++) {
+    const auto it = to.column_map_.find(from.col_oids_[!col_ids[i]]);
+    if (it != to.column_map_.end()) result.push_back(it->second);
+  }
+  return result;
+}
+
+SqlTable::VersionTranslation SqlTable::Translate(const DataTableVersion &from, const col_id_t *const from_col_ids,
+                                                 const uint16_t num_from, const DataTableVersion &to,
+                                                 const col_id_t *const to_col_ids, const uint16_t num_to) {
+  std::unordered_map<catalog::col_oid_t, uint16_t> from_indexes;
+  for (uint16_t i = 0; i < num_from; i++) from_indexes.emplace(from.col_oids_[!from_col_ids[i]], i);
+
+  VersionTranslation result;
+  result.attr_sizes_.reserve(num_to);
+  for (uint16_t i = 0; i < num_to; i++) {
+    const catalog::col_oid_t col_oid = to.col_oids_[!to_col_ids[i]];
+    result.attr_sizes_.push_back(to.layout_.AttrSize(to_col_ids[i]));
+    const auto from_index = from_indexes.find(col_oid);
+    if (from_index != from_indexes.end()) {
+      result.shared_.emplace_back(from_index->second, i);
+      continue;
+    }
+    const auto default_value = to.defaults_.find(col_oid);
+    result.missing_.emplace_back(i, default_value == to.defaults_.end() ? nullptr : default_value->second.get());
+  }
+  return result;
+}
+
+template <class RowType>
+void SqlTable::ApplyTranslation(const VersionTranslation &translation, const ProjectedRow &from, RowType *const to) {
+  for (const auto &shared : translation.shared_)
+    StorageUtil::CopyWithNullCheck(from.AccessWithNullCheck(shared.first), to,
+                                   translation.attr_sizes_[shared.second], shared.second);
+  for (const auto &missing : translation.missing_)
+    StorageUtil::CopyWithNullCheck(missing.second, to, translation.attr_sizes_[missing.first], missing.first);
+}
+
+template <class RowType>
+bool SqlTable::SelectFromOtherVersion(const common::ManagedPointer<transaction::TransactionContext> txn,
+                                      const TupleSlot slot, RowType *const out_buffer,
+                                      const layout_version_t layout_version) const {
+  const DataTableVersion &from = GetVersion(slot.GetBlock()->layout_version_);
+  const DataTableVersion &to = GetVersion(layout_version);
+
+  // Read the requested columns the stored tuple has. If it has none of them, still read one column so that the
+  // visibility of the tuple is checked.
+  std::vector<col_id_t> col_ids = ColIdsInVersion(to, out_buffer->ColumnIds(), out_buffer->NumColumns(), from);
+  if (col_ids.empty()) col_ids.emplace_back(NUM_RESERVED_COLUMNS);
+  const ProjectedRowInitializer initializer = ProjectedRowInitializer::Create(from.layout_, col_ids);
+  byte *const buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+  ProjectedRow *const row = initializer.InitializeRow(buffer);
+
+  const bool visible = from.data_table_->Select(txn, slot, row);
+  if (visible) {
+    const VersionTranslation translation = Translate(from, row->ColumnIds(), row->NumColumns(), to,
+                                                     out_buffer->ColumnIds(), out_buffer->NumColumns());
+    ApplyTranslation(translation, *row, out_buffer);
+  }
+  delete[] buffer;
+  return visible;
+}
+
+template bool SqlTable::SelectFromOtherVersion<ProjectedRow>(common::ManagedPointer<transaction::TransactionContext>,
+                                                             TupleSlot, ProjectedRow *, layout_version_t) const;
+
+byte *SqlTable::UnstageDelta(const common::ManagedPointer<transaction::TransactionContext> txn,
+                             const RedoRecord &redo) {
+  const ProjectedRow &delta = *(redo.Delta());
+  byte *const buffer = common::AllocationUtil::AllocateAligned(delta.Size());
+  std::memcpy(buffer, &delta, delta.Size());
+  txn->redo_buffer_.DiscardLastEntry();
+  return buffer;
+}
+
+void SqlTable::CopyUnsharedVarlens(const DataTableVersion &version, const VersionTranslation &translation,
+                                   ProjectedRow *const row) {
+  std::vector<bool> shared(row->NumColumns(), false);
+  for (const auto &index : translation.shared_) shared[index.second] = true;
+  for (uint16_t i = 0; i < row->NumColumns(); i++) {
+    if (shared[i] || !version.layout_.IsVarlen(row->ColumnIds()[i])) continue;
+    auto *const varlen = reinterpret_cast<VarlenEntry *>(row->AccessWithNullCheck(i));
+    if (varlen == nullptr || varlen->IsInlined()) continue;
+    const uint32_t size = varlen->Size();
+    byte *const content = new byte[size];
+    std::memcpy(content, varlen->Content(), size);
+    *varlen = VarlenEntry::Create(content, size, true);
+  }
+}
+
+void SqlTable::DeallocateUnsharedVarlens(const DataTableVersion &version, const ProjectedRow &delta,
+                                         const VersionTranslation *const translation) {
+  std::vector<bool> shared(delta.NumColumns(), false);
+  if (translation != nullptr)
+    for (const auto &index : translation->shared_) shared[index.first] = true;
+  for (uint16_t i = 0; i < delta.NumColumns(); i++) {
+    if (shared[i] || !version.layout_.IsVarlen(delta.ColumnIds()[i])) continue;
+    const auto *const varlen = reinterpret_cast<const VarlenEntry *>(delta.AccessWithNullCheck(i));
+    if (varlen != nullptr && varlen->NeedReclaim()) delete[] varlen->Content();
+  }
+}
+
+bool SqlTable::UpdateFromOtherVersion(const common::ManagedPointer<transaction::TransactionContext> txn,
+                                      RedoRecord *const redo, const layout_version_t layout_version,
+                                      TupleSlot *const migrated_slot) const {
+  const TupleSlot slot = redo->GetTupleSlot();
+  const catalog::db_oid_t db_oid = redo->GetDatabaseOid();
+  const catalog::table_oid_t table_oid = redo->GetTableOid();
+  const DataTableVersion &from = GetVersion(layout_version);
+  const DataTableVersion &stored = GetVersion(slot.GetBlock()->layout_version_);
+  const DataTableVersion &latest = *latest_.load();
+  byte *const delta_buffer = UnstageDelta(txn, *redo);
+  const ProjectedRow &delta = *reinterpret_cast<ProjectedRow *>(delta_buffer);
+
+  // The tuple only has to move if the update sets a column the stored tuple lacks, but the latest version has.
+  // Columns that were dropped since are simply not written.
+  bool migrate = false;
+  for (uint16_t i = 0; i < delta.NumColumns() && !migrate; i++) {
+    const catalog::col_oid_t col_oid = from.col_oids_[!delta.ColumnIds()[i]];
+    migrate = stored.column_map_.count(col_oid) == 0 && latest.column_map_.count(col_oid) > 0;
+  }
+
+  if (!migrate) {
+    const std::vector<col_id_t> col_ids = ColIdsInVersion(from, delta.ColumnIds(), delta.NumColumns(), stored);
+    bool result = true;
+    if (col_ids.empty()) {
+      // Only columns that were dropped since are updated, which leaves nothing to write
+      DeallocateUnsharedVarlens(from, delta, nullptr);
+    } else {
+      RedoRecord *const stored_redo =
+          txn->StageWrite(db_oid, table_oid, ProjectedRowInitializer::Create(stored.layout_, col_ids));
+      stored_redo->SetTupleSlot(slot);
+      ProjectedRow *const row = stored_redo->Delta();
+      const VersionTranslation translation =
+          Translate(from, delta.ColumnIds(), delta.NumColumns(), stored, row->ColumnIds(), row->NumColumns());
+      ApplyTranslation(translation, delta, row);
+      DeallocateUnsharedVarlens(from, delta, &translation);
+      result = stored.data_table_->Update(txn, slot, *row);
+    }
+    delete[] delta_buffer;
+    return result;
+  }
+
+  // The tuple moves to the latest layout version. Read the whole tuple in the latest layout (filling in defaults),
+  // apply the update on top, then delete and reinsert it. This is logged as exactly that, which is also how recovery
+  // replays it.
+  std::vector<col_id_t> all_col_ids;
+  all_col_ids.reserve(latest.column_map_.size());
+  for (const auto &oid_to_id : latest.column_map_) all_col_ids.push_back(oid_to_id.second);
+  const ProjectedRowInitializer initializer = ProjectedRowInitializer::Create(latest.layout_, all_col_ids);
+  byte *const buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+  ProjectedRow *const row = initializer.InitializeRow(buffer);
+
+  bool result = SelectFromOtherVersion(txn, slot, row, latest.data_table_->GetLayoutVersion());
+  if (result) {
+    txn->StageDelete(db_oid, table_oid, slot);
+    result = stored.data_table_->Delete(txn, slot);
+  }
+  if (result) {
+    VersionTranslation translation =
+        Translate(from, delta.ColumnIds(), delta.NumColumns(), latest, row->ColumnIds(), row->NumColumns());
+    // Columns the update does not set keep the values just read
+    translation.missing_.clear();
+    ApplyTranslation(translation, delta, row);
+    DeallocateUnsharedVarlens(from, delta, &translation);
+    // The varlens just read belong to the deleted tuple, whose content the GC frees once the delete is unlinked
+    CopyUnsharedVarlens(latest, translation, row);
+
+    RedoRecord *const latest_redo = txn->StageWrite(db_oid, table_oid, initializer);
+    std::memcpy(latest_redo->Delta(), row, initializer.ProjectedRowSize());
+    const TupleSlot new_slot = latest.data_table_->Insert(txn, *(latest_redo->Delta()));
+    latest_redo->SetTupleSlot(new_slot);
+    TERRIER_ASSERT(migrated_slot != nullptr, "Migrating a tuple needs somewhere to return its new slot.");
+    *migrated_slot = new_slot;
+  } else {
+    // The update was not staged anywhere, so nothing else reclaims its varlens
+    DeallocateUnsharedVarlens(from, delta, nullptr);
+  }
+  delete[] buffer;
+  delete[] delta_buffer;
+  return result;
+}
+
+TupleSlot SqlTable::InsertFromOtherVersion(const common::ManagedPointer<transaction::TransactionContext> txn,
+                                           RedoRecord *const redo, const layout_version_t layout_version) const {
+  const catalog::db_oid_t db_oid = redo->GetDatabaseOid();
+  const catalog::table_oid_t table_oid = redo->GetTableOid();
+  const DataTableVersion &from = GetVersion(layout_version);
+  const DataTableVersion &latest = *latest_.load();
+  byte *const delta_buffer = UnstageDelta(txn, *redo);
+  const ProjectedRow &delta = *reinterpret_cast<ProjectedRow *>(delta_buffer);
+
+  std::vector<col_id_t> all_col_ids;
+  all_col_ids.reserve(latest.column_map_.size());
+  for (const auto &oid_to_id : latest.column_map_) all_col_ids.push_back(oid_to_id.second);
+  RedoRecord *const latest_redo =
+      txn->StageWrite(db_oid, table_oid, ProjectedRowInitializer::Create(latest.layout_, all_col_ids));
+  ProjectedRow *const row = latest_redo->Delta();
+
+  const VersionTranslation translation =
+      Translate(from, delta.ColumnIds(), delta.NumColumns(), latest, row->ColumnIds(), row->NumColumns());
+  ApplyTranslation(translation, delta, row);
+  DeallocateUnsharedVarlens(from, delta, &translation);
+  // Defaults point into the SqlTable, but the tuple must own its varlens like any other
+  CopyUnsharedVarlens(latest, translation, row);
+  const TupleSlot slot = latest.data_table_->Insert(txn, *row);
+  latest_redo->SetTupleSlot(slot);
+  delete[] delta_buffer;
+  return slot;
+}
+
+void SqlTable::ScanFromOtherVersion(const common::ManagedPointer<transaction::TransactionContext> txn,
+                                    DataTable::SlotIterator *const start_pos, ProjectedColumns *const out_buffer,
+                                    const layout_version_t layout_version) const {
+  const DataTable *const table = start_pos->table_;
+  const DataTableVersion &from = GetVersion(table->GetLayoutVersion());
+  const DataTableVersion &to = GetVersion(layout_version);
+
+  // Same as SelectFromOtherVersion, but the translation is computed once for the whole invocation
+  std::vector<col_id_t> col_ids = ColIdsInVersion(to, out_buffer->ColumnIds(), out_buffer->NumColumns(), from);
+  if (col_ids.empty()) col_ids.emplace_back(NUM_RESERVED_COLUMNS);
+  const ProjectedRowInitializer initializer = ProjectedRowInitializer::Create(from.layout_, col_ids);
+  byte *const buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+  ProjectedRow *row = initializer.InitializeRow(buffer);
+  const VersionTranslation translation =
+      Translate(from, row->ColumnIds(), row->NumColumns(), to, out_buffer->ColumnIds(), out_buffer->NumColumns());
+
+  uint32_t filled = 0;
+  const DataTable::SlotIterator end = table->end();
+  while (filled < out_buffer->MaxTuples() && *start_pos != end) {
+    const TupleSlot slot = **start_pos;
+    row = initializer.InitializeRow(buffer);
+    // Only fill the buffer with valid, visible tuples
+    if (table->Select(txn, slot, row)) {
+      ProjectedColumns::RowView out_row = out_buffer->InterpretAsRow(filled);
+      ApplyTranslation(translation, *row, &out_row);
+      out_buffer->TupleSlots()[filled] = slot;
+      filled++;
+    }
+    ++(*start_pos);
+  }
+  out_buffer->SetNumTuples(filled);
+  delete[] buffer;
+}
+
+void SqlTable::SkipExhaustedVersions(DataTable::SlotIterator *const it) const {
+  const layout_version_t latest = LatestLayoutVersion();
+  layout_version_t layout_version = it->table_->GetLayoutVersion();
+  while (layout_version != latest && *it == it->table_->end()) {
+    layout_version++;
+    *it = GetVersion(layout_version).data_table_->begin();
+  }
 }
 }  // namespace terrier::storage
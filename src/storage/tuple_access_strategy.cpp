@@ -28,6 +28,7 @@ void TupleAccessStrategy::InitializeRawBlock(storage::DataTable *const data_tabl
   raw->layout_version_ = layout_version;
   raw->insert_head_ = 0;
   raw->controller_.Initialize();
+  raw->num_versions_ = 0;
   auto *result = reinterpret_cast<TupleAccessStrategy::Block *>(raw);
   result->GetArrowBlockMetadata().Initialize(GetBlockLayout().NumColumns());
   for (uint16_t i = 0; i < layout_.NumColumns(); i++) result->AttrOffsets(layout_)[i] = column_offsets_[i];
@@ -0,0 +1,438 @@
+#include "traffic_cop/point_query.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "catalog/catalog_accessor.h"
+#include "common/allocator.h"
+#include "execution/sql/value.h"
+#include "network/postgres/postgres_packet_writer.h"
+#include "optimizer/index_util.h"
+#include "parser/expression/column_value_expression.h"
+#include "parser/expression/constant_value_expression.h"
+#include "parser/select_statement.h"
+#include "parser/update_statement.h"
+#include "storage/index/index.h"
+#include "storage/sql_table.h"
+#include "transaction/transaction_context.h"
+#include "type/transient_value_peeker.h"
+#include "type/type_util.h"
+
+namespace terrier::trafficcop {
+
+namespace {
+bool IsIntegral(const type::TypeId type) {
+  return type == type::TypeId::TINYINT || type == type::TypeId::SMALLINT || type == type::TypeId::INTEGER ||
+         type == type::TypeId::BIGINT;
+}
+
+int64_t PeekIntegral(const type::TransientValue &value) {
+  switch (value.Type()) {
+    case type::TypeId::TINYINT:
+      return type::TransientValuePeeker::PeekTinyInt(value);
+    case type::TypeId::SMALLINT:
+      return type::TransientValuePeeker::PeekSmallInt(value);
+    case type::TypeId::INTEGER:
+      return type::TransientValuePeeker::PeekInteger(value);
+    case type::TypeId::BIGINT:
+      return type::TransientValuePeeker::PeekBigInt(value);
+    default:
+      UNREACHABLE("Not an integral type.");
+  }
+}
+
+template <typename T>
+bool StoreIntegral(const int64_t value, uint64_t *const result) {
+  if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max()) return false;
+  const T narrowed = static_cast<T>(value);
+  std::memcpy(result, &narrowed, sizeof(T));
+  return true;
+}
+
+catalog::table_oid_t TableOidFor(const common::ManagedPointer<catalog::CatalogAccessor> accessor,
+                                 const common::ManagedPointer<parser::TableRef> table_ref) {
+  const std::string namespace_name = table_ref->GetNamespaceName();
+  if (namespace_name.empty()) return accessor->GetTableOid(table_ref->GetTableName());
+  const catalog::namespace_oid_t ns_oid = accessor->GetNamespaceOid(namespace_name);
+  if (ns_oid == catalog::INVALID_NAMESPACE_OID) return catalog::INVALID_TABLE_OID;
+  return accessor->GetTableOid(ns_oid, table_ref->GetTableName());
+}
+
+bool IsSupportedType(const type::TypeId type) {
+  return IsIntegral(type) || type == type::TypeId::BOOLEAN || type == type::TypeId::DECIMAL ||
+         type == type::TypeId::DATE || type == type::TypeId::TIMESTAMP || type == type::TypeId::VARCHAR;
+}
+}  // namespace
+
+std::unique_ptr<PointQuery> PointQuery::Match(const common::ManagedPointer<catalog::CatalogAccessor> accessor,
+                                              const catalog::db_oid_t db_oid,
+                                              const common::ManagedPointer<parser::SQLStatement> statement) {
+  switch (statement->GetType()) {
+    case parser::StatementType::SELECT:
+      return MatchSelect(accessor, db_oid, statement.CastManagedPointerTo<parser::SelectStatement>());
+    case parser::StatementType::UPDATE:
+      return MatchUpdate(accessor, db_oid, statement.CastManagedPointerTo<parser::UpdateStatement>());
+    default:
+      return nullptr;
+  }
+}
+
+std::unique_ptr<PointQuery> PointQuery::MatchSelect(const common::ManagedPointer<catalog::CatalogAccessor> accessor,
+                                                    const catalog::db_oid_t db_oid,
+                                                    const common::ManagedPointer<parser::SelectStatement> statement) {
+  // A plain SELECT from a single base table
+  const auto table_ref = statement->GetSelectTable();
+  if (table_ref == nullptr || table_ref->GetTableReferenceType() != parser::TableReferenceType::NAME) return nullptr;
+  if (statement->IsSelectDistinct() || statement->GetSelectGroupBy() != nullptr ||
+      statement->GetSelectOrderBy() != nullptr || statement->GetSelectLimit() != nullptr ||
+      statement->GetUnionSelect() != nullptr || statement->GetSelectCondition() == nullptr)
+    return nullptr;
+
+  const catalog::table_oid_t table_oid = TableOidFor(accessor, table_ref);
+  if (table_oid == catalog::INVALID_TABLE_OID) return nullptr;
+  const auto &schema = accessor->GetSchema(table_oid);
+
+  // Only base columns of that table in the select list
+  std::vector<catalog::col_oid_t> col_oids;
+  std::unordered_set<catalog::col_oid_t> projected;
+  for (const auto &expr : statement->GetSelectColumns()) {
+    if (expr->GetExpressionType() != parser::ExpressionType::COLUMN_VALUE) return nullptr;
+    const auto column = expr.CastManagedPointerTo<parser::ColumnValueExpression>();
+    if (column->GetTableOid() != table_oid) return nullptr;
+    if (!IsSupportedType(schema.GetColumn(column->GetColumnOid()).Type())) return nullptr;
+    if (projected.insert(column->GetColumnOid()).second) col_oids.push_back(column->GetColumnOid());
+  }
+  if (col_oids.empty()) return nullptr;
+
+  std::unordered_map<catalog::col_oid_t, common::ManagedPointer<parser::ConstantValueExpression>> equalities;
+  if (!CollectEqualities(statement->GetSelectCondition(), table_oid, &equalities)) return nullptr;
+
+  auto result = std::unique_ptr<PointQuery>(
+      new PointQuery(network::QueryType::QUERY_SELECT, db_oid, table_oid, accessor->GetTable(table_oid),
+                     schema.GetVersion()));
+  if (!result->MatchIndex(accessor, equalities)) return nullptr;
+
+  result->initializer_ = std::make_unique<storage::ProjectedRowInitializer>(
+      result->table_->InitializerForProjectedRow(col_oids, result->layout_version_));
+  const storage::ProjectionMap projection_map = result->table_->ProjectionMapForOids(col_oids, result->layout_version_);
+  for (const auto &expr : statement->GetSelectColumns()) {
+    const auto col_oid = expr.CastManagedPointerTo<parser::ColumnValueExpression>()->GetColumnOid();
+    result->output_columns_.emplace_back(expr->GetExpressionName(), schema.GetColumn(col_oid).Type(), expr->Copy());
+    result->output_indexes_.push_back(projection_map.at(col_oid));
+  }
+  return result;
+}
+
+std::unique_ptr<PointQuery> PointQuery::MatchUpdate(const common::ManagedPointer<catalog::CatalogAccessor> accessor,
+                                                    const catalog::db_oid_t db_oid,
+                                                    const common::ManagedPointer<parser::UpdateStatement> statement) {
+  const auto table_ref = statement->GetUpdateTable();
+  if (table_ref == nullptr || table_ref->GetTableReferenceType() != parser::TableReferenceType::NAME ||
+      statement->GetUpdateCondition() == nullptr)
+    return nullptr;
+
+  const catalog::table_oid_t table_oid = TableOidFor(accessor, table_ref);
+  if (table_oid == catalog::INVALID_TABLE_OID) return nullptr;
+  const auto &schema = accessor->GetSchema(table_oid);
+  // An update can move a tuple to a newer layout version, which would also have to move its index entries. That only
+  // happens once the table's schema was changed, so leave such tables to the general path.
+  if (accessor->GetTable(table_oid)->LatestLayoutVersion() != storage::INITIAL_LAYOUT_VERSION) return nullptr;
+
+  std::unordered_map<catalog::col_oid_t, common::ManagedPointer<parser::ConstantValueExpression>> equalities;
+  if (!CollectEqualities(statement->GetUpdateCondition(), table_oid, &equalities)) return nullptr;
+
+  auto result = std::unique_ptr<PointQuery>(new PointQuery(
+      network::QueryType::QUERY_UPDATE, db_oid, table_oid, accessor->GetTable(table_oid), schema.GetVersion()));
+  if (!result->MatchIndex(accessor, equalities)) return nullptr;
+
+  // Only constant assignments to columns that no index covers, so that the update never has to touch an index
+  std::unordered_set<catalog::col_oid_t> indexed_cols;
+  for (const auto &index : accessor->GetIndexes(table_oid)) {
+    if (!optimizer::IndexUtil::SatisfiesBaseColumnRequirement(index.second)) return nullptr;
+    std::vector<catalog::col_oid_t> mapped_cols;
+    std::unordered_map<catalog::col_oid_t, catalog::indexkeycol_oid_t> lookup;
+    if (!optimizer::IndexUtil::ConvertIndexKeyOidToColOid(accessor.Get(), table_oid, index.second, &lookup,
+                                                          &mapped_cols))
+      return nullptr;
+    indexed_cols.insert(mapped_cols.cbegin(), mapped_cols.cend());
+  }
+
+  std::vector<catalog::col_oid_t> col_oids;
+  std::vector<StoredValue> values;
+  for (const auto &clause : statement->GetUpdateClauses()) {
+    const auto &column = schema.GetColumn(clause->GetColumnName());
+    if (indexed_cols.count(column.Oid()) > 0 || !IsSupportedType(column.Type())) return nullptr;
+    if (std::find(col_oids.cbegin(), col_oids.cend(), column.Oid()) != col_oids.cend()) return nullptr;
+    const auto value = clause->GetUpdateValue();
+    if (value->GetExpressionType() != parser::ExpressionType::VALUE_CONSTANT) return nullptr;
+    StoredValue stored;
+    if (!ConvertConstant(value.CastManagedPointerTo<parser::ConstantValueExpression>()->GetValue(), column.Type(),
+                         &stored))
+      return nullptr;
+    // Let the general path report NOT NULL violations
+    if (stored.is_null_ && !column.Nullable()) return nullptr;
+    col_oids.push_back(column.Oid());
+    values.emplace_back(std::move(stored));
+  }
+  if (col_oids.empty()) return nullptr;
+
+  result->initializer_ = std::make_unique<storage::ProjectedRowInitializer>(
+      result->table_->InitializerForProjectedRow(col_oids, result->layout_version_));
+  const storage::ProjectionMap projection_map = result->table_->ProjectionMapForOids(col_oids, result->layout_version_);
+  for (uint32_t i = 0; i < col_oids.size(); i++)
+    result->update_values_.emplace_back(projection_map.at(col_oids[i]), std::move(values[i]));
+  return result;
+}
+
+bool PointQuery::CollectEqualities(
+    const common::ManagedPointer<parser::AbstractExpression> expr, const catalog::table_oid_t table_oid,
+    std::unordered_map<catalog::col_oid_t, common::ManagedPointer<parser::ConstantValueExpression>> *const equalities) {
+  switch (expr->GetExpressionType()) {
+    case parser::ExpressionType::CONJUNCTION_AND:
+      for (const auto &child : expr->GetChildren())
+        if (!CollectEqualities(child, table_oid, equalities)) return false;
+      return true;
+    case parser::ExpressionType::COMPARE_EQUAL: {
+      auto column = expr->GetChild(0);
+      auto constant = expr->GetChild(1);
+      if (column->GetExpressionType() == parser::ExpressionType::VALUE_CONSTANT) std::swap(column, constant);
+      if (column->GetExpressionType() != parser::ExpressionType::COLUMN_VALUE ||
+          constant->GetExpressionType() != parser::ExpressionType::VALUE_CONSTANT)
+        return false;
+      const auto column_value = column.CastManagedPointerTo<parser::ColumnValueExpression>();
+      if (column_value->GetTableOid() != table_oid) return false;
+      return equalities
+          ->emplace(column_value->GetColumnOid(), constant.CastManagedPointerTo<parser::ConstantValueExpression>())
+          .second;
+    }
+    default:
+      return false;
+  }
+}
+
+bool PointQuery::MatchIndex(
+    const common::ManagedPointer<catalog::CatalogAccessor> accessor,
+    const std::unordered_map<catalog::col_oid_t, common::ManagedPointer<parser::ConstantValueExpression>>
+        &equalities) {
+  for (const auto &index : accessor->GetIndexes(table_oid_)) {
+    const catalog::IndexSchema &index_schema = index.second;
+    if (!index_schema.Unique() || index_schema.GetColumns().size() != equalities.size() ||
+        !optimizer::IndexUtil::SatisfiesBaseColumnRequirement(index_schema))
+      continue;
+    std::vector<catalog::col_oid_t> mapped_cols;
+    std::unordered_map<catalog::col_oid_t, catalog::indexkeycol_oid_t> lookup;
+    if (!optimizer::IndexUtil::ConvertIndexKeyOidToColOid(accessor.Get(), table_oid_, index_schema, &lookup,
+                                                          &mapped_cols))
+      continue;
+
+    // Every key column must be pinned, and nothing else may be constrained
+    std::vector<std::pair<uint16_t, StoredValue>> key;
+    for (const auto &key_column : index_schema.GetColumns()) {
+      const auto col_oid = std::find_if(lookup.cbegin(), lookup.cend(), [&](const auto &col_to_key) {
+        return col_to_key.second == key_column.Oid();
+      });
+      if (col_oid == lookup.cend()) break;
+      const auto constant = equalities.find(col_oid->first);
+      if (constant == equalities.end()) break;
+      StoredValue stored;
+      // A NULL key never matches, let the general path produce the empty result
+      if (!ConvertConstant(constant->second->GetValue(), key_column.Type(), &stored) || stored.is_null_) break;
+      key.emplace_back(index.first->GetKeyOidToOffsetMap().at(key_column.Oid()), std::move(stored));
+    }
+    if (key.size() != index_schema.GetColumns().size()) continue;
+
+    index_ = index.first;
+    key_ = std::move(key);
+    return true;
+  }
+  return false;
+}
+
+bool PointQuery::ConvertConstant(const type::TransientValue &value, const type::TypeId type,
+                                 StoredValue *const result) {
+  result->type_ = type;
+  if (value.Null()) {
+    result->is_null_ = true;
+    return true;
+  }
+
+  if (IsIntegral(type)) {
+    if (!IsIntegral(value.Type())) return false;
+    const int64_t integral = PeekIntegral(value);
+    switch (type) {
+      case type::TypeId::TINYINT:
+        return StoreIntegral<int8_t>(integral, &result->fixed_);
+      case type::TypeId::SMALLINT:
+        return StoreIntegral<int16_t>(integral, &result->fixed_);
+      case type::TypeId::INTEGER:
+        return StoreIntegral<int32_t>(integral, &result->fixed_);
+      default:
+        return StoreIntegral<int64_t>(integral, &result->fixed_);
+    }
+  }
+
+  switch (type) {
+    case type::TypeId::DECIMAL: {
+      double real;
+      if (value.Type() == type::TypeId::DECIMAL)
+        real = type::TransientValuePeeker::PeekDecimal(value);
+      else if (IsIntegral(value.Type()))
+        real = static_cast<double>(PeekIntegral(value));
+      else
+        return false;
+      std::memcpy(&result->fixed_, &real, sizeof(double));
+      return true;
+    }
+    case type::TypeId::BOOLEAN: {
+      if (value.Type() != type::TypeId::BOOLEAN) return false;
+      const bool boolean = type::TransientValuePeeker::PeekBoolean(value);
+      std::memcpy(&result->fixed_, &boolean, sizeof(bool));
+      return true;
+    }
+    case type::TypeId::DATE: {
+      if (value.Type() != type::TypeId::DATE) return false;
+      const uint32_t date = !type::TransientValuePeeker::PeekDate(value);
+      std::memcpy(&result->fixed_, &date, sizeof(uint32_t));
+      return true;
+    }
+    case type::TypeId::TIMESTAMP: {
+      if (value.Type() != type::TypeId::TIMESTAMP) return false;
+      result->fixed_ = !type::TransientValuePeeker::PeekTimestamp(value);
+      return true;
+    }
+    case type::TypeId::VARCHAR: {
+      if (value.Type() != type::TypeId::VARCHAR) return false;
+      result->varlen_ = std::string(type::TransientValuePeeker::PeekVarChar(value));
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+void PointQuery::WriteValue(const StoredValue &value, storage::ProjectedRow *const row,
+                            const uint16_t projection_list_index, const bool owned_varlen) {
+  if (value.is_null_) {
+    row->SetNull(projection_list_index);
+    return;
+  }
+  byte *const attr = row->AccessForceNotNull(projection_list_index);
+  if (value.type_ != type::TypeId::VARCHAR) {
+    std::memcpy(attr, &value.fixed_, type::TypeUtil::GetTypeSize(value.type_));
+    return;
+  }
+
+  const auto *const content = reinterpret_cast<const byte *>(value.varlen_.data());
+  const auto size = static_cast<uint32_t>(value.varlen_.size());
+  if (size <= storage::VarlenEntry::InlineThreshold()) {
+    *reinterpret_cast<storage::VarlenEntry *>(attr) = storage::VarlenEntry::CreateInline(content, size);
+  } else if (owned_varlen) {
+    // The table takes ownership of the buffer, and the GC frees it once the version is no longer visible
+    auto *const buffer = common::AllocationUtil::AllocateAligned(size);
+    std::memcpy(buffer, content, size);
+    *reinterpret_cast<storage::VarlenEntry *>(attr) = storage::VarlenEntry::Create(buffer, size, true);
+  } else {
+    *reinterpret_cast<storage::VarlenEntry *>(attr) = storage::VarlenEntry::Create(content, size, false);
+  }
+}
+
+uint32_t PointQuery::Execute(const common::ManagedPointer<transaction::TransactionContext> txn,
+                             const common::ManagedPointer<network::PostgresPacketWriter> out) const {
+  const auto &key_initializer = index_->GetProjectedRowInitializer();
+  auto *const key_buffer = common::AllocationUtil::AllocateAligned(key_initializer.ProjectedRowSize());
+  auto *const key = key_initializer.InitializeRow(key_buffer);
+  for (const auto &key_value : key_) WriteValue(key_value.second, key, key_value.first, false);
+
+  std::vector<storage::TupleSlot> slots;
+  index_->ScanKey(*txn, *key, &slots);
+  delete[] key_buffer;
+  TERRIER_ASSERT(slots.size() <= 1, "A unique index should never return more than one visible tuple.");
+  if (slots.empty()) return 0;
+
+  return query_type_ == network::QueryType::QUERY_SELECT ? ExecuteSelect(txn, out, slots.front())
+                                                         : ExecuteUpdate(txn, slots.front());
+}
+
+uint32_t PointQuery::ExecuteSelect(const common::ManagedPointer<transaction::TransactionContext> txn,
+                                   const common::ManagedPointer<network::PostgresPacketWriter> out,
+                                   const storage::TupleSlot slot) const {
+  auto *const buffer = common::AllocationUtil::AllocateAligned(initializer_->ProjectedRowSize());
+  auto *const row = initializer_->InitializeRow(buffer);
+  if (!table_->Select(txn, slot, row, layout_version_)) {
+    delete[] buffer;
+    return 0;
+  }
+
+  // Materialize the row the way the execution engine's OutputBuffer lays it out, so the regular DataRow writer applies
+  uint32_t tuple_size = 0;
+  for (const auto &column : output_columns_) tuple_size += execution::sql::ValUtil::GetSqlSize(column.GetType());
+  auto *const tuple = common::AllocationUtil::AllocateAligned(tuple_size);
+  uint32_t offset = 0;
+  for (uint32_t i = 0; i < output_columns_.size(); i++) {
+    const type::TypeId type = output_columns_[i].GetType();
+    byte *const val = tuple + offset;
+    offset += execution::sql::ValUtil::GetSqlSize(type);
+    const byte *const attr = row->AccessWithNullCheck(output_indexes_[i]);
+    if (attr == nullptr) {
+      new (val) execution::sql::Val(true);
+      continue;
+    }
+    switch (type) {
+      case type::TypeId::BOOLEAN:
+        new (val) execution::sql::BoolVal(*reinterpret_cast<const bool *>(attr));
+        break;
+      case type::TypeId::TINYINT:
+        new (val) execution::sql::Integer(*reinterpret_cast<const int8_t *>(attr));
+        break;
+      case type::TypeId::SMALLINT:
+        new (val) execution::sql::Integer(*reinterpret_cast<const int16_t *>(attr));
+        break;
+      case type::TypeId::INTEGER:
+        new (val) execution::sql::Integer(*reinterpret_cast<const int32_t *>(attr));
+        break;
+      case type::TypeId::BIGINT:
+        new (val) execution::sql::Integer(*reinterpret_cast<const int64_t *>(attr));
+        break;
+      case type::TypeId::DECIMAL:
+        new (val) execution::sql::Real(*reinterpret_cast<const double *>(attr));
+        break;
+      case type::TypeId::DATE:
+        new (val) execution::sql::DateVal(execution::sql::Date::FromNative(*reinterpret_cast<const uint32_t *>(attr)));
+        break;
+      case type::TypeId::TIMESTAMP:
+        new (val) execution::sql::TimestampVal(
+            execution::sql::Timestamp::FromNative(*reinterpret_cast<const uint64_t *>(attr)));
+        break;
+      case type::TypeId::VARCHAR: {
+        const auto *const varlen = reinterpret_cast<const storage::VarlenEntry *>(attr);
+        new (val) execution::sql::StringVal(reinterpret_cast<const char *>(varlen->Content()), varlen->Size());
+        break;
+      }
+      default:
+        UNREACHABLE("Unsupported types are rejected by Match.");
+    }
+  }
+  out->WriteDataRow(tuple, output_columns_);
+
+  delete[] tuple;
+  delete[] buffer;
+  return 1;
+}
+
+uint32_t PointQuery::ExecuteUpdate(const common::ManagedPointer<transaction::TransactionContext> txn,
+                                   const storage::TupleSlot slot) const {
+  auto *const redo = txn->StageWrite(db_oid_, table_oid_, *initializer_);
+  for (const auto &update_value : update_values_)
+    WriteValue(update_value.second, redo->Delta(), update_value.first, true);
+  redo->SetTupleSlot(slot);
+  return table_->Update(txn, redo, layout_version_) ? 1 : 0;
+}
+
+}  // namespace terrier::trafficcop
@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "binder/bind_node_visitor.h"
 #include "catalog/catalog.h"
@@ -19,9 +20,13 @@
 #include "optimizer/statistics/stats_storage.h"
 #include "parser/postgresparser.h"
 #include "planner/plannodes/abstract_plan_node.h"
+#include "planner/plannodes/insert_plan_node.h"
+#include "traffic_cop/point_query.h"
+#include "traffic_cop/prepared_statement.h"
 #include "traffic_cop/traffic_cop_defs.h"
 #include "traffic_cop/traffic_cop_util.h"
 #include "transaction/transaction_manager.h"
+#include "type/transient_value.h"
 
 namespace terrier::trafficcop {
 
@@ -62,6 +67,13 @@ void TrafficCop::EndTransaction(const common::ManagedPointer<network::Connection
   connection_ctx->SetAccessor(nullptr);
 }
 
+void TrafficCop::EndImplicitTransaction(const common::ManagedPointer<network::ConnectionContext> connection_ctx) const {
+  TERRIER_ASSERT(connection_ctx->TransactionState() != network::NetworkTransactionStateType::IDLE,
+                 "The implicit transaction was ended by a statement of the query.");
+  EndTransaction(connection_ctx, connection_ctx->Transaction()->MustAbort() ? network::QueryType::QUERY_ROLLBACK
+                                                                            : network::QueryType::QUERY_COMMIT);
+}
+
 void TrafficCop::HandBufferToReplication(std::unique_ptr<network::ReadBuffer> buffer) {
   TERRIER_ASSERT(replication_log_provider_ != DISABLED, "Should not be handing off logs if no log provider was given");
   replication_log_provider_->HandBufferToReplication(std::move(buffer));
@@ -243,17 +255,20 @@ std::unique_ptr<parser::ParseResult> TrafficCop::ParseQuery(
 bool TrafficCop::BindStatement(const common::ManagedPointer<network::ConnectionContext> connection_ctx,
                                const common::ManagedPointer<network::PostgresPacketWriter> out,
                                const common::ManagedPointer<parser::ParseResult> parse_result,
-                               const terrier::network::QueryType query_type) const {
+                               const common::ManagedPointer<parser::SQLStatement> statement,
+                               const terrier::network::QueryType query_type,
+                               std::vector<type::TypeId> *const parameter_types) const {
   try {
     // TODO(Matt): I don't think the binder should need the database name. It's already bound in the ConnectionContext
     binder::BindNodeVisitor visitor(connection_ctx->Accessor(), connection_ctx->GetDatabaseName());
-    visitor.BindNameToNode(parse_result->GetStatement(0), parse_result.Get());
+    visitor.BindNameToNode(statement, parse_result.Get());
+    if (parameter_types != nullptr) *parameter_types = visitor.GetParameterTypes();
   } catch (...) {
     // Failed to bind
     // TODO(Matt): this is a hack to get IF EXISTS to work with our tests, we actually need better support in
     // PostgresParser and the binder should return more state back to the TrafficCop to figure out what to do
-    if ((parse_result->GetStatement(0)->GetType() == parser::StatementType::DROP &&
-         parse_result->GetStatement(0).CastManagedPointerTo<parser::DropStatement>()->IsIfExists())) {
+    if ((statement->GetType() == parser::StatementType::DROP &&
+         statement.CastManagedPointerTo<parser::DropStatement>()->IsIfExists())) {
       out->WriteNoticeResponse("NOTICE:  binding failed with an IF EXISTS clause, skipping statement");
       out->WriteCommandComplete(query_type, 0);
     } else {
@@ -266,21 +281,23 @@ bool TrafficCop::BindStatement(const common::ManagedPointer<network::ConnectionC
   return true;
 }
 
-void TrafficCop::ExecuteStatement(const common::ManagedPointer<network::ConnectionContext> connection_ctx,
+bool TrafficCop::ExecuteStatement(const common::ManagedPointer<network::ConnectionContext> connection_ctx,
                                   const common::ManagedPointer<network::PostgresPacketWriter> out,
                                   const common::ManagedPointer<parser::ParseResult> parse_result,
-                                  const terrier::network::QueryType query_type) const {
+                                  const common::ManagedPointer<parser::SQLStatement> statement,
+                                  const terrier::network::QueryType query_type,
+                                  const bool row_description) const {
   // This logic relies on ordering of values in the enum's definition and is documented there as well.
   if (query_type <= network::QueryType::QUERY_ROLLBACK) {
     ExecuteTransactionStatement(connection_ctx, out, query_type);
-    return;
+    return true;
   }
 
   if (query_type >= network::QueryType::QUERY_RENAME) {
     // We don't yet support query types with values greater than this
     // TODO(Matt): add a TRAFFIC_COP_LOG_INFO here
     out->WriteCommandComplete(query_type, 0);
-    return;
+    return true;
   }
 
   const bool single_statement_txn = connection_ctx->TransactionState() == network::NetworkTransactionStateType::IDLE;
@@ -291,36 +308,183 @@ void TrafficCop::ExecuteStatement(const common::ManagedPointer<network::Connecti
   }
 
   // Try to bind the parsed statement
-  if (BindStatement(connection_ctx, out, parse_result, query_type)) {
+  if (BindStatement(connection_ctx, out, parse_result, statement, query_type, nullptr)) {
+    // Single-row SELECTs and UPDATEs through a unique index skip the optimizer and codegen entirely
+    if (query_type == network::QueryType::QUERY_SELECT || query_type == network::QueryType::QUERY_UPDATE) {
+      const auto point_query =
+          PointQuery::Match(connection_ctx->Accessor(), connection_ctx->GetDatabaseOid(), statement);
+      if (point_query != nullptr) {
+        RunPointQuery(connection_ctx, out, common::ManagedPointer(point_query), row_description);
+        return EndStatement(connection_ctx, single_statement_txn);
+      }
+    }
+
     // Binding succeeded, optimize to generate a physical plan and then execute
     auto physical_plan = trafficcop::TrafficCopUtil::Optimize(connection_ctx->Transaction(), connection_ctx->Accessor(),
-                                                              parse_result, stats_storage_, optimizer_timeout_);
+                                                              parse_result, statement, stats_storage_,
+                                                              optimizer_timeout_);
 
     // This logic relies on ordering of values in the enum's definition and is documented there as well.
     if (query_type <= network::QueryType::QUERY_DELETE) {
       // DML query to put through codegen
-      CodegenAndRunPhysicalPlan(connection_ctx, out, common::ManagedPointer(physical_plan), query_type);
+      CodegenAndRunPhysicalPlan(connection_ctx, out, common::ManagedPointer(physical_plan), query_type,
+                                row_description, nullptr, nullptr);
     } else if (query_type <= network::QueryType::QUERY_CREATE_VIEW) {
+      InvalidatePreparedStatementsOnEnd(connection_ctx->Transaction());
       ExecuteCreateStatement(connection_ctx, out, common::ManagedPointer(physical_plan), query_type,
                              single_statement_txn);
     } else if (query_type <= network::QueryType::QUERY_DROP_VIEW) {
+      InvalidatePreparedStatementsOnEnd(connection_ctx->Transaction());
       ExecuteDropStatement(connection_ctx, out, common::ManagedPointer(physical_plan), query_type,
                            single_statement_txn);
     }
   }
 
+  return EndStatement(connection_ctx, single_statement_txn);
+}
+
+void TrafficCop::InvalidatePreparedStatementsOnEnd(
+    const common::ManagedPointer<transaction::TransactionContext> txn) const {
+  const auto raise = [this](const transaction::timestamp_t end) {
+    auto last_ddl_end = last_ddl_end_.load();
+    while (last_ddl_end < end && !last_ddl_end_.compare_exchange_weak(last_ddl_end, end)) {
+    }
+  };
+  // A commit makes the DDL visible to every txn that starts after it. An abort hides it again from statements the txn
+  // bound itself, so it is treated as a DDL change right after the txn started.
+  const auto *const txn_ptr = txn.Get();
+  txn->RegisterCommitAction([=] { raise(txn_ptr->FinishTime()); });
+  txn->RegisterAbortAction([=] { raise(txn_ptr->StartTime() + 1); });
+}
+
+bool TrafficCop::BindPreparedStatement(const common::ManagedPointer<network::ConnectionContext> connection_ctx,
+                                       const common::ManagedPointer<network::PostgresPacketWriter> out,
+                                       const common::ManagedPointer<PreparedStatement> statement) const {
+  TERRIER_ASSERT(statement->IsCached(), "Only SELECT, INSERT, UPDATE and DELETE are bound when prepared.");
+  TERRIER_ASSERT(connection_ctx->TransactionState() != network::NetworkTransactionStateType::IDLE,
+                 "Binding reads the catalog, which needs a transaction.");
+  const bool rebind = statement->bound_at_ != transaction::INITIAL_TXN_TIMESTAMP;
+  if (rebind && last_ddl_end_.load() < statement->bound_at_) return true;
+
+  if (rebind) {
+    // The binder annotates the parse tree it is given, so a statement is bound again from a fresh one
+    statement->parse_result_ = ParseQuery(statement->query_, connection_ctx, out);
+    statement->point_query_ = nullptr;
+    statement->physical_plan_ = nullptr;
+    statement->executable_query_ = nullptr;
+    statement->bound_at_ = transaction::INITIAL_TXN_TIMESTAMP;
+    TERRIER_ASSERT(statement->parse_result_ != nullptr, "The query string was parsed before.");
+  }
+
+  const auto parse_result = common::ManagedPointer(statement->parse_result_);
+  std::vector<type::TypeId> parameter_types;
+  if (!BindStatement(connection_ctx, out, parse_result, parse_result->GetStatement(0), statement->query_type_,
+                     &parameter_types)) {
+    return false;
+  }
+
+  if (rebind && parameter_types != statement->parameter_types_) {
+    // Portals already hold values of the old types
+    out->WriteErrorResponse("ERROR:  cached plan must not change parameter types");
+    connection_ctx->Transaction()->SetMustAbort();
+    return false;
+  }
+  for (uint32_t i = 0; i < parameter_types.size(); i++) {
+    if (parameter_types[i] == type::TypeId::INVALID) {
+      out->WriteErrorResponse("ERROR:  could not determine data type of parameter $" + std::to_string(i + 1));
+      connection_ctx->Transaction()->SetMustAbort();
+      return false;
+    }
+  }
+
+  statement->parameter_types_ = std::move(parameter_types);
+  statement->bound_at_ = connection_ctx->Transaction()->StartTime();
+  return true;
+}
+
+bool TrafficCop::PlanPreparedStatement(const common::ManagedPointer<network::ConnectionContext> connection_ctx,
+                                       const common::ManagedPointer<network::PostgresPacketWriter> out,
+                                       const common::ManagedPointer<PreparedStatement> statement) const {
+  if (!BindPreparedStatement(connection_ctx, out, statement)) return false;
+  if (statement->point_query_ != nullptr || statement->physical_plan_ != nullptr) return true;
+
+  // Same choice of plan as ExecuteStatement
+  const auto parse_result = common::ManagedPointer(statement->parse_result_);
+  const auto query_type = statement->query_type_;
+  if (query_type == network::QueryType::QUERY_SELECT || query_type == network::QueryType::QUERY_UPDATE) {
+    statement->point_query_ =
+        PointQuery::Match(connection_ctx->Accessor(), connection_ctx->GetDatabaseOid(), parse_result->GetStatement(0));
+    if (statement->point_query_ != nullptr) return true;
+  }
+  statement->physical_plan_ =
+      trafficcop::TrafficCopUtil::Optimize(connection_ctx->Transaction(), connection_ctx->Accessor(), parse_result,
+                                           parse_result->GetStatement(0), stats_storage_, optimizer_timeout_);
+  return true;
+}
+
+bool TrafficCop::DescribePreparedStatement(const common::ManagedPointer<network::ConnectionContext> connection_ctx,
+                                           const common::ManagedPointer<network::PostgresPacketWriter> out,
+                                           const common::ManagedPointer<PreparedStatement> statement) const {
+  if (statement->query_type_ != network::QueryType::QUERY_SELECT) {
+    out->WriteNoData();
+    return true;
+  }
+
+  if (!PlanPreparedStatement(connection_ctx, out, statement)) return false;
+  if (statement->point_query_ != nullptr) {
+    out->WriteRowDescription(statement->point_query_->GetOutputColumns());
+  } else {
+    out->WriteRowDescription(statement->physical_plan_->GetOutputSchema()->GetColumns());
+  }
+  return true;
+}
+
+bool TrafficCop::ExecutePreparedStatement(
+    const common::ManagedPointer<network::ConnectionContext> connection_ctx,
+    const common::ManagedPointer<network::PostgresPacketWriter> out,
+    const common::ManagedPointer<PreparedStatement> statement,
+    const common::ManagedPointer<const std::vector<type::TransientValue>> params) const {
+  TERRIER_ASSERT(!statement->Empty(), "An empty query has nothing to execute.");
+  if (!statement->IsCached()) {
+    // The binder and the DDL executors annotate the parse tree, so every execution starts from a fresh one
+    const auto parse_result = ParseQuery(statement->query_, connection_ctx, out);
+    TERRIER_ASSERT(parse_result != nullptr, "The query string was parsed before.");
+    return ExecuteStatement(connection_ctx, out, common::ManagedPointer(parse_result), parse_result->GetStatement(0),
+                            statement->query_type_, false);
+  }
+
+  TERRIER_ASSERT(connection_ctx->TransactionState() != network::NetworkTransactionStateType::IDLE,
+                 "A cached statement runs in the implicit transaction or in a transaction block.");
+  if (PlanPreparedStatement(connection_ctx, out, statement)) {
+    if (statement->point_query_ != nullptr) {
+      RunPointQuery(connection_ctx, out, common::ManagedPointer(statement->point_query_), false);
+    } else {
+      CodegenAndRunPhysicalPlan(connection_ctx, out, common::ManagedPointer(statement->physical_plan_),
+                                statement->query_type_, false, params, &statement->executable_query_);
+    }
+  }
+  return EndStatement(connection_ctx, false);
+}
+
+bool TrafficCop::EndStatement(const common::ManagedPointer<network::ConnectionContext> connection_ctx,
+                              const bool single_statement_txn) const {
+  // Every failure on the way flags the txn for abort, in postgres a failed statement fails its transaction
+  const bool failed = connection_ctx->Transaction()->MustAbort();
   if (single_statement_txn) {
     // Single statement transaction should be ended before returning
     // decide whether the txn should be committed or aborted based on the MustAbort flag, and then end the txn
-    EndTransaction(connection_ctx, connection_ctx->Transaction()->MustAbort() ? network::QueryType::QUERY_ROLLBACK
-                                                                              : network::QueryType::QUERY_COMMIT);
+    EndTransaction(connection_ctx, failed ? network::QueryType::QUERY_ROLLBACK : network::QueryType::QUERY_COMMIT);
   }
+  return !failed;
 }
 
 void TrafficCop::CodegenAndRunPhysicalPlan(const common::ManagedPointer<network::ConnectionContext> connection_ctx,
                                            const common::ManagedPointer<network::PostgresPacketWriter> out,
                                            const common::ManagedPointer<planner::AbstractPlanNode> physical_plan,
-                                           const terrier::network::QueryType query_type) const {
+                                           const terrier::network::QueryType query_type,
+                                           const bool row_description,
+                                           const common::ManagedPointer<const std::vector<type::TransientValue>> params,
+                                           std::unique_ptr<execution::ExecutableQuery> *const cached_query) const {
   TERRIER_ASSERT(query_type == network::QueryType::QUERY_SELECT || query_type == network::QueryType::QUERY_INSERT ||
                      query_type == network::QueryType::QUERY_UPDATE || query_type == network::QueryType::QUERY_DELETE,
                  "CodegenAndRunPhysicalPlan called with invalid QueryType.");
@@ -330,9 +494,27 @@ void TrafficCop::CodegenAndRunPhysicalPlan(const common::ManagedPointer<network:
       connection_ctx->GetDatabaseOid(), connection_ctx->Transaction(), writer, physical_plan->GetOutputSchema().Get(),
       connection_ctx->Accessor());
 
-  auto exec_query = execution::ExecutableQuery(common::ManagedPointer(physical_plan), common::ManagedPointer(exec_ctx));
+  const auto constant_batch =
+      query_type == network::QueryType::QUERY_INSERT
+          ? physical_plan.CastManagedPointerTo<planner::InsertPlanNode>()->GetConstantBatch()
+          : nullptr;
+  if (constant_batch != nullptr) {
+    // The generated code reads the values of a constant batch as query parameters, straight from the parse result
+    exec_ctx->SetParams(common::ManagedPointer(&constant_batch->GetValues()));
+  } else if (params != nullptr) {
+    exec_ctx->SetParams(params);
+  }
+
+  // The compiled query only depends on the plan, so a prepared statement runs it with every new ExecutionContext
+  std::unique_ptr<execution::ExecutableQuery> compiled_query;
+  auto *const exec_query_ptr = cached_query != nullptr ? cached_query : &compiled_query;
+  if (*exec_query_ptr == nullptr) {
+    *exec_query_ptr = std::make_unique<execution::ExecutableQuery>(common::ManagedPointer(physical_plan),
+                                                                   common::ManagedPointer(exec_ctx));
+  }
+  auto &exec_query = **exec_query_ptr;
 
-  if (query_type == network::QueryType::QUERY_SELECT)
+  if (query_type == network::QueryType::QUERY_SELECT && row_description)
     out->WriteRowDescription(physical_plan->GetOutputSchema()->GetColumns());
 
   exec_query.Run(common::ManagedPointer(exec_ctx), execution::vm::ExecutionMode::Interpret);
@@ -358,6 +540,23 @@ void TrafficCop::CodegenAndRunPhysicalPlan(const common::ManagedPointer<network:
   }
 }
 
+void TrafficCop::RunPointQuery(const common::ManagedPointer<network::ConnectionContext> connection_ctx,
+                               const common::ManagedPointer<network::PostgresPacketWriter> out,
+                               const common::ManagedPointer<PointQuery> point_query,
+                               const bool row_description) const {
+  const auto query_type = point_query->GetQueryType();
+  if (query_type == network::QueryType::QUERY_SELECT && row_description)
+    out->WriteRowDescription(point_query->GetOutputColumns());
+
+  const uint32_t num_rows = point_query->Execute(connection_ctx->Transaction(), out);
+
+  if (connection_ctx->TransactionState() == network::NetworkTransactionStateType::BLOCK) {
+    out->WriteCommandComplete(query_type, num_rows);
+  } else {
+    out->WriteErrorResponse("Query failed.");
+  }
+}
+
 std::pair<catalog::db_oid_t, catalog::namespace_oid_t> TrafficCop::CreateTempNamespace(
     const network::connection_id_t connection_id, const std::string &database_name) {
   auto *const txn = txn_manager_->BeginTransaction();
@@ -21,10 +21,11 @@ std::unique_ptr<planner::AbstractPlanNode> TrafficCopUtil::Optimize(
     const common::ManagedPointer<transaction::TransactionContext> txn,
     const common::ManagedPointer<catalog::CatalogAccessor> accessor,
     const common::ManagedPointer<parser::ParseResult> query,
+    const common::ManagedPointer<parser::SQLStatement> statement,
     const common::ManagedPointer<optimizer::StatsStorage> stats_storage, const uint64_t optimizer_timeout) {
   // Optimizer transforms annotated ParseResult to logical expressions (ephemeral Optimizer structure)
   optimizer::QueryToOperatorTransformer transformer(accessor);
-  auto logical_exprs = transformer.ConvertToOpExpression(query->GetStatement(0), query.Get());
+  auto logical_exprs = transformer.ConvertToOpExpression(statement, query.Get());
 
   // TODO(Matt): is the cost model to use going to become an arg to this function eventually?
   optimizer::Optimizer optimizer(std::make_unique<optimizer::TrivialCostModel>(), optimizer_timeout);
@@ -34,9 +35,9 @@ std::unique_ptr<planner::AbstractPlanNode> TrafficCopUtil::Optimize(
   // Build the QueryInfo object. For SELECTs this may require a bunch of other stuff from the original statement.
   // If any more logic like this is needed in the future, we should break this into its own function somewhere since
   // this is Optimizer-specific stuff.
-  const auto type = query->GetStatement(0)->GetType();
+  const auto type = statement->GetType();
   if (type == parser::StatementType::SELECT) {
-    const auto sel_stmt = query->GetStatement(0).CastManagedPointerTo<parser::SelectStatement>();
+    const auto sel_stmt = statement.CastManagedPointerTo<parser::SelectStatement>();
 
     // Output
     output = sel_stmt->GetSelectColumns();  // TODO(Matt): this is making a local copy. Revisit the life cycle and
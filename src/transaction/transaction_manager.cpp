@@ -15,6 +15,7 @@ TransactionContext *TransactionManager::BeginTransaction() {
   {
     start_time = timestamp_manager_->BeginTransaction();
     result = new TransactionContext(start_time, start_time + INT64_MIN, buffer_pool_, log_manager_);
+    result->oldest_active_at_start_ = timestamp_manager_->CachedOldestTransactionStartTime();
     // Ensure we do not return from this function if there are ongoing write commits
     if (common::thread_context.metrics_store_ != nullptr &&
         common::thread_context.metrics_store_->ComponentEnabled(metrics::MetricsComponent::TRANSACTION))
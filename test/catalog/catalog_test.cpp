@@ -292,6 +292,97 @@ TEST_F(CatalogTests, UserTableTest) {
   txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
 }
 
+/*
+ * Add and drop a column of a user table that already holds data, then read the old tuples and write new ones.
+ */
+// NOLINTNEXTLINE
+TEST_F(CatalogTests, AlterTableTest) {
+  auto txn = txn_manager_->BeginTransaction();
+  auto accessor = catalog_->GetAccessor(common::ManagedPointer(txn), db_);
+
+  std::vector<catalog::Schema::Column> cols;
+  cols.emplace_back("id", type::TypeId::INTEGER, false,
+                    parser::ConstantValueExpression(type::TransientValueFactory::GetNull(type::TypeId::INTEGER)));
+  cols.emplace_back("user_col_1", type::TypeId::INTEGER, false,
+                    parser::ConstantValueExpression(type::TransientValueFactory::GetNull(type::TypeId::INTEGER)));
+  auto table_oid = accessor->CreateTable(accessor->GetDefaultNamespace(), "test_table", catalog::Schema(cols));
+  const auto old_schema = accessor->GetSchema(table_oid);
+  const auto id_oid = old_schema.GetColumn("id").Oid();
+  const auto col_1_oid = old_schema.GetColumn("user_col_1").Oid();
+  auto table = new storage::SqlTable(db_main_->GetStorageLayer()->GetBlockStore(), old_schema);
+  EXPECT_TRUE(accessor->SetTablePointer(table_oid, table));
+
+  // Insert a tuple under the original schema
+  auto old_initializer = table->InitializerForProjectedRow({id_oid, col_1_oid}, old_schema.GetVersion());
+  auto old_pm = table->ProjectionMapForOids({id_oid, col_1_oid}, old_schema.GetVersion());
+  auto *redo = txn->StageWrite(db_, table_oid, old_initializer);
+  *reinterpret_cast<int32_t *>(redo->Delta()->AccessForceNotNull(old_pm[id_oid])) = 1;
+  *reinterpret_cast<int32_t *>(redo->Delta()->AccessForceNotNull(old_pm[col_1_oid])) = 10;
+  const auto old_slot = table->Insert(common::ManagedPointer(txn), redo, old_schema.GetVersion());
+  txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  // Drop user_col_1 and add user_col_2 with a default
+  txn = txn_manager_->BeginTransaction();
+  accessor = catalog_->GetAccessor(common::ManagedPointer(txn), db_);
+  std::vector<catalog::Schema::Column> new_cols{accessor->GetSchema(table_oid).GetColumn("id")};
+  new_cols.emplace_back("user_col_2", type::TypeId::INTEGER, true,
+                        parser::ConstantValueExpression(type::TransientValueFactory::GetInteger(42)));
+  EXPECT_TRUE(accessor->UpdateSchema(table_oid, new catalog::Schema(new_cols)));
+  const auto new_schema = accessor->GetSchema(table_oid);
+  EXPECT_NE(new_schema.GetVersion(), old_schema.GetVersion());
+  EXPECT_EQ(new_schema.GetColumns().size(), 2);
+  EXPECT_EQ(new_schema.GetColumn("id").Oid(), id_oid);
+  EXPECT_THROW(new_schema.GetColumn("user_col_1"), std::out_of_range);
+  const auto col_2_oid = new_schema.GetColumn("user_col_2").Oid();
+  EXPECT_NE(col_2_oid, catalog::INVALID_COLUMN_OID);
+  EXPECT_NE(col_2_oid, col_1_oid);
+  txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  // Insert a tuple under the new schema
+  txn = txn_manager_->BeginTransaction();
+  accessor = catalog_->GetAccessor(common::ManagedPointer(txn), db_);
+  const auto version = accessor->GetSchema(table_oid).GetVersion();
+  EXPECT_EQ(version, new_schema.GetVersion());
+  auto new_initializer = table->InitializerForProjectedRow({id_oid, col_2_oid}, version);
+  auto new_pm = table->ProjectionMapForOids({id_oid, col_2_oid}, version);
+  redo = txn->StageWrite(db_, table_oid, new_initializer);
+  *reinterpret_cast<int32_t *>(redo->Delta()->AccessForceNotNull(new_pm[id_oid])) = 2;
+  *reinterpret_cast<int32_t *>(redo->Delta()->AccessForceNotNull(new_pm[col_2_oid])) = 20;
+  const auto new_slot = table->Insert(common::ManagedPointer(txn), redo, version);
+  txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  // The old tuple reads back with the default for the added column, the new one with its own value
+  txn = txn_manager_->BeginTransaction();
+  auto *buffer = common::AllocationUtil::AllocateAligned(new_initializer.ProjectedRowSize());
+  auto *row = new_initializer.InitializeRow(buffer);
+  EXPECT_TRUE(table->Select(common::ManagedPointer(txn), old_slot, row, version));
+  EXPECT_EQ(*reinterpret_cast<int32_t *>(row->AccessWithNullCheck(new_pm[id_oid])), 1);
+  EXPECT_EQ(*reinterpret_cast<int32_t *>(row->AccessWithNullCheck(new_pm[col_2_oid])), 42);
+  row = new_initializer.InitializeRow(buffer);
+  EXPECT_TRUE(table->Select(common::ManagedPointer(txn), new_slot, row, version));
+  EXPECT_EQ(*reinterpret_cast<int32_t *>(row->AccessWithNullCheck(new_pm[id_oid])), 2);
+  EXPECT_EQ(*reinterpret_cast<int32_t *>(row->AccessWithNullCheck(new_pm[col_2_oid])), 20);
+  delete[] buffer;
+
+  // A scan under the new schema reaches the tuples of both versions
+  auto pc_initializer = table->InitializerForProjectedColumns({id_oid, col_2_oid}, 10, version);
+  buffer = common::AllocationUtil::AllocateAligned(pc_initializer.ProjectedColumnsSize());
+  auto *columns = pc_initializer.Initialize(buffer);
+  uint32_t num_tuples = 0;
+  for (auto it = table->begin(); it != table->end();) {
+    table->Scan(common::ManagedPointer(txn), &it, columns, version);
+    num_tuples += columns->NumTuples();
+  }
+  EXPECT_EQ(num_tuples, 2);
+  delete[] buffer;
+  txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  txn = txn_manager_->BeginTransaction();
+  accessor = catalog_->GetAccessor(common::ManagedPointer(txn), db_);
+  EXPECT_TRUE(accessor->DropTable(table_oid));
+  txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+}
+
 /*
  * Create and delete a user index.
  */
@@ -103,7 +103,8 @@ class AggregationHashTableTest : public SqlBasedTest {
     for (const auto &col : schema.GetColumns()) {
       col_oids.emplace_back(col.Oid());
     }
-    auto pc_init = sql_table->InitializerForProjectedColumns(col_oids, common::Constants::K_DEFAULT_VECTOR_SIZE);
+    auto pc_init = sql_table->InitializerForProjectedColumns(col_oids, common::Constants::K_DEFAULT_VECTOR_SIZE,
+                                                             storage::INITIAL_LAYOUT_VERSION);
     buffer_ = common::AllocationUtil::AllocateAligned(pc_init.ProjectedColumnsSize());
     projected_columns_ = pc_init.Initialize(buffer_);
     projected_columns_->SetNumTuples(common::Constants::K_DEFAULT_VECTOR_SIZE);
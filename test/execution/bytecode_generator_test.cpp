@@ -199,6 +199,42 @@ TEST_F(BytecodeGeneratorTest, ComparisonTest) {
 #undef CMP_TEST
 }
 
+// NOLINTNEXTLINE
+TEST_F(BytecodeGeneratorTest, SqlConditionTest) {
+  //
+  // Branches and loops on SQL booleans are generated with the JumpIfSql superinstructions, and SQL integer constants
+  // with InitIntegerImm. Check that both branch directions are still taken correctly.
+  //
+
+  auto src = R"(
+    fun test(x: int32) -> int32 {
+      var a = @intToSql(x)
+      var count: int32 = 0
+      if (a < 10) {
+        count = count + 1
+      }
+      if (@sqlToBool(a >= @intToSql(5))) {
+        count = count + 2
+      } else {
+        count = count + 4
+      }
+      for (var i: int32 = 0; @sqlToBool(@intToSql(i) < a); i = i + 1) {
+        count = count + 10
+      }
+      return count
+    })";
+  auto compiler = ModuleCompiler();
+  auto module = compiler.CompileToModule(src);
+  ASSERT_TRUE(module != nullptr);
+
+  std::function<int32_t(int32_t)> fn;
+  ASSERT_TRUE(module->GetFunction("test", ExecutionMode::Interpret, &fn)) << "Function 'test' not found in module";
+
+  EXPECT_EQ(1 + 4 + 30, fn(3));
+  EXPECT_EQ(1 + 2 + 70, fn(7));
+  EXPECT_EQ(2 + 120, fn(12));
+}
+
 // NOLINTNEXTLINE
 TEST_F(BytecodeGeneratorTest, ParameterPassingTest) {
   auto src = R"(
@@ -229,6 +265,54 @@ TEST_F(BytecodeGeneratorTest, ParameterPassingTest) {
   EXPECT_EQ(20, s.b_);
 }
 
+// NOLINTNEXTLINE
+TEST_F(BytecodeGeneratorTest, AddAssignTest) {
+  //
+  // Adding a value to the location being assigned through a pointer or a struct member is generated with the
+  // AddAssign superinstruction. Other additions keep the regular load, add and store.
+  //
+
+  auto src = R"(
+    struct S {
+      a: int64
+      b: int64
+    }
+    fun test(s: *S, p: *int64) -> int64 {
+      for (var i: int64 = 0; i < 10; i = i + 1) {
+        *p = *p + 1
+        s.a = s.a + i
+        s.b = s.a + 1
+      }
+      return *p
+    })";
+  auto compiler = ModuleCompiler();
+  auto module = compiler.CompileToModule(src);
+  ASSERT_TRUE(module != nullptr);
+
+  const auto *bytecode_module = module->GetBytecodeModule();
+  uint32_t num_add_assign = 0;
+  for (auto iter = bytecode_module->BytecodeForFunction(*bytecode_module->GetFuncInfoByName("test")); !iter.Done();
+       iter.Advance()) {
+    if (iter.CurrentBytecode() == Bytecode::AddAssign_int64_t) num_add_assign++;
+  }
+  EXPECT_EQ(2u, num_add_assign);
+
+  struct S {
+    int64_t a_;
+    int64_t b_;
+  };
+
+  std::function<int64_t(S *, int64_t *)> f;
+  ASSERT_TRUE(module->GetFunction("test", ExecutionMode::Interpret, &f)) << "Function 'test' not found in module";
+
+  S s{.a_ = 1, .b_ = 0};
+  int64_t p = 5;
+  EXPECT_EQ(15, f(&s, &p));
+  EXPECT_EQ(15, p);
+  EXPECT_EQ(1 + 45, s.a_);
+  EXPECT_EQ(1 + 45 + 1, s.b_);
+}
+
 // NOLINTNEXTLINE
 TEST_F(BytecodeGeneratorTest, FunctionTypeCheckTest) {
   {
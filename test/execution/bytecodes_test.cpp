@@ -20,6 +20,8 @@ TEST_F(BytecodesTest, OperandCountTest) {
   EXPECT_EQ(1u, Bytecodes::NumOperands(Bytecode::Jump));
   EXPECT_EQ(2u, Bytecodes::NumOperands(Bytecode::JumpIfTrue));
   EXPECT_EQ(2u, Bytecodes::NumOperands(Bytecode::JumpIfFalse));
+  EXPECT_EQ(2u, Bytecodes::NumOperands(Bytecode::JumpIfSqlTrue));
+  EXPECT_EQ(2u, Bytecodes::NumOperands(Bytecode::JumpIfSqlFalse));
 
   // Binary ops
   EXPECT_EQ(3u, Bytecodes::NumOperands(Bytecode::Add_int32_t));
@@ -28,6 +30,10 @@ TEST_F(BytecodesTest, OperandCountTest) {
   EXPECT_EQ(3u, Bytecodes::NumOperands(Bytecode::Rem_int32_t));
   EXPECT_EQ(3u, Bytecodes::NumOperands(Bytecode::Sub_int32_t));
 
+  // Superinstructions
+  EXPECT_EQ(2u, Bytecodes::NumOperands(Bytecode::AddAssign_int32_t));
+  EXPECT_EQ(4u, Bytecodes::NumOperands(Bytecode::PCILessThanInteger));
+
   // Return has no arguments
   EXPECT_EQ(0u, Bytecodes::NumOperands(Bytecode::Return));
 }
@@ -22,6 +22,7 @@
 #include "execution/vm/bytecode_module.h"
 #include "execution/vm/llvm_engine.h"
 #include "execution/vm/module.h"
+#include "parser/constant_batch.h"
 #include "planner/plannodes/aggregate_plan_node.h"
 #include "planner/plannodes/delete_plan_node.h"
 #include "planner/plannodes/hash_join_plan_node.h"
@@ -49,6 +50,13 @@ class CompilerTest : public SqlBasedTest {
     table_generator.GenerateTestTables();
   }
 
+  // The TPL code generated for the plan, to check which builtins it calls
+  static std::string DumpCompiledPlan(const planner::AbstractPlanNode *plan, exec::ExecutionContext *exec_ctx) {
+    CodeGen codegen(exec_ctx);
+    Compiler compiler(&codegen, plan);
+    return ast::AstDump::Dump(compiler.Compile());
+  }
+
   static constexpr vm::ExecutionMode MODE = vm::ExecutionMode::Interpret;
 };
 
@@ -108,6 +116,143 @@ TEST_F(CompilerTest, SimpleSeqScanTest) {
   multi_checker.CheckCorrectness();
 }
 
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, VectorizedSeqScanTest) {
+  // SELECT colA, colB, colC FROM test_1 WHERE colA > -10 AND 500 > colA AND colC >= colA AND (colB = 3 OR colB <= 1);
+  // The first three conjuncts run as vectorized filters, the last one tuple at a time.
+  auto accessor = MakeAccessor();
+  auto table_oid = accessor->GetTableOid(NSOid(), "test_1");
+  auto table_schema = accessor->GetSchema(table_oid);
+  ExpressionMaker expr_maker;
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan;
+  OutputSchemaHelper seq_scan_out{0, &expr_maker};
+  {
+    // OIDs
+    auto cola_oid = table_schema.GetColumn("colA").Oid();
+    auto colb_oid = table_schema.GetColumn("colB").Oid();
+    auto colc_oid = table_schema.GetColumn("colC").Oid();
+    // Get Table columns
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+    auto col2 = expr_maker.CVE(colb_oid, type::TypeId::INTEGER);
+    auto col3 = expr_maker.CVE(colc_oid, type::TypeId::INTEGER);
+    seq_scan_out.AddOutput("col1", common::ManagedPointer(col1));
+    seq_scan_out.AddOutput("col2", common::ManagedPointer(col2));
+    seq_scan_out.AddOutput("col3", common::ManagedPointer(col3));
+    auto schema = seq_scan_out.MakeSchema();
+    // Make predicate
+    auto comp1 = expr_maker.ComparisonGt(col1, expr_maker.OpNeg(expr_maker.Constant(10)));
+    auto comp2 = expr_maker.ComparisonGt(expr_maker.Constant(500), col1);
+    auto comp3 = expr_maker.ComparisonGe(col3, col1);
+    auto comp4 = expr_maker.ConjunctionOr(expr_maker.ComparisonEq(col2, expr_maker.Constant(3)),
+                                          expr_maker.ComparisonLe(col2, expr_maker.Constant(1)));
+    auto predicate =
+        expr_maker.ConjunctionAnd(expr_maker.ConjunctionAnd(comp1, comp2), expr_maker.ConjunctionAnd(comp3, comp4));
+    // Build
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan = builder.SetOutputSchema(std::move(schema))
+                   .SetColumnOids({cola_oid, colb_oid, colc_oid})
+                   .SetScanPredicate(predicate)
+                   .SetIsForUpdateFlag(false)
+                   .SetNamespaceOid(NSOid())
+                   .SetTableOid(table_oid)
+                   .Build();
+  }
+  // Make the output checkers
+  uint32_t num_output_rows = 0;
+  RowChecker row_checker = [&num_output_rows](const std::vector<sql::Val *> &vals) {
+    auto col1 = static_cast<sql::Integer *>(vals[0]);
+    auto col2 = static_cast<sql::Integer *>(vals[1]);
+    auto col3 = static_cast<sql::Integer *>(vals[2]);
+    EXPECT_GT(col1->val_, -10);
+    EXPECT_LT(col1->val_, 500);
+    EXPECT_GE(col3->val_, col1->val_);
+    EXPECT_TRUE(col2->val_ == 3 || col2->val_ <= 1);
+    num_output_rows++;
+  };
+  CorrectnessFn correctness_fn = [&num_output_rows]() { EXPECT_GT(num_output_rows, 0); };
+  GenericChecker checker(row_checker, correctness_fn);
+
+  // Create the execution context
+  OutputStore store{&checker, seq_scan->GetOutputSchema().Get()};
+  exec::OutputPrinter printer(seq_scan->GetOutputSchema().Get());
+  MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+  auto exec_ctx = MakeExecCtx(std::move(callback), seq_scan->GetOutputSchema().Get());
+
+  // The first three conjuncts compile to vectorized filters, 500 > colA to colA < 500
+  auto tpl = DumpCompiledPlan(seq_scan.get(), exec_ctx.get());
+  EXPECT_NE(tpl.find("filterGt"), std::string::npos);
+  EXPECT_NE(tpl.find("filterLt"), std::string::npos);
+  EXPECT_NE(tpl.find("filterColGe"), std::string::npos);
+
+  // Run & Check
+  auto executable = ExecutableQuery(common::ManagedPointer(seq_scan), common::ManagedPointer(exec_ctx));
+  executable.Run(common::ManagedPointer(exec_ctx), MODE);
+  checker.CheckCorrectness();
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, NullableVectorizedSeqScanTest) {
+  // SELECT col2, col4 FROM test_2 WHERE col2 >= 5 AND col4 > col2;
+  // Both columns are nullable, and both conjuncts run as vectorized filters, which must drop the NULLs.
+  auto accessor = MakeAccessor();
+  auto table_oid = accessor->GetTableOid(NSOid(), "test_2");
+  auto table_schema = accessor->GetSchema(table_oid);
+  ExpressionMaker expr_maker;
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan;
+  OutputSchemaHelper seq_scan_out{0, &expr_maker};
+  {
+    // OIDs
+    auto col2_oid = table_schema.GetColumn("col2").Oid();
+    auto col4_oid = table_schema.GetColumn("col4").Oid();
+    // Get Table columns
+    auto col2 = expr_maker.CVE(col2_oid, type::TypeId::INTEGER);
+    auto col4 = expr_maker.CVE(col4_oid, type::TypeId::INTEGER);
+    seq_scan_out.AddOutput("col2", common::ManagedPointer(col2));
+    seq_scan_out.AddOutput("col4", common::ManagedPointer(col4));
+    auto schema = seq_scan_out.MakeSchema();
+    // Make predicate
+    auto comp1 = expr_maker.ComparisonGe(col2, expr_maker.Constant(5));
+    auto comp2 = expr_maker.ComparisonGt(col4, col2);
+    auto predicate = expr_maker.ConjunctionAnd(comp1, comp2);
+    // Build
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan = builder.SetOutputSchema(std::move(schema))
+                   .SetColumnOids({col2_oid, col4_oid})
+                   .SetScanPredicate(predicate)
+                   .SetIsForUpdateFlag(false)
+                   .SetNamespaceOid(NSOid())
+                   .SetTableOid(table_oid)
+                   .Build();
+  }
+  // Make the output checkers
+  uint32_t num_output_rows = 0;
+  RowChecker row_checker = [&num_output_rows](const std::vector<sql::Val *> &vals) {
+    auto col2 = static_cast<sql::Integer *>(vals[0]);
+    auto col4 = static_cast<sql::Integer *>(vals[1]);
+    ASSERT_FALSE(col2->is_null_ || col4->is_null_);
+    EXPECT_GE(col2->val_, 5);
+    EXPECT_GT(col4->val_, col2->val_);
+    num_output_rows++;
+  };
+  CorrectnessFn correctness_fn = [&num_output_rows]() { EXPECT_GT(num_output_rows, 0); };
+  GenericChecker checker(row_checker, correctness_fn);
+
+  // Create the execution context
+  OutputStore store{&checker, seq_scan->GetOutputSchema().Get()};
+  exec::OutputPrinter printer(seq_scan->GetOutputSchema().Get());
+  MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+  auto exec_ctx = MakeExecCtx(std::move(callback), seq_scan->GetOutputSchema().Get());
+
+  auto tpl = DumpCompiledPlan(seq_scan.get(), exec_ctx.get());
+  EXPECT_NE(tpl.find("filterGe"), std::string::npos);
+  EXPECT_NE(tpl.find("filterColGt"), std::string::npos);
+
+  // Run & Check
+  auto executable = ExecutableQuery(common::ManagedPointer(seq_scan), common::ManagedPointer(exec_ctx));
+  executable.Run(common::ManagedPointer(exec_ctx), MODE);
+  checker.CheckCorrectness();
+}
+
 // NOLINTNEXTLINE
 TEST_F(CompilerTest, SimpleSeqScanWithProjectionTest) {
   // SELECT col1, col2, col1 * col2, col1 >= 100*col2 FROM test_1 WHERE col1 < 500;
@@ -174,6 +319,158 @@ TEST_F(CompilerTest, SimpleSeqScanWithProjectionTest) {
   multi_checker.CheckCorrectness();
 }
 
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, ProjectionCommonSubexpressionTest) {
+  // SELECT col1 * col2, col1 * col2 + 2 * 3, (col1 * col2) / 2, -(4 - 1) FROM test_1 WHERE col1 < 500;
+  // col1 * col2 is computed once per tuple, the constant expressions are folded during code generation.
+  auto accessor = MakeAccessor();
+  auto table_oid = accessor->GetTableOid(NSOid(), "test_1");
+  auto table_schema = accessor->GetSchema(table_oid);
+  ExpressionMaker expr_maker;
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan;
+  OutputSchemaHelper seq_scan_out{0, &expr_maker};
+  {
+    // Get Table columns
+    auto cola_oid = table_schema.GetColumn("colA").Oid();
+    auto colb_oid = table_schema.GetColumn("colB").Oid();
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+    auto col2 = expr_maker.CVE(colb_oid, type::TypeId::INTEGER);
+    // Make New Column
+    seq_scan_out.AddOutput("col1", common::ManagedPointer(col1));
+    seq_scan_out.AddOutput("col2", common::ManagedPointer(col2));
+    auto schema = seq_scan_out.MakeSchema();
+    // Make predicate
+    auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(500));
+    // Build
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan = builder.SetOutputSchema(std::move(schema))
+                   .SetColumnOids({cola_oid, colb_oid})
+                   .SetScanPredicate(predicate)
+                   .SetIsForUpdateFlag(false)
+                   .SetNamespaceOid(NSOid())
+                   .SetTableOid(table_oid)
+                   .Build();
+  }
+  std::unique_ptr<planner::AbstractPlanNode> proj;
+  OutputSchemaHelper proj_out{0, &expr_maker};
+  {
+    auto col1 = seq_scan_out.GetOutput("col1");
+    auto col2 = seq_scan_out.GetOutput("col2");
+    auto product = expr_maker.OpMul(col1, col2);
+    auto plus_six = expr_maker.OpSum(expr_maker.OpMul(col1, col2),
+                                     expr_maker.OpMul(expr_maker.Constant(2), expr_maker.Constant(3)));
+    auto half = expr_maker.OpDiv(expr_maker.OpMul(col1, col2), expr_maker.Constant(2));
+    auto minus_three = expr_maker.OpNeg(expr_maker.OpMin(expr_maker.Constant(4), expr_maker.Constant(1)));
+    proj_out.AddOutput("product", common::ManagedPointer(product));
+    proj_out.AddOutput("plus_six", common::ManagedPointer(plus_six));
+    proj_out.AddOutput("half", common::ManagedPointer(half));
+    proj_out.AddOutput("minus_three", common::ManagedPointer(minus_three));
+    auto schema = proj_out.MakeSchema();
+    planner::ProjectionPlanNode::Builder builder;
+    proj = builder.SetOutputSchema(std::move(schema)).AddChild(std::move(seq_scan)).Build();
+  }
+
+  // Make the output checkers
+  NumChecker num_checker(500);
+  RowChecker row_checker = [](const std::vector<sql::Val *> &vals) {
+    auto product = static_cast<sql::Integer *>(vals[0]);
+    auto plus_six = static_cast<sql::Integer *>(vals[1]);
+    auto half = static_cast<sql::Integer *>(vals[2]);
+    auto minus_three = static_cast<sql::Integer *>(vals[3]);
+    EXPECT_EQ(plus_six->val_, product->val_ + 6);
+    EXPECT_EQ(half->val_, product->val_ / 2);
+    EXPECT_EQ(minus_three->val_, -3);
+  };
+  GenericChecker row_values_checker(row_checker, {});
+  MultiChecker multi_checker{std::vector<OutputChecker *>{&num_checker, &row_values_checker}};
+
+  // Create the execution context
+  OutputStore store{&multi_checker, proj->GetOutputSchema().Get()};
+  exec::OutputPrinter printer(proj->GetOutputSchema().Get());
+  MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+  auto exec_ctx = MakeExecCtx(std::move(callback), proj->GetOutputSchema().Get());
+
+  // Run & Check
+  auto executable = ExecutableQuery(common::ManagedPointer(proj), common::ManagedPointer(exec_ctx));
+  executable.Run(common::ManagedPointer(exec_ctx), MODE);
+  multi_checker.CheckCorrectness();
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, FilterProjectionCommonSubexpressionTest) {
+  // SELECT col1 * col2, col1 * col2 + param1 FROM test_1 WHERE col1 * col2 < param2 * 2;
+  // param1 = 10; param2 = 1000
+  // col1 * col2 is computed once per tuple by the scan, param2 * 2 once before the scan.
+  auto accessor = MakeAccessor();
+  auto table_oid = accessor->GetTableOid(NSOid(), "test_1");
+  auto table_schema = accessor->GetSchema(table_oid);
+  ExpressionMaker expr_maker;
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan;
+  OutputSchemaHelper seq_scan_out{0, &expr_maker};
+  {
+    // Get Table columns
+    auto cola_oid = table_schema.GetColumn("colA").Oid();
+    auto colb_oid = table_schema.GetColumn("colB").Oid();
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+    auto col2 = expr_maker.CVE(colb_oid, type::TypeId::INTEGER);
+    seq_scan_out.AddOutput("col1", common::ManagedPointer(col1));
+    seq_scan_out.AddOutput("col2", common::ManagedPointer(col2));
+    auto schema = seq_scan_out.MakeSchema();
+    // Make predicate
+    auto param2 = expr_maker.PVE(type::TypeId::INTEGER, 1);
+    auto predicate =
+        expr_maker.ComparisonLt(expr_maker.OpMul(col1, col2), expr_maker.OpMul(param2, expr_maker.Constant(2)));
+    // Build
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan = builder.SetOutputSchema(std::move(schema))
+                   .SetColumnOids({cola_oid, colb_oid})
+                   .SetScanPredicate(predicate)
+                   .SetIsForUpdateFlag(false)
+                   .SetNamespaceOid(NSOid())
+                   .SetTableOid(table_oid)
+                   .Build();
+  }
+  std::unique_ptr<planner::AbstractPlanNode> proj;
+  OutputSchemaHelper proj_out{0, &expr_maker};
+  {
+    auto col1 = seq_scan_out.GetOutput("col1");
+    auto col2 = seq_scan_out.GetOutput("col2");
+    auto param1 = expr_maker.PVE(type::TypeId::INTEGER, 0);
+    auto product = expr_maker.OpMul(col1, col2);
+    auto plus_param = expr_maker.OpSum(expr_maker.OpMul(col1, col2), param1);
+    proj_out.AddOutput("product", common::ManagedPointer(product));
+    proj_out.AddOutput("plus_param", common::ManagedPointer(plus_param));
+    auto schema = proj_out.MakeSchema();
+    planner::ProjectionPlanNode::Builder builder;
+    proj = builder.SetOutputSchema(std::move(schema)).AddChild(std::move(seq_scan)).Build();
+  }
+
+  // Make the output checkers
+  SingleIntComparisonChecker product_checker(std::less<>(), 0, 2000);
+  RowChecker row_checker = [](const std::vector<sql::Val *> &vals) {
+    auto product = static_cast<sql::Integer *>(vals[0]);
+    auto plus_param = static_cast<sql::Integer *>(vals[1]);
+    EXPECT_EQ(plus_param->val_, product->val_ + 10);
+  };
+  GenericChecker row_values_checker(row_checker, {});
+  MultiChecker multi_checker{std::vector<OutputChecker *>{&product_checker, &row_values_checker}};
+
+  // Create the execution context
+  OutputStore store{&multi_checker, proj->GetOutputSchema().Get()};
+  exec::OutputPrinter printer(proj->GetOutputSchema().Get());
+  MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+  auto exec_ctx = MakeExecCtx(std::move(callback), proj->GetOutputSchema().Get());
+  std::vector<type::TransientValue> params;
+  params.emplace_back(type::TransientValueFactory::GetInteger(10));
+  params.emplace_back(type::TransientValueFactory::GetInteger(1000));
+  exec_ctx->SetParams(std::move(params));
+
+  // Run & Check
+  auto executable = ExecutableQuery(common::ManagedPointer(proj), common::ManagedPointer(exec_ctx));
+  executable.Run(common::ManagedPointer(exec_ctx), MODE);
+  multi_checker.CheckCorrectness();
+}
+
 // NOLINTNEXTLINE
 TEST_F(CompilerTest, SimpleSeqScanWithParamsTest) {
   // SELECT col1, col2, col1 * col2, col1 >= param1*col2 FROM test_1 WHERE col1 < param2 AND col2 >= param3;
@@ -607,33 +904,206 @@ TEST_F(CompilerTest, SimpleAggregateTest) {
   {
     // Read previous output
     auto col1 = seq_scan_out.GetOutput("col1");
-    auto col2 = seq_scan_out.GetOutput("col2");
+    auto col2 = seq_scan_out.GetOutput("col2");
+    // Add group by term
+    agg_out.AddGroupByTerm("col2", col2);
+    // Add aggregates
+    auto sum_col1 = expr_maker.AggSum(col1);
+    agg_out.AddAggTerm("sum_col1", sum_col1);
+    // Make the output expressions
+    agg_out.AddOutput("col2", agg_out.GetGroupByTermForOutput("col2"));
+    agg_out.AddOutput("sum_col1", agg_out.GetAggTermForOutput("sum_col1"));
+    auto schema = agg_out.MakeSchema();
+    // Build
+    planner::AggregatePlanNode::Builder builder;
+    agg = builder.SetOutputSchema(std::move(schema))
+              .AddGroupByTerm(agg_out.GetGroupByTerm("col2"))
+              .AddAggregateTerm(agg_out.GetAggTerm("col1"))
+              .AddChild(std::move(seq_scan))
+              .SetAggregateStrategyType(planner::AggregateStrategyType::HASH)
+              .SetHavingClausePredicate(nullptr)
+              .Build();
+  }
+  // Make the checkers
+  NumChecker num_checker{10};
+  SingleIntSumChecker sum_checker{1, (1000 * 999) / 2};
+  MultiChecker multi_checker{std::vector<OutputChecker *>{&num_checker, &sum_checker}};
+
+  // Compile and Run
+  OutputStore store{&multi_checker, agg->GetOutputSchema().Get()};
+  exec::OutputPrinter printer(agg->GetOutputSchema().Get());
+  MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+  auto exec_ctx = MakeExecCtx(std::move(callback), agg->GetOutputSchema().Get());
+
+  // Run & Check
+  auto executable = ExecutableQuery(common::ManagedPointer(agg), common::ManagedPointer(exec_ctx));
+  executable.Run(common::ManagedPointer(exec_ctx), MODE);
+  multi_checker.CheckCorrectness();
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, SortedAggregateTest) {
+  // SELECT col2, SUM(col1) FROM (SELECT col1, col2 FROM test_1 WHERE col1 < 1000 ORDER BY col2) GROUP BY col2;
+  // Same as SimpleAggregateTest, but the input is sorted on the group by term, so the groups are streamed
+  // Get accessor
+  auto accessor = MakeAccessor();
+  ExpressionMaker expr_maker;
+  auto table_oid = accessor->GetTableOid(NSOid(), "test_1");
+  auto table_schema = accessor->GetSchema(table_oid);
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan;
+  OutputSchemaHelper seq_scan_out{0, &expr_maker};
+  {
+    // OIDs
+    auto cola_oid = table_schema.GetColumn("colA").Oid();
+    auto colb_oid = table_schema.GetColumn("colB").Oid();
+    // Get Table columns
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+    auto col2 = expr_maker.CVE(colb_oid, type::TypeId::INTEGER);
+    seq_scan_out.AddOutput("col1", col1);
+    seq_scan_out.AddOutput("col2", col2);
+    auto schema = seq_scan_out.MakeSchema();
+    // Make predicate
+    auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(1000));
+    // Build
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan = builder.SetOutputSchema(std::move(schema))
+                   .SetColumnOids({cola_oid, colb_oid})
+                   .SetScanPredicate(predicate)
+                   .SetIsForUpdateFlag(false)
+                   .SetNamespaceOid(NSOid())
+                   .SetTableOid(table_oid)
+                   .Build();
+  }
+  // Order By
+  std::unique_ptr<planner::AbstractPlanNode> order_by;
+  OutputSchemaHelper order_by_out{0, &expr_maker};
+  {
+    auto col1 = seq_scan_out.GetOutput("col1");
+    auto col2 = seq_scan_out.GetOutput("col2");
+    order_by_out.AddOutput("col1", col1);
+    order_by_out.AddOutput("col2", col2);
+    auto schema = order_by_out.MakeSchema();
+    // Build
+    planner::OrderByPlanNode::Builder builder;
+    order_by = builder.SetOutputSchema(std::move(schema))
+                   .AddChild(std::move(seq_scan))
+                   .AddSortKey(col2, optimizer::OrderByOrderingType::ASC)
+                   .Build();
+  }
+  // Make the aggregate
+  std::unique_ptr<planner::AbstractPlanNode> agg;
+  OutputSchemaHelper agg_out{0, &expr_maker};
+  {
+    // Read previous output
+    auto col1 = order_by_out.GetOutput("col1");
+    auto col2 = order_by_out.GetOutput("col2");
+    // Add group by term
+    agg_out.AddGroupByTerm("col2", col2);
+    // Add aggregates
+    auto sum_col1 = expr_maker.AggSum(col1);
+    agg_out.AddAggTerm("sum_col1", sum_col1);
+    // Make the output expressions
+    agg_out.AddOutput("col2", agg_out.GetGroupByTermForOutput("col2"));
+    agg_out.AddOutput("sum_col1", agg_out.GetAggTermForOutput("sum_col1"));
+    auto schema = agg_out.MakeSchema();
+    // Build
+    planner::AggregatePlanNode::Builder builder;
+    agg = builder.SetOutputSchema(std::move(schema))
+              .AddGroupByTerm(agg_out.GetGroupByTerm("col2"))
+              .AddAggregateTerm(agg_out.GetAggTerm("col1"))
+              .AddChild(std::move(order_by))
+              .SetAggregateStrategyType(planner::AggregateStrategyType::SORTED)
+              .SetHavingClausePredicate(nullptr)
+              .Build();
+  }
+  // Make the checkers
+  NumChecker num_checker{10};
+  SingleIntSumChecker sum_checker{1, (1000 * 999) / 2};
+  MultiChecker multi_checker{std::vector<OutputChecker *>{&num_checker, &sum_checker}};
+
+  // Compile and Run
+  OutputStore store{&multi_checker, agg->GetOutputSchema().Get()};
+  exec::OutputPrinter printer(agg->GetOutputSchema().Get());
+  MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+  auto exec_ctx = MakeExecCtx(std::move(callback), agg->GetOutputSchema().Get());
+
+  // Run & Check
+  auto executable = ExecutableQuery(common::ManagedPointer(agg), common::ManagedPointer(exec_ctx));
+  executable.Run(common::ManagedPointer(exec_ctx), MODE);
+  multi_checker.CheckCorrectness();
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, VectorizedAggregateTest) {
+  // SELECT colA / 100, COUNT(colA), SUM(colA) FROM test_1 WHERE colA < 2000 GROUP BY colA / 100;
+  // The scan hands whole vectors to the aggregation, which processes them with @aggHTProcessBatch.
+  auto accessor = MakeAccessor();
+  ExpressionMaker expr_maker;
+  auto table_oid = accessor->GetTableOid(NSOid(), "test_1");
+  auto table_schema = accessor->GetSchema(table_oid);
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan;
+  OutputSchemaHelper seq_scan_out{0, &expr_maker};
+  {
+    // OIDs
+    auto cola_oid = table_schema.GetColumn("colA").Oid();
+    // Get Table columns
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+    seq_scan_out.AddOutput("col1", col1);
+    auto schema = seq_scan_out.MakeSchema();
+    // Make predicate
+    auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(2000));
+    // Build
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan = builder.SetOutputSchema(std::move(schema))
+                   .SetColumnOids({cola_oid})
+                   .SetScanPredicate(predicate)
+                   .SetIsForUpdateFlag(false)
+                   .SetNamespaceOid(NSOid())
+                   .SetTableOid(table_oid)
+                   .Build();
+  }
+  // Make the aggregate
+  std::unique_ptr<planner::AbstractPlanNode> agg;
+  OutputSchemaHelper agg_out{0, &expr_maker};
+  {
+    // Read previous output
+    auto col1 = seq_scan_out.GetOutput("col1");
     // Add group by term
-    agg_out.AddGroupByTerm("col2", col2);
+    agg_out.AddGroupByTerm("group", expr_maker.OpDiv(col1, expr_maker.Constant(100)));
     // Add aggregates
-    auto sum_col1 = expr_maker.AggSum(col1);
-    agg_out.AddAggTerm("sum_col1", sum_col1);
+    agg_out.AddAggTerm("count_col1", expr_maker.AggCount(col1));
+    agg_out.AddAggTerm("sum_col1", expr_maker.AggSum(col1));
     // Make the output expressions
-    agg_out.AddOutput("col2", agg_out.GetGroupByTermForOutput("col2"));
+    agg_out.AddOutput("group", agg_out.GetGroupByTermForOutput("group"));
+    agg_out.AddOutput("count_col1", agg_out.GetAggTermForOutput("count_col1"));
     agg_out.AddOutput("sum_col1", agg_out.GetAggTermForOutput("sum_col1"));
     auto schema = agg_out.MakeSchema();
     // Build
     planner::AggregatePlanNode::Builder builder;
     agg = builder.SetOutputSchema(std::move(schema))
-              .AddGroupByTerm(agg_out.GetGroupByTerm("col2"))
-              .AddAggregateTerm(agg_out.GetAggTerm("col1"))
+              .AddGroupByTerm(agg_out.GetGroupByTerm("group"))
+              .AddAggregateTerm(agg_out.GetAggTerm("count_col1"))
+              .AddAggregateTerm(agg_out.GetAggTerm("sum_col1"))
               .AddChild(std::move(seq_scan))
               .SetAggregateStrategyType(planner::AggregateStrategyType::HASH)
               .SetHavingClausePredicate(nullptr)
               .Build();
   }
-  // Make the checkers
-  NumChecker num_checker{10};
-  SingleIntSumChecker sum_checker{1, (1000 * 999) / 2};
-  MultiChecker multi_checker{std::vector<OutputChecker *>{&num_checker, &sum_checker}};
+  // Make the checkers: every group holds 100 consecutive values
+  uint32_t num_output_rows = 0;
+  RowChecker row_checker = [&num_output_rows](const std::vector<sql::Val *> &vals) {
+    auto group = static_cast<sql::Integer *>(vals[0]);
+    auto count = static_cast<sql::Integer *>(vals[1]);
+    auto sum = static_cast<sql::Integer *>(vals[2]);
+    EXPECT_EQ(count->val_, 100);
+    EXPECT_EQ(sum->val_, group->val_ * 100 * 100 + (99 * 100) / 2);
+    num_output_rows++;
+  };
+  CorrectnessFn correctness_fn = [&num_output_rows]() { EXPECT_EQ(num_output_rows, 20); };
+  GenericChecker checker(row_checker, correctness_fn);
 
   // Compile and Run
-  OutputStore store{&multi_checker, agg->GetOutputSchema().Get()};
+  OutputStore store{&checker, agg->GetOutputSchema().Get()};
   exec::OutputPrinter printer(agg->GetOutputSchema().Get());
   MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
   auto exec_ctx = MakeExecCtx(std::move(callback), agg->GetOutputSchema().Get());
@@ -641,7 +1111,7 @@ TEST_F(CompilerTest, SimpleAggregateTest) {
   // Run & Check
   auto executable = ExecutableQuery(common::ManagedPointer(agg), common::ManagedPointer(exec_ctx));
   executable.Run(common::ManagedPointer(exec_ctx), MODE);
-  multi_checker.CheckCorrectness();
+  checker.CheckCorrectness();
 }
 
 // NOLINTNEXTLINE
@@ -918,6 +1388,257 @@ TEST_F(CompilerTest, SimpleHashJoinTest) {
   checker.CheckCorrectness();
 }
 
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, ConciseHashJoinTest) {
+  // SELECT t1.col1, t2.col1, t2.col2, t1.col1 + t2.col2 FROM t1 INNER JOIN t2 ON t1.col1=t2.col1
+  // WHERE t1.col1 < 500 AND t2.col1 < 80
+  // Same as SimpleHashJoinTest, but the hash table is built as a concise hash table
+  // Get accessor
+  auto accessor = MakeAccessor();
+  ExpressionMaker expr_maker;
+  auto table_oid1 = accessor->GetTableOid(NSOid(), "test_1");
+  auto table_oid2 = accessor->GetTableOid(NSOid(), "test_2");
+  auto table_schema1 = accessor->GetSchema(table_oid1);
+  auto table_schema2 = accessor->GetSchema(table_oid2);
+
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan1;
+  OutputSchemaHelper seq_scan_out1{0, &expr_maker};
+  {
+    // OIDs
+    auto cola_oid = table_schema1.GetColumn("colA").Oid();
+    auto colb_oid = table_schema1.GetColumn("colB").Oid();
+    // Get Table columns
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+    auto col2 = expr_maker.CVE(colb_oid, type::TypeId::INTEGER);
+    seq_scan_out1.AddOutput("col1", col1);
+    seq_scan_out1.AddOutput("col2", col2);
+    auto schema = seq_scan_out1.MakeSchema();
+    // Make predicate
+    auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(1000));
+    // Build
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan1 = builder.SetOutputSchema(std::move(schema))
+                    .SetColumnOids({cola_oid, colb_oid})
+                    .SetScanPredicate(predicate)
+                    .SetIsForUpdateFlag(false)
+                    .SetNamespaceOid(NSOid())
+                    .SetTableOid(table_oid1)
+                    .Build();
+  }
+  // Make the second seq scan
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan2;
+  OutputSchemaHelper seq_scan_out2{1, &expr_maker};
+  {
+    // OIDs
+    auto cola_oid = table_schema2.GetColumn("col1").Oid();
+    auto colb_oid = table_schema2.GetColumn("col2").Oid();
+    // Get Table columns
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::SMALLINT);
+    auto col2 = expr_maker.CVE(colb_oid, type::TypeId::INTEGER);
+    seq_scan_out2.AddOutput("col1", col1);
+    seq_scan_out2.AddOutput("col2", col2);
+    auto schema = seq_scan_out2.MakeSchema();
+    auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(80));
+    // Build
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan2 = builder.SetOutputSchema(std::move(schema))
+                    .SetColumnOids({cola_oid, colb_oid})
+                    .SetScanPredicate(predicate)
+                    .SetIsForUpdateFlag(false)
+                    .SetNamespaceOid(NSOid())
+                    .SetTableOid(table_oid2)
+                    .Build();
+  }
+  // Make hash join
+  std::unique_ptr<planner::AbstractPlanNode> hash_join;
+  OutputSchemaHelper hash_join_out{0, &expr_maker};
+  {
+    // t1.col1, and t1.col2
+    auto t1_col1 = seq_scan_out1.GetOutput("col1");
+    // t2.col1 and t2.col2
+    auto t2_col1 = seq_scan_out2.GetOutput("col1");
+    auto t2_col2 = seq_scan_out2.GetOutput("col2");
+    // t1.col2 + t2.col2
+    auto sum = expr_maker.OpSum(t1_col1, t2_col2);
+    // Output Schema
+    hash_join_out.AddOutput("t1.col1", t1_col1);
+    hash_join_out.AddOutput("t2.col1", t2_col1);
+    hash_join_out.AddOutput("t2.col2", t2_col2);
+    hash_join_out.AddOutput("sum", sum);
+    auto schema = hash_join_out.MakeSchema();
+    // Predicate
+    auto predicate = expr_maker.ComparisonEq(t1_col1, t2_col1);
+    // Build
+    planner::HashJoinPlanNode::Builder builder;
+    hash_join = builder.AddChild(std::move(seq_scan1))
+                    .AddChild(std::move(seq_scan2))
+                    .SetOutputSchema(std::move(schema))
+                    .AddLeftHashKey(t1_col1)
+                    .AddRightHashKey(t2_col1)
+                    .SetJoinType(planner::LogicalJoinType::INNER)
+                    .SetJoinPredicate(predicate)
+                    .SetUseConciseHashTable(true)
+                    .Build();
+  }
+  // Compile and Run
+  // 80 hundred rows should be outputted because of the WHERE clause
+  // The joined cols should be equal
+  // The 4th column is the sum of the 1nd and 3rd columns
+  uint32_t num_output_rows{0};
+  uint32_t num_expected_rows{80};
+  RowChecker row_checker = [&num_output_rows, num_expected_rows](const std::vector<sql::Val *> &vals) {
+    // Read cols
+    auto col1 = static_cast<sql::Integer *>(vals[0]);
+    auto col2 = static_cast<sql::Integer *>(vals[1]);
+    auto col3 = static_cast<sql::Integer *>(vals[2]);
+    auto col4 = static_cast<sql::Integer *>(vals[3]);
+    ASSERT_FALSE(col1->is_null_ || col2->is_null_);
+    // Check join cols
+    ASSERT_EQ(col1->val_, col2->val_);
+    // Check that col4 = col1 + col3
+    ASSERT_EQ(col4->val_, col1->val_ + col3->val_);
+    // Check the number of output row
+    num_output_rows++;
+    ASSERT_LE(num_output_rows, num_expected_rows);
+  };
+  CorrectnessFn correcteness_fn = [&num_output_rows, num_expected_rows]() {
+    ASSERT_EQ(num_output_rows, num_expected_rows);
+  };
+
+  GenericChecker checker(row_checker, correcteness_fn);
+
+  OutputStore store{&checker, hash_join->GetOutputSchema().Get()};
+  exec::OutputPrinter printer(hash_join->GetOutputSchema().Get());
+  MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+  auto exec_ctx = MakeExecCtx(std::move(callback), hash_join->GetOutputSchema().Get());
+
+  // Run & Check
+  auto executable = ExecutableQuery(common::ManagedPointer(hash_join), common::ManagedPointer(exec_ctx));
+  executable.Run(common::ManagedPointer(exec_ctx), MODE);
+  checker.CheckCorrectness();
+}
+
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, SemiAntiHashJoinTest) {
+  // SELECT t2.col1, t2.col2 FROM t2 WHERE t2.col1 < 100 AND [NOT] EXISTS (SELECT * FROM t1 WHERE t1.col1 = t2.col1
+  // AND t1.col1 < 40)
+  // Get accessor
+  auto accessor = MakeAccessor();
+  ExpressionMaker expr_maker;
+  auto table_oid1 = accessor->GetTableOid(NSOid(), "test_1");
+  auto table_oid2 = accessor->GetTableOid(NSOid(), "test_2");
+  auto table_schema1 = accessor->GetSchema(table_oid1);
+  auto table_schema2 = accessor->GetSchema(table_oid2);
+
+  for (const auto join_type : {planner::LogicalJoinType::SEMI, planner::LogicalJoinType::ANTI}) {
+    std::unique_ptr<planner::AbstractPlanNode> seq_scan1;
+    OutputSchemaHelper seq_scan_out1{0, &expr_maker};
+    {
+      // OIDs
+      auto cola_oid = table_schema1.GetColumn("colA").Oid();
+      auto colb_oid = table_schema1.GetColumn("colB").Oid();
+      // Get Table columns
+      auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+      auto col2 = expr_maker.CVE(colb_oid, type::TypeId::INTEGER);
+      seq_scan_out1.AddOutput("col1", col1);
+      seq_scan_out1.AddOutput("col2", col2);
+      auto schema = seq_scan_out1.MakeSchema();
+      // Make predicate
+      auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(40));
+      // Build
+      planner::SeqScanPlanNode::Builder builder;
+      seq_scan1 = builder.SetOutputSchema(std::move(schema))
+                      .SetColumnOids({cola_oid, colb_oid})
+                      .SetScanPredicate(predicate)
+                      .SetIsForUpdateFlag(false)
+                      .SetNamespaceOid(NSOid())
+                      .SetTableOid(table_oid1)
+                      .Build();
+    }
+    // Make the second seq scan
+    std::unique_ptr<planner::AbstractPlanNode> seq_scan2;
+    OutputSchemaHelper seq_scan_out2{1, &expr_maker};
+    {
+      // OIDs
+      auto cola_oid = table_schema2.GetColumn("col1").Oid();
+      auto colb_oid = table_schema2.GetColumn("col2").Oid();
+      // Get Table columns
+      auto col1 = expr_maker.CVE(cola_oid, type::TypeId::SMALLINT);
+      auto col2 = expr_maker.CVE(colb_oid, type::TypeId::INTEGER);
+      seq_scan_out2.AddOutput("col1", col1);
+      seq_scan_out2.AddOutput("col2", col2);
+      auto schema = seq_scan_out2.MakeSchema();
+      auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(100));
+      // Build
+      planner::SeqScanPlanNode::Builder builder;
+      seq_scan2 = builder.SetOutputSchema(std::move(schema))
+                      .SetColumnOids({cola_oid, colb_oid})
+                      .SetScanPredicate(predicate)
+                      .SetIsForUpdateFlag(false)
+                      .SetNamespaceOid(NSOid())
+                      .SetTableOid(table_oid2)
+                      .Build();
+    }
+    // Make hash join
+    std::unique_ptr<planner::AbstractPlanNode> hash_join;
+    OutputSchemaHelper hash_join_out{0, &expr_maker};
+    {
+      // t1.col1
+      auto t1_col1 = seq_scan_out1.GetOutput("col1");
+      // t2.col1 and t2.col2
+      auto t2_col1 = seq_scan_out2.GetOutput("col1");
+      auto t2_col2 = seq_scan_out2.GetOutput("col2");
+      // Output Schema: only the probe side
+      hash_join_out.AddOutput("t2.col1", t2_col1);
+      hash_join_out.AddOutput("t2.col2", t2_col2);
+      auto schema = hash_join_out.MakeSchema();
+      // Predicate
+      auto predicate = expr_maker.ComparisonEq(t1_col1, t2_col1);
+      // Build
+      planner::HashJoinPlanNode::Builder builder;
+      hash_join = builder.AddChild(std::move(seq_scan1))
+                      .AddChild(std::move(seq_scan2))
+                      .SetOutputSchema(std::move(schema))
+                      .AddLeftHashKey(t1_col1)
+                      .AddRightHashKey(t2_col1)
+                      .SetJoinType(join_type)
+                      .SetJoinPredicate(predicate)
+                      .Build();
+    }
+    // Compile and Run
+    // The semi join outputs each of the 40 probe rows with a match once, the anti join the other 60
+    const bool anti = join_type == planner::LogicalJoinType::ANTI;
+    uint32_t num_output_rows{0};
+    uint32_t num_expected_rows = anti ? 60 : 40;
+    RowChecker row_checker = [&num_output_rows, num_expected_rows, anti](const std::vector<sql::Val *> &vals) {
+      // Read cols
+      auto col1 = static_cast<sql::Integer *>(vals[0]);
+      ASSERT_FALSE(col1->is_null_);
+      // Check that the row has (or doesn't have) a match
+      ASSERT_EQ(!anti, col1->val_ < 40);
+      ASSERT_LT(col1->val_, 100);
+      // Check the number of output row
+      num_output_rows++;
+      ASSERT_LE(num_output_rows, num_expected_rows);
+    };
+    CorrectnessFn correcteness_fn = [&num_output_rows, num_expected_rows]() {
+      ASSERT_EQ(num_output_rows, num_expected_rows);
+    };
+
+    GenericChecker checker(row_checker, correcteness_fn);
+
+    OutputStore store{&checker, hash_join->GetOutputSchema().Get()};
+    exec::OutputPrinter printer(hash_join->GetOutputSchema().Get());
+    MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+    auto exec_ctx = MakeExecCtx(std::move(callback), hash_join->GetOutputSchema().Get());
+
+    // Run & Check
+    auto executable = ExecutableQuery(common::ManagedPointer(hash_join), common::ManagedPointer(exec_ctx));
+    executable.Run(common::ManagedPointer(exec_ctx), MODE);
+    checker.CheckCorrectness();
+  }
+}
+
 // NOLINTNEXTLINE
 TEST_F(CompilerTest, MultiWayHashJoinTest) {
   // SELECT t1.col1, t2.col1, t3.col1, t1.col1 + t2.col1 + t3.col1
@@ -1974,6 +2695,119 @@ TEST_F(CompilerTest, SimpleInsertTest) {
   }
 }
 
+// NOLINTNEXTLINE
+TEST_F(CompilerTest, ConstantBatchInsertTest) {
+  // INSERT INTO test_1 (colA, colB, colC, colD) VALUES (-1, 0, 0, 0), (-2, 1, 2, 3), ..., (-40, 39, 78, 117)
+  // as a constant batch, which the generated code reads as parameters. Then check that the following finds every row
+  // with the values of its own row:
+  // SELECT colA, colB, colC, colD FROM test_1 WHERE test_1.colA < 0.
+  auto accessor = MakeAccessor();
+  ExpressionMaker expr_maker;
+  auto table_oid1 = accessor->GetTableOid(NSOid(), "test_1");
+  auto index_oid1 = accessor->GetIndexOid(NSOid(), "index_1");
+  auto table_schema1 = accessor->GetSchema(table_oid1);
+
+  // Every column holds a different function of the row, so that reading a value of the wrong row or column shows
+  const uint32_t num_rows = 40;
+  parser::ConstantBatch batch(num_rows, 4);
+  for (uint32_t row = 0; row < num_rows; row++) {
+    const auto r = static_cast<int32_t>(row);
+    batch.SetValue(row, 0, type::TransientValueFactory::GetInteger(-1 - r));
+    batch.SetValue(row, 1, type::TransientValueFactory::GetInteger(r));
+    batch.SetValue(row, 2, type::TransientValueFactory::GetInteger(2 * r));
+    batch.SetValue(row, 3, type::TransientValueFactory::GetInteger(3 * r));
+  }
+
+  // make InsertPlanNode
+  std::unique_ptr<planner::AbstractPlanNode> insert;
+  {
+    planner::InsertPlanNode::Builder builder;
+    insert = builder.AddParameterInfo(table_schema1.GetColumn("colA").Oid())
+                 .AddParameterInfo(table_schema1.GetColumn("colB").Oid())
+                 .AddParameterInfo(table_schema1.GetColumn("colC").Oid())
+                 .AddParameterInfo(table_schema1.GetColumn("colD").Oid())
+                 .SetIndexOids({index_oid1})
+                 .SetConstantBatch(common::ManagedPointer(&batch))
+                 .SetNamespaceOid(NSOid())
+                 .SetTableOid(table_oid1)
+                 .Build();
+  }
+  // Execute insert, the batch is passed as the parameters like the TrafficCop does
+  {
+    MultiOutputCallback callback{std::vector<exec::OutputCallback>{}};
+    auto exec_ctx = MakeExecCtx(std::move(callback), insert->GetOutputSchema().Get());
+    exec_ctx->SetParams(common::ManagedPointer(&batch.GetValues()));
+    auto executable = ExecutableQuery(common::ManagedPointer(insert), common::ManagedPointer(exec_ctx));
+    executable.Run(common::ManagedPointer(exec_ctx), MODE);
+    EXPECT_EQ(exec_ctx->RowsAffected(), num_rows);
+  }
+
+  // Now scan through table to check content.
+  std::unique_ptr<planner::AbstractPlanNode> seq_scan;
+  OutputSchemaHelper seq_scan_out{0, &expr_maker};
+  {
+    // OIDs
+    auto cola_oid = table_schema1.GetColumn("colA").Oid();
+    auto colb_oid = table_schema1.GetColumn("colB").Oid();
+    auto colc_oid = table_schema1.GetColumn("colC").Oid();
+    auto cold_oid = table_schema1.GetColumn("colD").Oid();
+    // Get Table columns
+    auto col1 = expr_maker.CVE(cola_oid, type::TypeId::INTEGER);
+    auto col2 = expr_maker.CVE(colb_oid, type::TypeId::INTEGER);
+    auto col3 = expr_maker.CVE(colc_oid, type::TypeId::INTEGER);
+    auto col4 = expr_maker.CVE(cold_oid, type::TypeId::INTEGER);
+    seq_scan_out.AddOutput("col1", col1);
+    seq_scan_out.AddOutput("col2", col2);
+    seq_scan_out.AddOutput("col3", col3);
+    seq_scan_out.AddOutput("col4", col4);
+    // Make predicate
+    auto predicate = expr_maker.ComparisonLt(col1, expr_maker.Constant(0));
+    auto schema = seq_scan_out.MakeSchema();
+    // Build
+    planner::SeqScanPlanNode::Builder builder;
+    seq_scan = builder.SetOutputSchema(std::move(schema))
+                   .SetColumnOids({cola_oid, colb_oid, colc_oid, cold_oid})
+                   .SetScanPredicate(predicate)
+                   .SetIsForUpdateFlag(false)
+                   .SetNamespaceOid(NSOid())
+                   .SetTableOid(table_oid1)
+                   .Build();
+  }
+  // Create the checkers
+  uint32_t num_output_rows{0};
+  std::vector<bool> seen(num_rows, false);
+  RowChecker row_checker = [&num_output_rows, &seen, num_rows](const std::vector<sql::Val *> &vals) {
+    // Read cols
+    auto col1 = static_cast<sql::Integer *>(vals[0]);
+    auto col2 = static_cast<sql::Integer *>(vals[1]);
+    auto col3 = static_cast<sql::Integer *>(vals[2]);
+    auto col4 = static_cast<sql::Integer *>(vals[3]);
+    ASSERT_FALSE(col1->is_null_ || col2->is_null_ || col3->is_null_ || col4->is_null_);
+    const auto row = -1 - col1->val_;
+    ASSERT_GE(row, 0);
+    ASSERT_LT(row, static_cast<int64_t>(num_rows));
+    ASSERT_FALSE(seen[row]);
+    seen[row] = true;
+    ASSERT_EQ(col2->val_, row);
+    ASSERT_EQ(col3->val_, 2 * row);
+    ASSERT_EQ(col4->val_, 3 * row);
+    num_output_rows++;
+  };
+  CorrectnessFn correcteness_fn = [&num_output_rows, num_rows]() { ASSERT_EQ(num_output_rows, num_rows); };
+
+  // Execute Table Scan
+  {
+    GenericChecker checker(row_checker, correcteness_fn);
+    OutputStore store{&checker, seq_scan->GetOutputSchema().Get()};
+    exec::OutputPrinter printer(seq_scan->GetOutputSchema().Get());
+    MultiOutputCallback callback{std::vector<exec::OutputCallback>{store, printer}};
+    auto exec_ctx = MakeExecCtx(std::move(callback), seq_scan->GetOutputSchema().Get());
+    auto executable = ExecutableQuery(common::ManagedPointer(seq_scan), common::ManagedPointer(exec_ctx));
+    executable.Run(common::ManagedPointer(exec_ctx), MODE);
+    checker.CheckCorrectness();
+  }
+}
+
 // NOLINTNEXTLINE
 TEST_F(CompilerTest, InsertIntoSelectWithParamTest) {
   // INSERT INTO test_1
@@ -42,6 +42,30 @@ uint32_t TaaTLt500(ProjectedColumnsIterator *pci) {
   return pci->NumSelected();
 }
 
+uint32_t TaaTGe0(ProjectedColumnsIterator *pci) {
+  pci->RunFilter([pci]() -> bool {
+    auto cola = *pci->Get<int32_t, false>(Col::A, nullptr);
+    return cola >= 0;
+  });
+  return pci->NumSelected();
+}
+
+uint32_t TaaTLt5000(ProjectedColumnsIterator *pci) {
+  pci->RunFilter([pci]() -> bool {
+    auto cola = *pci->Get<int32_t, false>(Col::A, nullptr);
+    return cola < 5000;
+  });
+  return pci->NumSelected();
+}
+
+uint32_t TaaTGe5000(ProjectedColumnsIterator *pci) {
+  pci->RunFilter([pci]() -> bool {
+    auto cola = *pci->Get<int32_t, false>(Col::A, nullptr);
+    return cola >= 5000;
+  });
+  return pci->NumSelected();
+}
+
 uint32_t HobbledTaaTLt500(ProjectedColumnsIterator *pci) {
   std::this_thread::sleep_for(std::chrono::milliseconds(50));
   return TaaTLt500(pci);
@@ -103,4 +127,70 @@ TEST_F(FilterManagerTest, AdaptiveFilterManagerTest) {
   EXPECT_EQ(1u, filter.GetOptimalFlavorForClause(0));
 }
 
+// NOLINTNEXTLINE
+TEST_F(FilterManagerTest, ClauseOrderFilterManagerTest) {
+  // The first clause lets everything through, the second is selective. The
+  // manager should learn to run the second one first.
+  FilterManager filter(bandit::Policy::Kind::FixedAction);
+  filter.StartNewClause();
+  filter.InsertClauseFlavor(TaaTGe0);
+  filter.StartNewClause();
+  filter.InsertClauseFlavor(TaaTLt500);
+  filter.Finalize();
+  EXPECT_EQ((std::vector<uint32_t>{0, 1}), filter.GetOptimalClauseOrder());
+
+  auto table_oid = exec_ctx_->GetAccessor()->GetTableOid(NSOid(), "test_1");
+  std::array<uint32_t, 1> col_oids{1};
+  TableVectorIterator tvi(exec_ctx_.get(), !table_oid, col_oids.data(), static_cast<uint32_t>(col_oids.size()));
+  for (tvi.Init(); tvi.Advance();) {
+    auto *pci = tvi.GetProjectedColumnsIterator();
+
+    // Run the filters
+    filter.RunFilters(pci);
+
+    // Check
+    pci->ForEach([pci]() {
+      auto cola = *pci->Get<int32_t, false>(Col::A, nullptr);
+      EXPECT_LT(cola, 500);
+    });
+  }
+
+  EXPECT_EQ((std::vector<uint32_t>{1, 0}), filter.GetOptimalClauseOrder());
+}
+
+// NOLINTNEXTLINE
+TEST_F(FilterManagerTest, ShiftingClauseOrderFilterManagerTest) {
+  // colA is serial, so the first clause lets the first half of the table
+  // through and the second clause the second half. Each one is the selective
+  // clause for half of the scan, and re-sampling should follow the shift.
+  FilterManager filter(bandit::Policy::Kind::FixedAction);
+  filter.StartNewClause();
+  filter.InsertClauseFlavor(TaaTLt5000);
+  filter.StartNewClause();
+  filter.InsertClauseFlavor(TaaTGe5000);
+  filter.Finalize();
+
+  auto table_oid = exec_ctx_->GetAccessor()->GetTableOid(NSOid(), "test_1");
+  std::array<uint32_t, 1> col_oids{1};
+  TableVectorIterator tvi(exec_ctx_.get(), !table_oid, col_oids.data(), static_cast<uint32_t>(col_oids.size()));
+  bool first_vector = true;
+  for (tvi.Init(); tvi.Advance();) {
+    auto *pci = tvi.GetProjectedColumnsIterator();
+
+    // Run the filters
+    filter.RunFilters(pci);
+    if (first_vector) {
+      // Only rows below 5000 so far, the second clause discards all of them
+      EXPECT_EQ((std::vector<uint32_t>{1, 0}), filter.GetOptimalClauseOrder());
+      first_vector = false;
+    }
+
+    // No row passes both clauses
+    EXPECT_EQ(0u, pci->NumSelected());
+  }
+
+  // The last rows are all at least 5000, so the first clause is the selective one now
+  EXPECT_EQ((std::vector<uint32_t>{0, 1}), filter.GetOptimalClauseOrder());
+}
+
 }  // namespace terrier::execution::sql::test
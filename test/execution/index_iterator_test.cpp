@@ -59,7 +59,7 @@ TEST_F(IndexIteratorTest, SimpleIndexIteratorTest) {
       val = nullptr;
       // Get indirectly from tuple slot
       storage::TupleSlot slot(index_iter.CurrentSlot());
-      ASSERT_TRUE(sql_table->Select(exec_ctx_->GetTxn(), slot, index_iter.TablePR()));
+      ASSERT_TRUE(sql_table->Select(exec_ctx_->GetTxn(), slot, index_iter.TablePR(), storage::INITIAL_LAYOUT_VERSION));
       val = table_pr->Get<int32_t, false>(0, nullptr);
       ASSERT_EQ(*key, *val);
 
@@ -53,7 +53,8 @@ class JoinHashTableVectorProbeTest : public SqlBasedTest {
       col_oids.emplace_back(col.Oid());
     }
 
-    auto pc_init = sql_table->InitializerForProjectedColumns(col_oids, common::Constants::K_DEFAULT_VECTOR_SIZE);
+    auto pc_init = sql_table->InitializerForProjectedColumns(col_oids, common::Constants::K_DEFAULT_VECTOR_SIZE,
+                                                             storage::INITIAL_LAYOUT_VERSION);
     buffer_ = common::AllocationUtil::AllocateAligned(pc_init.ProjectedColumnsSize());
     projected_columns_ = pc_init.Initialize(buffer_);
     projected_columns_->SetNumTuples(common::Constants::K_DEFAULT_VECTOR_SIZE);
@@ -177,6 +178,106 @@ TEST_F(JoinHashTableVectorProbeTest, SimpleGenericLookupTest) {
   EXPECT_EQ(num_probe, count);
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashTableVectorProbeTest, SimpleConciseLookupTest) {
+  constexpr const uint8_t n = 1;
+  constexpr const uint32_t num_build = 1000;
+  constexpr const uint32_t num_probe = num_build * 10;
+
+  // Create test JHT
+  auto jht = InsertAndBuild<n>(/*concise*/ true, num_build, Seq(0));
+
+  // Create test probe input
+  auto probe_keys = std::vector<uint32_t>(num_probe);
+  std::generate(probe_keys.begin(), probe_keys.end(), Range(0, num_build - 1));
+
+  auto *projected_columns = GetProjectedColumns();
+  ProjectedColumnsIterator pci(projected_columns);
+
+  // Lookup
+  JoinHashTableVectorProbe lookup(*jht);
+
+  // Loop over all matches
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < num_probe; i += projected_columns->MaxTuples()) {
+    uint32_t size = std::min(projected_columns->MaxTuples(), num_probe - i);
+
+    // Setup Projected Column
+    projected_columns->SetNumTuples(size);
+    std::memcpy(projected_columns->ColumnStart(0), &probe_keys[i], size * sizeof(uint32_t));
+    pci.SetProjectedColumn(projected_columns);
+
+    // Lookup
+    lookup.Prepare(&pci, HashTupleInPCI<n>);
+
+    // Iterate all
+    while (const auto *entry = lookup.GetNextOutput(&pci, CmpTupleInPCI<n>)) {
+      count++;
+      auto ht_key = entry->PayloadAs<Tuple<n>>()->build_key_;
+      auto probe_key = *pci.Get<uint32_t, false>(0, nullptr);
+      EXPECT_EQ(ht_key, probe_key);
+    }
+  }
+
+  EXPECT_EQ(num_probe, count);
+
+  // An exhausted vector keeps returning no match
+  EXPECT_EQ(nullptr, lookup.GetNextOutput(&pci, CmpTupleInPCI<n>));
+
+  // So does an empty one
+  projected_columns->SetNumTuples(0);
+  pci.SetProjectedColumn(projected_columns);
+  lookup.Prepare(&pci, HashTupleInPCI<n>);
+  EXPECT_EQ(nullptr, lookup.GetNextOutput(&pci, CmpTupleInPCI<n>));
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashTableVectorProbeTest, FilterMatchesTest) {
+  constexpr const uint8_t n = 1;
+  constexpr const uint32_t num_build = 1000;
+  constexpr const uint32_t num_probe = num_build * 10;
+
+  // Create test JHT
+  auto jht = InsertAndBuild<n>(/*concise*/ false, num_build, Seq(0));
+
+  // Create test probe input, about half of which has a match
+  auto probe_keys = std::vector<uint32_t>(num_probe);
+  std::generate(probe_keys.begin(), probe_keys.end(), Range(0, 2 * num_build - 1));
+  const auto num_matching = static_cast<uint32_t>(
+      std::count_if(probe_keys.begin(), probe_keys.end(), [&](uint32_t key) { return key < num_build; }));
+
+  auto *projected_columns = GetProjectedColumns();
+  ProjectedColumnsIterator pci(projected_columns);
+
+  // Lookup
+  JoinHashTableVectorProbe lookup(*jht);
+
+  for (const bool anti : {false, true}) {
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < num_probe; i += projected_columns->MaxTuples()) {
+      uint32_t size = std::min(projected_columns->MaxTuples(), num_probe - i);
+
+      // Setup Projected Column
+      projected_columns->SetNumTuples(size);
+      std::memcpy(projected_columns->ColumnStart(0), &probe_keys[i], size * sizeof(uint32_t));
+      pci.SetProjectedColumn(projected_columns);
+
+      // Filter
+      lookup.Prepare(&pci, HashTupleInPCI<n>);
+      lookup.FilterMatches(&pci, CmpTupleInPCI<n>, anti);
+
+      // Only the tuples with (or without) a match remain, each of them exactly once
+      for (; pci.HasNextFiltered(); pci.AdvanceFiltered()) {
+        count++;
+        auto probe_key = *pci.Get<uint32_t, false>(0, nullptr);
+        EXPECT_EQ(!anti, probe_key < num_build);
+      }
+    }
+
+    EXPECT_EQ(anti ? num_probe - num_matching : num_matching, count);
+  }
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashTableVectorProbeTest, DISABLED_PerfLookupTest) {
   auto bench = [this](bool concise) {
@@ -84,7 +84,7 @@ TEST_F(PRFillerTest, SimpleIndexFillerTest) {
   for (const auto &col : table_schema.GetColumns()) {
     col_oids.emplace_back(col.Oid());
   }
-  storage::ProjectionMap table_pm(table->ProjectionMapForOids(col_oids));
+  storage::ProjectionMap table_pm(table->ProjectionMapForOids(col_oids, storage::INITIAL_LAYOUT_VERSION));
 
   // Create pr filler
   CodeGen codegen(exec_ctx.get());
@@ -105,7 +105,7 @@ TEST_F(PRFillerTest, SimpleIndexFillerTest) {
   ASSERT_TRUE(module->GetFunction(fn_name, vm::ExecutionMode::Interpret, &filler_fn));
 
   // Try it out.
-  auto table_init = table->InitializerForProjectedRow(col_oids);
+  auto table_init = table->InitializerForProjectedRow(col_oids, storage::INITIAL_LAYOUT_VERSION);
   auto table_buffer = common::AllocationUtil::AllocateAligned(table_init.ProjectedRowSize());
   auto table_pr = table_init.InitializeRow(table_buffer);
   auto index_init = index->GetProjectedRowInitializer();
@@ -155,8 +155,9 @@ class ProjectedColumnsIteratorTest : public SqlBasedTest {
     for (const auto &col : schema.GetColumns()) {
       col_oids.emplace_back(col.Oid());
     }
-    auto pc_init = sql_table->InitializerForProjectedColumns(col_oids, common::Constants::K_DEFAULT_VECTOR_SIZE);
-    pm_ = sql_table->ProjectionMapForOids(col_oids);
+    auto pc_init = sql_table->InitializerForProjectedColumns(col_oids, common::Constants::K_DEFAULT_VECTOR_SIZE,
+                                                             storage::INITIAL_LAYOUT_VERSION);
+    pm_ = sql_table->ProjectionMapForOids(col_oids, storage::INITIAL_LAYOUT_VERSION);
     buffer_ = common::AllocationUtil::AllocateAligned(pc_init.ProjectedColumnsSize());
     projected_columns_ = pc_init.Initialize(buffer_);
     projected_columns_->SetNumTuples(common::Constants::K_DEFAULT_VECTOR_SIZE);
@@ -452,4 +453,41 @@ TEST_F(ProjectedColumnsIteratorTest, MultipleVectorizedFilterTest) {
   EXPECT_LE(count, 10u);
 }
 
+// NOLINTNEXTLINE
+TEST_F(ProjectedColumnsIteratorTest, NullableVectorizedFilterTest) {
+  //
+  // Filter on col_b > 0, a nullable column. Like a SQL comparison, the filter
+  // must drop the NULL values whatever their slots in the column hold.
+  //
+
+  ProjectedColumnsIterator iter(GetProjectedColumn());
+  SetSize(common::Constants::K_DEFAULT_VECTOR_SIZE);
+
+  // Compute expected result
+  uint32_t expected = 0;
+  for (; iter.HasNext(); iter.Advance()) {
+    bool null = false;
+    auto val = *iter.Get<int32_t, true>(GetColOffset(ColId::col_b), &null);
+    if (!null && val > 0) {
+      expected++;
+    }
+  }
+
+  // Filter
+  iter.FilterColByVal<std::greater>(GetColOffset(ColId::col_b), type::TypeId::INTEGER,
+                                    ProjectedColumnsIterator::FilterVal{.i_ = 0});
+
+  // Check
+  uint32_t count = 0;
+  for (; iter.HasNextFiltered(); iter.AdvanceFiltered()) {
+    bool null = false;
+    auto val = *iter.Get<int32_t, true>(GetColOffset(ColId::col_b), &null);
+    EXPECT_FALSE(null);
+    EXPECT_GT(val, 0);
+    count++;
+  }
+
+  EXPECT_EQ(expected, count);
+}
+
 }  // namespace terrier::execution::sql::test
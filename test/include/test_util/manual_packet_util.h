@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <sys/un.h>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -64,20 +65,27 @@ class ManualPacketUtil {
     int64_t ret UNUSED_ATTRIBUTE = connect(socket_fd, reinterpret_cast<sockaddr *>(&serv_addr), sizeof(serv_addr));
     TERRIER_ASSERT(ret >= 0, "Connector Error");
 
-    auto io_socket = std::make_unique<NetworkIoWrapper>(socket_fd);
-    PostgresPacketWriter writer(io_socket->GetWriteQueue());
+    return StartSession(socket_fd);
+  }
 
-    std::unordered_map<std::string, std::string> params{
-        {"user", catalog::DEFAULT_DATABASE}, {"database", catalog::DEFAULT_DATABASE}, {"application_name", "psql"}};
+  /**
+   * Same as StartConnection, but connects through the server's Unix domain socket
+   * @param socket_path path of the Unix domain socket
+   * @return the connected socket, or nullptr if the server closed the connection during startup
+   */
+  static std::unique_ptr<NetworkIoWrapper> StartUnixConnection(const std::string &socket_path) {
+    int socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    TERRIER_ASSERT(socket_fd >= 0, "Failed to create socket");
 
-    writer.WriteStartupRequest(params);
-    io_socket->FlushAllWrites();
+    struct sockaddr_un serv_addr;
+    memset(&serv_addr, 0, sizeof(serv_addr));
+    serv_addr.sun_family = AF_UNIX;
+    strncpy(serv_addr.sun_path, socket_path.c_str(), sizeof(serv_addr.sun_path) - 1);
 
-    bool success = ReadUntilReadyOrClose(common::ManagedPointer(io_socket));
-    if (!success) {
-      return nullptr;
-    }
-    return io_socket;
+    int64_t ret UNUSED_ATTRIBUTE = connect(socket_fd, reinterpret_cast<sockaddr *>(&serv_addr), sizeof(serv_addr));
+    TERRIER_ASSERT(ret >= 0, "Connector Error");
+
+    return StartSession(socket_fd);
   }
 
   /**
@@ -100,5 +108,23 @@ class ManualPacketUtil {
   static const int POSTGRES_PORT = 5432;
   // Read and write buffer size for the test
   static const uint32_t TEST_BUFFER_SIZE = 1000;
+
+  // Sends the startup packet on a connected socket and waits until the server is ready for queries
+  static std::unique_ptr<NetworkIoWrapper> StartSession(const int socket_fd) {
+    auto io_socket = std::make_unique<NetworkIoWrapper>(socket_fd);
+    PostgresPacketWriter writer(io_socket->GetWriteQueue());
+
+    std::unordered_map<std::string, std::string> params{
+        {"user", catalog::DEFAULT_DATABASE}, {"database", catalog::DEFAULT_DATABASE}, {"application_name", "psql"}};
+
+    writer.WriteStartupRequest(params);
+    io_socket->FlushAllWrites();
+
+    bool success = ReadUntilReadyOrClose(common::ManagedPointer(io_socket));
+    if (!success) {
+      return nullptr;
+    }
+    return io_socket;
+  }
 };
 }  // namespace terrier::network
@@ -389,8 +389,9 @@ class StorageTestUtil {
     bool result = true;
     for (auto &tuple : table_one_tuples) {
       TERRIER_ASSERT(tuple_slot_map.find(tuple) != tuple_slot_map.end(), "No mapping for this tuple slot");
-      table_one->Select(common::ManagedPointer(txn_one), tuple, row_one);
-      table_two->Select(common::ManagedPointer(txn_two), tuple_slot_map.at(tuple), row_two);
+      table_one->Select(common::ManagedPointer(txn_one), tuple, row_one, storage::INITIAL_LAYOUT_VERSION);
+      table_two->Select(common::ManagedPointer(txn_two), tuple_slot_map.at(tuple), row_two,
+                        storage::INITIAL_LAYOUT_VERSION);
       if (!ProjectionListEqualDeep(layout, row_one, row_two)) {
         result = false;
         break;
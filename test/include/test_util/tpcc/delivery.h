@@ -72,7 +72,8 @@ class Delivery {
         no_w_id_key_oid_(db->new_order_primary_index_schema_.GetColumn(0).Oid()),
 
         new_order_pr_initializer_(
-            db->new_order_table_->InitializerForProjectedRow({db->new_order_schema_.GetColumn(0).Oid()})),
+            db->new_order_table_->InitializerForProjectedRow({db->new_order_schema_.GetColumn(0).Oid()},
+                                                             storage::INITIAL_LAYOUT_VERSION)),
         no_o_id_key_pr_offset_(
             static_cast<uint8_t>(db->new_order_primary_index_->GetKeyOidToOffsetMap().at(no_o_id_key_oid_))),
         no_d_id_key_pr_offset_(
@@ -85,9 +86,11 @@ class Delivery {
         o_w_id_key_oid_(db->order_primary_index_schema_.GetColumn(0).Oid()),
 
         order_select_pr_initializer_(
-            db->order_table_->InitializerForProjectedRow({db->order_schema_.GetColumn(3).Oid()})),
+            db->order_table_->InitializerForProjectedRow({db->order_schema_.GetColumn(3).Oid()},
+                                                         storage::INITIAL_LAYOUT_VERSION)),
         order_update_pr_initializer_(
-            db->order_table_->InitializerForProjectedRow({db->order_schema_.GetColumn(5).Oid()})),
+            db->order_table_->InitializerForProjectedRow({db->order_schema_.GetColumn(5).Oid()},
+                                                         storage::INITIAL_LAYOUT_VERSION)),
         o_id_key_pr_offset_(static_cast<uint8_t>(db->order_primary_index_->GetKeyOidToOffsetMap().at(o_id_key_oid_))),
         o_d_id_key_pr_offset_(
             static_cast<uint8_t>(db->order_primary_index_->GetKeyOidToOffsetMap().at(o_d_id_key_oid_))),
@@ -102,9 +105,11 @@ class Delivery {
         ol_number_key_oid_(db->order_line_primary_index_schema_.GetColumn(3).Oid()),
 
         order_line_select_pr_initializer_(
-            db->order_line_table_->InitializerForProjectedRow({db->order_line_schema_.GetColumn(8).Oid()})),
+            db->order_line_table_->InitializerForProjectedRow({db->order_line_schema_.GetColumn(8).Oid()},
+                                                              storage::INITIAL_LAYOUT_VERSION)),
         order_line_update_pr_initializer_(
-            db->order_line_table_->InitializerForProjectedRow({db->order_line_schema_.GetColumn(6).Oid()})),
+            db->order_line_table_->InitializerForProjectedRow({db->order_line_schema_.GetColumn(6).Oid()},
+                                                              storage::INITIAL_LAYOUT_VERSION)),
         ol_o_id_key_pr_offset_(
             static_cast<uint8_t>(db->order_line_primary_index_->GetKeyOidToOffsetMap().at(ol_o_id_key_oid_))),
         ol_d_id_key_pr_offset_(
@@ -121,8 +126,10 @@ class Delivery {
         c_w_id_key_oid_(db->customer_primary_index_schema_.GetColumn(0).Oid()),
 
         customer_pr_initializer_(
-            db->customer_table_->InitializerForProjectedRow({c_balance_oid_, c_delivery_cnt_oid_})),
-        customer_pr_map_(db->customer_table_->ProjectionMapForOids({c_balance_oid_, c_delivery_cnt_oid_})),
+            db->customer_table_->InitializerForProjectedRow({c_balance_oid_, c_delivery_cnt_oid_},
+                                                            storage::INITIAL_LAYOUT_VERSION)),
+        customer_pr_map_(db->customer_table_->ProjectionMapForOids({c_balance_oid_, c_delivery_cnt_oid_},
+                                                                   storage::INITIAL_LAYOUT_VERSION)),
         c_balance_pr_offset_(static_cast<uint8_t>(customer_pr_map_.at(c_balance_oid_))),
         c_delivery_cnt_pr_offset_(static_cast<uint8_t>(customer_pr_map_.at(c_delivery_cnt_oid_))),
         c_id_key_pr_offset_(
@@ -33,8 +33,10 @@ struct Loader {
     // Item tuple
     const auto item_tuple_col_oids = Util::AllColOidsForSchema(db->item_schema_);
 
-    const auto item_tuple_pr_initializer = db->item_table_->InitializerForProjectedRow(item_tuple_col_oids);
-    const auto item_tuple_pr_map = db->item_table_->ProjectionMapForOids(item_tuple_col_oids);
+    const auto item_tuple_pr_initializer =
+        db->item_table_->InitializerForProjectedRow(item_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
+    const auto item_tuple_pr_map =
+        db->item_table_->ProjectionMapForOids(item_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
 
     // Item key
     const auto item_key_pr_initializer = db->item_primary_index_->GetProjectedRowInitializer();
@@ -44,8 +46,9 @@ struct Loader {
     const auto warehouse_tuple_col_oids = Util::AllColOidsForSchema(db->warehouse_schema_);
 
     const auto warehouse_tuple_pr_initializer =
-        db->warehouse_table_->InitializerForProjectedRow(warehouse_tuple_col_oids);
-    const auto warehouse_tuple_pr_map = db->warehouse_table_->ProjectionMapForOids(warehouse_tuple_col_oids);
+        db->warehouse_table_->InitializerForProjectedRow(warehouse_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
+    const auto warehouse_tuple_pr_map =
+        db->warehouse_table_->ProjectionMapForOids(warehouse_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
 
     // Warehouse key
     const auto warehouse_key_pr_initializer = db->warehouse_primary_index_->GetProjectedRowInitializer();
@@ -54,8 +57,10 @@ struct Loader {
     // Stock tuple
     const auto stock_tuple_col_oids = Util::AllColOidsForSchema(db->stock_schema_);
 
-    const auto stock_tuple_pr_initializer = db->stock_table_->InitializerForProjectedRow(stock_tuple_col_oids);
-    const auto stock_tuple_pr_map = db->stock_table_->ProjectionMapForOids(stock_tuple_col_oids);
+    const auto stock_tuple_pr_initializer =
+        db->stock_table_->InitializerForProjectedRow(stock_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
+    const auto stock_tuple_pr_map =
+        db->stock_table_->ProjectionMapForOids(stock_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
 
     // Stock key
     const auto stock_key_pr_initializer = db->stock_primary_index_->GetProjectedRowInitializer();
@@ -64,8 +69,10 @@ struct Loader {
     // District tuple
     const auto district_tuple_col_oids = Util::AllColOidsForSchema(db->district_schema_);
 
-    const auto district_tuple_pr_initializer = db->district_table_->InitializerForProjectedRow(district_tuple_col_oids);
-    const auto district_tuple_pr_map = db->district_table_->ProjectionMapForOids(district_tuple_col_oids);
+    const auto district_tuple_pr_initializer =
+        db->district_table_->InitializerForProjectedRow(district_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
+    const auto district_tuple_pr_map =
+        db->district_table_->ProjectionMapForOids(district_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
 
     // District key
     const auto district_key_pr_initializer = db->district_primary_index_->GetProjectedRowInitializer();
@@ -74,8 +81,10 @@ struct Loader {
     // Customer tuple
     const auto customer_tuple_col_oids = Util::AllColOidsForSchema(db->customer_schema_);
 
-    const auto customer_tuple_pr_initializer = db->customer_table_->InitializerForProjectedRow(customer_tuple_col_oids);
-    const auto customer_tuple_pr_map = db->customer_table_->ProjectionMapForOids(customer_tuple_col_oids);
+    const auto customer_tuple_pr_initializer =
+        db->customer_table_->InitializerForProjectedRow(customer_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
+    const auto customer_tuple_pr_map =
+        db->customer_table_->ProjectionMapForOids(customer_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
 
     // Customer key
     const auto customer_key_pr_initializer = db->customer_primary_index_->GetProjectedRowInitializer();
@@ -88,14 +97,18 @@ struct Loader {
     // History tuple
     const auto history_tuple_col_oids = Util::AllColOidsForSchema(db->history_schema_);
 
-    const auto history_tuple_pr_initializer = db->history_table_->InitializerForProjectedRow(history_tuple_col_oids);
-    const auto history_tuple_pr_map = db->history_table_->ProjectionMapForOids(history_tuple_col_oids);
+    const auto history_tuple_pr_initializer =
+        db->history_table_->InitializerForProjectedRow(history_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
+    const auto history_tuple_pr_map =
+        db->history_table_->ProjectionMapForOids(history_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
 
     // Order tuple
     const auto order_tuple_col_oids = Util::AllColOidsForSchema(db->order_schema_);
 
-    const auto order_tuple_pr_initializer = db->order_table_->InitializerForProjectedRow(order_tuple_col_oids);
-    const auto order_tuple_pr_map = db->order_table_->ProjectionMapForOids(order_tuple_col_oids);
+    const auto order_tuple_pr_initializer =
+        db->order_table_->InitializerForProjectedRow(order_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
+    const auto order_tuple_pr_map =
+        db->order_table_->ProjectionMapForOids(order_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
 
     // Order key
     const auto order_key_pr_initializer = db->order_primary_index_->GetProjectedRowInitializer();
@@ -109,8 +122,9 @@ struct Loader {
     const auto new_order_tuple_col_oids = Util::AllColOidsForSchema(db->new_order_schema_);
 
     const auto new_order_tuple_pr_initializer =
-        db->new_order_table_->InitializerForProjectedRow(new_order_tuple_col_oids);
-    const auto new_order_tuple_pr_map = db->new_order_table_->ProjectionMapForOids(new_order_tuple_col_oids);
+        db->new_order_table_->InitializerForProjectedRow(new_order_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
+    const auto new_order_tuple_pr_map =
+        db->new_order_table_->ProjectionMapForOids(new_order_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
 
     // New Order key
     const auto new_order_key_pr_initializer = db->new_order_primary_index_->GetProjectedRowInitializer();
@@ -120,8 +134,9 @@ struct Loader {
     const auto order_line_tuple_col_oids = Util::AllColOidsForSchema(db->order_line_schema_);
 
     const auto order_line_tuple_pr_initializer =
-        db->order_line_table_->InitializerForProjectedRow(order_line_tuple_col_oids);
-    const auto order_line_tuple_pr_map = db->order_line_table_->ProjectionMapForOids(order_line_tuple_col_oids);
+        db->order_line_table_->InitializerForProjectedRow(order_line_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
+    const auto order_line_tuple_pr_map =
+        db->order_line_table_->ProjectionMapForOids(order_line_tuple_col_oids, storage::INITIAL_LAYOUT_VERSION);
 
     // Order Line key
     const auto order_line_key_pr_initializer = db->order_line_primary_index_->GetProjectedRowInitializer();
@@ -145,7 +160,8 @@ struct Loader {
         auto *const item_redo = item_txn->StageWrite(db->db_oid_, db->item_table_oid_, item_tuple_pr_initializer);
         BuildItemTuple(i_id + 1, item_original[i_id], item_redo->Delta(), item_tuple_pr_map, db->item_schema_,
                        worker->generator_);
-        const auto item_slot = db->item_table_->Insert(common::ManagedPointer(item_txn), item_redo);
+        const auto item_slot =
+            db->item_table_->Insert(common::ManagedPointer(item_txn), item_redo, storage::INITIAL_LAYOUT_VERSION);
 
         // insert in index
         const auto *const item_key = BuildItemKey(i_id + 1, worker->item_key_buffer_, item_key_pr_initializer,
@@ -172,7 +188,8 @@ struct Loader {
             txn->StageWrite(db->db_oid_, db->warehouse_table_oid_, warehouse_tuple_pr_initializer);
         BuildWarehouseTuple(static_cast<int8_t>(w_id + 1), warehouse_redo->Delta(), warehouse_tuple_pr_map,
                             db->warehouse_schema_, worker->generator_);
-        const auto warehouse_slot = db->warehouse_table_->Insert(common::ManagedPointer(txn), warehouse_redo);
+        const auto warehouse_slot =
+            db->warehouse_table_->Insert(common::ManagedPointer(txn), warehouse_redo, storage::INITIAL_LAYOUT_VERSION);
 
         // insert in index
         const auto *const warehouse_key =
@@ -199,7 +216,8 @@ struct Loader {
             auto *const stock_redo = txn->StageWrite(db->db_oid_, db->stock_table_oid_, stock_tuple_pr_initializer);
             BuildStockTuple(s_i_id + 1, static_cast<int8_t>(w_id + 1), stock_original[s_i_id], stock_redo->Delta(),
                             stock_tuple_pr_map, db->stock_schema_, worker->generator_);
-            const auto stock_slot = db->stock_table_->Insert(common::ManagedPointer(txn), stock_redo);
+            const auto stock_slot =
+                db->stock_table_->Insert(common::ManagedPointer(txn), stock_redo, storage::INITIAL_LAYOUT_VERSION);
 
             // insert in index
             const auto *const stock_key =
@@ -220,7 +238,8 @@ struct Loader {
               txn->StageWrite(db->db_oid_, db->district_table_oid_, district_tuple_pr_initializer);
           BuildDistrictTuple(static_cast<int8_t>(d_id + 1), static_cast<int8_t>(w_id + 1), district_redo->Delta(),
                              district_tuple_pr_map, db->district_schema_, worker->generator_);
-          const auto district_slot = db->district_table_->Insert(common::ManagedPointer(txn), district_redo);
+          const auto district_slot =
+              db->district_table_->Insert(common::ManagedPointer(txn), district_redo, storage::INITIAL_LAYOUT_VERSION);
 
           // insert in index
           const auto *const district_key = BuildDistrictKey(
@@ -252,7 +271,8 @@ struct Loader {
                 txn->StageWrite(db->db_oid_, db->customer_table_oid_, customer_tuple_pr_initializer);
             BuildCustomerTuple(c_id + 1, static_cast<int8_t>(d_id + 1), static_cast<int8_t>(w_id + 1), c_credit[c_id],
                                customer_redo->Delta(), customer_tuple_pr_map, db->customer_schema_, worker->generator_);
-            const auto customer_slot = db->customer_table_->Insert(common::ManagedPointer(txn), customer_redo);
+            const auto customer_slot = db->customer_table_->Insert(common::ManagedPointer(txn), customer_redo,
+                                                                   storage::INITIAL_LAYOUT_VERSION);
 
             // insert in index
             const auto *const customer_key = BuildCustomerKey(
@@ -294,7 +314,7 @@ struct Loader {
                 txn->StageWrite(db->db_oid_, db->history_table_oid_, history_tuple_pr_initializer);
             BuildHistoryTuple(c_id + 1, static_cast<int8_t>(d_id + 1), static_cast<int8_t>(w_id + 1),
                               history_redo->Delta(), history_tuple_pr_map, db->history_schema_, worker->generator_);
-            db->history_table_->Insert(common::ManagedPointer(txn), history_redo);
+            db->history_table_->Insert(common::ManagedPointer(txn), history_redo, storage::INITIAL_LAYOUT_VERSION);
 
             // For each row in the DISTRICT table:
             // 3,000 rows in the ORDER table
@@ -305,7 +325,8 @@ struct Loader {
             const auto order_results =
                 BuildOrderTuple(o_id + 1, o_c_ids[c_id], static_cast<int8_t>(d_id + 1), static_cast<int8_t>(w_id + 1),
                                 order_redo->Delta(), order_tuple_pr_map, db->order_schema_, worker->generator_);
-            const auto order_slot = db->order_table_->Insert(common::ManagedPointer(txn), order_redo);
+            const auto order_slot =
+                db->order_table_->Insert(common::ManagedPointer(txn), order_redo, storage::INITIAL_LAYOUT_VERSION);
 
             // insert in index
             const auto *const order_key = BuildOrderKey(
@@ -335,7 +356,8 @@ struct Loader {
                                   static_cast<int8_t>(ol_number + 1), order_results.o_entry_d_,
                                   order_line_redo->Delta(), order_line_tuple_pr_map, db->order_line_schema_,
                                   worker->generator_);
-              const auto order_line_slot = db->order_line_table_->Insert(common::ManagedPointer(txn), order_line_redo);
+              const auto order_line_slot = db->order_line_table_->Insert(common::ManagedPointer(txn), order_line_redo,
+                                                                         storage::INITIAL_LAYOUT_VERSION);
 
               // insert in index
               const auto *const order_line_key = BuildOrderLineKey(
@@ -356,7 +378,8 @@ struct Loader {
                   txn->StageWrite(db->db_oid_, db->new_order_table_oid_, new_order_tuple_pr_initializer);
               BuildNewOrderTuple(o_id + 1, static_cast<int8_t>(d_id + 1), static_cast<int8_t>(w_id + 1),
                                  new_order_redo->Delta(), new_order_tuple_pr_map, db->new_order_schema_);
-              const auto new_order_slot = db->new_order_table_->Insert(common::ManagedPointer(txn), new_order_redo);
+              const auto new_order_slot = db->new_order_table_->Insert(common::ManagedPointer(txn), new_order_redo,
+                                                                       storage::INITIAL_LAYOUT_VERSION);
 
               // insert in index
               const auto *const new_order_key = BuildNewOrderKey(
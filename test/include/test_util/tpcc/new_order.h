@@ -140,30 +140,36 @@ class NewOrder {
 
       :  // Warehouse metadata
         warehouse_select_pr_initializer_(
-            db->warehouse_table_->InitializerForProjectedRow({db->warehouse_schema_.GetColumn(7).Oid()})),
+            db->warehouse_table_->InitializerForProjectedRow({db->warehouse_schema_.GetColumn(7).Oid()},
+                                                             storage::INITIAL_LAYOUT_VERSION)),
 
         // District metadata
         d_tax_oid_(db->district_schema_.GetColumn(8).Oid()),
         d_next_o_id_oid_(db->district_schema_.GetColumn(10).Oid()),
         district_select_pr_initializer_(
-            db->district_table_->InitializerForProjectedRow({d_tax_oid_, d_next_o_id_oid_})),
-        district_select_pr_map_(db->district_table_->ProjectionMapForOids({d_tax_oid_, d_next_o_id_oid_})),
+            db->district_table_->InitializerForProjectedRow({d_tax_oid_, d_next_o_id_oid_},
+                                                            storage::INITIAL_LAYOUT_VERSION)),
+        district_select_pr_map_(db->district_table_->ProjectionMapForOids({d_tax_oid_, d_next_o_id_oid_},
+                                                                          storage::INITIAL_LAYOUT_VERSION)),
         d_id_key_pr_offset_(static_cast<uint8_t>(db->district_primary_index_->GetKeyOidToOffsetMap().at(
             db->district_primary_index_schema_.GetColumn(1).Oid()))),
         d_w_id_key_pr_offset_(static_cast<uint8_t>(db->district_primary_index_->GetKeyOidToOffsetMap().at(
             db->district_primary_index_schema_.GetColumn(0).Oid()))),
         d_tax_select_pr_offset_(static_cast<uint8_t>(district_select_pr_map_.at(d_tax_oid_))),
         d_next_o_id_select_pr_offset_(static_cast<uint8_t>(district_select_pr_map_.at(d_next_o_id_oid_))),
-        district_update_pr_initializer_(db->district_table_->InitializerForProjectedRow({d_next_o_id_oid_})),
+        district_update_pr_initializer_(
+            db->district_table_->InitializerForProjectedRow({d_next_o_id_oid_}, storage::INITIAL_LAYOUT_VERSION)),
 
         // Customer metadata
         c_discount_oid_(db->customer_schema_.GetColumn(15).Oid()),
         c_last_oid_(db->customer_schema_.GetColumn(5).Oid()),
         c_credit_oid_(db->customer_schema_.GetColumn(13).Oid()),
         customer_select_pr_initializer_(
-            db->customer_table_->InitializerForProjectedRow({c_discount_oid_, c_last_oid_, c_credit_oid_})),
+            db->customer_table_->InitializerForProjectedRow({c_discount_oid_, c_last_oid_, c_credit_oid_},
+                                                            storage::INITIAL_LAYOUT_VERSION)),
         customer_select_pr_map_(
-            db->customer_table_->ProjectionMapForOids({c_discount_oid_, c_last_oid_, c_credit_oid_})),
+            db->customer_table_->ProjectionMapForOids({c_discount_oid_, c_last_oid_, c_credit_oid_},
+                                                      storage::INITIAL_LAYOUT_VERSION)),
         c_discount_select_pr_offset_(static_cast<uint8_t>(customer_select_pr_map_.at(c_discount_oid_))),
         c_id_key_pr_offset_(static_cast<uint8_t>(db->customer_primary_index_->GetKeyOidToOffsetMap().at(
             db->customer_primary_index_schema_.GetColumn(2).Oid()))),
@@ -174,9 +180,11 @@ class NewOrder {
 
         // New Order metadata
         new_order_insert_pr_initializer_(
-            db->new_order_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->new_order_schema_))),
+            db->new_order_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->new_order_schema_),
+                                                             storage::INITIAL_LAYOUT_VERSION)),
         new_order_insert_pr_map_(
-            db->new_order_table_->ProjectionMapForOids(Util::AllColOidsForSchema(db->new_order_schema_))),
+            db->new_order_table_->ProjectionMapForOids(Util::AllColOidsForSchema(db->new_order_schema_),
+                                                       storage::INITIAL_LAYOUT_VERSION)),
         no_o_id_insert_pr_offset_(
             static_cast<uint8_t>(new_order_insert_pr_map_.at(db->new_order_schema_.GetColumn(0).Oid()))),
         no_d_id_insert_pr_offset_(
@@ -192,8 +200,10 @@ class NewOrder {
 
         // Order metadata
         order_insert_pr_initializer_(
-            db->order_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->order_schema_))),
-        order_insert_pr_map_(db->order_table_->ProjectionMapForOids(Util::AllColOidsForSchema(db->order_schema_))),
+            db->order_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->order_schema_),
+                                                         storage::INITIAL_LAYOUT_VERSION)),
+        order_insert_pr_map_(db->order_table_->ProjectionMapForOids(Util::AllColOidsForSchema(db->order_schema_),
+                                                                    storage::INITIAL_LAYOUT_VERSION)),
         o_id_insert_pr_offset_(static_cast<uint8_t>(order_insert_pr_map_.at(db->order_schema_.GetColumn(0).Oid()))),
         o_d_id_insert_pr_offset_(static_cast<uint8_t>(order_insert_pr_map_.at(db->order_schema_.GetColumn(1).Oid()))),
         o_w_id_insert_pr_offset_(static_cast<uint8_t>(order_insert_pr_map_.at(db->order_schema_.GetColumn(2).Oid()))),
@@ -225,8 +235,10 @@ class NewOrder {
         i_name_oid_(db->item_schema_.GetColumn(2).Oid()),
         i_data_oid_(db->item_schema_.GetColumn(4).Oid()),
         item_select_pr_initializer_(
-            db->item_table_->InitializerForProjectedRow({i_price_oid_, i_name_oid_, i_data_oid_})),
-        item_select_pr_map_(db->item_table_->ProjectionMapForOids({i_price_oid_, i_name_oid_, i_data_oid_})),
+            db->item_table_->InitializerForProjectedRow({i_price_oid_, i_name_oid_, i_data_oid_},
+                                                        storage::INITIAL_LAYOUT_VERSION)),
+        item_select_pr_map_(db->item_table_->ProjectionMapForOids({i_price_oid_, i_name_oid_, i_data_oid_},
+                                                                  storage::INITIAL_LAYOUT_VERSION)),
         i_price_select_pr_offset_(static_cast<uint8_t>(item_select_pr_map_.at(i_price_oid_))),
         i_data_select_pr_offset_(static_cast<uint8_t>(item_select_pr_map_.at(i_data_oid_))),
 
@@ -237,9 +249,10 @@ class NewOrder {
         s_remote_cnt_oid_(db->stock_schema_.GetColumn(15).Oid()),
         s_data_oid_(db->stock_schema_.GetColumn(16).Oid()),
         stock_update_pr_initializer_(db->stock_table_->InitializerForProjectedRow(
-            {s_quantity_oid_, s_ytd_oid_, s_order_cnt_oid_, s_remote_cnt_oid_})),
+            {s_quantity_oid_, s_ytd_oid_, s_order_cnt_oid_, s_remote_cnt_oid_}, storage::INITIAL_LAYOUT_VERSION)),
         stock_update_pr_map_(
-            db->stock_table_->ProjectionMapForOids({s_quantity_oid_, s_ytd_oid_, s_order_cnt_oid_, s_remote_cnt_oid_})),
+            db->stock_table_->ProjectionMapForOids({s_quantity_oid_, s_ytd_oid_, s_order_cnt_oid_, s_remote_cnt_oid_},
+                                                   storage::INITIAL_LAYOUT_VERSION)),
 
         s_quantity_update_pr_offset_(static_cast<uint8_t>(stock_update_pr_map_.at(s_quantity_oid_))),
         s_ytd_update_pr_offset_(static_cast<uint8_t>(stock_update_pr_map_.at(s_ytd_oid_))),
@@ -252,9 +265,11 @@ class NewOrder {
 
         // Order Line metadata
         order_line_insert_pr_initializer_(
-            db->order_line_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->order_line_schema_))),
+            db->order_line_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->order_line_schema_),
+                                                              storage::INITIAL_LAYOUT_VERSION)),
         order_line_insert_pr_map_(
-            db->order_line_table_->ProjectionMapForOids(Util::AllColOidsForSchema(db->order_line_schema_))),
+            db->order_line_table_->ProjectionMapForOids(Util::AllColOidsForSchema(db->order_line_schema_),
+                                                        storage::INITIAL_LAYOUT_VERSION)),
         ol_o_id_insert_pr_offset_(
             static_cast<uint8_t>(order_line_insert_pr_map_.at(db->order_line_schema_.GetColumn(0).Oid()))),
         ol_d_id_insert_pr_offset_(
@@ -289,9 +304,11 @@ class NewOrder {
       const auto s_dist_xx_oid = db->stock_schema_.GetColumn(3 + d_id).Oid();
       stock_select_initializers_.emplace_back(std::pair(
           (db->stock_table_->InitializerForProjectedRow(
-              {s_quantity_oid_, s_dist_xx_oid, s_ytd_oid_, s_order_cnt_oid_, s_remote_cnt_oid_, s_data_oid_})),
+              {s_quantity_oid_, s_dist_xx_oid, s_ytd_oid_, s_order_cnt_oid_, s_remote_cnt_oid_, s_data_oid_},
+storage::INITIAL_LAYOUT_VERSION)),
           db->stock_table_->ProjectionMapForOids(
-              {s_quantity_oid_, s_dist_xx_oid, s_ytd_oid_, s_order_cnt_oid_, s_remote_cnt_oid_, s_data_oid_})));
+              {s_quantity_oid_, s_dist_xx_oid, s_ytd_oid_, s_order_cnt_oid_, s_remote_cnt_oid_, s_data_oid_},
+storage::INITIAL_LAYOUT_VERSION)));
     }
     stock_select_pr_offsets_.reserve(10);
     for (uint8_t d_id = 0; d_id < 10; d_id++) {
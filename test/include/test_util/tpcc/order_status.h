@@ -86,11 +86,12 @@ class OrderStatus {
         c_middle_oid_(db->customer_schema_.GetColumn(4).Oid()),
         c_last_oid_(db->customer_schema_.GetColumn(5).Oid()),
 
-        c_first_pr_initializer_(db->customer_table_->InitializerForProjectedRow({c_first_oid_})),
+        c_first_pr_initializer_(db->customer_table_->InitializerForProjectedRow({c_first_oid_},
+                                                                                storage::INITIAL_LAYOUT_VERSION)),
         customer_select_pr_initializer_(db->customer_table_->InitializerForProjectedRow(
-            {c_id_oid_, c_balance_oid_, c_first_oid_, c_middle_oid_, c_last_oid_})),
+            {c_id_oid_, c_balance_oid_, c_first_oid_, c_middle_oid_, c_last_oid_}, storage::INITIAL_LAYOUT_VERSION)),
         customer_select_pr_map_(db->customer_table_->ProjectionMapForOids(
-            {c_id_oid_, c_balance_oid_, c_first_oid_, c_middle_oid_, c_last_oid_})),
+            {c_id_oid_, c_balance_oid_, c_first_oid_, c_middle_oid_, c_last_oid_}, storage::INITIAL_LAYOUT_VERSION)),
 
         c_id_select_pr_offset_(static_cast<uint8_t>(customer_select_pr_map_.at(c_id_oid_))),
         c_balance_select_pr_offset_(static_cast<uint8_t>(customer_select_pr_map_.at(c_balance_oid_))),
@@ -109,8 +110,10 @@ class OrderStatus {
         o_entry_d_oid_(db->order_schema_.GetColumn(4).Oid()),
         o_carrier_id_oid_(db->order_schema_.GetColumn(5).Oid()),
         order_select_pr_initializer_(
-            db->order_table_->InitializerForProjectedRow({o_id_oid_, o_entry_d_oid_, o_carrier_id_oid_})),
-        order_select_pr_map_(db->order_table_->ProjectionMapForOids({o_id_oid_, o_entry_d_oid_, o_carrier_id_oid_})),
+            db->order_table_->InitializerForProjectedRow({o_id_oid_, o_entry_d_oid_, o_carrier_id_oid_},
+                                                         storage::INITIAL_LAYOUT_VERSION)),
+        order_select_pr_map_(db->order_table_->ProjectionMapForOids({o_id_oid_, o_entry_d_oid_, o_carrier_id_oid_},
+                                                                    storage::INITIAL_LAYOUT_VERSION)),
         o_id_select_pr_offset_(static_cast<uint8_t>(order_select_pr_map_.at(o_id_oid_))),
         ol_o_id_key_pr_offset_(static_cast<uint8_t>(db->order_line_primary_index_->GetKeyOidToOffsetMap().at(
             db->order_line_primary_index_schema_.GetColumn(2).Oid()))),
@@ -127,7 +130,8 @@ class OrderStatus {
         ol_amount_oid_(db->order_line_schema_.GetColumn(8).Oid()),
         ol_delivery_d_oid_(db->order_line_schema_.GetColumn(6).Oid()),
         order_line_select_pr_initializer_(db->order_line_table_->InitializerForProjectedRow(
-            {ol_i_id_oid_, ol_supply_w_id_oid_, ol_quantity_oid_, ol_amount_oid_, ol_delivery_d_oid_}))
+            {ol_i_id_oid_, ol_supply_w_id_oid_, ol_quantity_oid_, ol_amount_oid_, ol_delivery_d_oid_},
+storage::INITIAL_LAYOUT_VERSION))
 
   {}
 
@@ -105,12 +105,15 @@ class Payment {
         w_zip_oid_(db->warehouse_schema_.GetColumn(6).Oid()),
         w_ytd_oid_(db->warehouse_schema_.GetColumn(8).Oid()),
         warehouse_select_pr_initializer_(db->warehouse_table_->InitializerForProjectedRow(
-            {w_name_oid_, w_street_1_oid_, w_street_2_oid_, w_city_oid_, w_state_oid_, w_zip_oid_, w_ytd_oid_})),
+            {w_name_oid_, w_street_1_oid_, w_street_2_oid_, w_city_oid_, w_state_oid_, w_zip_oid_, w_ytd_oid_},
+storage::INITIAL_LAYOUT_VERSION)),
         warehouse_select_pr_map_(db->warehouse_table_->ProjectionMapForOids(
-            {w_name_oid_, w_street_1_oid_, w_street_2_oid_, w_city_oid_, w_state_oid_, w_zip_oid_, w_ytd_oid_})),
+            {w_name_oid_, w_street_1_oid_, w_street_2_oid_, w_city_oid_, w_state_oid_, w_zip_oid_, w_ytd_oid_},
+storage::INITIAL_LAYOUT_VERSION)),
         w_name_select_pr_offset_(static_cast<uint8_t>(warehouse_select_pr_map_.at(w_name_oid_))),
         w_ytd_select_pr_offset_(static_cast<uint8_t>(warehouse_select_pr_map_.at(w_ytd_oid_))),
-        warehouse_update_pr_initializer_(db->warehouse_table_->InitializerForProjectedRow({w_ytd_oid_})),
+        warehouse_update_pr_initializer_(
+            db->warehouse_table_->InitializerForProjectedRow({w_ytd_oid_}, storage::INITIAL_LAYOUT_VERSION)),
 
         // District metadata
         d_id_key_pr_offset_(static_cast<uint8_t>(db->district_primary_index_->GetKeyOidToOffsetMap().at(
@@ -126,12 +129,15 @@ class Payment {
         d_zip_oid_(db->district_schema_.GetColumn(7).Oid()),
         d_ytd_oid_(db->district_schema_.GetColumn(9).Oid()),
         district_select_pr_initializer_(db->district_table_->InitializerForProjectedRow(
-            {d_name_oid_, d_street_1_oid_, d_street_2_oid_, d_city_oid_, d_state_oid_, d_zip_oid_, d_ytd_oid_})),
+            {d_name_oid_, d_street_1_oid_, d_street_2_oid_, d_city_oid_, d_state_oid_, d_zip_oid_, d_ytd_oid_},
+storage::INITIAL_LAYOUT_VERSION)),
         district_select_pr_map_(db->district_table_->ProjectionMapForOids(
-            {d_name_oid_, d_street_1_oid_, d_street_2_oid_, d_city_oid_, d_state_oid_, d_zip_oid_, d_ytd_oid_})),
+            {d_name_oid_, d_street_1_oid_, d_street_2_oid_, d_city_oid_, d_state_oid_, d_zip_oid_, d_ytd_oid_},
+storage::INITIAL_LAYOUT_VERSION)),
         d_name_select_pr_offset_(static_cast<uint8_t>(district_select_pr_map_.at(d_name_oid_))),
         d_ytd_select_pr_offset_(static_cast<uint8_t>(district_select_pr_map_.at(d_ytd_oid_))),
-        district_update_pr_initializer_(db->district_table_->InitializerForProjectedRow({d_ytd_oid_})),
+        district_update_pr_initializer_(
+            db->district_table_->InitializerForProjectedRow({d_ytd_oid_}, storage::INITIAL_LAYOUT_VERSION)),
 
         // Customer metadata
         c_id_key_pr_offset_(static_cast<uint8_t>(db->customer_primary_index_->GetKeyOidToOffsetMap().at(
@@ -147,11 +153,14 @@ class Payment {
         c_w_id_name_key_pr_offset_(static_cast<uint8_t>(db->customer_secondary_index_->GetKeyOidToOffsetMap().at(
             db->customer_secondary_index_schema_.GetColumn(0).Oid()))),
         c_first_pr_initializer_(
-            db->customer_table_->InitializerForProjectedRow({db->customer_schema_.GetColumn(3).Oid()})),
+            db->customer_table_->InitializerForProjectedRow({db->customer_schema_.GetColumn(3).Oid()},
+                                                            storage::INITIAL_LAYOUT_VERSION)),
         customer_select_pr_initializer_(
-            db->customer_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->customer_schema_))),
+            db->customer_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->customer_schema_),
+                                                            storage::INITIAL_LAYOUT_VERSION)),
         customer_select_pr_map_(
-            db->customer_table_->ProjectionMapForOids(Util::AllColOidsForSchema(db->customer_schema_))),
+            db->customer_table_->ProjectionMapForOids(Util::AllColOidsForSchema(db->customer_schema_),
+                                                      storage::INITIAL_LAYOUT_VERSION)),
 
         c_id_oid_(db->customer_schema_.GetColumn(0).Oid()),
         c_credit_oid_(db->customer_schema_.GetColumn(13).Oid()),
@@ -167,18 +176,23 @@ class Payment {
         c_payment_cnt_select_pr_offset_(static_cast<uint8_t>(customer_select_pr_map_.at(c_payment_cnt_oid_))),
         c_data_select_pr_offset_(static_cast<uint8_t>(customer_select_pr_map_.at(c_data_oid_))),
         customer_update_pr_initializer_(
-            db->customer_table_->InitializerForProjectedRow({c_balance_oid_, c_ytd_payment_oid_, c_payment_cnt_oid_})),
+            db->customer_table_->InitializerForProjectedRow({c_balance_oid_, c_ytd_payment_oid_, c_payment_cnt_oid_},
+                                                            storage::INITIAL_LAYOUT_VERSION)),
         customer_update_pr_map_(
-            db->customer_table_->ProjectionMapForOids({c_balance_oid_, c_ytd_payment_oid_, c_payment_cnt_oid_})),
+            db->customer_table_->ProjectionMapForOids({c_balance_oid_, c_ytd_payment_oid_, c_payment_cnt_oid_},
+                                                      storage::INITIAL_LAYOUT_VERSION)),
         c_balance_update_pr_offset_(static_cast<uint8_t>(customer_update_pr_map_.at(c_balance_oid_))),
         c_ytd_payment_update_pr_offset_(static_cast<uint8_t>(customer_update_pr_map_.at(c_ytd_payment_oid_))),
         c_payment_cnt_update_pr_offset_(static_cast<uint8_t>(customer_update_pr_map_.at(c_payment_cnt_oid_))),
-        c_data_pr_initializer_(db->customer_table_->InitializerForProjectedRow({c_data_oid_})),
+        c_data_pr_initializer_(db->customer_table_->InitializerForProjectedRow({c_data_oid_},
+                                                                               storage::INITIAL_LAYOUT_VERSION)),
 
         history_insert_pr_initializer_(
-            db->history_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->history_schema_))),
+            db->history_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->history_schema_),
+                                                           storage::INITIAL_LAYOUT_VERSION)),
         history_insert_pr_map_(
-            db->history_table_->ProjectionMapForOids(Util::AllColOidsForSchema(db->history_schema_))),
+            db->history_table_->ProjectionMapForOids(Util::AllColOidsForSchema(db->history_schema_),
+                                                     storage::INITIAL_LAYOUT_VERSION)),
 
         h_c_id_insert_pr_offset_(
             static_cast<uint8_t>(history_insert_pr_map_.at(db->history_schema_.GetColumn(0).Oid()))),
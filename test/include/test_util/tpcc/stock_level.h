@@ -39,13 +39,15 @@ class StockLevel {
  public:
   explicit StockLevel(const Database *const db)
       : district_select_pr_initializer_(
-            db->district_table_->InitializerForProjectedRow({db->district_schema_.GetColumn(10).Oid()})),
+            db->district_table_->InitializerForProjectedRow({db->district_schema_.GetColumn(10).Oid()},
+                                                            storage::INITIAL_LAYOUT_VERSION)),
         d_id_key_pr_offset_(static_cast<uint8_t>(db->district_primary_index_->GetKeyOidToOffsetMap().at(
             db->district_primary_index_schema_.GetColumn(1).Oid()))),
         d_w_id_key_pr_offset_(static_cast<uint8_t>(db->district_primary_index_->GetKeyOidToOffsetMap().at(
             db->district_primary_index_schema_.GetColumn(0).Oid()))),
         order_line_select_pr_initializer_(
-            db->order_line_table_->InitializerForProjectedRow({db->order_line_schema_.GetColumn(4).Oid()})),
+            db->order_line_table_->InitializerForProjectedRow({db->order_line_schema_.GetColumn(4).Oid()},
+                                                              storage::INITIAL_LAYOUT_VERSION)),
         ol_o_id_key_pr_offset_(static_cast<uint8_t>(db->order_line_primary_index_->GetKeyOidToOffsetMap().at(
             db->order_line_primary_index_schema_.GetColumn(2).Oid()))),
         ol_d_id_key_pr_offset_(static_cast<uint8_t>(db->order_line_primary_index_->GetKeyOidToOffsetMap().at(
@@ -55,7 +57,8 @@ class StockLevel {
         ol_number_key_pr_offset_(static_cast<uint8_t>(db->order_line_primary_index_->GetKeyOidToOffsetMap().at(
             db->order_line_primary_index_schema_.GetColumn(3).Oid()))),
         stock_select_pr_initializer_(
-            db->stock_table_->InitializerForProjectedRow({db->stock_schema_.GetColumn(2).Oid()})),
+            db->stock_table_->InitializerForProjectedRow({db->stock_schema_.GetColumn(2).Oid()},
+                                                         storage::INITIAL_LAYOUT_VERSION)),
         s_w_id_key_pr_offset_(static_cast<uint8_t>(
             db->stock_primary_index_->GetKeyOidToOffsetMap().at(db->stock_primary_index_schema_.GetColumn(0).Oid()))),
         s_i_id_key_pr_offset_(static_cast<uint8_t>(
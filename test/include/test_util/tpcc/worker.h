@@ -13,31 +13,40 @@ namespace terrier::tpcc {
 struct Worker {
   explicit Worker(tpcc::Database *const db)
       : item_tuple_buffer_(common::AllocationUtil::AllocateAligned(
-            db->item_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->item_schema_))
+            db->item_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->item_schema_),
+                                                        storage::INITIAL_LAYOUT_VERSION)
                 .ProjectedRowSize())),
         warehouse_tuple_buffer_(common::AllocationUtil::AllocateAligned(
-            db->warehouse_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->warehouse_schema_))
+            db->warehouse_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->warehouse_schema_),
+                                                             storage::INITIAL_LAYOUT_VERSION)
                 .ProjectedRowSize())),
         stock_tuple_buffer_(common::AllocationUtil::AllocateAligned(
-            db->stock_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->stock_schema_))
+            db->stock_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->stock_schema_),
+                                                         storage::INITIAL_LAYOUT_VERSION)
                 .ProjectedRowSize())),
         district_tuple_buffer_(common::AllocationUtil::AllocateAligned(
-            db->district_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->district_schema_))
+            db->district_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->district_schema_),
+                                                            storage::INITIAL_LAYOUT_VERSION)
                 .ProjectedRowSize())),
         customer_tuple_buffer_(common::AllocationUtil::AllocateAligned(
-            db->customer_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->customer_schema_))
+            db->customer_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->customer_schema_),
+                                                            storage::INITIAL_LAYOUT_VERSION)
                 .ProjectedRowSize())),
         history_tuple_buffer_(common::AllocationUtil::AllocateAligned(
-            db->history_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->history_schema_))
+            db->history_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->history_schema_),
+                                                           storage::INITIAL_LAYOUT_VERSION)
                 .ProjectedRowSize())),
         order_tuple_buffer_(common::AllocationUtil::AllocateAligned(
-            db->order_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->order_schema_))
+            db->order_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->order_schema_),
+                                                         storage::INITIAL_LAYOUT_VERSION)
                 .ProjectedRowSize())),
         new_order_tuple_buffer_(common::AllocationUtil::AllocateAligned(
-            db->new_order_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->new_order_schema_))
+            db->new_order_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->new_order_schema_),
+                                                             storage::INITIAL_LAYOUT_VERSION)
                 .ProjectedRowSize())),
         order_line_tuple_buffer_(common::AllocationUtil::AllocateAligned(
-            db->order_line_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->order_line_schema_))
+            db->order_line_table_->InitializerForProjectedRow(Util::AllColOidsForSchema(db->order_line_schema_),
+                                                              storage::INITIAL_LAYOUT_VERSION)
                 .ProjectedRowSize())),
         item_key_buffer_(common::AllocationUtil::AllocateAligned(
             db->item_primary_index_->GetProjectedRowInitializer().ProjectedRowSize())),
@@ -56,13 +56,13 @@ class MetricsTests : public TerrierTest {
 
   void Insert() {
     static storage::ProjectedRowInitializer tuple_initializer =
-        sql_table_->InitializerForProjectedRow({catalog::col_oid_t(0)});
+        sql_table_->InitializerForProjectedRow({catalog::col_oid_t(0)}, storage::INITIAL_LAYOUT_VERSION);
     auto *const insert_txn = txn_manager_->BeginTransaction();
     auto *const insert_redo =
         insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer);
     auto *const insert_tuple = insert_redo->Delta();
     *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-    sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+    sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
     txn_manager_->Commit(insert_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
   }
 
@@ -200,4 +200,37 @@ TEST_F(MetricsTests, TransactionCSVTest) {
 
   metrics_manager_->UnregisterThread();
 }
+
+/**
+ *  Testing garbage collection metric stats collection and persistence, single thread
+ */
+// NOLINTNEXTLINE
+TEST_F(MetricsTests, GarbageCollectionCSVTest) {
+  for (const auto &file : metrics::GarbageCollectionMetricRawData::FILES) unlink(std::string(file).c_str());
+  const settings::setter_callback_fn setter_callback = MetricsTests::EmptySetterCallback;
+  auto action_context = std::make_unique<common::ActionContext>(common::action_id_t(1));
+  settings_manager_->SetBool(settings::Param::metrics_gc, true, common::ManagedPointer(action_context),
+                             setter_callback);
+
+  metrics_manager_->RegisterThread();
+  const auto gc = db_main_->GetStorageLayer()->GetGarbageCollector();
+
+  Insert();
+  gc->PerformGarbageCollection();
+  gc->PerformGarbageCollection();
+
+  metrics_manager_->Aggregate();
+  const auto aggregated_data = reinterpret_cast<GarbageCollectionMetricRawData *>(
+      metrics_manager_->AggregatedMetrics().at(static_cast<uint8_t>(MetricsComponent::GARBAGECOLLECTION)).get());
+  EXPECT_NE(aggregated_data, nullptr);
+  EXPECT_EQ(aggregated_data->gc_data_.size(), 2);  // 2 invocations recorded
+  metrics_manager_->ToCSV();
+  EXPECT_EQ(aggregated_data->gc_data_.size(), 0);
+
+  action_context = std::make_unique<common::ActionContext>(common::action_id_t(2));
+  settings_manager_->SetBool(settings::Param::metrics_gc, false, common::ManagedPointer(action_context),
+                             setter_callback);
+
+  metrics_manager_->UnregisterThread();
+}
 }  // namespace terrier::metrics
@@ -0,0 +1,57 @@
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "network/connection_dispatcher_task.h"
+#include "test_util/test_harness.h"
+
+namespace terrier::network {
+
+class ConnectionDispatcherTaskTests : public TerrierTest {
+ protected:
+  static uint64_t Pick(const std::vector<uint32_t> &num_connections, const uint64_t start) {
+    return ConnectionDispatcherTask::LeastLoadedHandler(num_connections.size(), start,
+                                                        [&](const uint64_t id) { return num_connections[id]; });
+  }
+};
+
+// NOLINTNEXTLINE
+TEST_F(ConnectionDispatcherTaskTests, PicksLeastLoadedHandler) {
+  EXPECT_EQ(2u, Pick({3, 5, 1, 4}, 0));
+  EXPECT_EQ(2u, Pick({3, 5, 1, 4}, 3));
+  // The only handler gets every connection
+  EXPECT_EQ(0u, Pick({7}, 0));
+}
+
+// NOLINTNEXTLINE
+TEST_F(ConnectionDispatcherTaskTests, BreaksTiesFromStart) {
+  // An idle handler at the start is taken without looking further
+  EXPECT_EQ(1u, Pick({0, 0, 0}, 1));
+  // Among equally loaded handlers, the first one at or after the start wins, wrapping around the end
+  EXPECT_EQ(3u, Pick({2, 1, 2, 1}, 2));
+  EXPECT_EQ(1u, Pick({2, 1, 2, 2}, 2));
+
+  // Advancing the start, as the dispatcher does after every connection, spreads a burst over idle handlers
+  std::vector<uint32_t> num_connections(4, 0);
+  for (uint64_t start = 0; start < 8; start++) num_connections[Pick(num_connections, start % 4)]++;
+  EXPECT_EQ(std::vector<uint32_t>(4, 2), num_connections);
+}
+
+// NOLINTNEXTLINE
+TEST_F(ConnectionDispatcherTaskTests, PrefersHandlersWithoutQueuedOrBusyConnections) {
+  // Handler loads as ConnectionHandlerTask::Load reports them: queued and busy connections, then open connections
+  std::vector<std::pair<uint32_t, uint32_t>> loads{{1, 1}, {0, 5}, {0, 3}, {2, 2}};
+  const auto pick = [&](const uint64_t start) {
+    return ConnectionDispatcherTask::LeastLoadedHandler(loads.size(), start,
+                                                        [&](const uint64_t id) { return loads[id]; });
+  };
+  // A handler with many idle sessions beats one that is working on a single connection
+  EXPECT_EQ(2u, pick(0));
+  loads[2].first = 1;
+  EXPECT_EQ(1u, pick(3));
+  // A handler with nothing to do is taken without looking further
+  loads[3] = {0, 0};
+  EXPECT_EQ(3u, pick(3));
+}
+
+}  // namespace terrier::network
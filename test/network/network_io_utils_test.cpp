@@ -0,0 +1,98 @@
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "network/network_io_utils.h"
+#include "test_util/test_harness.h"
+
+namespace terrier::network {
+
+class NetworkIoUtilsTests : public TerrierTest {};
+
+// NOLINTNEXTLINE
+TEST_F(NetworkIoUtilsTests, BufferPoolSizeClasses) {
+  auto *const pool = NetworkBufferPool::Instance();
+  ByteBuf small = pool->Get(1);
+  EXPECT_EQ(small.size(), SOCKET_BUFFER_CAPACITY);
+  ByteBuf large = pool->Get(SOCKET_BUFFER_CAPACITY + 1);
+  EXPECT_EQ(large.size(), 2 * SOCKET_BUFFER_CAPACITY);
+
+  // Released storage is handed out again for its size class
+  const uchar *const large_data = large.data();
+  pool->Release(std::move(large));
+  ByteBuf reused = pool->Get(2 * SOCKET_BUFFER_CAPACITY);
+  EXPECT_EQ(reused.data(), large_data);
+
+  pool->Release(std::move(small));
+  pool->Release(std::move(reused));
+}
+
+// NOLINTNEXTLINE
+TEST_F(NetworkIoUtilsTests, WriteQueueGatheredWrite) {
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+  // Spans three buffers, so that all of them have to be gathered
+  std::vector<uchar> sent(2 * SOCKET_BUFFER_CAPACITY + 100);
+  for (uint32_t i = 0; i < sent.size(); i++) sent[i] = static_cast<uchar>(i % 251);
+  WriteQueue queue;
+  queue.BufferWriteRaw(sent.data(), sent.size());
+  EXPECT_TRUE(queue.ShouldFlush());
+
+  while (!queue.Flushed()) ASSERT_GT(queue.WriteOutTo(fds[0]), 0);
+
+  std::vector<uchar> received(sent.size());
+  size_t bytes_read = 0;
+  while (bytes_read < received.size()) {
+    const auto result = read(fds[1], &received[bytes_read], received.size() - bytes_read);
+    ASSERT_GT(result, 0);
+    bytes_read += result;
+  }
+  EXPECT_EQ(received, sent);
+
+  // An empty queue has nothing to write
+  queue.Reset();
+  EXPECT_EQ(queue.WriteOutTo(fds[0]), 0);
+  EXPECT_TRUE(queue.Flushed());
+
+  close(fds[0]);
+  close(fds[1]);
+}
+
+// NOLINTNEXTLINE
+TEST_F(NetworkIoUtilsTests, ReadBufferGrowsForLargePacket) {
+  int fds[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+
+  const uint32_t packet_size = 3 * SOCKET_BUFFER_CAPACITY;
+  std::vector<uchar> sent(packet_size + sizeof(uint32_t));
+  for (uint32_t i = 0; i < sent.size(); i++) sent[i] = static_cast<uchar>(i % 251);
+  ASSERT_EQ(write(fds[0], sent.data(), sent.size()), static_cast<ssize_t>(sent.size()));
+
+  // Read as much as fits, consume a header, then make room for the rest of the packet
+  ReadBuffer buffer;
+  ASSERT_EQ(buffer.FillBufferFrom(fds[1]), SOCKET_BUFFER_CAPACITY);
+  buffer.ReadValue<uint32_t>();
+  buffer.EnsureCapacity(packet_size);
+  EXPECT_GE(buffer.Capacity(), packet_size);
+  EXPECT_EQ(buffer.BytesAvailable(), SOCKET_BUFFER_CAPACITY - sizeof(uint32_t));
+
+  while (!buffer.HasMore(packet_size)) ASSERT_GT(buffer.FillBufferFrom(fds[1]), 0);
+  std::vector<uchar> received(packet_size);
+  buffer.ReadIntoView(packet_size).Read(packet_size, received.data());
+  EXPECT_TRUE(std::equal(received.begin(), received.end(), sent.begin() + sizeof(uint32_t)));
+
+  // Once the packet is consumed the buffer gives its storage back
+  buffer.Shrink();
+  EXPECT_EQ(buffer.Capacity(), SOCKET_BUFFER_CAPACITY);
+  EXPECT_FALSE(buffer.HasMore());
+
+  close(fds[0]);
+  close(fds[1]);
+}
+
+}  // namespace terrier::network
@@ -1,13 +1,20 @@
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <cstring>
 #include <memory>
 #include <pqxx/pqxx>  // NOLINT
 #include <string>
 #include <thread>  // NOLINT
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "common/managed_pointer.h"
 #include "common/settings.h"
 #include "gtest/gtest.h"
+#include "main/db_main.h"
 #include "network/connection_handle_factory.h"
 #include "network/terrier_server.h"
 #include "storage/garbage_collector.h"
@@ -45,11 +52,22 @@ class NetworkTests : public TerrierTest {
   std::unique_ptr<ConnectionHandleFactory> handle_factory_;
   common::DedicatedThreadRegistry thread_registry_ = common::DedicatedThreadRegistry(DISABLED);
   uint16_t port_ = 15721;
+  // More than one, so that connections are accepted on several SO_REUSEPORT sockets
+  static constexpr uint32_t NUM_ACCEPTORS = 2;
+  // The default number of handler threads, from the connection_thread_count setting
+  uint32_t num_handlers_;
   FakeCommandFactory fake_command_factory_;
   PostgresProtocolInterpreter::Provider protocol_provider_{
       common::ManagedPointer<PostgresCommandFactory>(&fake_command_factory_)};
 
   void SetUp() override {
+    std::unordered_map<settings::Param, settings::ParamInfo> param_map;
+    settings::SettingsManager::ConstructParamMap(param_map);
+    auto settings_db_main =
+        DBMain::Builder().SetUseSettingsManager(true).SetSettingsParameterMap(std::move(param_map)).Build();
+    num_handlers_ = static_cast<uint32_t>(
+        settings_db_main->GetSettingsManager()->GetInt(settings::Param::connection_thread_count));
+
     timestamp_manager_ = new transaction::TimestampManager;
     deferred_action_manager_ = new transaction::DeferredActionManager(common::ManagedPointer(timestamp_manager_));
     txn_manager_ = new transaction::TransactionManager(common::ManagedPointer(timestamp_manager_),
@@ -76,7 +94,8 @@ class NetworkTests : public TerrierTest {
       handle_factory_ = std::make_unique<ConnectionHandleFactory>(common::ManagedPointer(tcop_));
       server_ = std::make_unique<TerrierServer>(
           common::ManagedPointer<ProtocolInterpreter::Provider>(&protocol_provider_),
-          common::ManagedPointer(handle_factory_.get()), common::ManagedPointer(&thread_registry_), port_);
+          common::ManagedPointer(handle_factory_.get()), common::ManagedPointer(&thread_registry_), port_,
+          NUM_ACCEPTORS, num_handlers_, "/tmp");
       server_->RunServer();
     } catch (NetworkProcessException &exception) {
       NETWORK_LOG_ERROR("[LaunchServer] exception when launching server");
@@ -113,31 +132,20 @@ class NetworkTests : public TerrierTest {
 
     PostgresPacketWriter writer(io_socket->GetWriteQueue());
     auto type_oid = static_cast<int>(PostgresValueType::INTEGER);
-    writer.WriteParseCommand(stmt_name, query, std::vector<int>(4, type_oid));
-    io_socket->FlushAllWrites();
-    EXPECT_TRUE(ManualPacketUtil::ReadUntilReadyOrClose(io_socket));
 
+    // The whole pipeline is sent at once, and answered at once when the server gets to the Sync
+    writer.WriteParseCommand(stmt_name, query, std::vector<int>(4, type_oid));
     std::string portal_name;
     writer.WriteBindCommand(portal_name, stmt_name, {}, {}, {});
-    io_socket->FlushAllWrites();
-    EXPECT_TRUE(ManualPacketUtil::ReadUntilReadyOrClose(io_socket));
-
+    writer.WriteDescribeCommand(DescribeCommandObjectType::PORTAL, portal_name);
     writer.WriteExecuteCommand(portal_name, 0);
-    io_socket->FlushAllWrites();
-    EXPECT_TRUE(ManualPacketUtil::ReadUntilReadyOrClose(io_socket));
-
-    // DescribeCommand
-    writer.WriteDescribeCommand(DescribeCommandObjectType::STATEMENT, stmt_name);
-    io_socket->FlushAllWrites();
-    EXPECT_TRUE(ManualPacketUtil::ReadUntilReadyOrClose(io_socket));
-
-    // SyncCommand
     writer.WriteSyncCommand();
     io_socket->FlushAllWrites();
     EXPECT_TRUE(ManualPacketUtil::ReadUntilReadyOrClose(io_socket));
 
     // CloseCommand
     writer.WriteCloseCommand(DescribeCommandObjectType::STATEMENT, stmt_name);
+    writer.WriteSyncCommand();
     io_socket->FlushAllWrites();
     EXPECT_TRUE(ManualPacketUtil::ReadUntilReadyOrClose(io_socket));
 
@@ -247,6 +255,47 @@ TEST_F(NetworkTests, LargePacketsTest) {
   }
 }
 
+/**
+ * Sends the header of a packet larger than the read buffer on its own, so that the server parses the header before
+ * any byte of the body has arrived. The body must still be read into the grown buffer.
+ */
+// NOLINTNEXTLINE
+TEST_F(NetworkTests, LargePacketHeaderOnlyTest) {
+  auto io_socket_unique_ptr = network::ManualPacketUtil::StartConnection(port_);
+  ASSERT_NE(io_socket_unique_ptr, nullptr);
+  auto io_socket = common::ManagedPointer(io_socket_unique_ptr);
+  const int socket_fd = io_socket->GetSocketFd();
+
+  // Write all of the bytes to the non-blocking socket
+  const auto send_all = [&](const char *data, size_t size) {
+    while (size > 0) {
+      const ssize_t written = write(socket_fd, data, size);
+      if (written < 0) {
+        ASSERT_TRUE(errno == EAGAIN || errno == EINTR);
+        continue;
+      }
+      data += written;
+      size -= static_cast<size_t>(written);
+    }
+  };
+
+  std::string query(3 * SOCKET_BUFFER_CAPACITY, 'a');
+  query.back() = '\0';
+  char header[1 + sizeof(int32_t)];
+  header[0] = static_cast<char>(NetworkMessageType::PG_SIMPLE_QUERY_COMMAND);
+  const auto len = htonl(static_cast<uint32_t>(sizeof(int32_t) + query.size()));
+  std::memcpy(header + 1, &len, sizeof(len));
+
+  send_all(header, sizeof(header));
+  // Give the server time to read the header before the body follows
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  send_all(query.data(), query.size());
+  EXPECT_TRUE(ManualPacketUtil::ReadUntilReadyOrClose(io_socket));
+
+  ManualPacketUtil::TerminateConnection(socket_fd);
+  io_socket->Close();
+}
+
 /**
  * This is a less "parallelized" version of RacerTest that tests the network layers functionality
  * on multiple synchronous clients in two batches
@@ -254,10 +303,10 @@ TEST_F(NetworkTests, LargePacketsTest) {
 // NOLINTNEXTLINE
 TEST_F(NetworkTests, MultipleConnectionTest) {
   std::vector<std::unique_ptr<NetworkIoWrapper>> io_sockets;
-  io_sockets.reserve(CONNECTION_THREAD_COUNT * 2);
+  io_sockets.reserve(num_handlers_ * 2);
 
   for (size_t i = 0; i < 2; i++) {
-    for (size_t i = 0; i < CONNECTION_THREAD_COUNT * 2; i++) {
+    for (size_t i = 0; i < num_handlers_ * 2; i++) {
       auto io_socket_unique_ptr = network::ManualPacketUtil::StartConnection(port_);
       EXPECT_NE(io_socket_unique_ptr, nullptr);
       io_sockets.emplace_back(std::move(io_socket_unique_ptr));
@@ -271,6 +320,99 @@ TEST_F(NetworkTests, MultipleConnectionTest) {
   }
 }
 
+/**
+ * Connects to the server through its Unix domain socket, which speaks the same protocol as the TCP port
+ */
+// NOLINTNEXTLINE
+TEST_F(NetworkTests, UnixSocketTest) {
+  EXPECT_EQ("/tmp/.s.PGSQL." + std::to_string(port_), server_->UnixSocketPath());
+  // Every local user may connect, whatever the umask of the server
+  struct stat socket_stat;
+  ASSERT_EQ(0, stat(server_->UnixSocketPath().c_str(), &socket_stat));
+  EXPECT_EQ(0777u, socket_stat.st_mode & 0777u);
+  auto io_socket_unique_ptr = network::ManualPacketUtil::StartUnixConnection(server_->UnixSocketPath());
+  ASSERT_NE(io_socket_unique_ptr, nullptr);
+  auto io_socket = common::ManagedPointer(io_socket_unique_ptr);
+
+  io_socket->GetWriteQueue()->Reset();
+  PostgresPacketWriter writer(io_socket->GetWriteQueue());
+  writer.WriteSyncCommand();
+  io_socket->FlushAllWrites();
+  EXPECT_TRUE(ManualPacketUtil::ReadUntilReadyOrClose(io_socket));
+
+  ManualPacketUtil::TerminateConnection(io_socket->GetSocketFd());
+  io_socket->Close();
+
+  // libpq finds the socket from its directory and the port
+  try {
+    pqxx::connection c(
+        fmt::format("host=/tmp port={0} user={1} application_name=psql", port_, catalog::DEFAULT_DATABASE));
+    pqxx::work txn1(c);
+    txn1.exec("INSERT INTO employee VALUES (1, 'Han LI');");
+    txn1.commit();
+  } catch (const std::exception &e) {
+    NETWORK_LOG_ERROR("[UnixSocketTest] Exception occurred: {0}", e.what());
+    EXPECT_TRUE(false);
+  }
+}
+
+/**
+ * A second server must not take over the Unix domain socket of a running server, nor remove it when it gives up
+ */
+// NOLINTNEXTLINE
+TEST_F(NetworkTests, UnixSocketInUseTest) {
+  // Several acceptors share the TCP port, so that starting the second server only fails on the Unix domain socket
+  TerrierServer other_server(common::ManagedPointer<ProtocolInterpreter::Provider>(&protocol_provider_),
+                             common::ManagedPointer(handle_factory_.get()), common::ManagedPointer(&thread_registry_),
+                             port_, NUM_ACCEPTORS, num_handlers_, "/tmp");
+  EXPECT_THROW(other_server.RunServer(), NetworkProcessException);
+  other_server.StopServer();
+
+  auto io_socket_unique_ptr = network::ManualPacketUtil::StartUnixConnection(server_->UnixSocketPath());
+  ASSERT_NE(io_socket_unique_ptr, nullptr);
+  ManualPacketUtil::TerminateConnection(io_socket_unique_ptr->GetSocketFd());
+  io_socket_unique_ptr->Close();
+}
+
+/**
+ * A socket file left behind by a server that is gone is replaced, and a server only removes the file it created
+ */
+// NOLINTNEXTLINE
+TEST_F(NetworkTests, StaleUnixSocketTest) {
+  const auto other_port = static_cast<uint16_t>(port_ + 1);
+  const std::string socket_path = "/tmp/.s.PGSQL." + std::to_string(other_port);
+
+  // Leave a socket file that refuses connections, like a server that crashed would
+  const auto bind_stale_socket = [&] {
+    struct sockaddr_un sun;
+    std::memset(&sun, 0, sizeof(sun));
+    sun.sun_family = AF_UNIX;
+    std::strncpy(sun.sun_path, socket_path.c_str(), sizeof(sun.sun_path) - 1);
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_EQ(0, bind(fd, reinterpret_cast<struct sockaddr *>(&sun), sizeof(sun)));
+    close(fd);
+  };
+  unlink(socket_path.c_str());
+  bind_stale_socket();
+
+  TerrierServer other_server(common::ManagedPointer<ProtocolInterpreter::Provider>(&protocol_provider_),
+                             common::ManagedPointer(handle_factory_.get()), common::ManagedPointer(&thread_registry_),
+                             other_port, 1, num_handlers_, "/tmp");
+  other_server.RunServer();
+  auto io_socket_unique_ptr = network::ManualPacketUtil::StartUnixConnection(socket_path);
+  ASSERT_NE(io_socket_unique_ptr, nullptr);
+  ManualPacketUtil::TerminateConnection(io_socket_unique_ptr->GetSocketFd());
+  io_socket_unique_ptr->Close();
+
+  // Someone else replaced the file while the server ran, so stopping must leave it alone
+  unlink(socket_path.c_str());
+  bind_stale_socket();
+  other_server.StopServer();
+  EXPECT_EQ(0, access(socket_path.c_str(), F_OK));
+
+  unlink(socket_path.c_str());
+}
+
 /**
  * This is meant to overload the network layer with multiple concurrent client threads. It was made to uncover
  * a bug where ConnectionHandlerTask had a few race conditions amongst its fields. Two threads using the same
@@ -285,9 +427,9 @@ TEST_F(NetworkTests, RacerTest) {
   std::vector<size_t> thread_counts = {
       // clang-format off
       2,
-      CONNECTION_THREAD_COUNT,
-      CONNECTION_THREAD_COUNT * 2,
-      CONNECTION_THREAD_COUNT * 3
+      num_handlers_,
+      num_handlers_ * 2,
+      num_handlers_ * 3
       // clang-format on
   };
 
@@ -1,8 +1,10 @@
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
 #include "network/postgres/postgres_protocol_util.h"
 #include "test_util/test_harness.h"
+#include "type/transient_value_peeker.h"
 
 namespace terrier::network {
 
@@ -39,4 +41,38 @@ TEST_F(PostgresProtocolUtilTests, TypeConversionTest) {
                NetworkProcessException);
 }
 
+// NOLINTNEXTLINE
+TEST_F(PostgresProtocolUtilTests, ParameterValueTest) {
+  // Check that parameter values of Bind messages are read in both formats
+
+  auto value = PostgresProtocolUtil::ParameterValue(type::TypeId::INTEGER, FieldFormat::text, "-42");
+  EXPECT_EQ(value.Type(), type::TypeId::INTEGER);
+  EXPECT_EQ(type::TransientValuePeeker::PeekInteger(value), -42);
+
+  value = PostgresProtocolUtil::ParameterValue(type::TypeId::INTEGER, FieldFormat::binary,
+                                               std::string("\xff\xff\xff\xd6", 4));
+  EXPECT_EQ(type::TransientValuePeeker::PeekInteger(value), -42);
+
+  value = PostgresProtocolUtil::ParameterValue(type::TypeId::BIGINT, FieldFormat::binary,
+                                               std::string("\x00\x00\x00\x01\x00\x00\x00\x00", 8));
+  EXPECT_EQ(type::TransientValuePeeker::PeekBigInt(value), INT64_C(1) << 32);
+
+  value = PostgresProtocolUtil::ParameterValue(type::TypeId::BOOLEAN, FieldFormat::text, "t");
+  EXPECT_TRUE(type::TransientValuePeeker::PeekBoolean(value));
+
+  value = PostgresProtocolUtil::ParameterValue(type::TypeId::DECIMAL, FieldFormat::text, "3.5");
+  EXPECT_EQ(type::TransientValuePeeker::PeekDecimal(value), 3.5);
+
+  value = PostgresProtocolUtil::ParameterValue(type::TypeId::VARCHAR, FieldFormat::text, "abc");
+  EXPECT_EQ(type::TransientValuePeeker::PeekVarChar(value), "abc");
+
+  // Malformed values and values out of the type's range are refused
+  EXPECT_THROW(PostgresProtocolUtil::ParameterValue(type::TypeId::INTEGER, FieldFormat::text, "12abc"),
+               NetworkProcessException);
+  EXPECT_THROW(PostgresProtocolUtil::ParameterValue(type::TypeId::SMALLINT, FieldFormat::text, "40000"),
+               NetworkProcessException);
+  EXPECT_THROW(PostgresProtocolUtil::ParameterValue(type::TypeId::INTEGER, FieldFormat::binary, std::string(3, '\0')),
+               NetworkProcessException);
+}
+
 }  // namespace terrier::network
@@ -33,7 +33,8 @@ TEST(OperatorTests, LogicalInsertTest) {
   // Check that all of our GET methods work as expected
   Operator op1 = LogicalInsert::Make(
       database_oid, namespace_oid, table_oid, std::vector<catalog::col_oid_t>(columns, std::end(columns)),
-      common::ManagedPointer<std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>>(values));
+      common::ManagedPointer<std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>>(values),
+      nullptr);
   EXPECT_EQ(op1.GetType(), OpType::LOGICALINSERT);
   EXPECT_EQ(op1.As<LogicalInsert>()->GetDatabaseOid(), database_oid);
   EXPECT_EQ(op1.As<LogicalInsert>()->GetNamespaceOid(), namespace_oid);
@@ -41,12 +42,14 @@ TEST(OperatorTests, LogicalInsertTest) {
   EXPECT_EQ(op1.As<LogicalInsert>()->GetColumns(),
             (std::vector<catalog::col_oid_t>{catalog::col_oid_t(1), catalog::col_oid_t(2)}));
   EXPECT_EQ(op1.As<LogicalInsert>()->GetValues(), values);
+  EXPECT_EQ(op1.As<LogicalInsert>()->GetConstantBatch(), nullptr);
 
   // Check that if we make a new object with the same values, then it will
   // be equal to our first object and have the same hash
   Operator op2 = LogicalInsert::Make(
       database_oid, namespace_oid, table_oid, std::vector<catalog::col_oid_t>(columns, std::end(columns)),
-      common::ManagedPointer<std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>>(values));
+      common::ManagedPointer<std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>>(values),
+      nullptr);
   EXPECT_TRUE(op1 == op2);
   EXPECT_EQ(op1.Hash(), op2.Hash());
 
@@ -58,7 +61,8 @@ TEST(OperatorTests, LogicalInsertTest) {
   Operator op3 = LogicalInsert::Make(
       database_oid, namespace_oid, table_oid, std::vector<catalog::col_oid_t>(columns, std::end(columns)),
       common::ManagedPointer<std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>>(
-          other_values));
+          other_values),
+      nullptr);
   EXPECT_FALSE(op1 == op3);
   EXPECT_NE(op1.Hash(), op3.Hash());
 
@@ -75,7 +79,8 @@ TEST(OperatorTests, LogicalInsertTest) {
   EXPECT_DEATH(LogicalInsert::Make(
                    database_oid, namespace_oid, table_oid, std::vector<catalog::col_oid_t>(columns, std::end(columns)),
                    common::ManagedPointer<std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>>(
-                       bad_values)),
+                       bad_values),
+                   nullptr),
                "Mismatched");
   for (auto entry : bad_raw_values) delete entry;
   delete bad_values;
@@ -901,6 +906,49 @@ TEST(OperatorTests, LogicalSemiJoinTest) {
   delete expr_b_3;
 }
 
+// NOLINTNEXTLINE
+TEST(OperatorTests, LogicalAntiJoinTest) {
+  //===--------------------------------------------------------------------===//
+  // LogicalAntiJoin
+  //===--------------------------------------------------------------------===//
+  parser::AbstractExpression *expr_b_1 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(true));
+  parser::AbstractExpression *expr_b_2 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(true));
+  parser::AbstractExpression *expr_b_3 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(false));
+
+  auto x_1 = common::ManagedPointer<parser::AbstractExpression>(expr_b_1);
+  auto x_2 = common::ManagedPointer<parser::AbstractExpression>(expr_b_2);
+  auto x_3 = common::ManagedPointer<parser::AbstractExpression>(expr_b_3);
+
+  auto annotated_expr_1 = AnnotatedExpression(x_1, std::unordered_set<std::string>());
+  auto annotated_expr_2 = AnnotatedExpression(x_2, std::unordered_set<std::string>());
+  auto annotated_expr_3 = AnnotatedExpression(x_3, std::unordered_set<std::string>());
+
+  Operator logical_anti_join_1 = LogicalAntiJoin::Make(std::vector<AnnotatedExpression>({annotated_expr_1}));
+  Operator logical_anti_join_2 = LogicalAntiJoin::Make(std::vector<AnnotatedExpression>({annotated_expr_2}));
+  Operator logical_anti_join_3 = LogicalAntiJoin::Make(std::vector<AnnotatedExpression>({annotated_expr_3}));
+
+  EXPECT_EQ(logical_anti_join_1.GetType(), OpType::LOGICALANTIJOIN);
+  EXPECT_EQ(logical_anti_join_3.GetType(), OpType::LOGICALANTIJOIN);
+  EXPECT_EQ(logical_anti_join_1.GetName(), "LogicalAntiJoin");
+  EXPECT_EQ(logical_anti_join_1.As<LogicalAntiJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>({annotated_expr_1}));
+  EXPECT_EQ(logical_anti_join_2.As<LogicalAntiJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>({annotated_expr_2}));
+  EXPECT_EQ(logical_anti_join_3.As<LogicalAntiJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>({annotated_expr_3}));
+  EXPECT_TRUE(logical_anti_join_1 == logical_anti_join_2);
+  EXPECT_FALSE(logical_anti_join_1 == logical_anti_join_3);
+  EXPECT_EQ(logical_anti_join_1.Hash(), logical_anti_join_2.Hash());
+  EXPECT_NE(logical_anti_join_1.Hash(), logical_anti_join_3.Hash());
+
+  delete expr_b_1;
+  delete expr_b_2;
+  delete expr_b_3;
+}
+
 // NOLINTNEXTLINE
 TEST(OperatorTests, LogicalAggregateAndGroupByTest) {
   //===--------------------------------------------------------------------===//
@@ -72,7 +72,7 @@ class OperatorTransformerTest : public TerrierTest {
   std::vector<optimizer::OpType> op_types_;
   std::unique_ptr<optimizer::TrivialCostModel> trivial_cost_model_;
   std::unique_ptr<optimizer::OptimizerContext> optimizer_context_;
-  std::unique_ptr<optimizer::OptimizationContext> optimization_context_;
+  optimizer::OptimizationContext *optimization_context_;
 
   std::unique_ptr<DBMain> db_main_;
 
@@ -158,7 +158,9 @@ class OperatorTransformerTest : public TerrierTest {
     optimizer_context_->SetStatsStorage(db_main_->GetStatsStorage().Get());
 
     auto *properties = new optimizer::PropertySet();
-    optimization_context_ = std::make_unique<optimizer::OptimizationContext>(optimizer_context_.get(), properties);
+    optimization_context_ =
+        new (optimizer_context_->GetArena()) optimizer::OptimizationContext(optimizer_context_.get(), properties);
+    optimizer_context_->AddOptimizationContext(optimization_context_);
   }
 
   void TearDown() override {
@@ -616,12 +618,12 @@ TEST_F(OperatorTransformerTest, SelectStatementMarkJoinTest) {
   OPTIMIZER_LOG_DEBUG("Parsing sql query");
   std::string select_sql = "SELECT * FROM A WHERE A1 = 0 AND A1 IN (SELECT B1 FROM B WHERE B1 IN (SELECT A1 FROM A))";
 
+  // The IN predicates are evaluated by the mark joins and are not in filters
   std::string ref =
       "{\"Op\":\"LogicalFilter\",\"Children\":"
       "[{\"Op\":\"LogicalMarkJoin\",\"Children\":"
-      "[{\"Op\":\"LogicalGet\",},{\"Op\":\"LogicalFilter\",\"Children\":"
-      "[{\"Op\":\"LogicalMarkJoin\",\"Children\":"
-      "[{\"Op\":\"LogicalGet\",},{\"Op\":\"LogicalGet\",}]}]}]}]}";
+      "[{\"Op\":\"LogicalGet\",},{\"Op\":\"LogicalMarkJoin\",\"Children\":"
+      "[{\"Op\":\"LogicalGet\",},{\"Op\":\"LogicalGet\",}]}]}]}";
 
   auto parse_tree = parser::PostgresParser::BuildParseTree(select_sql);
   auto statement = parse_tree->GetStatements()[0];
@@ -631,6 +633,17 @@ TEST_F(OperatorTransformerTest, SelectStatementMarkJoinTest) {
   auto info = GenerateOperatorAudit(common::ManagedPointer<optimizer::OperatorNode>(operator_tree_));
 
   EXPECT_EQ(ref, info);
+
+  // Test LogicalFilter
+  auto logical_filter = operator_tree_->GetOp().As<optimizer::LogicalFilter>();
+  EXPECT_EQ(1, logical_filter->GetPredicates().size());
+
+  // Test LogicalMarkJoin, (A1 IN (SELECT B1 ...)) becomes (A1 = B1)
+  auto logical_mark_join = operator_tree_->GetChildren()[0]->GetOp().As<optimizer::LogicalMarkJoin>();
+  EXPECT_EQ(1, logical_mark_join->GetJoinPredicates().size());
+  EXPECT_EQ(parser::ExpressionType::COMPARE_EQUAL,
+            logical_mark_join->GetJoinPredicates()[0].GetExpr()->GetExpressionType());
+  EXPECT_EQ(2, logical_mark_join->GetJoinPredicates()[0].GetTableAliasSet().size());
 }
 
 // NOLINTNEXTLINE
@@ -863,7 +876,7 @@ TEST_F(OperatorTransformerTest, CreateDatabaseTest) {
   EXPECT_EQ("c", logical_create->GetDatabaseName());
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalCreateDatabaseToPhysicalCreateDatabase rule;
@@ -918,7 +931,7 @@ TEST_F(OperatorTransformerTest, CreateTableTest) {
   EXPECT_EQ(logical_create->GetForeignKeys(), create_stmt->GetForeignKeys());
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalCreateTableToPhysicalCreateTable rule;
@@ -1088,7 +1101,7 @@ TEST_F(OperatorTransformerTest, CreateIndexTest) {
   EXPECT_EQ(col_attr->GetDatabaseOid(), db_oid_);
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalCreateIndexToPhysicalCreateIndex rule;
@@ -1177,7 +1190,7 @@ TEST_F(OperatorTransformerTest, CreateFunctionTest) {
   }
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalCreateFunctionToPhysicalCreateFunction rule;
@@ -1247,7 +1260,7 @@ TEST_F(OperatorTransformerTest, CreateNamespaceTest) {
   EXPECT_EQ("e", logical_create->GetNamespaceName());
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalCreateNamespaceToPhysicalCreateNamespace rule;
@@ -1299,7 +1312,7 @@ TEST_F(OperatorTransformerTest, CreateViewTest) {
   EXPECT_EQ(logical_create->GetViewName(), "a_view");
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalCreateViewToPhysicalCreateView rule;
@@ -1394,7 +1407,7 @@ TEST_F(OperatorTransformerTest, CreateTriggerTest) {
   EXPECT_EQ(col2->GetDatabaseOid(), db_oid_);
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalCreateTriggerToPhysicalCreateTrigger rule;
@@ -1475,7 +1488,7 @@ TEST_F(OperatorTransformerTest, DropDatabaseTest) {
   EXPECT_EQ(logical_create->GetDatabaseOID(), db_oid_);
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalDropDatabaseToPhysicalDropDatabase rule;
@@ -1524,7 +1537,7 @@ TEST_F(OperatorTransformerTest, DropTableTest) {
   EXPECT_EQ(logical_create->GetTableOID(), table_a_oid_);
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalDropTableToPhysicalDropTable rule;
@@ -1572,7 +1585,7 @@ TEST_F(OperatorTransformerTest, DropIndexTest) {
   EXPECT_EQ(logical_create->GetIndexOID(), a_index_oid_);
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalDropIndexToPhysicalDropIndex rule;
@@ -1619,7 +1632,7 @@ TEST_F(OperatorTransformerTest, DropNamespaceIfExistsWhereExistTest) {
   EXPECT_EQ(logical_drop->GetNamespaceOID(), catalog::postgres::NAMESPACE_DEFAULT_NAMESPACE_OID);
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalDropNamespaceToPhysicalDropNamespace rule;
@@ -1666,7 +1679,7 @@ TEST_F(OperatorTransformerTest, DropNamespaceIfExistsWhereNotExistTest) {
   EXPECT_EQ(logical_drop->GetNamespaceOID(), catalog::INVALID_NAMESPACE_OID);
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalDropNamespaceToPhysicalDropNamespace rule;
@@ -1713,7 +1726,7 @@ TEST_F(OperatorTransformerTest, DISABLED_DropTriggerIfExistsWhereNotExistTest) {
   EXPECT_EQ(logical_drop->GetTriggerOid(), catalog::INVALID_TRIGGER_OID);
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalDropTriggerToPhysicalDropTrigger rule;
@@ -1760,7 +1773,7 @@ TEST_F(OperatorTransformerTest, DISABLED_DropViewIfExistsWhereNotExistTest) {
   EXPECT_EQ(logical_drop->GetViewOid(), catalog::INVALID_VIEW_OID);
 
   auto optree_ptr = common::ManagedPointer(operator_tree_);
-  auto *op_ctx = optimization_context_.get();
+  auto *op_ctx = optimization_context_;
   std::vector<std::unique_ptr<optimizer::OperatorNode>> transformed;
 
   optimizer::LogicalDropViewToPhysicalDropView rule;
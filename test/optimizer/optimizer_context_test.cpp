@@ -44,11 +44,12 @@ TEST_F(OptimizerContextTest, PatternTest) {
 
 // NOLINTNEXTLINE
 TEST_F(OptimizerContextTest, OptimizerTaskStackTest) {
+  OptimizerArena arena;
   auto task_stack = new OptimizerTaskStack();
 
   std::stack<OptimizerTask *> track_stack;
   for (size_t i = 0; i < 5; i++) {
-    auto task = new OptimizeGroup(nullptr, nullptr);
+    auto task = new (&arena) OptimizeGroup(nullptr, nullptr);
     track_stack.push(task);
     task_stack->Push(task);
   }
@@ -69,10 +70,11 @@ TEST_F(OptimizerContextTest, OptimizerTaskStackTest) {
 
 // NOLINTNEXTLINE
 TEST_F(OptimizerContextTest, OptimizerTaskStackRemainTest) {
+  OptimizerArena arena;
   auto task_stack = new OptimizerTaskStack();
 
   for (size_t i = 0; i < 5; i++) {
-    auto task = new OptimizeGroup(nullptr, nullptr);
+    auto task = new (&arena) OptimizeGroup(nullptr, nullptr);
     task_stack->Push(task);
   }
 
@@ -81,15 +83,35 @@ TEST_F(OptimizerContextTest, OptimizerTaskStackRemainTest) {
   delete task_stack;
 }
 
+// NOLINTNEXTLINE
+TEST_F(OptimizerContextTest, OptimizerArenaReuseTest) {
+  OptimizerArena arena;
+
+  // A deleted task hands its memory back to the arena, and the next task of the same size reuses it
+  auto *task = new (&arena) OptimizeGroup(nullptr, nullptr);
+  const auto allocated = arena.GetRegion().Allocated();
+  delete task;
+  auto *reused = new (&arena) OptimizeGroup(nullptr, nullptr);
+  EXPECT_EQ(reused, task);
+  EXPECT_EQ(arena.GetRegion().Allocated(), allocated);
+
+  // Live objects never share memory
+  auto *other = new (&arena) OptimizeGroup(nullptr, nullptr);
+  EXPECT_NE(other, reused);
+  EXPECT_GT(arena.GetRegion().Allocated(), allocated);
+  delete reused;
+  delete other;
+}
+
 // NOLINTNEXTLINE
 TEST_F(OptimizerContextTest, OptimizerContextTaskStackTest) {
   auto context = OptimizerContext(nullptr);
 
   auto task_stack = new OptimizerTaskStack();
-  task_stack->Push(new OptimizeGroup(nullptr, nullptr));
+  task_stack->Push(new (context.GetArena()) OptimizeGroup(nullptr, nullptr));
   context.SetTaskPool(task_stack);
 
-  auto *pushed = new OptimizeGroup(nullptr, nullptr);
+  auto *pushed = new (context.GetArena()) OptimizeGroup(nullptr, nullptr);
   context.PushTask(pushed);
   EXPECT_EQ(task_stack->Pop(), pushed);
   EXPECT_TRUE(!task_stack->Empty());
@@ -102,7 +124,7 @@ TEST_F(OptimizerContextTest, OptimizerContextTaskStackNullptrTest) {
   context.SetTaskPool(nullptr);
 
   auto task_stack = new OptimizerTaskStack();
-  task_stack->Push(new OptimizeGroup(nullptr, nullptr));
+  task_stack->Push(new (context.GetArena()) OptimizeGroup(nullptr, nullptr));
   context.SetTaskPool(task_stack);
 
   // This should clean up memory
@@ -159,6 +159,10 @@ TEST(OperatorTests, IndexScanTest) {
   // different from index_scan_1 in 'is for update'
   Operator index_scan_05 = IndexScan::Make(catalog::db_oid_t(1), catalog::namespace_oid_t(2), catalog::table_oid_t(4),
                                            catalog::index_oid_t(3), std::vector<AnnotatedExpression>(), true, type, {});
+  // different from index_scan_1 in scan limit
+  Operator index_scan_06 = IndexScan::Make(catalog::db_oid_t(1), catalog::namespace_oid_t(2), catalog::table_oid_t(4),
+                                           catalog::index_oid_t(3), std::vector<AnnotatedExpression>(), false, type, {},
+                                           20);
   Operator index_scan_1 = IndexScan::Make(catalog::db_oid_t(1), catalog::namespace_oid_t(2), catalog::table_oid_t(4),
                                           catalog::index_oid_t(3), std::vector<AnnotatedExpression>(), false, type, {});
   Operator index_scan_2 = IndexScan::Make(catalog::db_oid_t(1), catalog::namespace_oid_t(2), catalog::table_oid_t(4),
@@ -186,6 +190,8 @@ TEST(OperatorTests, IndexScanTest) {
   EXPECT_EQ(index_scan_3.As<IndexScan>()->GetPredicates(), std::vector<AnnotatedExpression>{annotated_expr_0});
   EXPECT_EQ(index_scan_4.As<IndexScan>()->GetPredicates(), std::vector<AnnotatedExpression>{annotated_expr_1});
   EXPECT_EQ(index_scan_1.As<IndexScan>()->GetIsForUpdate(), false);
+  EXPECT_EQ(index_scan_1.As<IndexScan>()->GetScanLimit(), 0);
+  EXPECT_EQ(index_scan_06.As<IndexScan>()->GetScanLimit(), 20);
   EXPECT_EQ(index_scan_1.GetName(), "IndexScan");
   EXPECT_TRUE(index_scan_1 == index_scan_2);
   EXPECT_FALSE(index_scan_1 == index_scan_3);
@@ -194,6 +200,7 @@ TEST(OperatorTests, IndexScanTest) {
   EXPECT_FALSE(index_scan_1 == index_scan_03);
   EXPECT_FALSE(index_scan_1 == index_scan_04);
   EXPECT_FALSE(index_scan_1 == index_scan_05);
+  EXPECT_FALSE(index_scan_1 == index_scan_06);
   EXPECT_FALSE(index_scan_1 == index_scan_4);
   EXPECT_FALSE(index_scan_4 == index_scan_5);
   EXPECT_FALSE(index_scan_1 == index_scan_6);
@@ -204,6 +211,7 @@ TEST(OperatorTests, IndexScanTest) {
   EXPECT_NE(index_scan_1.Hash(), index_scan_03.Hash());
   EXPECT_NE(index_scan_1.Hash(), index_scan_04.Hash());
   EXPECT_NE(index_scan_1.Hash(), index_scan_05.Hash());
+  EXPECT_NE(index_scan_1.Hash(), index_scan_06.Hash());
   EXPECT_NE(index_scan_1.Hash(), index_scan_4.Hash());
   EXPECT_NE(index_scan_1.Hash(), index_scan_5.Hash());
   EXPECT_NE(index_scan_1.Hash(), index_scan_6.Hash());
@@ -696,6 +704,138 @@ TEST(OperatorTests, OuterHashJoinTest) {
   delete expr_b_3;
 }
 
+// NOLINTNEXTLINE
+TEST(OperatorTests, LeftSemiHashJoinTest) {
+  //===--------------------------------------------------------------------===//
+  // LeftSemiHashJoin
+  //===--------------------------------------------------------------------===//
+  parser::AbstractExpression *expr_b_1 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(true));
+  parser::AbstractExpression *expr_b_2 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(true));
+  parser::AbstractExpression *expr_b_3 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(false));
+
+  auto x_1 = common::ManagedPointer<parser::AbstractExpression>(expr_b_1);
+  auto x_2 = common::ManagedPointer<parser::AbstractExpression>(expr_b_2);
+  auto x_3 = common::ManagedPointer<parser::AbstractExpression>(expr_b_3);
+
+  auto annotated_expr_0 =
+      AnnotatedExpression(common::ManagedPointer<parser::AbstractExpression>(), std::unordered_set<std::string>());
+  auto annotated_expr_1 = AnnotatedExpression(x_1, std::unordered_set<std::string>());
+  auto annotated_expr_2 = AnnotatedExpression(x_2, std::unordered_set<std::string>());
+  auto annotated_expr_3 = AnnotatedExpression(x_3, std::unordered_set<std::string>());
+
+  Operator semi_hash_join_1 = LeftSemiHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator semi_hash_join_2 = LeftSemiHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator semi_hash_join_3 = LeftSemiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_0}, {x_1}, {x_1});
+  Operator semi_hash_join_4 = LeftSemiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_1});
+  Operator semi_hash_join_5 = LeftSemiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_2}, {x_2}, {x_1});
+  Operator semi_hash_join_6 = LeftSemiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_2});
+  Operator semi_hash_join_7 = LeftSemiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_3}, {x_1}, {x_1});
+  Operator semi_hash_join_8 = LeftSemiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_3}, {x_1});
+  Operator semi_hash_join_9 = LeftSemiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_3});
+
+  EXPECT_EQ(semi_hash_join_1.GetType(), OpType::LEFTSEMIHASHJOIN);
+  EXPECT_EQ(semi_hash_join_3.GetType(), OpType::LEFTSEMIHASHJOIN);
+  EXPECT_EQ(semi_hash_join_1.GetName(), "LeftSemiHashJoin");
+  EXPECT_EQ(semi_hash_join_1.As<LeftSemiHashJoin>()->GetJoinPredicates(), std::vector<AnnotatedExpression>());
+  EXPECT_EQ(semi_hash_join_3.As<LeftSemiHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_0});
+  EXPECT_EQ(semi_hash_join_4.As<LeftSemiHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_1});
+  EXPECT_EQ(semi_hash_join_1.As<LeftSemiHashJoin>()->GetLeftKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_1});
+  EXPECT_EQ(semi_hash_join_9.As<LeftSemiHashJoin>()->GetRightKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_3});
+  EXPECT_TRUE(semi_hash_join_1 == semi_hash_join_2);
+  EXPECT_FALSE(semi_hash_join_1 == semi_hash_join_3);
+  EXPECT_FALSE(semi_hash_join_4 == semi_hash_join_3);
+  EXPECT_TRUE(semi_hash_join_4 == semi_hash_join_5);
+  EXPECT_TRUE(semi_hash_join_4 == semi_hash_join_6);
+  EXPECT_FALSE(semi_hash_join_4 == semi_hash_join_7);
+  EXPECT_FALSE(semi_hash_join_4 == semi_hash_join_8);
+  EXPECT_FALSE(semi_hash_join_4 == semi_hash_join_9);
+  EXPECT_EQ(semi_hash_join_1.Hash(), semi_hash_join_2.Hash());
+  EXPECT_NE(semi_hash_join_1.Hash(), semi_hash_join_3.Hash());
+  EXPECT_NE(semi_hash_join_4.Hash(), semi_hash_join_3.Hash());
+  EXPECT_EQ(semi_hash_join_4.Hash(), semi_hash_join_5.Hash());
+  EXPECT_EQ(semi_hash_join_4.Hash(), semi_hash_join_6.Hash());
+  EXPECT_NE(semi_hash_join_4.Hash(), semi_hash_join_7.Hash());
+  EXPECT_NE(semi_hash_join_4.Hash(), semi_hash_join_8.Hash());
+  EXPECT_NE(semi_hash_join_4.Hash(), semi_hash_join_9.Hash());
+
+  delete expr_b_1;
+  delete expr_b_2;
+  delete expr_b_3;
+}
+
+// NOLINTNEXTLINE
+TEST(OperatorTests, LeftAntiHashJoinTest) {
+  //===--------------------------------------------------------------------===//
+  // LeftAntiHashJoin
+  //===--------------------------------------------------------------------===//
+  parser::AbstractExpression *expr_b_1 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(true));
+  parser::AbstractExpression *expr_b_2 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(true));
+  parser::AbstractExpression *expr_b_3 =
+      new parser::ConstantValueExpression(type::TransientValueFactory::GetBoolean(false));
+
+  auto x_1 = common::ManagedPointer<parser::AbstractExpression>(expr_b_1);
+  auto x_2 = common::ManagedPointer<parser::AbstractExpression>(expr_b_2);
+  auto x_3 = common::ManagedPointer<parser::AbstractExpression>(expr_b_3);
+
+  auto annotated_expr_0 =
+      AnnotatedExpression(common::ManagedPointer<parser::AbstractExpression>(), std::unordered_set<std::string>());
+  auto annotated_expr_1 = AnnotatedExpression(x_1, std::unordered_set<std::string>());
+  auto annotated_expr_2 = AnnotatedExpression(x_2, std::unordered_set<std::string>());
+  auto annotated_expr_3 = AnnotatedExpression(x_3, std::unordered_set<std::string>());
+
+  Operator anti_hash_join_1 = LeftAntiHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator anti_hash_join_2 = LeftAntiHashJoin::Make(std::vector<AnnotatedExpression>(), {x_1}, {x_1});
+  Operator anti_hash_join_3 = LeftAntiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_0}, {x_1}, {x_1});
+  Operator anti_hash_join_4 = LeftAntiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_1});
+  Operator anti_hash_join_5 = LeftAntiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_2}, {x_2}, {x_1});
+  Operator anti_hash_join_6 = LeftAntiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_2});
+  Operator anti_hash_join_7 = LeftAntiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_3}, {x_1}, {x_1});
+  Operator anti_hash_join_8 = LeftAntiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_3}, {x_1});
+  Operator anti_hash_join_9 = LeftAntiHashJoin::Make(std::vector<AnnotatedExpression>{annotated_expr_1}, {x_1}, {x_3});
+
+  EXPECT_EQ(anti_hash_join_1.GetType(), OpType::LEFTANTIHASHJOIN);
+  EXPECT_EQ(anti_hash_join_3.GetType(), OpType::LEFTANTIHASHJOIN);
+  EXPECT_EQ(anti_hash_join_1.GetName(), "LeftAntiHashJoin");
+  EXPECT_EQ(anti_hash_join_1.As<LeftAntiHashJoin>()->GetJoinPredicates(), std::vector<AnnotatedExpression>());
+  EXPECT_EQ(anti_hash_join_3.As<LeftAntiHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_0});
+  EXPECT_EQ(anti_hash_join_4.As<LeftAntiHashJoin>()->GetJoinPredicates(),
+            std::vector<AnnotatedExpression>{annotated_expr_1});
+  EXPECT_EQ(anti_hash_join_1.As<LeftAntiHashJoin>()->GetLeftKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_1});
+  EXPECT_EQ(anti_hash_join_9.As<LeftAntiHashJoin>()->GetRightKeys(),
+            std::vector<common::ManagedPointer<parser::AbstractExpression>>{x_3});
+  EXPECT_TRUE(anti_hash_join_1 == anti_hash_join_2);
+  EXPECT_FALSE(anti_hash_join_1 == anti_hash_join_3);
+  EXPECT_FALSE(anti_hash_join_4 == anti_hash_join_3);
+  EXPECT_TRUE(anti_hash_join_4 == anti_hash_join_5);
+  EXPECT_TRUE(anti_hash_join_4 == anti_hash_join_6);
+  EXPECT_FALSE(anti_hash_join_4 == anti_hash_join_7);
+  EXPECT_FALSE(anti_hash_join_4 == anti_hash_join_8);
+  EXPECT_FALSE(anti_hash_join_4 == anti_hash_join_9);
+  EXPECT_EQ(anti_hash_join_1.Hash(), anti_hash_join_2.Hash());
+  EXPECT_NE(anti_hash_join_1.Hash(), anti_hash_join_3.Hash());
+  EXPECT_NE(anti_hash_join_4.Hash(), anti_hash_join_3.Hash());
+  EXPECT_EQ(anti_hash_join_4.Hash(), anti_hash_join_5.Hash());
+  EXPECT_EQ(anti_hash_join_4.Hash(), anti_hash_join_6.Hash());
+  EXPECT_NE(anti_hash_join_4.Hash(), anti_hash_join_7.Hash());
+  EXPECT_NE(anti_hash_join_4.Hash(), anti_hash_join_8.Hash());
+  EXPECT_NE(anti_hash_join_4.Hash(), anti_hash_join_9.Hash());
+
+  delete expr_b_1;
+  delete expr_b_2;
+  delete expr_b_3;
+}
+
 // NOLINTNEXTLINE
 TEST(OperatorTests, InsertTest) {
   //===--------------------------------------------------------------------===//
@@ -715,13 +855,14 @@ TEST(OperatorTests, InsertTest) {
   // Check that all of our GET methods work as expected
   Operator op1 =
       Insert::Make(database_oid, namespace_oid, table_oid, std::vector<catalog::col_oid_t>(columns, std::end(columns)),
-                   std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>(values),
+                   std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>(values), nullptr,
                    std::vector<catalog::index_oid_t>(indexes));
   EXPECT_EQ(op1.GetType(), OpType::INSERT);
   EXPECT_EQ(op1.As<Insert>()->GetDatabaseOid(), database_oid);
   EXPECT_EQ(op1.As<Insert>()->GetNamespaceOid(), namespace_oid);
   EXPECT_EQ(op1.As<Insert>()->GetTableOid(), table_oid);
   EXPECT_EQ(op1.As<Insert>()->GetValues(), values);
+  EXPECT_EQ(op1.As<Insert>()->GetConstantBatch(), nullptr);
   EXPECT_EQ(op1.As<Insert>()->GetColumns(), (std::vector<catalog::col_oid_t>(columns, std::end(columns))));
   EXPECT_EQ(op1.As<Insert>()->GetIndexes(), indexes);
 
@@ -729,7 +870,7 @@ TEST(OperatorTests, InsertTest) {
   // be equal to our first object and have the same hash
   Operator op2 =
       Insert::Make(database_oid, namespace_oid, table_oid, std::vector<catalog::col_oid_t>(columns, std::end(columns)),
-                   std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>(values),
+                   std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>(values), nullptr,
                    std::vector<catalog::index_oid_t>(indexes));
   EXPECT_TRUE(op1 == op2);
   EXPECT_EQ(op1.Hash(), op2.Hash());
@@ -741,7 +882,7 @@ TEST(OperatorTests, InsertTest) {
       std::vector<common::ManagedPointer<parser::AbstractExpression>>(raw_values, std::end(raw_values))};
   Operator op3 =
       Insert::Make(database_oid, namespace_oid, table_oid, std::vector<catalog::col_oid_t>(columns, std::end(columns)),
-                   std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>(other_values),
+                   std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>(other_values), nullptr,
                    std::vector<catalog::index_oid_t>(indexes));
   EXPECT_FALSE(op1 == op3);
   EXPECT_NE(op1.Hash(), op3.Hash());
@@ -758,7 +899,7 @@ TEST(OperatorTests, InsertTest) {
       std::vector<common::ManagedPointer<parser::AbstractExpression>>(bad_raw_values, std::end(bad_raw_values))};
   EXPECT_DEATH(
       Insert::Make(database_oid, namespace_oid, table_oid, std::vector<catalog::col_oid_t>(columns, std::end(columns)),
-                   std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>(bad_values),
+                   std::vector<std::vector<common::ManagedPointer<parser::AbstractExpression>>>(bad_values), nullptr,
                    std::vector<catalog::index_oid_t>(indexes)),
       "Mismatched");
   for (auto entry : bad_raw_values) delete entry;
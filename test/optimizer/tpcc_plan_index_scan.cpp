@@ -9,6 +9,7 @@
 #include "parser/expression_util.h"
 #include "parser/postgresparser.h"
 #include "planner/plannodes/abstract_plan_node.h"
+#include "planner/plannodes/aggregate_plan_node.h"
 #include "planner/plannodes/index_scan_plan_node.h"
 #include "planner/plannodes/limit_plan_node.h"
 #include "planner/plannodes/order_by_plan_node.h"
@@ -123,8 +124,8 @@ TEST_F(TpccPlanIndexScanTests, IndexCannotFulfillSort) {
     EXPECT_NE(plan->GetPlanNodeType(), planner::PlanNodeType::INDEXSCAN);
   };
 
-  OptimizeQuery("SELECT NO_O_ID FROM \"NEW ORDER\" ORDER BY NO_W_ID DESC", tbl_new_order_, check);
   OptimizeQuery("SELECT NO_O_ID FROM \"NEW ORDER\" ORDER BY NO_D_ID", tbl_new_order_, check);
+  OptimizeQuery("SELECT NO_O_ID FROM \"NEW ORDER\" ORDER BY NO_D_ID DESC", tbl_new_order_, check);
   OptimizeQuery("SELECT NO_O_ID FROM \"NEW ORDER\" ORDER BY NO_W_ID, NO_D_ID DESC", tbl_new_order_, check);
 }
 
@@ -181,24 +182,9 @@ TEST_F(TpccPlanIndexScanTests, IndexFulfillSortAndPredicateWithLimitOffset) {
     EXPECT_EQ(limit_plan->GetLimit(), sel_stmt->GetSelectLimit()->GetLimit());
     EXPECT_EQ(limit_plan->GetOffset(), sel_stmt->GetSelectLimit()->GetOffset());
 
-    // Order By
-    auto planc = planl->GetChild(0);
-    EXPECT_EQ(planc->GetChildrenSize(), 1);
-    EXPECT_EQ(planc->GetPlanNodeType(), planner::PlanNodeType::ORDERBY);
-    auto orderby = reinterpret_cast<const planner::OrderByPlanNode *>(planc);
-    EXPECT_EQ(orderby->HasLimit(), true);
-    EXPECT_EQ(orderby->GetLimit(), sel_stmt->GetSelectLimit()->GetLimit());
-    EXPECT_EQ(orderby->GetOffset(), sel_stmt->GetSelectLimit()->GetOffset());
-    EXPECT_EQ(orderby->GetSortKeys().size(), 1);
-    EXPECT_EQ(orderby->GetSortKeys()[0].second, optimizer::OrderByOrderingType::ASC);
-    auto sortkey = orderby->GetSortKeys()[0].first.CastManagedPointerTo<parser::DerivedValueExpression>();
-    EXPECT_TRUE(sortkey != nullptr);
-    EXPECT_EQ(sortkey->GetExpressionType(), parser::ExpressionType::VALUE_TUPLE);
-    EXPECT_EQ(sortkey->GetTupleIdx(), 0);
-    EXPECT_EQ(sortkey->GetValueIdx(), 0);
-
+    // The index produces the order, so there is no Order By
     // Should use New Order Primary Key (NO_W_ID, NO_D_ID, NO_O_ID)
-    auto plani = planc->GetChild(0);
+    auto plani = planl->GetChild(0);
     EXPECT_EQ(plani->GetPlanNodeType(), planner::PlanNodeType::INDEXSCAN);
     EXPECT_EQ(plani->GetChildrenSize(), 0);
     auto index_plan = reinterpret_cast<const planner::IndexScanPlanNode *>(plani);
@@ -210,6 +196,9 @@ TEST_F(TpccPlanIndexScanTests, IndexFulfillSortAndPredicateWithLimitOffset) {
     EXPECT_EQ(index_plan->GetDatabaseOid(), test->db_);
     EXPECT_EQ(index_plan->GetNamespaceOid(), test->accessor_->GetDefaultNamespace());
 
+    // The predicate is evaluated after the index scan, so the limit can't be pushed into it
+    EXPECT_EQ(index_plan->ScanLimit(), 0);
+
     // Check Index Scan Predicate
     auto scan_pred = index_plan->GetScanPredicate();
     EXPECT_TRUE(scan_pred != nullptr);
@@ -228,4 +217,208 @@ TEST_F(TpccPlanIndexScanTests, IndexFulfillSortAndPredicateWithLimitOffset) {
   OptimizeQuery(query, tbl_new_order_, check);
 }
 
+// NOLINTNEXTLINE
+TEST_F(TpccPlanIndexScanTests, IndexFulfillSortWithLimitPushdown) {
+  auto check = [](TpccPlanTest *test, parser::SelectStatement *sel_stmt, catalog::table_oid_t tbl_oid,
+                  std::unique_ptr<planner::AbstractPlanNode> plan) {
+    EXPECT_EQ(plan->GetChildrenSize(), 1);
+    EXPECT_EQ(plan->GetPlanNodeType(), planner::PlanNodeType::PROJECTION);
+
+    // Limit still applies the offset
+    auto planl = plan->GetChild(0);
+    EXPECT_EQ(planl->GetChildrenSize(), 1);
+    EXPECT_EQ(planl->GetPlanNodeType(), planner::PlanNodeType::LIMIT);
+    auto limit_plan = reinterpret_cast<const planner::LimitPlanNode *>(planl);
+    EXPECT_EQ(limit_plan->GetLimit(), sel_stmt->GetSelectLimit()->GetLimit());
+    EXPECT_EQ(limit_plan->GetOffset(), sel_stmt->GetSelectLimit()->GetOffset());
+
+    // No Order By, and the index scan stops after LIMIT + OFFSET tuples
+    auto plani = planl->GetChild(0);
+    EXPECT_EQ(plani->GetPlanNodeType(), planner::PlanNodeType::INDEXSCAN);
+    EXPECT_EQ(plani->GetChildrenSize(), 0);
+    auto index_plan = reinterpret_cast<const planner::IndexScanPlanNode *>(plani);
+    EXPECT_EQ(index_plan->GetIndexOid(), test->pk_new_order_);
+    EXPECT_EQ(index_plan->GetScanType(), planner::IndexScanType::AscendingOpenBoth);
+    EXPECT_EQ(index_plan->ScanLimit(), 460);
+    EXPECT_EQ(index_plan->GetScanPredicate().Get(), nullptr);
+  };
+
+  std::string query = "SELECT NO_O_ID FROM \"NEW ORDER\" ORDER BY NO_W_ID LIMIT 15 OFFSET 445";
+  OptimizeQuery(query, tbl_new_order_, check);
+}
+
+// NOLINTNEXTLINE
+TEST_F(TpccPlanIndexScanTests, IndexFulfillDescendingSort) {
+  auto check = [](TpccPlanTest *test, parser::SelectStatement *sel_stmt, catalog::table_oid_t tbl_oid,
+                  std::unique_ptr<planner::AbstractPlanNode> plan) {
+    // The ascending New Order Primary Key (NO_W_ID, NO_D_ID, NO_O_ID) is scanned backwards, there is no Order By
+    EXPECT_EQ(plan->GetPlanNodeType(), planner::PlanNodeType::INDEXSCAN);
+    EXPECT_EQ(plan->GetChildrenSize(), 0);
+    auto index_plan = reinterpret_cast<planner::IndexScanPlanNode *>(plan.get());
+    EXPECT_EQ(index_plan->GetIndexOid(), test->pk_new_order_);
+    EXPECT_EQ(index_plan->GetScanType(), planner::IndexScanType::Descending);
+    EXPECT_EQ(index_plan->ScanLimit(), 0);
+    EXPECT_EQ(index_plan->GetScanPredicate().Get(), nullptr);
+
+    // From the largest to the smallest key
+    auto &index_schema = test->accessor_->GetIndexSchema(test->pk_new_order_);
+    EXPECT_EQ(index_plan->GetLoIndexColumns().size(), index_schema.GetColumns().size());
+    EXPECT_EQ(index_plan->GetHiIndexColumns().size(), index_schema.GetColumns().size());
+  };
+
+  OptimizeQuery("SELECT NO_O_ID FROM \"NEW ORDER\" ORDER BY NO_W_ID DESC", tbl_new_order_, check);
+  OptimizeQuery("SELECT NO_O_ID FROM \"NEW ORDER\" ORDER BY NO_W_ID DESC, NO_D_ID DESC", tbl_new_order_, check);
+}
+
+// NOLINTNEXTLINE
+TEST_F(TpccPlanIndexScanTests, IndexFulfillDescendingSortWithLimitPushdown) {
+  auto check = [](TpccPlanTest *test, parser::SelectStatement *sel_stmt, catalog::table_oid_t tbl_oid,
+                  std::unique_ptr<planner::AbstractPlanNode> plan) {
+    EXPECT_EQ(plan->GetChildrenSize(), 1);
+    EXPECT_EQ(plan->GetPlanNodeType(), planner::PlanNodeType::PROJECTION);
+
+    // Limit still applies the offset
+    auto planl = plan->GetChild(0);
+    EXPECT_EQ(planl->GetChildrenSize(), 1);
+    EXPECT_EQ(planl->GetPlanNodeType(), planner::PlanNodeType::LIMIT);
+    auto limit_plan = reinterpret_cast<const planner::LimitPlanNode *>(planl);
+    EXPECT_EQ(limit_plan->GetLimit(), sel_stmt->GetSelectLimit()->GetLimit());
+    EXPECT_EQ(limit_plan->GetOffset(), sel_stmt->GetSelectLimit()->GetOffset());
+
+    // No Order By, and the backward index scan stops after LIMIT + OFFSET tuples
+    auto plani = planl->GetChild(0);
+    EXPECT_EQ(plani->GetPlanNodeType(), planner::PlanNodeType::INDEXSCAN);
+    EXPECT_EQ(plani->GetChildrenSize(), 0);
+    auto index_plan = reinterpret_cast<const planner::IndexScanPlanNode *>(plani);
+    EXPECT_EQ(index_plan->GetIndexOid(), test->pk_new_order_);
+    EXPECT_EQ(index_plan->GetScanType(), planner::IndexScanType::DescendingLimit);
+    EXPECT_EQ(index_plan->ScanLimit(), 460);
+    EXPECT_EQ(index_plan->GetScanPredicate().Get(), nullptr);
+
+    // The bounds are the smallest and the largest value of each key column
+    auto &index_schema = test->accessor_->GetIndexSchema(test->pk_new_order_);
+    auto w_key = index_schema.GetColumn(0).Oid();
+    auto lo = index_plan->GetLoIndexColumns().at(w_key).CastManagedPointerTo<parser::ConstantValueExpression>();
+    auto hi = index_plan->GetHiIndexColumns().at(w_key).CastManagedPointerTo<parser::ConstantValueExpression>();
+    EXPECT_EQ(type::TransientValuePeeker::PeekTinyInt(lo->GetValue()), INT8_MIN);
+    EXPECT_EQ(type::TransientValuePeeker::PeekTinyInt(hi->GetValue()), INT8_MAX);
+  };
+
+  std::string query = "SELECT NO_O_ID FROM \"NEW ORDER\" ORDER BY NO_W_ID DESC LIMIT 15 OFFSET 445";
+  OptimizeQuery(query, tbl_new_order_, check);
+}
+
+// NOLINTNEXTLINE
+TEST_F(TpccPlanIndexScanTests, CompositePrefixRangeIndexScan) {
+  auto check = [](TpccPlanTest *test, parser::SelectStatement *sel_stmt, catalog::table_oid_t tbl_oid,
+                  std::unique_ptr<planner::AbstractPlanNode> plan) {
+    // Should use New Order Primary Key (NO_W_ID, NO_D_ID, NO_O_ID)
+    EXPECT_EQ(plan->GetPlanNodeType(), planner::PlanNodeType::INDEXSCAN);
+    auto index_plan = reinterpret_cast<planner::IndexScanPlanNode *>(plan.get());
+    EXPECT_EQ(index_plan->GetIndexOid(), test->pk_new_order_);
+
+    // NO_W_ID = 1 AND NO_D_ID > 2 scans from (1, 2) to (1, MAX) instead of to the end of the index
+    EXPECT_EQ(index_plan->GetScanType(), planner::IndexScanType::AscendingClosed);
+    auto &index_schema = test->accessor_->GetIndexSchema(test->pk_new_order_);
+    auto w_key = index_schema.GetColumn(0).Oid();
+    auto d_key = index_schema.GetColumn(1).Oid();
+    auto &lo = index_plan->GetLoIndexColumns();
+    auto &hi = index_plan->GetHiIndexColumns();
+    EXPECT_EQ(lo.size(), 2);
+    EXPECT_EQ(hi.size(), 2);
+    EXPECT_EQ(lo.at(w_key), hi.at(w_key));
+    EXPECT_EQ(hi.at(d_key)->GetExpressionType(), parser::ExpressionType::VALUE_CONSTANT);
+    EXPECT_NE(lo.at(d_key), hi.at(d_key));
+
+    // The predicates are still checked
+    EXPECT_EQ(index_plan->GetScanPredicate()->GetExpressionType(), parser::ExpressionType::CONJUNCTION_AND);
+  };
+
+  OptimizeQuery("SELECT NO_O_ID FROM \"NEW ORDER\" WHERE NO_W_ID = 1 AND NO_D_ID > 2", tbl_new_order_, check);
+}
+
+// NOLINTNEXTLINE
+TEST_F(TpccPlanIndexScanTests, InListRangeIndexScan) {
+  auto check = [](TpccPlanTest *test, parser::SelectStatement *sel_stmt, catalog::table_oid_t tbl_oid,
+                  std::unique_ptr<planner::AbstractPlanNode> plan) {
+    // Should use New Order Primary Key (NO_W_ID, NO_D_ID, NO_O_ID)
+    EXPECT_EQ(plan->GetPlanNodeType(), planner::PlanNodeType::INDEXSCAN);
+    auto index_plan = reinterpret_cast<planner::IndexScanPlanNode *>(plan.get());
+    EXPECT_EQ(index_plan->GetIndexOid(), test->pk_new_order_);
+
+    // NO_W_ID IN (3, 1, 2) scans from 1 to 3, and the list is still checked
+    auto scan_pred = index_plan->GetScanPredicate();
+    EXPECT_EQ(scan_pred->GetExpressionType(), parser::ExpressionType::COMPARE_IN);
+    EXPECT_EQ(index_plan->GetScanType(), planner::IndexScanType::AscendingClosed);
+    auto w_key = test->accessor_->GetIndexSchema(test->pk_new_order_).GetColumn(0).Oid();
+    EXPECT_EQ(index_plan->GetLoIndexColumns().size(), 1);
+    EXPECT_EQ(index_plan->GetHiIndexColumns().size(), 1);
+    EXPECT_EQ(index_plan->GetLoIndexColumns().at(w_key), scan_pred->GetChild(2));
+    EXPECT_EQ(index_plan->GetHiIndexColumns().at(w_key), scan_pred->GetChild(1));
+  };
+
+  OptimizeQuery("SELECT NO_O_ID FROM \"NEW ORDER\" WHERE NO_W_ID IN (3, 1, 2)", tbl_new_order_, check);
+}
+
+// NOLINTNEXTLINE
+TEST_F(TpccPlanIndexScanTests, DisjunctionLeftToScanPredicate) {
+  auto check = [](TpccPlanTest *test, parser::SelectStatement *sel_stmt, catalog::table_oid_t tbl_oid,
+                  std::unique_ptr<planner::AbstractPlanNode> plan) {
+    // The OR can't bound the index, but NO_W_ID = 1 still can
+    EXPECT_EQ(plan->GetPlanNodeType(), planner::PlanNodeType::INDEXSCAN);
+    auto index_plan = reinterpret_cast<planner::IndexScanPlanNode *>(plan.get());
+    EXPECT_EQ(index_plan->GetIndexOid(), test->pk_new_order_);
+    EXPECT_EQ(index_plan->GetScanType(), planner::IndexScanType::AscendingClosed);
+    EXPECT_EQ(index_plan->GetLoIndexColumns().size(), 1);
+    EXPECT_EQ(index_plan->GetHiIndexColumns().size(), 1);
+    EXPECT_EQ(index_plan->GetScanPredicate()->GetExpressionType(), parser::ExpressionType::CONJUNCTION_AND);
+  };
+
+  OptimizeQuery("SELECT NO_O_ID FROM \"NEW ORDER\" WHERE NO_W_ID = 1 AND (NO_D_ID = 2 OR NO_D_ID = 3)",
+                tbl_new_order_, check);
+}
+
+// NOLINTNEXTLINE
+TEST_F(TpccPlanIndexScanTests, IndexFulfillSortGroupBy) {
+  auto check = [](TpccPlanTest *test, parser::SelectStatement *sel_stmt, catalog::table_oid_t tbl_oid,
+                  std::unique_ptr<planner::AbstractPlanNode> plan) {
+    // Skip the projection, if any
+    const planner::AbstractPlanNode *plana = plan.get();
+    if (plana->GetPlanNodeType() == planner::PlanNodeType::PROJECTION) plana = plana->GetChild(0);
+
+    // The index produces the group by order, so the cheaper sorted aggregation is used without an Order By
+    EXPECT_EQ(plana->GetPlanNodeType(), planner::PlanNodeType::AGGREGATE);
+    EXPECT_EQ(plana->GetChildrenSize(), 1);
+    auto aggr = reinterpret_cast<const planner::AggregatePlanNode *>(plana);
+    EXPECT_EQ(aggr->GetAggregateStrategyType(), planner::AggregateStrategyType::SORTED);
+    EXPECT_EQ(aggr->GetGroupByTerms().size(), 1);
+
+    // Should use New Order Primary Key (NO_W_ID, NO_D_ID, NO_O_ID)
+    auto plani = plana->GetChild(0);
+    EXPECT_EQ(plani->GetPlanNodeType(), planner::PlanNodeType::INDEXSCAN);
+    auto index_plan = reinterpret_cast<const planner::IndexScanPlanNode *>(plani);
+    EXPECT_EQ(index_plan->GetIndexOid(), test->pk_new_order_);
+  };
+
+  OptimizeQuery("SELECT NO_W_ID, COUNT(NO_O_ID) FROM \"NEW ORDER\" GROUP BY NO_W_ID", tbl_new_order_, check);
+}
+
+// NOLINTNEXTLINE
+TEST_F(TpccPlanIndexScanTests, IndexCannotFulfillSortGroupBy) {
+  auto check = [](TpccPlanTest *test, parser::SelectStatement *sel_stmt, catalog::table_oid_t tbl_oid,
+                  std::unique_ptr<planner::AbstractPlanNode> plan) {
+    // Skip the projection, if any
+    const planner::AbstractPlanNode *plana = plan.get();
+    if (plana->GetPlanNodeType() == planner::PlanNodeType::PROJECTION) plana = plana->GetChild(0);
+
+    // NO_O_ID is not a prefix of the index, and sorting costs more than hashing
+    EXPECT_EQ(plana->GetPlanNodeType(), planner::PlanNodeType::AGGREGATE);
+    auto aggr = reinterpret_cast<const planner::AggregatePlanNode *>(plana);
+    EXPECT_EQ(aggr->GetAggregateStrategyType(), planner::AggregateStrategyType::HASH);
+    EXPECT_NE(plana->GetChild(0)->GetPlanNodeType(), planner::PlanNodeType::ORDERBY);
+  };
+
+  OptimizeQuery("SELECT NO_O_ID, COUNT(NO_W_ID) FROM \"NEW ORDER\" GROUP BY NO_O_ID", tbl_new_order_, check);
+}
+
 }  // namespace terrier::optimizer
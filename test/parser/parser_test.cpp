@@ -1209,6 +1209,36 @@ TEST_F(ParserTestBase, OldInsertTest) {
   EXPECT_EQ(type::TransientValuePeeker::PeekInteger(constant->GetValue()), 5);
 }
 
+// NOLINTNEXTLINE
+TEST_F(ParserTestBase, ConstantBatchInsertTest) {
+  // A long VALUES list of constants is parsed into a constant batch instead of expressions
+  const uint32_t num_rows = PostgresParser::CONSTANT_BATCH_MIN_ROWS;
+  std::string query = "INSERT INTO foo VALUES ";
+  for (uint32_t i = 0; i < num_rows; i++) {
+    query += (i != 0 ? ", (" : "(") + std::to_string(i) + ", 'row" + std::to_string(i) + "', NULL)";
+  }
+  auto result = parser::PostgresParser::BuildParseTree(query);
+  auto insert_stmt = result->GetStatement(0).CastManagedPointerTo<InsertStatement>();
+  EXPECT_TRUE(insert_stmt->GetValues()->empty());
+
+  auto batch = insert_stmt->GetConstantBatch();
+  ASSERT_NE(batch, nullptr);
+  EXPECT_EQ(batch->NumRows(), num_rows);
+  EXPECT_EQ(batch->NumColumns(), 3);
+  for (uint32_t i = 0; i < num_rows; i++) {
+    EXPECT_EQ(type::TransientValuePeeker::PeekInteger(batch->GetValue(i, 0)), static_cast<int32_t>(i));
+    EXPECT_EQ(type::TransientValuePeeker::PeekVarChar(batch->GetValue(i, 1)), "row" + std::to_string(i));
+    EXPECT_TRUE(batch->GetValue(i, 2).Null());
+  }
+
+  // Anything other than a constant falls back to one expression per value
+  query += ", (1 + 1, 'x', NULL)";
+  result = parser::PostgresParser::BuildParseTree(query);
+  insert_stmt = result->GetStatement(0).CastManagedPointerTo<InsertStatement>();
+  EXPECT_EQ(insert_stmt->GetConstantBatch(), nullptr);
+  EXPECT_EQ(insert_stmt->GetValues()->size(), num_rows + 1);
+}
+
 // NOLINTNEXTLINE
 TEST_F(ParserTestBase, OldCreateTest) {
   std::string query =
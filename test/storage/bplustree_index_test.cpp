@@ -63,7 +63,8 @@ class BPlusTreeIndexTests : public TerrierTest {
     StorageTestUtil::ForceOid(&(col), catalog::col_oid_t(1));
     table_schema_ = catalog::Schema({col});
     sql_table_ = new storage::SqlTable(db_main_->GetStorageLayer()->GetBlockStore(), table_schema_);
-    tuple_initializer_ = sql_table_->InitializerForProjectedRow({catalog::col_oid_t(1)});
+    tuple_initializer_ =
+        sql_table_->InitializerForProjectedRow({catalog::col_oid_t(1)}, storage::INITIAL_LAYOUT_VERSION);
 
     std::vector<catalog::IndexSchema::Column> keycols;
     keycols.emplace_back("", type::TypeId::INTEGER, false,
@@ -126,7 +127,8 @@ TEST_F(BPlusTreeIndexTests, UniqueInsert) {
             insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
         auto *const insert_tuple = insert_redo->Delta();
         *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
-        const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+        const auto tuple_slot =
+            sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
         *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
         if (unique_index_->InsertUnique(common::ManagedPointer(insert_txn), *insert_key, tuple_slot)) {
@@ -143,7 +145,8 @@ TEST_F(BPlusTreeIndexTests, UniqueInsert) {
             insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
         auto *const insert_tuple = insert_redo->Delta();
         *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
-        const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+        const auto tuple_slot =
+            sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
         *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
         if (unique_index_->InsertUnique(common::ManagedPointer(insert_txn), *insert_key, tuple_slot)) {
@@ -200,7 +203,8 @@ TEST_F(BPlusTreeIndexTests, DefaultInsert) {
             insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
         auto *const insert_tuple = insert_redo->Delta();
         *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
-        const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+        const auto tuple_slot =
+            sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
         *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
         EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
@@ -213,7 +217,8 @@ TEST_F(BPlusTreeIndexTests, DefaultInsert) {
             insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
         auto *const insert_tuple = insert_redo->Delta();
         *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
-        const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+        const auto tuple_slot =
+            sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
         *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
         EXPECT_TRUE(default_index_->Insert(common::ManagedPointer(insert_txn), *insert_key, tuple_slot));
@@ -261,7 +266,8 @@ TEST_F(BPlusTreeIndexTests, ScanAscending) {
         insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
     auto *const insert_tuple = insert_redo->Delta();
     *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
-    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+    const auto tuple_slot =
+        sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
     auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
     *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
@@ -335,7 +341,8 @@ TEST_F(BPlusTreeIndexTests, ScanDescending) {
         insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
     auto *const insert_tuple = insert_redo->Delta();
     *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
-    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+    const auto tuple_slot =
+        sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
     auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
     *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
@@ -408,7 +415,8 @@ TEST_F(BPlusTreeIndexTests, ScanLimitAscending) {
         insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
     auto *const insert_tuple = insert_redo->Delta();
     *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
-    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+    const auto tuple_slot =
+        sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
     auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
     *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
@@ -477,7 +485,8 @@ TEST_F(BPlusTreeIndexTests, ScanLimitDescending) {
         insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
     auto *const insert_tuple = insert_redo->Delta();
     *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = i;
-    const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+    const auto tuple_slot =
+        sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
     auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
     *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = i;
@@ -542,7 +551,8 @@ TEST_F(BPlusTreeIndexTests, UniqueKey1) {
       txn0->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn0), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn0), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // txn 0 inserts into index
   auto *insert_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -571,7 +581,8 @@ TEST_F(BPlusTreeIndexTests, UniqueKey1) {
   insert_redo = txn1->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto new_tuple_slot = sql_table_->Insert(common::ManagedPointer(txn1), insert_redo);
+  const auto new_tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn1), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // txn 1 inserts into index and fails due to write-write conflict with txn 0
   insert_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -603,7 +614,8 @@ TEST_F(BPlusTreeIndexTests, UniqueKey2) {
       txn0->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn0), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn0), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // txn 0 inserts into index
   auto *insert_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -629,7 +641,8 @@ TEST_F(BPlusTreeIndexTests, UniqueKey2) {
   insert_redo = txn1->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto new_tuple_slot = sql_table_->Insert(common::ManagedPointer(txn1), insert_redo);
+  const auto new_tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn1), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // txn 1 inserts into index and fails due to visible key conflict with txn 0
   insert_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -659,7 +672,8 @@ TEST_F(BPlusTreeIndexTests, UniqueKey3) {
       txn0->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn0), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn0), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // txn 0 inserts into index
   auto *insert_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -681,7 +695,8 @@ TEST_F(BPlusTreeIndexTests, UniqueKey3) {
   insert_redo = txn0->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto new_tuple_slot = sql_table_->Insert(common::ManagedPointer(txn0), insert_redo);
+  const auto new_tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn0), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // txn 0 inserts into index and fails due to visible key conflict with txn 0
   insert_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -710,7 +725,8 @@ TEST_F(BPlusTreeIndexTests, UniqueKey4) {
       txn0->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn0), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn0), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // txn 0 inserts into index
   auto *insert_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -743,7 +759,8 @@ TEST_F(BPlusTreeIndexTests, UniqueKey4) {
   insert_redo = txn1->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto new_tuple_slot = sql_table_->Insert(common::ManagedPointer(txn1), insert_redo);
+  const auto new_tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn1), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // txn 1 inserts into index and fails due to write-write conflict with txn 0
   insert_key = unique_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -792,7 +809,8 @@ TEST_F(BPlusTreeIndexTests, CommitInsert1) {
       txn0->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn0), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn0), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // txn 0 inserts into index
   auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -866,7 +884,8 @@ TEST_F(BPlusTreeIndexTests, CommitInsert2) {
       txn1->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn1), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn1), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // txn 1 inserts into index
   auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -937,7 +956,8 @@ TEST_F(BPlusTreeIndexTests, AbortInsert1) {
       txn0->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn0), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn0), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // txn 0 inserts into index
   auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -1010,7 +1030,8 @@ TEST_F(BPlusTreeIndexTests, AbortInsert2) {
       txn1->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(txn1), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn1), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // txn 1 inserts into index
   auto *const insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -1080,7 +1101,8 @@ TEST_F(BPlusTreeIndexTests, CommitUpdate1) {
       insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // insert_txn inserts into index
   auto *insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -1110,7 +1132,8 @@ TEST_F(BPlusTreeIndexTests, CommitUpdate1) {
   insert_redo = txn0->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15445;
-  const auto new_tuple_slot = sql_table_->Insert(common::ManagedPointer(txn0), insert_redo);
+  const auto new_tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn0), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
   *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = 15445;
@@ -1207,7 +1230,8 @@ TEST_F(BPlusTreeIndexTests, CommitUpdate2) {
       insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // insert_txn inserts into index
   auto *insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -1237,7 +1261,8 @@ TEST_F(BPlusTreeIndexTests, CommitUpdate2) {
   insert_redo = txn1->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15445;
-  const auto new_tuple_slot = sql_table_->Insert(common::ManagedPointer(txn1), insert_redo);
+  const auto new_tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn1), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
   *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = 15445;
@@ -1334,7 +1359,8 @@ TEST_F(BPlusTreeIndexTests, AbortUpdate1) {
       insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // insert_txn inserts into index
   auto *insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -1364,7 +1390,8 @@ TEST_F(BPlusTreeIndexTests, AbortUpdate1) {
   insert_redo = txn0->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15445;
-  const auto new_tuple_slot = sql_table_->Insert(common::ManagedPointer(txn0), insert_redo);
+  const auto new_tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn0), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
   *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = 15445;
@@ -1461,7 +1488,8 @@ TEST_F(BPlusTreeIndexTests, AbortUpdate2) {
       insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // insert_txn inserts into index
   auto *insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -1491,7 +1519,8 @@ TEST_F(BPlusTreeIndexTests, AbortUpdate2) {
   insert_redo = txn1->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15445;
-  const auto new_tuple_slot = sql_table_->Insert(common::ManagedPointer(txn1), insert_redo);
+  const auto new_tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(txn1), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
   *reinterpret_cast<int32_t *>(insert_key->AccessForceNotNull(0)) = 15445;
@@ -1588,7 +1617,8 @@ TEST_F(BPlusTreeIndexTests, CommitDelete1) {
       insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // insert_txn inserts into index
   auto *insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -1680,7 +1710,8 @@ TEST_F(BPlusTreeIndexTests, CommitDelete2) {
       insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // insert_txn inserts into index
   auto *insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -1772,7 +1803,8 @@ TEST_F(BPlusTreeIndexTests, AbortDelete1) {
       insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // insert_txn inserts into index
   auto *insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -1865,7 +1897,8 @@ TEST_F(BPlusTreeIndexTests, AbortDelete2) {
       insert_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer_);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 15721;
-  const auto tuple_slot = sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo);
+  const auto tuple_slot =
+      sql_table_->Insert(common::ManagedPointer(insert_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // insert_txn inserts into index
   auto *insert_key = default_index_->GetProjectedRowInitializer().InitializeRow(key_buffer_1_);
@@ -1,5 +1,8 @@
+#include <algorithm>
 #include <memory>
+#include <thread>  // NOLINT
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "storage/data_table.h"
@@ -124,6 +127,97 @@ TEST_F(DataTableConcurrentTests, ConcurrentInsert) {
   }
 }
 
+// Spawns multiple transactions that insert concurrently, and checks that every block is only ever inserted into by a
+// single thread, since each thread owns its insertion block.
+// NOLINTNEXTLINE
+TEST_F(DataTableConcurrentTests, ConcurrentInsertThreadAffineBlocks) {
+  const uint32_t num_iterations = 50;
+  const uint32_t num_inserts = 10000;
+  const uint16_t max_columns = 20;
+  const uint32_t num_threads = MultiThreadTestUtil::HardwareConcurrency();
+  common::WorkerPool thread_pool(num_threads, {});
+  thread_pool.Startup();
+
+  for (uint32_t iteration = 0; iteration < num_iterations; iteration++) {
+    storage::BlockLayout layout = StorageTestUtil::RandomLayoutNoVarlen(max_columns, &generator_);
+    storage::DataTable tested(common::ManagedPointer<storage::BlockStore>(&block_store_), layout,
+                              storage::layout_version_t(0));
+    std::vector<std::unique_ptr<FakeTransaction>> fake_txns;
+    for (uint32_t thread = 0; thread < num_threads; thread++)
+      // timestamps are irrelevant for inserts
+      fake_txns.emplace_back(std::make_unique<FakeTransaction>(layout, &tested, null_ratio_(generator_),
+                                                               transaction::timestamp_t(0), transaction::timestamp_t(0),
+                                                               &buffer_pool_));
+    // The worker pool may run several workloads on the same thread, so remember which thread ran each of them
+    std::vector<std::thread::id> thread_ids(num_threads);
+    auto workload = [&](uint32_t id) {
+      thread_ids[id] = std::this_thread::get_id();
+      std::default_random_engine thread_generator(id);
+      for (uint32_t i = 0; i < num_inserts / num_threads; i++) fake_txns[id]->InsertRandomTuple(&thread_generator);
+    };
+    MultiThreadTestUtil::RunThreadsUntilFinish(&thread_pool, num_threads, workload);
+
+    std::unordered_map<storage::RawBlock *, std::unordered_set<std::thread::id>> block_owners;
+    for (uint32_t id = 0; id < num_threads; id++)
+      for (auto slot : fake_txns[id]->InsertedTuples()) block_owners[slot.GetBlock()].insert(thread_ids[id]);
+    for (auto &entry : block_owners) EXPECT_EQ(1, entry.second.size());
+  }
+}
+
+// Scans a table over and over while other threads keep inserting into it. The inserts are newer than the scanning
+// transaction, so every scan should return exactly the tuples that were there before the inserters started.
+// NOLINTNEXTLINE
+TEST_F(DataTableConcurrentTests, ConcurrentScanInsert) {
+  const uint32_t num_iterations = 10;
+  const uint32_t num_preloaded = 1000;
+  const uint32_t num_inserts = 10000;
+  const uint16_t max_columns = 20;
+  const uint32_t num_threads = std::max(MultiThreadTestUtil::HardwareConcurrency(), 2U);
+  common::WorkerPool thread_pool(num_threads, {});
+  thread_pool.Startup();
+
+  for (uint32_t iteration = 0; iteration < num_iterations; iteration++) {
+    storage::BlockLayout layout = StorageTestUtil::RandomLayoutNoVarlen(max_columns, &generator_);
+    storage::DataTable tested(common::ManagedPointer<storage::BlockStore>(&block_store_), layout,
+                              storage::layout_version_t(0));
+    FakeTransaction preload(layout, &tested, null_ratio_(generator_), transaction::timestamp_t(0),
+                            transaction::timestamp_t(0), &buffer_pool_);
+    for (uint32_t i = 0; i < num_preloaded; i++) preload.InsertRandomTuple(&generator_);
+
+    std::vector<std::unique_ptr<FakeTransaction>> fake_txns;
+    for (uint32_t thread = 0; thread < num_threads; thread++)
+      // Inserters are newer than the scanner, which starts at timestamp 1
+      fake_txns.emplace_back(std::make_unique<FakeTransaction>(layout, &tested, null_ratio_(generator_),
+                                                               transaction::timestamp_t(1 + thread),
+                                                               transaction::timestamp_t(1 + thread), &buffer_pool_));
+    std::atomic<bool> inserting = true;
+    std::atomic<uint32_t> num_scans = 0;
+    auto workload = [&](uint32_t id) {
+      if (id != 0) {
+        std::default_random_engine thread_generator(id);
+        for (uint32_t i = 0; i < num_inserts / num_threads; i++) fake_txns[id]->InsertRandomTuple(&thread_generator);
+        inserting = false;
+        return;
+      }
+      storage::ProjectedColumnsInitializer initializer(layout, StorageTestUtil::ProjectionListAllColumns(layout), 100);
+      auto *buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedColumnsSize());
+      storage::ProjectedColumns *columns = initializer.Initialize(buffer);
+      do {
+        uint32_t num_scanned = 0;
+        for (auto it = tested.begin(); it != tested.end();) {
+          tested.Scan(common::ManagedPointer(fake_txns[0]->GetTxn()), &it, columns);
+          num_scanned += columns->NumTuples();
+        }
+        EXPECT_EQ(num_preloaded, num_scanned);
+        num_scans++;
+      } while (inserting);
+      delete[] buffer;
+    };
+    MultiThreadTestUtil::RunThreadsUntilFinish(&thread_pool, num_threads, workload);
+    EXPECT_LT(0U, num_scans.load());
+  }
+}
+
 // Spawns multiple transactions that all begin at the same time.
 // Each transaction attempts to update the same tuple.
 // Therefore only one transaction should win, which is what we test for.
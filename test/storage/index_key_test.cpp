@@ -225,7 +225,8 @@ class IndexKeyTests : public TerrierTest {
                          parser::ConstantValueExpression(type::TransientValueFactory::GetNull(type::TypeId::INTEGER)));
     catalog::Schema schema{columns};
     auto *sql_table = new storage::SqlTable(db_main->GetStorageLayer()->GetBlockStore(), schema);
-    const auto &tuple_initializer = sql_table->InitializerForProjectedRow({catalog::col_oid_t(0)});
+    const auto &tuple_initializer =
+        sql_table->InitializerForProjectedRow({catalog::col_oid_t(0)}, storage::INITIAL_LAYOUT_VERSION);
 
     auto *const txn = txn_manager->BeginTransaction();
 
@@ -249,7 +250,8 @@ class IndexKeyTests : public TerrierTest {
     index->ScanKey(*txn, *key, &results);
     EXPECT_TRUE(results.empty());
 
-    const auto tuple_slot = sql_table->Insert(common::ManagedPointer(txn), insert_redo);
+    const auto tuple_slot =
+        sql_table->Insert(common::ManagedPointer(txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
     EXPECT_TRUE(index->Insert(common::ManagedPointer(txn), *key, tuple_slot));
 
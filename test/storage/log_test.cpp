@@ -301,7 +301,8 @@ TEST_F(WriteAheadLoggingTests, AbortRecordTest) {
   StorageTestUtil::ForceOid(&(col), catalog::col_oid_t(0));
   auto table_schema = catalog::Schema(std::vector<catalog::Schema::Column>({col}));
   auto *const sql_table = new storage::SqlTable(store_, table_schema);
-  auto tuple_initializer = sql_table->InitializerForProjectedRow({catalog::col_oid_t(0)});
+  auto tuple_initializer =
+      sql_table->InitializerForProjectedRow({catalog::col_oid_t(0)}, storage::INITIAL_LAYOUT_VERSION);
 
   // Initialize first transaction, this txn will write a single tuple
   auto *first_txn = txn_manager_->BeginTransaction();
@@ -309,7 +310,8 @@ TEST_F(WriteAheadLoggingTests, AbortRecordTest) {
       first_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 1;
-  auto first_tuple_slot = sql_table->Insert(common::ManagedPointer(first_txn), insert_redo);
+  auto first_tuple_slot =
+      sql_table->Insert(common::ManagedPointer(first_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
   EXPECT_TRUE(!first_txn->Aborted());
 
   // Initialize the second txn, this one will write until it has flushed a buffer to the log manager
@@ -320,7 +322,7 @@ TEST_F(WriteAheadLoggingTests, AbortRecordTest) {
         second_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer);
     insert_tuple = insert_redo->Delta();
     *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = insert_value++;
-    sql_table->Insert(common::ManagedPointer(second_txn), insert_redo);
+    sql_table->Insert(common::ManagedPointer(second_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
   }
   EXPECT_TRUE(GetRedoBuffer(second_txn).HasFlushed());
   EXPECT_TRUE(!second_txn->Aborted());
@@ -332,7 +334,7 @@ TEST_F(WriteAheadLoggingTests, AbortRecordTest) {
   auto update_tuple = update_redo->Delta();
   *reinterpret_cast<int32_t *>(update_tuple->AccessForceNotNull(0)) = 0;
   update_redo->SetTupleSlot(first_tuple_slot);
-  EXPECT_FALSE(sql_table->Update(common::ManagedPointer(second_txn), update_redo));
+  EXPECT_FALSE(sql_table->Update(common::ManagedPointer(second_txn), update_redo, storage::INITIAL_LAYOUT_VERSION));
 
   // Commit first txn and abort the second
   txn_manager_->Commit(first_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
@@ -373,7 +375,8 @@ TEST_F(WriteAheadLoggingTests, NoAbortRecordTest) {
   StorageTestUtil::ForceOid(&(col), catalog::col_oid_t(0));
   auto table_schema = catalog::Schema(std::vector<catalog::Schema::Column>({col}));
   auto *const sql_table = new storage::SqlTable(store_, table_schema);
-  auto tuple_initializer = sql_table->InitializerForProjectedRow({catalog::col_oid_t(0)});
+  auto tuple_initializer =
+      sql_table->InitializerForProjectedRow({catalog::col_oid_t(0)}, storage::INITIAL_LAYOUT_VERSION);
 
   // Initialize first transaction, this txn will write a single tuple
   auto *first_txn = txn_manager_->BeginTransaction();
@@ -381,7 +384,8 @@ TEST_F(WriteAheadLoggingTests, NoAbortRecordTest) {
       first_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, tuple_initializer);
   auto *insert_tuple = insert_redo->Delta();
   *reinterpret_cast<int32_t *>(insert_tuple->AccessForceNotNull(0)) = 1;
-  auto first_tuple_slot = sql_table->Insert(common::ManagedPointer(first_txn), insert_redo);
+  auto first_tuple_slot =
+      sql_table->Insert(common::ManagedPointer(first_txn), insert_redo, storage::INITIAL_LAYOUT_VERSION);
   EXPECT_TRUE(!first_txn->Aborted());
 
   // Initialize the second txn, this txn will try to update the tuple the first txn wrote, and thus will abort. We
@@ -392,7 +396,7 @@ TEST_F(WriteAheadLoggingTests, NoAbortRecordTest) {
   auto update_tuple = update_redo->Delta();
   *reinterpret_cast<int32_t *>(update_tuple->AccessForceNotNull(0)) = 0;
   update_redo->SetTupleSlot(first_tuple_slot);
-  EXPECT_FALSE(sql_table->Update(common::ManagedPointer(second_txn), update_redo));
+  EXPECT_FALSE(sql_table->Update(common::ManagedPointer(second_txn), update_redo, storage::INITIAL_LAYOUT_VERSION));
   EXPECT_FALSE(GetRedoBuffer(second_txn).HasFlushed());
 
   // Commit first txn and abort the second
@@ -154,8 +154,8 @@ class RecoveryTests : public TerrierTest {
 
   storage::RedoBuffer &GetRedoBuffer(transaction::TransactionContext *txn) { return txn->redo_buffer_; }
 
-  storage::BlockLayout &GetBlockLayout(common::ManagedPointer<storage::SqlTable> table) const {
-    return table->table_.layout_;
+  const storage::BlockLayout &GetBlockLayout(common::ManagedPointer<storage::SqlTable> table) const {
+    return table->GetBlockLayout(storage::INITIAL_LAYOUT_VERSION);
   }
 
   // Simulates the system shutting down and restarting
@@ -220,9 +220,9 @@ class RecoveryTests : public TerrierTest {
         EXPECT_TRUE(recovered_sql_table != nullptr);
 
         EXPECT_TRUE(StorageTestUtil::SqlTableEqualDeep(
-            original_sql_table->table_.layout_, original_sql_table, recovered_sql_table,
-            tested->GetTupleSlotsForTable(database_oid, table_oid), recovery_manager.tuple_slot_map_,
-            txn_manager_.Get(), recovery_txn_manager_.Get()));
+            original_sql_table->GetBlockLayout(storage::INITIAL_LAYOUT_VERSION), original_sql_table,
+            recovered_sql_table, tested->GetTupleSlotsForTable(database_oid, table_oid),
+            recovery_manager.tuple_slot_map_, txn_manager_.Get(), recovery_txn_manager_.Get()));
         txn_manager_->Commit(original_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
         recovery_txn_manager_->Commit(recovery_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
       }
@@ -593,10 +593,11 @@ TEST_F(RecoveryTests, ConcurrentDDLChangesTest) {
   const auto &schema = db_catalog->GetSchema(common::ManagedPointer(txn1), table_oid);
   EXPECT_EQ(1, schema.GetColumns().size());
   EXPECT_EQ(type::TypeId::INTEGER, schema.GetColumn(0).Type());
-  auto initializer = table_ptr->InitializerForProjectedRow({schema.GetColumn(0).Oid()});
+  auto initializer =
+      table_ptr->InitializerForProjectedRow({schema.GetColumn(0).Oid()}, storage::INITIAL_LAYOUT_VERSION);
   auto *redo_record = txn1->StageWrite(db_oid, table_oid, initializer);
   *reinterpret_cast<int32_t *>(redo_record->Delta()->AccessForceNotNull(0)) = 0;
-  table_ptr->Insert(common::ManagedPointer(txn1), redo_record);
+  table_ptr->Insert(common::ManagedPointer(txn1), redo_record, storage::INITIAL_LAYOUT_VERSION);
   txn_manager_->Commit(txn1, transaction::TransactionUtil::EmptyCallback, nullptr);
 
   ShutdownAndRestartSystem();
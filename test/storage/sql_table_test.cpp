@@ -0,0 +1,303 @@
+#include "storage/sql_table.h"
+
+#include <chrono>  // NOLINT
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>  // NOLINT
+#include <utility>
+#include <vector>
+
+#include "catalog/index_schema.h"
+#include "catalog/schema.h"
+#include "main/db_main.h"
+#include "parser/expression/column_value_expression.h"
+#include "parser/expression/constant_value_expression.h"
+#include "storage/index/index_builder.h"
+#include "storage/projected_columns.h"
+#include "storage/projected_row.h"
+#include "test_util/catalog_test_util.h"
+#include "test_util/storage_test_util.h"
+#include "test_util/test_harness.h"
+#include "transaction/transaction_context.h"
+#include "transaction/transaction_manager.h"
+#include "type/transient_value_factory.h"
+
+namespace terrier::storage {
+
+class SqlTableTests : public TerrierTest {
+ public:
+  std::unique_ptr<DBMain> db_main_;
+  common::ManagedPointer<transaction::TransactionManager> txn_manager_;
+  common::ManagedPointer<BlockStore> block_store_;
+
+ protected:
+  void SetUp() override {
+    db_main_ = terrier::DBMain::Builder().SetUseGC(true).SetUseGCThread(true).SetRecordBufferSegmentSize(1e6).Build();
+    txn_manager_ = db_main_->GetTransactionLayer()->GetTransactionManager();
+    block_store_ = db_main_->GetStorageLayer()->GetBlockStore();
+  }
+
+  static catalog::Schema::Column IntegerColumn(const catalog::col_oid_t oid, type::TransientValue default_value) {
+    auto col = catalog::Schema::Column("attribute" + std::to_string(!oid), type::TypeId::INTEGER, true,
+                                       parser::ConstantValueExpression(std::move(default_value)));
+    StorageTestUtil::ForceOid(&col, oid);
+    return col;
+  }
+
+  static catalog::Schema::Column IntegerColumn(const catalog::col_oid_t oid) {
+    return IntegerColumn(oid, type::TransientValueFactory::GetNull(type::TypeId::INTEGER));
+  }
+
+  static catalog::Schema::Column VarcharColumn(const catalog::col_oid_t oid) {
+    auto col = catalog::Schema::Column("attribute" + std::to_string(!oid), type::TypeId::VARCHAR, 100, true,
+                                       parser::ConstantValueExpression(
+                                           type::TransientValueFactory::GetNull(type::TypeId::VARCHAR)));
+    StorageTestUtil::ForceOid(&col, oid);
+    return col;
+  }
+
+  // Creates a varlen that owns a copy of the given content
+  static VarlenEntry MakeVarlen(const std::string &content) {
+    auto *const buffer = new byte[content.size()];
+    std::memcpy(buffer, content.data(), content.size());
+    return VarlenEntry::Create(buffer, static_cast<uint32_t>(content.size()), true);
+  }
+
+  TupleSlot InsertTuple(SqlTable *const table, const std::vector<catalog::col_oid_t> &col_oids,
+                        const std::vector<int32_t> &values, const layout_version_t layout_version) {
+    auto *const txn = txn_manager_->BeginTransaction();
+    auto *const redo = txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID,
+                                       table->InitializerForProjectedRow(col_oids, layout_version));
+    const auto pm = table->ProjectionMapForOids(col_oids, layout_version);
+    for (uint32_t i = 0; i < col_oids.size(); i++)
+      *reinterpret_cast<int32_t *>(redo->Delta()->AccessForceNotNull(pm.at(col_oids[i]))) = values[i];
+    const TupleSlot slot = table->Insert(common::ManagedPointer(txn), redo, layout_version);
+    txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+    return slot;
+  }
+
+  // Reads the given column of a tuple as of a new transaction, returns nullptr if it is NULL
+  std::unique_ptr<int32_t> ReadColumn(SqlTable *const table, const TupleSlot slot, const catalog::col_oid_t col_oid,
+                                      const layout_version_t layout_version) {
+    auto *const txn = txn_manager_->BeginTransaction();
+    const auto initializer = table->InitializerForProjectedRow({col_oid}, layout_version);
+    auto *const buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+    auto *const row = initializer.InitializeRow(buffer);
+    EXPECT_TRUE(table->Select(common::ManagedPointer(txn), slot, row, layout_version));
+    const byte *const value = row->AccessWithNullCheck(0);
+    auto result = value == nullptr ? nullptr : std::make_unique<int32_t>(*reinterpret_cast<const int32_t *>(value));
+    delete[] buffer;
+    txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+    return result;
+  }
+
+  // Reads the given VARCHAR column of a tuple as of a new transaction, the column must not be NULL
+  std::string ReadVarchar(SqlTable *const table, const TupleSlot slot, const catalog::col_oid_t col_oid,
+                          const layout_version_t layout_version) {
+    auto *const txn = txn_manager_->BeginTransaction();
+    const auto initializer = table->InitializerForProjectedRow({col_oid}, layout_version);
+    auto *const buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+    auto *const row = initializer.InitializeRow(buffer);
+    EXPECT_TRUE(table->Select(common::ManagedPointer(txn), slot, row, layout_version));
+    const byte *const value = row->AccessWithNullCheck(0);
+    EXPECT_NE(value, nullptr);
+    std::string result(reinterpret_cast<const VarlenEntry *>(value)->StringView());
+    delete[] buffer;
+    txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+    return result;
+  }
+};
+
+// Adds a column with a default value, and checks that tuples of both layout versions read correctly through either
+// version, and that a scan covers both versions.
+// NOLINTNEXTLINE
+TEST_F(SqlTableTests, AddColumn) {
+  const catalog::col_oid_t c1(1), c2(2);
+  auto *const table = new SqlTable(block_store_, catalog::Schema({IntegerColumn(c1)}));
+  const uint32_t num_old_tuples = 100;
+  std::vector<TupleSlot> old_slots;
+  for (uint32_t i = 0; i < num_old_tuples; i++)
+    old_slots.push_back(InsertTuple(table, {c1}, {static_cast<int32_t>(i)}, layout_version_t(0)));
+
+  // ALTER TABLE ADD COLUMN c2 INTEGER DEFAULT 15721
+  const layout_version_t v1 = table->UpdateSchema(
+      catalog::Schema({IntegerColumn(c1), IntegerColumn(c2, type::TransientValueFactory::GetInteger(15721))}));
+  EXPECT_EQ(v1, layout_version_t(1));
+  EXPECT_EQ(table->LatestLayoutVersion(), v1);
+
+  // Old tuples are not migrated, but read the default through the new version
+  for (uint32_t i = 0; i < num_old_tuples; i++) {
+    EXPECT_EQ(old_slots[i].GetBlock()->layout_version_, layout_version_t(0));
+    EXPECT_EQ(*ReadColumn(table, old_slots[i], c1, v1), static_cast<int32_t>(i));
+    EXPECT_EQ(*ReadColumn(table, old_slots[i], c2, v1), 15721);
+  }
+
+  // New tuples go into the new version, whichever version the caller inserts through
+  const TupleSlot new_slot = InsertTuple(table, {c1, c2}, {-1, -2}, v1);
+  const TupleSlot old_format_slot = InsertTuple(table, {c1}, {-3}, layout_version_t(0));
+  EXPECT_EQ(new_slot.GetBlock()->layout_version_, v1);
+  EXPECT_EQ(old_format_slot.GetBlock()->layout_version_, v1);
+  EXPECT_EQ(*ReadColumn(table, new_slot, c1, layout_version_t(0)), -1);
+  EXPECT_EQ(*ReadColumn(table, new_slot, c2, v1), -2);
+  EXPECT_EQ(*ReadColumn(table, old_format_slot, c2, v1), 15721);
+
+  // A scan through the new version sees the tuples of both versions
+  auto *const txn = txn_manager_->BeginTransaction();
+  const auto initializer = table->InitializerForProjectedColumns({c1, c2}, 32, v1);
+  auto *const buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedColumnsSize());
+  auto *const columns = initializer.Initialize(buffer);
+  const auto pm = table->ProjectionMapForOids({c1, c2}, v1);
+  uint32_t num_tuples = 0, num_defaults = 0;
+  auto it = table->begin();
+  while (it != table->end()) {
+    table->Scan(common::ManagedPointer(txn), &it, columns, v1);
+    for (uint32_t i = 0; i < columns->NumTuples(); i++) {
+      const auto row = columns->InterpretAsRow(i);
+      if (*reinterpret_cast<const int32_t *>(row.AccessWithNullCheck(pm.at(c2))) == 15721) num_defaults++;
+    }
+    num_tuples += columns->NumTuples();
+  }
+  EXPECT_EQ(num_tuples, num_old_tuples + 2);
+  EXPECT_EQ(num_defaults, num_old_tuples + 1);
+  delete[] buffer;
+  txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  db_main_->GetTransactionLayer()->GetDeferredActionManager()->RegisterDeferredAction([=]() { delete table; });
+}
+
+// Drops a column and adds another, and checks that updates are applied in place when the stored tuple has every
+// updated column, and migrate the tuple to the latest version otherwise.
+// NOLINTNEXTLINE
+TEST_F(SqlTableTests, DropColumnAndMigrateOnUpdate) {
+  const catalog::col_oid_t c1(1), c2(2), c3(3);
+  auto *const table = new SqlTable(block_store_, catalog::Schema({IntegerColumn(c1), IntegerColumn(c2)}));
+  const TupleSlot slot = InsertTuple(table, {c1, c2}, {1, 2}, layout_version_t(0));
+
+  // ALTER TABLE DROP COLUMN c2, then ALTER TABLE ADD COLUMN c3 INTEGER (default NULL)
+  table->UpdateSchema(catalog::Schema({IntegerColumn(c1)}));
+  const layout_version_t v2 = table->UpdateSchema(catalog::Schema({IntegerColumn(c1), IntegerColumn(c3)}));
+  EXPECT_TRUE(ReadColumn(table, slot, c3, v2) == nullptr);
+
+  // c1 exists in the stored layout, so the tuple is updated in place
+  auto *txn = txn_manager_->BeginTransaction();
+  auto *redo = txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID,
+                               table->InitializerForProjectedRow({c1}, v2));
+  redo->SetTupleSlot(slot);
+  *reinterpret_cast<int32_t *>(redo->Delta()->AccessForceNotNull(0)) = 10;
+  TupleSlot migrated_slot;
+  EXPECT_TRUE(table->Update(common::ManagedPointer(txn), redo, v2, &migrated_slot));
+  EXPECT_EQ(migrated_slot, slot);
+  txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  EXPECT_EQ(*ReadColumn(table, slot, c1, v2), 10);
+
+  // c3 does not, so the tuple moves to the latest layout version
+  txn = txn_manager_->BeginTransaction();
+  redo = txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID,
+                         table->InitializerForProjectedRow({c3}, v2));
+  redo->SetTupleSlot(slot);
+  *reinterpret_cast<int32_t *>(redo->Delta()->AccessForceNotNull(0)) = 30;
+  EXPECT_TRUE(table->Update(common::ManagedPointer(txn), redo, v2, &migrated_slot));
+  txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  EXPECT_NE(migrated_slot, slot);
+  EXPECT_EQ(migrated_slot.GetBlock()->layout_version_, v2);
+  EXPECT_EQ(*ReadColumn(table, migrated_slot, c1, v2), 10);
+  EXPECT_EQ(*ReadColumn(table, migrated_slot, c3, v2), 30);
+
+  // The old copy of the tuple is gone
+  txn = txn_manager_->BeginTransaction();
+  const auto initializer = table->InitializerForProjectedRow({c1}, layout_version_t(0));
+  auto *const buffer = common::AllocationUtil::AllocateAligned(initializer.ProjectedRowSize());
+  EXPECT_FALSE(table->Select(common::ManagedPointer(txn), slot, initializer.InitializeRow(buffer),
+                             storage::INITIAL_LAYOUT_VERSION));
+  delete[] buffer;
+  txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  db_main_->GetTransactionLayer()->GetDeferredActionManager()->RegisterDeferredAction([=]() { delete table; });
+}
+
+// Migrates an indexed tuple with an out-of-line VARCHAR, first in a transaction that aborts and then in one that
+// commits. Checks that the migrated tuple owns its copy of the varlen, and that the caller can move the index entry to
+// the new slot it is given.
+// NOLINTNEXTLINE
+TEST_F(SqlTableTests, MigrateVarlenAndIndexEntry) {
+  const catalog::col_oid_t c1(1), c2(2), c3(3);
+  auto *const table = new SqlTable(block_store_, catalog::Schema({IntegerColumn(c1), VarcharColumn(c2)}));
+  std::vector<catalog::IndexSchema::Column> keycols;
+  keycols.emplace_back(
+      "", type::TypeId::INTEGER, false,
+      parser::ColumnValueExpression(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID, c1));
+  StorageTestUtil::ForceOid(&(keycols[0]), catalog::indexkeycol_oid_t(1));
+  const catalog::IndexSchema index_schema(keycols, index::IndexType::BWTREE, false, false, false, true);
+  index::Index *const index = (index::IndexBuilder().SetKeySchema(index_schema)).Build();
+  db_main_->GetStorageLayer()->GetGarbageCollector()->RegisterIndexForGC(common::ManagedPointer(index));
+  auto *const key_buffer =
+      common::AllocationUtil::AllocateAligned(index->GetProjectedRowInitializer().ProjectedRowSize());
+  auto *const key = index->GetProjectedRowInitializer().InitializeRow(key_buffer);
+  *reinterpret_cast<int32_t *>(key->AccessForceNotNull(0)) = 1;
+
+  const std::string content = "long enough to not be inlined";
+  ASSERT_GT(content.size(), VarlenEntry::InlineThreshold());
+  auto *txn = txn_manager_->BeginTransaction();
+  auto *redo = txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID,
+                               table->InitializerForProjectedRow({c1, c2}, storage::INITIAL_LAYOUT_VERSION));
+  const auto pm = table->ProjectionMapForOids({c1, c2}, storage::INITIAL_LAYOUT_VERSION);
+  *reinterpret_cast<int32_t *>(redo->Delta()->AccessForceNotNull(pm.at(c1))) = 1;
+  *reinterpret_cast<VarlenEntry *>(redo->Delta()->AccessForceNotNull(pm.at(c2))) = MakeVarlen(content);
+  const TupleSlot slot = table->Insert(common::ManagedPointer(txn), redo, storage::INITIAL_LAYOUT_VERSION);
+  EXPECT_TRUE(index->Insert(common::ManagedPointer(txn), *key, slot));
+  txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+
+  // ALTER TABLE ADD COLUMN c3 INTEGER (default NULL)
+  const layout_version_t v1 =
+      table->UpdateSchema(catalog::Schema({IntegerColumn(c1), VarcharColumn(c2), IntegerColumn(c3)}));
+
+  // Sets c3, which moves the tuple to v1, and moves its index entry along
+  const auto migrate = [&](transaction::TransactionContext *const migrating_txn) {
+    auto *const update = migrating_txn->StageWrite(CatalogTestUtil::TEST_DB_OID, CatalogTestUtil::TEST_TABLE_OID,
+                                                   table->InitializerForProjectedRow({c3}, v1));
+    update->SetTupleSlot(slot);
+    *reinterpret_cast<int32_t *>(update->Delta()->AccessForceNotNull(0)) = 30;
+    TupleSlot new_slot;
+    EXPECT_TRUE(table->Update(common::ManagedPointer(migrating_txn), update, v1, &new_slot));
+    EXPECT_NE(new_slot, slot);
+    index->Delete(common::ManagedPointer(migrating_txn), *key, slot);
+    EXPECT_TRUE(index->Insert(common::ManagedPointer(migrating_txn), *key, new_slot));
+    return new_slot;
+  };
+  const auto index_lookup = [&]() {
+    auto *const lookup_txn = txn_manager_->BeginTransaction();
+    std::vector<TupleSlot> results;
+    index->ScanKey(*lookup_txn, *key, &results);
+    txn_manager_->Commit(lookup_txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+    return results;
+  };
+
+  // An aborted migration leaves both the tuple and its index entry where they were
+  txn = txn_manager_->BeginTransaction();
+  migrate(txn);
+  txn_manager_->Abort(txn);
+  EXPECT_EQ(ReadVarchar(table, slot, c2, v1), content);
+  EXPECT_EQ(index_lookup(), std::vector<TupleSlot>({slot}));
+
+  txn = txn_manager_->BeginTransaction();
+  const TupleSlot migrated_slot = migrate(txn);
+  txn_manager_->Commit(txn, transaction::TransactionUtil::EmptyCallback, nullptr);
+  EXPECT_EQ(migrated_slot.GetBlock()->layout_version_, v1);
+  EXPECT_EQ(index_lookup(), std::vector<TupleSlot>({migrated_slot}));
+
+  // Give the GC time to unlink the deleted tuple and free its varlen, which must not be the one the new tuple uses
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(*ReadColumn(table, migrated_slot, c1, v1), 1);
+  EXPECT_EQ(ReadVarchar(table, migrated_slot, c2, v1), content);
+  EXPECT_EQ(*ReadColumn(table, migrated_slot, c3, v1), 30);
+
+  delete[] key_buffer;
+  db_main_->GetStorageLayer()->GetGarbageCollector()->UnregisterIndexForGC(common::ManagedPointer(index));
+  db_main_->GetTransactionLayer()->GetDeferredActionManager()->RegisterDeferredAction([=]() {
+    delete table;
+    delete index;
+  });
+}
+
+}  // namespace terrier::storage
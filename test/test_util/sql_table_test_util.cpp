@@ -22,11 +22,13 @@ void RandomSqlTableTransaction::RandomInsert(Random *generator) {
                            ->GetTable(common::ManagedPointer(txn_), table_oid);
 
   // Generate random insert
-  auto initializer = sql_table_ptr->InitializerForProjectedRow(sql_table_metadata->col_oids_);
+  auto initializer =
+      sql_table_ptr->InitializerForProjectedRow(sql_table_metadata->col_oids_, storage::INITIAL_LAYOUT_VERSION);
   auto *const record = txn_->StageWrite(database_oid, table_oid, initializer);
-  StorageTestUtil::PopulateRandomRow(record->Delta(), sql_table_ptr->table_.layout_, 0.0, generator);
+  StorageTestUtil::PopulateRandomRow(record->Delta(), sql_table_ptr->GetBlockLayout(storage::INITIAL_LAYOUT_VERSION),
+                                     0.0, generator);
   record->SetTupleSlot(storage::TupleSlot(nullptr, 0));
-  auto tuple_slot = sql_table_ptr->Insert(common::ManagedPointer(txn_), record);
+  auto tuple_slot = sql_table_ptr->Insert(common::ManagedPointer(txn_), record, storage::INITIAL_LAYOUT_VERSION);
 
   // Defer addition of tuples until commit in case of aborts
   inserted_tuples_[database_oid][table_oid].push_back(tuple_slot);
@@ -54,11 +56,12 @@ void RandomSqlTableTransaction::RandomUpdate(Random *generator) {
   auto sql_table_ptr = test_object_->catalog_->GetDatabaseCatalog(common::ManagedPointer(txn_), database_oid)
                            ->GetTable(common::ManagedPointer(txn_), table_oid);
   auto initializer = sql_table_ptr->InitializerForProjectedRow(
-      StorageTestUtil::RandomNonEmptySubset(sql_table_metadata->col_oids_, generator));
+      StorageTestUtil::RandomNonEmptySubset(sql_table_metadata->col_oids_, generator), storage::INITIAL_LAYOUT_VERSION);
   auto *const record = txn_->StageWrite(database_oid, table_oid, initializer);
   record->SetTupleSlot(updated);
-  StorageTestUtil::PopulateRandomRow(record->Delta(), sql_table_ptr->table_.layout_, 0.0, generator);
-  auto result = sql_table_ptr->Update(common::ManagedPointer(txn_), record);
+  StorageTestUtil::PopulateRandomRow(record->Delta(), sql_table_ptr->GetBlockLayout(storage::INITIAL_LAYOUT_VERSION),
+                                     0.0, generator);
+  auto result = sql_table_ptr->Update(common::ManagedPointer(txn_), record, storage::INITIAL_LAYOUT_VERSION);
   aborted_ = !result;
 }
 
@@ -121,9 +124,10 @@ void RandomSqlTableTransaction::RandomSelect(Random *generator) {
   // an expensive call (Like GetTable) will help in having the OS interleave the threads more.
   auto sql_table_ptr = test_object_->catalog_->GetDatabaseCatalog(common::ManagedPointer(txn_), database_oid)
                            ->GetTable(common::ManagedPointer(txn_), table_oid);
-  auto initializer = sql_table_ptr->InitializerForProjectedRow(sql_table_metadata->col_oids_);
+  auto initializer =
+      sql_table_ptr->InitializerForProjectedRow(sql_table_metadata->col_oids_, storage::INITIAL_LAYOUT_VERSION);
   storage::ProjectedRow *select = initializer.InitializeRow(sql_table_metadata->buffer_);
-  sql_table_ptr->Select(common::ManagedPointer(txn_), selected, select);
+  sql_table_ptr->Select(common::ManagedPointer(txn_), selected, select, storage::INITIAL_LAYOUT_VERSION);
 }
 
 void RandomSqlTableTransaction::Finish() {
@@ -247,14 +251,16 @@ void LargeSqlTableTestObject::PopulateInitialTables(uint16_t num_databases, uint
       }
 
       // Create row initializer
-      auto initializer = sql_table->InitializerForProjectedRow(metadata->col_oids_);
+      auto initializer = sql_table->InitializerForProjectedRow(metadata->col_oids_, storage::INITIAL_LAYOUT_VERSION);
 
       // Populate table
       std::vector<storage::TupleSlot> inserted_tuples;
       for (uint32_t i = 0; i < num_tuples; i++) {
         auto *const redo = initial_txn_->StageWrite(database_oid, table_oid, initializer);
-        StorageTestUtil::PopulateRandomRow(redo->Delta(), sql_table->table_.layout_, 0.0, generator);
-        const storage::TupleSlot inserted = sql_table->Insert(common::ManagedPointer(initial_txn_), redo);
+        StorageTestUtil::PopulateRandomRow(redo->Delta(), sql_table->GetBlockLayout(storage::INITIAL_LAYOUT_VERSION),
+                                           0.0, generator);
+        const storage::TupleSlot inserted =
+            sql_table->Insert(common::ManagedPointer(initial_txn_), redo, storage::INITIAL_LAYOUT_VERSION);
         inserted_tuples.emplace_back(inserted);
       }
 
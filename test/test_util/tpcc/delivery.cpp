@@ -37,7 +37,8 @@ bool Delivery::Execute(transaction::TransactionManager *const txn_manager, Datab
     auto *const new_order_select_tuple = new_order_pr_initializer_.InitializeRow(worker->new_order_tuple_buffer_);
     const auto new_order_slot = index_scan_results[0];
     bool select_result UNUSED_ATTRIBUTE =
-        db->new_order_table_->Select(common::ManagedPointer(txn), new_order_slot, new_order_select_tuple);
+        db->new_order_table_->Select(common::ManagedPointer(txn), new_order_slot, new_order_select_tuple,
+                                     storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(select_result,
                    "New Order select failed. This assertion assumes 1:1 mapping between warehouse and workers and "
                    "that indexes are getting cleaned.");
@@ -72,7 +73,8 @@ bool Delivery::Execute(transaction::TransactionManager *const txn_manager, Datab
     // Retrieve O_C_ID
     auto &order_slot = index_scan_results[0];
     auto *order_select_tuple = order_select_pr_initializer_.InitializeRow(worker->order_tuple_buffer_);
-    select_result = db->order_table_->Select(common::ManagedPointer(txn), order_slot, order_select_tuple);
+    select_result = db->order_table_->Select(common::ManagedPointer(txn), order_slot, order_select_tuple,
+                                             storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(select_result,
                    "Order select failed. This assertion assumes 1:1 mapping between warehouse and workers.");
 
@@ -83,7 +85,8 @@ bool Delivery::Execute(transaction::TransactionManager *const txn_manager, Datab
     auto *const order_update_redo = txn->StageWrite(db->db_oid_, db->order_table_oid_, order_update_pr_initializer_);
     *reinterpret_cast<int8_t *>(order_update_redo->Delta()->AccessForceNotNull(0)) = args.o_carrier_id_;
     order_update_redo->SetTupleSlot(order_slot);
-    bool update_result UNUSED_ATTRIBUTE = db->order_table_->Update(common::ManagedPointer(txn), order_update_redo);
+    bool update_result UNUSED_ATTRIBUTE =
+        db->order_table_->Update(common::ManagedPointer(txn), order_update_redo, storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(select_result,
                    "Order update failed. This assertion assumes 1:1 mapping between warehouse and workers.");
 
@@ -114,7 +117,8 @@ bool Delivery::Execute(transaction::TransactionManager *const txn_manager, Datab
     for (const auto &order_line_slot : index_scan_results) {
       order_line_select_tuple = order_line_select_pr_initializer_.InitializeRow(worker->order_line_tuple_buffer_);
       select_result =
-          db->order_line_table_->Select(common::ManagedPointer(txn), order_line_slot, order_line_select_tuple);
+          db->order_line_table_->Select(common::ManagedPointer(txn), order_line_slot, order_line_select_tuple,
+                                        storage::INITIAL_LAYOUT_VERSION);
       TERRIER_ASSERT(select_result,
                      "Order Line select failed. This assertion assumes 1:1 mapping between warehouse and workers.");
       const auto ol_amount = *reinterpret_cast<double *>(order_line_select_tuple->AccessForceNotNull(0));
@@ -125,7 +129,8 @@ bool Delivery::Execute(transaction::TransactionManager *const txn_manager, Datab
           txn->StageWrite(db->db_oid_, db->order_line_table_oid_, order_line_update_pr_initializer_);
       *reinterpret_cast<uint64_t *>(order_line_update_redo->Delta()->AccessForceNotNull(0)) = args.ol_delivery_d_;
       order_line_update_redo->SetTupleSlot(order_line_slot);
-      update_result = db->order_line_table_->Update(common::ManagedPointer(txn), order_line_update_redo);
+      update_result = db->order_line_table_->Update(common::ManagedPointer(txn), order_line_update_redo,
+                                                    storage::INITIAL_LAYOUT_VERSION);
       TERRIER_ASSERT(update_result,
                      "Order Line update failed. This assertion assumes 1:1 mapping between warehouse and workers.");
     }
@@ -147,13 +152,15 @@ bool Delivery::Execute(transaction::TransactionManager *const txn_manager, Datab
     auto *const customer_update_tuple = customer_update_redo->Delta();
 
     select_result =
-        db->customer_table_->Select(common::ManagedPointer(txn), index_scan_results[0], customer_update_tuple);
+        db->customer_table_->Select(common::ManagedPointer(txn), index_scan_results[0], customer_update_tuple,
+                                    storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(select_result,
                    "Customer select failed. This assertion assumes 1:1 mapping between warehouse and workers.");
     *reinterpret_cast<double *>(customer_update_tuple->AccessForceNotNull(c_balance_pr_offset_)) += ol_amount_sum;
     (*reinterpret_cast<int16_t *>(customer_update_tuple->AccessForceNotNull(c_delivery_cnt_pr_offset_)))++;
     customer_update_redo->SetTupleSlot(index_scan_results[0]);
-    update_result = db->customer_table_->Update(common::ManagedPointer(txn), customer_update_redo);
+    update_result =
+        db->customer_table_->Update(common::ManagedPointer(txn), customer_update_redo, storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(update_result,
                    "Customer update failed. This assertion assumes 1:1 mapping between warehouse and workers.");
   }
@@ -26,7 +26,8 @@ bool NewOrder::Execute(transaction::TransactionManager *const txn_manager, Datab
   // Select W_TAX in table
   auto *const warehouse_select_tuple = warehouse_select_pr_initializer_.InitializeRow(worker->warehouse_tuple_buffer_);
   bool UNUSED_ATTRIBUTE select_result =
-      db->warehouse_table_->Select(common::ManagedPointer(txn), index_scan_results[0], warehouse_select_tuple);
+      db->warehouse_table_->Select(common::ManagedPointer(txn), index_scan_results[0], warehouse_select_tuple,
+                                   storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(select_result, "Warehouse table doesn't change. All lookups should succeed.");
   const auto w_tax = *reinterpret_cast<double *>(warehouse_select_tuple->AccessWithNullCheck(0));
   TERRIER_ASSERT(w_tax >= 0 && w_tax <= 0.2, "Invalid w_tax read from the Warehouse table.");
@@ -45,7 +46,8 @@ bool NewOrder::Execute(transaction::TransactionManager *const txn_manager, Datab
   // Select D_TAX, D_NEXT_O_ID in table
   auto *const district_select_tuple = district_select_pr_initializer_.InitializeRow(worker->district_tuple_buffer_);
   select_result =
-      db->district_table_->Select(common::ManagedPointer(txn), index_scan_results[0], district_select_tuple);
+      db->district_table_->Select(common::ManagedPointer(txn), index_scan_results[0], district_select_tuple,
+                                  storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(select_result, "District table doesn't change. All lookups should succeed.");
 
   const auto d_tax = *reinterpret_cast<double *>(district_select_tuple->AccessWithNullCheck(d_tax_select_pr_offset_));
@@ -59,7 +61,8 @@ bool NewOrder::Execute(transaction::TransactionManager *const txn_manager, Datab
       txn->StageWrite(db->db_oid_, db->district_table_oid_, district_update_pr_initializer_);
   *reinterpret_cast<int32_t *>(district_update_redo->Delta()->AccessForceNotNull(0)) = d_next_o_id + 1;
   district_update_redo->SetTupleSlot(index_scan_results[0]);
-  bool UNUSED_ATTRIBUTE result = db->district_table_->Update(common::ManagedPointer(txn), district_update_redo);
+  bool UNUSED_ATTRIBUTE result =
+      db->district_table_->Update(common::ManagedPointer(txn), district_update_redo, storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(result, "District update failed. This assertion assumes 1:1 mapping between warehouse and workers.");
 
   // Look up C_ID, D_ID, W_ID in index
@@ -77,7 +80,8 @@ bool NewOrder::Execute(transaction::TransactionManager *const txn_manager, Datab
   // Select C_DISCOUNT, C_LAST, and C_CREDIT in table
   auto *const customer_select_tuple = customer_select_pr_initializer_.InitializeRow(worker->customer_tuple_buffer_);
   select_result =
-      db->customer_table_->Select(common::ManagedPointer(txn), index_scan_results[0], customer_select_tuple);
+      db->customer_table_->Select(common::ManagedPointer(txn), index_scan_results[0], customer_select_tuple,
+                                  storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(select_result, "Customer table doesn't change. All lookups should succeed.");
   const auto c_discount =
       *reinterpret_cast<double *>(customer_select_tuple->AccessWithNullCheck(c_discount_select_pr_offset_));
@@ -92,7 +96,8 @@ bool NewOrder::Execute(transaction::TransactionManager *const txn_manager, Datab
   *reinterpret_cast<int8_t *>(new_order_insert_tuple->AccessForceNotNull(no_d_id_insert_pr_offset_)) = args.d_id_;
   *reinterpret_cast<int8_t *>(new_order_insert_tuple->AccessForceNotNull(no_w_id_insert_pr_offset_)) = args.w_id_;
 
-  const auto new_order_slot = db->new_order_table_->Insert(common::ManagedPointer(txn), new_order_insert_redo);
+  const auto new_order_slot =
+      db->new_order_table_->Insert(common::ManagedPointer(txn), new_order_insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // insert in New Order index
   const auto new_order_key_pr_initializer = db->new_order_primary_index_->GetProjectedRowInitializer();
@@ -120,7 +125,8 @@ bool NewOrder::Execute(transaction::TransactionManager *const txn_manager, Datab
   *reinterpret_cast<int8_t *>(order_insert_tuple->AccessForceNotNull(o_all_local_insert_pr_offset_)) =
       static_cast<int8_t>(args.o_all_local_);
 
-  const auto order_slot = db->order_table_->Insert(common::ManagedPointer(txn), order_insert_redo);
+  const auto order_slot =
+      db->order_table_->Insert(common::ManagedPointer(txn), order_insert_redo, storage::INITIAL_LAYOUT_VERSION);
 
   // insert in Order index
   const auto order_key_pr_initializer = db->order_primary_index_->GetProjectedRowInitializer();
@@ -167,7 +173,8 @@ bool NewOrder::Execute(transaction::TransactionManager *const txn_manager, Datab
 
     // Select I_PRICE, I_NAME, and I_DATE in table
     auto *const item_select_tuple = item_select_pr_initializer_.InitializeRow(worker->item_tuple_buffer_);
-    select_result = db->item_table_->Select(common::ManagedPointer(txn), index_scan_results[0], item_select_tuple);
+    select_result = db->item_table_->Select(common::ManagedPointer(txn), index_scan_results[0], item_select_tuple,
+                                            storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(select_result, "Item table doesn't change. All lookups should succeed.");
     const auto i_price = *reinterpret_cast<double *>(item_select_tuple->AccessWithNullCheck(i_price_select_pr_offset_));
     const auto i_data =
@@ -188,7 +195,8 @@ bool NewOrder::Execute(transaction::TransactionManager *const txn_manager, Datab
     // Select S_QUANTITY, S_DIST_xx (xx = args.d_id), S_YTD, S_ORDER_CNT, S_REMOTE_CNT, S_DATA in table
     auto *const stock_select_tuple =
         stock_select_initializers_[args.d_id_ - 1].first.InitializeRow(worker->stock_tuple_buffer_);
-    select_result = db->stock_table_->Select(common::ManagedPointer(txn), index_scan_results[0], stock_select_tuple);
+    select_result = db->stock_table_->Select(common::ManagedPointer(txn), index_scan_results[0], stock_select_tuple,
+                                             storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(select_result, "Stock table doesn't change (no new entries). All lookups should succeed.");
     const auto s_quantity = *reinterpret_cast<int16_t *>(
         stock_select_tuple->AccessWithNullCheck(stock_select_pr_offsets_[args.d_id_ - 1].s_quantity_select_pr_offset_));
@@ -217,7 +225,7 @@ bool NewOrder::Execute(transaction::TransactionManager *const txn_manager, Datab
     *reinterpret_cast<int16_t *>(stock_update_tuple->AccessForceNotNull(s_remote_cnt_update_pr_offset_)) =
         static_cast<int16_t>(item.remote_ ? s_remote_cnt + 1 : s_remote_cnt);
     stock_update_redo->SetTupleSlot(index_scan_results[0]);
-    result = db->stock_table_->Update(common::ManagedPointer(txn), stock_update_redo);
+    result = db->stock_table_->Update(common::ManagedPointer(txn), stock_update_redo, storage::INITIAL_LAYOUT_VERSION);
     if (!result) {
       // This can fail due to remote orders
       txn_manager->Abort(txn);
@@ -265,7 +273,8 @@ bool NewOrder::Execute(transaction::TransactionManager *const txn_manager, Datab
           order_line_insert_tuple->AccessForceNotNull(ol_dist_info_insert_pr_offset_)) = varlen_entry;
     }
 
-    const auto order_line_slot = db->order_line_table_->Insert(common::ManagedPointer(txn), order_line_insert_redo);
+    const auto order_line_slot = db->order_line_table_->Insert(common::ManagedPointer(txn), order_line_insert_redo,
+                                                               storage::INITIAL_LAYOUT_VERSION);
 
     // insert in Order Line index
     const auto order_line_key_pr_initializer = db->order_line_primary_index_->GetProjectedRowInitializer();
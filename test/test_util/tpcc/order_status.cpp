@@ -47,7 +47,8 @@ bool OrderStatus::Execute(transaction::TransactionManager *const txn_manager, Da
       for (const auto &tuple_slot : index_scan_results) {
         auto *const c_first_select_tuple = c_first_pr_initializer_.InitializeRow(worker->customer_tuple_buffer_);
         bool UNUSED_ATTRIBUTE select_result =
-            db->customer_table_->Select(common::ManagedPointer(txn), tuple_slot, c_first_select_tuple);
+            db->customer_table_->Select(common::ManagedPointer(txn), tuple_slot, c_first_select_tuple,
+                                        storage::INITIAL_LAYOUT_VERSION);
         TERRIER_ASSERT(select_result, "Customer table doesn't change (no new entries). All lookups should succeed.");
         const auto c_first = *reinterpret_cast<storage::VarlenEntry *>(c_first_select_tuple->AccessWithNullCheck(0));
         sorted_index_scan_results.emplace(
@@ -65,7 +66,8 @@ bool OrderStatus::Execute(transaction::TransactionManager *const txn_manager, Da
   // Select customer in table
   auto *const customer_select_tuple = customer_select_pr_initializer_.InitializeRow(worker->customer_tuple_buffer_);
   bool UNUSED_ATTRIBUTE select_result =
-      db->customer_table_->Select(common::ManagedPointer(txn), customer_slot, customer_select_tuple);
+      db->customer_table_->Select(common::ManagedPointer(txn), customer_slot, customer_select_tuple,
+                                  storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(select_result, "Customer table doesn't change (no new entries). All lookups should succeed.");
 
   const auto *const c_id_ptr =
@@ -103,7 +105,8 @@ bool OrderStatus::Execute(transaction::TransactionManager *const txn_manager, Da
 
   // Select O_ID, O_ENTRY_D, O_CARRIER_ID from table for largest key (back of vector)
   auto *const order_select_tuple = order_select_pr_initializer_.InitializeRow(worker->order_tuple_buffer_);
-  select_result = db->order_table_->Select(common::ManagedPointer(txn), index_scan_results[0], order_select_tuple);
+  select_result = db->order_table_->Select(common::ManagedPointer(txn), index_scan_results[0], order_select_tuple,
+                                           storage::INITIAL_LAYOUT_VERSION);
   TERRIER_ASSERT(select_result,
                  "Order select failed. This assertion assumes 1:1 mapping between warehouse and workers.");
 
@@ -136,7 +139,8 @@ bool OrderStatus::Execute(transaction::TransactionManager *const txn_manager, Da
   auto *const order_line_select_tuple =
       order_line_select_pr_initializer_.InitializeRow(worker->order_line_tuple_buffer_);
   for (const auto &tuple_slot : index_scan_results) {
-    select_result = db->order_line_table_->Select(common::ManagedPointer(txn), tuple_slot, order_line_select_tuple);
+    select_result = db->order_line_table_->Select(common::ManagedPointer(txn), tuple_slot, order_line_select_tuple,
+                                                  storage::INITIAL_LAYOUT_VERSION);
     TERRIER_ASSERT(select_result,
                    "We already confirmed that this is a committed order above, so none of these should fail.");
   }
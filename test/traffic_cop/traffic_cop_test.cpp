@@ -149,6 +149,271 @@ TEST_F(TrafficCopTests, DISABLED_BasicTest) {
   }
 }
 
+/**
+ * Test that SELECTs and UPDATEs of a single row by primary key, which skip the optimizer, return the same results as
+ * the ones that don't
+ */
+// NOLINTNEXTLINE
+TEST_F(TrafficCopTests, PointQueryTest) {
+  try {
+    pqxx::connection connection(fmt::format("host=127.0.0.1 port={0} user={1} sslmode=disable application_name=psql",
+                                            port_, catalog::DEFAULT_DATABASE));
+
+    pqxx::work txn1(connection);
+    txn1.exec("CREATE TABLE TableA (id INT PRIMARY KEY, data INT);");
+    txn1.exec("INSERT INTO TableA VALUES (1, 10);");
+    txn1.exec("INSERT INTO TableA VALUES (2, 20);");
+
+    pqxx::result r = txn1.exec("SELECT data, id FROM TableA WHERE id = 2;");
+    EXPECT_EQ(r.size(), 1);
+    EXPECT_EQ(r[0][0].as<int32_t>(), 20);
+    EXPECT_EQ(r[0][1].as<int32_t>(), 2);
+
+    r = txn1.exec("SELECT data FROM TableA WHERE id = 3;");
+    EXPECT_EQ(r.size(), 0);
+
+    r = txn1.exec("UPDATE TableA SET data = 21 WHERE id = 2;");
+    EXPECT_EQ(r.affected_rows(), 1);
+    r = txn1.exec("UPDATE TableA SET data = NULL WHERE id = 1;");
+    EXPECT_EQ(r.affected_rows(), 1);
+
+    // Goes through the optimizer, and sees the updates made through the fast path
+    r = txn1.exec("SELECT id, data FROM TableA WHERE data > 0;");
+    EXPECT_EQ(r.size(), 1);
+    EXPECT_EQ(r[0][1].as<int32_t>(), 21);
+
+    r = txn1.exec("SELECT data, id FROM TableA WHERE id = 1;");
+    EXPECT_EQ(r.size(), 1);
+    EXPECT_TRUE(r[0][0].is_null());
+    EXPECT_EQ(r[0][1].as<int32_t>(), 1);
+    txn1.commit();
+    connection.disconnect();
+  } catch (const std::exception &e) {
+    EXPECT_TRUE(false);
+  }
+}
+
+/**
+ * Test that every statement of a query string is executed, and that a failed statement rolls back the whole query since
+ * the statements run in one implicit transaction
+ */
+// NOLINTNEXTLINE
+TEST_F(TrafficCopTests, MultiStatementQueryTest) {
+  try {
+    pqxx::connection connection(fmt::format("host=127.0.0.1 port={0} user={1} sslmode=disable application_name=psql",
+                                            port_, catalog::DEFAULT_DATABASE));
+
+    pqxx::nontransaction txn1(connection);
+    txn1.exec("CREATE TABLE TableA (id INT, data INT);");
+    txn1.exec("INSERT INTO TableA VALUES (1, 1); INSERT INTO TableA VALUES (2, 2);");
+    pqxx::result r = txn1.exec("SELECT * FROM TableA;");
+    EXPECT_EQ(r.size(), 2);
+
+    // The first INSERT is rolled back with the failed second one, and the third never runs
+    EXPECT_ANY_THROW(txn1.exec(
+        "INSERT INTO TableA VALUES (3, 3); INSERT INTO TableB VALUES (4, 4); INSERT INTO TableA VALUES (5, 5);"));
+    r = txn1.exec("SELECT * FROM TableA;");
+    EXPECT_EQ(r.size(), 2);
+
+    // A query that controls its transaction itself is not wrapped in another one
+    txn1.exec("BEGIN; INSERT INTO TableA VALUES (6, 6); COMMIT;");
+    r = txn1.exec("SELECT * FROM TableA;");
+    EXPECT_EQ(r.size(), 3);
+    connection.disconnect();
+  } catch (const std::exception &e) {
+    EXPECT_TRUE(false);
+  }
+}
+
+/**
+ * Test that a prepared SELECT is described before it is executed, as libpq expects the RowDescription in response to
+ * the Describe of the portal and only the rows in response to the Execute
+ */
+// NOLINTNEXTLINE
+TEST_F(TrafficCopTests, PreparedSelectTest) {
+  try {
+    pqxx::connection connection(fmt::format("host=127.0.0.1 port={0} user={1} sslmode=disable application_name=psql",
+                                            port_, catalog::DEFAULT_DATABASE));
+
+    pqxx::work txn1(connection);
+    txn1.exec("CREATE TABLE TableA (id INT, data INT);");
+    txn1.exec("INSERT INTO TableA VALUES (1, 10);");
+    connection.prepare("select_all", "SELECT data, id FROM TableA;");
+    pqxx::result r = txn1.exec_prepared("select_all");
+    EXPECT_EQ(r.columns(), 2);
+    EXPECT_EQ(r.size(), 1);
+    EXPECT_EQ(r[0][0].as<int32_t>(), 10);
+    EXPECT_EQ(r[0][1].as<int32_t>(), 1);
+
+    connection.prepare("insert_one", "INSERT INTO TableA VALUES (2, 20);");
+    r = txn1.exec_prepared("insert_one");
+    EXPECT_EQ(r.affected_rows(), 1);
+    txn1.commit();
+    connection.disconnect();
+  } catch (const std::exception &e) {
+    EXPECT_TRUE(false);
+  }
+}
+
+/**
+ * Test that prepared statements take parameters, and that executing one again with other values reuses its plan
+ */
+// NOLINTNEXTLINE
+TEST_F(TrafficCopTests, PreparedParameterTest) {
+  try {
+    pqxx::connection connection(fmt::format("host=127.0.0.1 port={0} user={1} sslmode=disable application_name=psql",
+                                            port_, catalog::DEFAULT_DATABASE));
+
+    pqxx::work txn1(connection);
+    txn1.exec("CREATE TABLE TableA (id INT, data VARCHAR);");
+    connection.prepare("insert_row", "INSERT INTO TableA VALUES ($1, $2);");
+    pqxx::result r = txn1.exec_prepared("insert_row", 1, "one");
+    EXPECT_EQ(r.affected_rows(), 1);
+    r = txn1.exec_prepared("insert_row", 2, "two");
+    EXPECT_EQ(r.affected_rows(), 1);
+
+    connection.prepare("select_row", "SELECT data FROM TableA WHERE id = $1;");
+    r = txn1.exec_prepared("select_row", 2);
+    EXPECT_EQ(r.size(), 1);
+    EXPECT_EQ(r[0][0].as<std::string>(), "two");
+    r = txn1.exec_prepared("select_row", 1);
+    EXPECT_EQ(r.size(), 1);
+    EXPECT_EQ(r[0][0].as<std::string>(), "one");
+
+    // A value that does not fit the parameter's type is refused by Bind
+    EXPECT_ANY_THROW(txn1.exec_prepared("select_row", "one"));
+    txn1.abort();
+    connection.disconnect();
+  } catch (const std::exception &e) {
+    EXPECT_TRUE(false);
+  }
+}
+
+/**
+ * Test that the Executes of a pipeline run in one implicit transaction up to the Sync, so that a failed statement rolls
+ * back the ones before it
+ */
+// NOLINTNEXTLINE
+TEST_F(TrafficCopTests, PipelinedExtendedQueryTest) {
+  try {
+    auto io_socket_unique_ptr = network::ManualPacketUtil::StartConnection(port_);
+    auto io_socket = common::ManagedPointer(io_socket_unique_ptr);
+    network::PostgresPacketWriter writer(io_socket->GetWriteQueue());
+
+    writer.WriteSimpleQuery("CREATE TABLE TableA (id INT, data INT);");
+    io_socket->FlushAllWrites();
+    network::ManualPacketUtil::ReadUntilReadyOrClose(io_socket);
+
+    // The second statement fails to bind, after the first one was executed
+    writer.WriteParseCommand("", "INSERT INTO TableA VALUES (1, 1);", std::vector<int>());
+    writer.WriteBindCommand("", "", {}, {}, {});
+    writer.WriteExecuteCommand("", 0);
+    writer.WriteParseCommand("", "INSERT INTO TableB VALUES (2, 2);", std::vector<int>());
+    writer.WriteBindCommand("", "", {}, {}, {});
+    writer.WriteExecuteCommand("", 0);
+    writer.WriteSyncCommand();
+    io_socket->FlushAllWrites();
+    network::ManualPacketUtil::ReadUntilReadyOrClose(io_socket);
+    network::ManualPacketUtil::TerminateConnection(io_socket->GetSocketFd());
+    io_socket->Close();
+
+    pqxx::connection connection(fmt::format("host=127.0.0.1 port={0} user={1} sslmode=disable application_name=psql",
+                                            port_, catalog::DEFAULT_DATABASE));
+    pqxx::nontransaction txn1(connection);
+    pqxx::result r = txn1.exec("SELECT * FROM TableA;");
+    EXPECT_EQ(r.size(), 0);
+    connection.disconnect();
+  } catch (const std::exception &e) {
+    EXPECT_TRUE(false);
+  }
+}
+
+/**
+ * Test that IN and (NOT) EXISTS over a sub-select output every row of the query at most once, even if the sub-select
+ * has several matches for it
+ */
+// NOLINTNEXTLINE
+TEST_F(TrafficCopTests, SemiJoinQueryTest) {
+  try {
+    pqxx::connection connection(fmt::format("host=127.0.0.1 port={0} user={1} sslmode=disable application_name=psql",
+                                            port_, catalog::DEFAULT_DATABASE));
+
+    pqxx::nontransaction txn1(connection);
+    txn1.exec("CREATE TABLE TableA (id INT, data INT);");
+    txn1.exec("INSERT INTO TableA VALUES (1, 1); INSERT INTO TableA VALUES (2, 2); INSERT INTO TableA VALUES (3, 3);");
+    txn1.exec("CREATE TABLE TableB (id INT, data INT);");
+    txn1.exec(
+        "INSERT INTO TableB VALUES (1, 10); INSERT INTO TableB VALUES (1, 11); INSERT INTO TableB VALUES (2, 20);");
+
+    pqxx::result r =
+        txn1.exec("SELECT id FROM TableA WHERE EXISTS (SELECT 1 FROM TableB WHERE TableB.id = TableA.id) ORDER BY id;");
+    ASSERT_EQ(r.size(), 2);
+    EXPECT_EQ(r[0][0].as<int32_t>(), 1);
+    EXPECT_EQ(r[1][0].as<int32_t>(), 2);
+
+    r = txn1.exec("SELECT id FROM TableA WHERE NOT EXISTS (SELECT 1 FROM TableB WHERE TableB.id = TableA.id);");
+    ASSERT_EQ(r.size(), 1);
+    EXPECT_EQ(r[0][0].as<int32_t>(), 3);
+
+    // The filter on the query is evaluated before the join, the one on the sub-select when scanning it
+    r = txn1.exec(
+        "SELECT id FROM TableA WHERE id > 1 AND EXISTS (SELECT 1 FROM TableB WHERE TableB.id = TableA.id AND "
+        "TableB.data > 10);");
+    ASSERT_EQ(r.size(), 1);
+    EXPECT_EQ(r[0][0].as<int32_t>(), 2);
+
+    r = txn1.exec("SELECT id FROM TableA WHERE id IN (SELECT id FROM TableB) ORDER BY id;");
+    ASSERT_EQ(r.size(), 2);
+    EXPECT_EQ(r[0][0].as<int32_t>(), 1);
+    EXPECT_EQ(r[1][0].as<int32_t>(), 2);
+
+    // A list of more than a few constants is searched with a binary search
+    r = txn1.exec("SELECT id FROM TableA WHERE data IN (1, 2) ORDER BY id;");
+    EXPECT_EQ(r.size(), 2);
+    r = txn1.exec("SELECT id FROM TableA WHERE data IN (13, 3, 7, 1, 11, 9, 3) ORDER BY id;");
+    ASSERT_EQ(r.size(), 2);
+    EXPECT_EQ(r[0][0].as<int32_t>(), 1);
+    EXPECT_EQ(r[1][0].as<int32_t>(), 3);
+    connection.disconnect();
+  } catch (const std::exception &e) {
+    EXPECT_TRUE(false);
+  }
+}
+
+/**
+ * Test that an ORDER BY ... DESC on the primary key scans the ascending index backwards, and stops early for a LIMIT
+ */
+// NOLINTNEXTLINE
+TEST_F(TrafficCopTests, DescendingIndexScanQueryTest) {
+  try {
+    pqxx::connection connection(fmt::format("host=127.0.0.1 port={0} user={1} sslmode=disable application_name=psql",
+                                            port_, catalog::DEFAULT_DATABASE));
+
+    pqxx::nontransaction txn1(connection);
+    txn1.exec("CREATE TABLE TableA (id INT NOT NULL PRIMARY KEY, data INT);");
+    txn1.exec(
+        "INSERT INTO TableA VALUES (2, 20); INSERT INTO TableA VALUES (-1, -10); INSERT INTO TableA VALUES (3, 30); "
+        "INSERT INTO TableA VALUES (1, 10);");
+
+    pqxx::result r = txn1.exec("SELECT id FROM TableA ORDER BY id DESC;");
+    ASSERT_EQ(r.size(), 4);
+    EXPECT_EQ(r[0][0].as<int32_t>(), 3);
+    EXPECT_EQ(r[1][0].as<int32_t>(), 2);
+    EXPECT_EQ(r[2][0].as<int32_t>(), 1);
+    EXPECT_EQ(r[3][0].as<int32_t>(), -1);
+
+    r = txn1.exec("SELECT id, data FROM TableA ORDER BY id DESC LIMIT 2 OFFSET 1;");
+    ASSERT_EQ(r.size(), 2);
+    EXPECT_EQ(r[0][0].as<int32_t>(), 2);
+    EXPECT_EQ(r[0][1].as<int32_t>(), 20);
+    EXPECT_EQ(r[1][0].as<int32_t>(), 1);
+    EXPECT_EQ(r[1][1].as<int32_t>(), 10);
+    connection.disconnect();
+  } catch (const std::exception &e) {
+    EXPECT_TRUE(false);
+  }
+}
+
 /**
  * Test whether a temporary namespace is created for a connection to the database
  */
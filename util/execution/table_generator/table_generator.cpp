@@ -128,8 +128,8 @@ void TableGenerator::FillTable(catalog::table_oid_t table_oid, common::ManagedPo
   for (const auto &col : schema.GetColumns()) {
     table_cols.emplace_back(col.Oid());
   }
-  auto pri = table->InitializerForProjectedRow(table_cols);
-  auto offset_map = table->ProjectionMapForOids(table_cols);
+  auto pri = table->InitializerForProjectedRow(table_cols, storage::INITIAL_LAYOUT_VERSION);
+  auto offset_map = table->ProjectionMapForOids(table_cols, storage::INITIAL_LAYOUT_VERSION);
   uint32_t vals_written = 0;
 
   std::vector<uint16_t> offsets;
@@ -161,7 +161,7 @@ void TableGenerator::FillTable(catalog::table_oid_t table_oid, common::ManagedPo
           std::memcpy(data, column_data[k].first + j * elem_size, elem_size);
         }
       }
-      table->Insert(exec_ctx_->GetTxn(), redo);
+      table->Insert(exec_ctx_->GetTxn(), redo, storage::INITIAL_LAYOUT_VERSION);
       vals_written++;
     }
 
@@ -261,8 +261,8 @@ void TableGenerator::FillIndex(common::ManagedPointer<storage::index::Index> ind
   for (const auto &col : table_schema.GetColumns()) {
     table_cols.emplace_back(col.Oid());
   }
-  auto table_pri = table->InitializerForProjectedRow(table_cols);
-  auto table_offset_map = table->ProjectionMapForOids(table_cols);
+  auto table_pri = table->InitializerForProjectedRow(table_cols, storage::INITIAL_LAYOUT_VERSION);
+  auto table_offset_map = table->ProjectionMapForOids(table_cols, storage::INITIAL_LAYOUT_VERSION);
   byte *table_buffer = common::AllocationUtil::AllocateAligned(table_pri.ProjectedRowSize());
   auto table_pr = table_pri.InitializeRow(table_buffer);
 
@@ -280,7 +280,7 @@ void TableGenerator::FillIndex(common::ManagedPointer<storage::index::Index> ind
   uint32_t num_inserted = 0;
   for (const storage::TupleSlot &slot : *table) {
     // Get table data
-    table->Select(exec_ctx_->GetTxn(), slot, table_pr);
+    table->Select(exec_ctx_->GetTxn(), slot, table_pr, storage::INITIAL_LAYOUT_VERSION);
     // Fill up the index data
     for (uint32_t index_col_idx = 0; index_col_idx < index_meta.cols_.size(); index_col_idx++) {
       // Get the offset of this column in the table